@@ -0,0 +1,205 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+#include <ctime>
+#include <string>
+#include <algorithm>
+#include "freertos/FreeRTOS.h"
+
+#define HIGH 1
+#define LOW 0
+#define INPUT 0x01
+#define OUTPUT 0x03
+#define INPUT_PULLUP 0x05
+#define IRAM_ATTR
+#define PROGMEM
+#define DRAM_ATTR
+#define RISING 0x01
+#define FALLING 0x02
+#define CHANGE 0x03
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+class String {
+public:
+    String() {}
+    String(const char *s) : s_(s ? s : "") {}
+    String(const std::string &s) : s_(s) {}
+    String(char c) : s_(1, c) {}
+    String(int v, unsigned char base = 10) { fromLong(v, base); }
+    String(unsigned int v, unsigned char base = 10) { fromULong(v, base); }
+    String(long v, unsigned char base = 10) { fromLong(v, base); }
+    String(unsigned long v, unsigned char base = 10) { fromULong(v, base); }
+    String(long long v, unsigned char base = 10) { fromLong(v, base); }
+    String(unsigned long long v, unsigned char base = 10) { fromULong(v, base); }
+    String(float v, unsigned int decimals = 2) { fromDouble(v, decimals); }
+    String(double v, unsigned int decimals = 2) { fromDouble(v, decimals); }
+
+    unsigned int length() const { return s_.size(); }
+    bool isEmpty() const { return s_.empty(); }
+    const char *c_str() const { return s_.c_str(); }
+    bool reserve(unsigned int n) { s_.reserve(n); return true; }
+    char charAt(unsigned int i) const { return i < s_.size() ? s_[i] : 0; }
+    char operator[](unsigned int i) const { return charAt(i); }
+    char &operator[](unsigned int i) { return s_[i]; }
+    bool startsWith(const String &p) const { return s_.compare(0, p.s_.size(), p.s_) == 0; }
+    bool endsWith(const String &p) const {
+        return s_.size() >= p.s_.size() && s_.compare(s_.size() - p.s_.size(), p.s_.size(), p.s_) == 0;
+    }
+    bool equals(const String &o) const { return s_ == o.s_; }
+    bool equalsIgnoreCase(const String &o) const {
+        if (s_.size() != o.s_.size()) return false;
+        for (size_t i = 0; i < s_.size(); i++)
+            if (tolower((unsigned char)s_[i]) != tolower((unsigned char)o.s_[i])) return false;
+        return true;
+    }
+    int compareTo(const String &o) const { return s_.compare(o.s_); }
+    int indexOf(char c, unsigned int from = 0) const { size_t p = s_.find(c, from); return p == std::string::npos ? -1 : (int)p; }
+    int indexOf(const String &t, unsigned int from = 0) const { size_t p = s_.find(t.s_, from); return p == std::string::npos ? -1 : (int)p; }
+    int lastIndexOf(char c) const { size_t p = s_.rfind(c); return p == std::string::npos ? -1 : (int)p; }
+    String substring(int from) const { if (from < 0) from = 0; if ((size_t)from > s_.size()) return String(); return String(s_.substr(from)); }
+    String substring(int from, int to) const {
+        if (from > to) std::swap(from, to);
+        if (from < 0) from = 0;
+        if ((size_t)from > s_.size()) return String();
+        if ((size_t)to > s_.size()) to = s_.size();
+        return String(s_.substr(from, to - from));
+    }
+    void toLowerCase() { for (auto &c : s_) c = tolower((unsigned char)c); }
+    void toUpperCase() { for (auto &c : s_) c = toupper((unsigned char)c); }
+    void trim() {
+        size_t a = s_.find_first_not_of(" \t\r\n"), b = s_.find_last_not_of(" \t\r\n");
+        s_ = a == std::string::npos ? std::string() : s_.substr(a, b - a + 1);
+    }
+    long toInt() const { return strtol(s_.c_str(), nullptr, 10); }
+    float toFloat() const { return strtof(s_.c_str(), nullptr); }
+    bool concat(const String &o) { s_ += o.s_; return true; }
+    String &operator+=(const String &o) { s_ += o.s_; return *this; }
+    String &operator+=(const char *o) { s_ += o; return *this; }
+    String &operator+=(char c) { s_ += c; return *this; }
+    friend String operator+(const String &a, const String &b) { return String(a.s_ + b.s_); }
+    friend String operator+(const String &a, const char *b) { return String(a.s_ + b); }
+    friend String operator+(const char *a, const String &b) { return String(a + b.s_); }
+    friend String operator+(const String &a, char b) { return String(a.s_ + b); }
+    bool operator==(const String &o) const { return s_ == o.s_; }
+    bool operator==(const char *o) const { return s_ == o; }
+    bool operator!=(const String &o) const { return s_ != o.s_; }
+    bool operator<(const String &o) const { return s_ < o.s_; }
+    operator bool() const { return true; }
+    const std::string &str() const { return s_; }
+
+private:
+    void fromLong(long long v, unsigned char base) {
+        if (v < 0 && base == 10) { fromULong((unsigned long long)(-v), base); s_ = "-" + s_; }
+        else fromULong((unsigned long long)v, base);
+    }
+    void fromULong(unsigned long long v, unsigned char base) {
+        if (base < 2 || base > 36) base = 10;
+        char buf[72]; int i = 70; buf[71] = 0;
+        do { int d = v % base; buf[i--] = d < 10 ? '0' + d : 'a' + d - 10; v /= base; } while (v && i >= 0);
+        s_ = &buf[i + 1];
+    }
+    void fromDouble(double v, unsigned int dec) { char b[64]; snprintf(b, sizeof(b), "%.*f", dec, v); s_ = b; }
+    std::string s_;
+};
+
+class Print {
+public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t c) = 0;
+    virtual size_t write(const uint8_t *buf, size_t n) { size_t r = 0; while (n--) r += write(*buf++); return r; }
+    size_t print(const String &s) { return write((const uint8_t *)s.c_str(), s.length()); }
+    size_t print(const char *s) { return write((const uint8_t *)s, strlen(s)); }
+    size_t print(char c) { return write((uint8_t)c); }
+    size_t print(int v) { return print(String(v)); }
+    size_t print(unsigned int v) { return print(String(v)); }
+    size_t print(long v) { return print(String(v)); }
+    size_t print(unsigned long v) { return print(String(v)); }
+    size_t print(long long v) { return print(String(v)); }
+    size_t print(unsigned long long v) { return print(String(v)); }
+    size_t print(double v, int d = 2) { return print(String(v, d)); }
+    size_t println() { return print("\r\n"); }
+    template <typename T> size_t println(T v) { size_t n = print(v); return n + println(); }
+    size_t printf(const char *fmt, ...) __attribute__((format(printf, 2, 3)));
+};
+
+class Stream : public Print {
+public:
+    virtual int available() = 0;
+    virtual int read() = 0;
+    virtual int peek() { return -1; }
+    size_t readBytes(uint8_t *buf, size_t n) {
+        size_t got = 0; while (got < n) { int c = read(); if (c < 0) break; buf[got++] = (uint8_t)c; } return got;
+    }
+    String readStringUntil(char t) { std::string s; int c; while ((c = read()) >= 0 && c != t) s += (char)c; return String(s); }
+    String readString() { std::string s; int c; while ((c = read()) >= 0) s += (char)c; return String(s); }
+    void setTimeout(unsigned long) {}
+};
+
+class HardwareSerial : public Stream {
+public:
+    void begin(unsigned long baud);
+    void end() {}
+    size_t write(uint8_t c) override;
+    size_t write(const uint8_t *buf, size_t n) override;
+    int available() override;
+    int read() override;
+    void flush() {}
+    size_t setRxBufferSize(size_t n);
+    size_t setTxBufferSize(size_t n);
+    operator bool() const { return true; }
+};
+extern HardwareSerial Serial;
+
+unsigned long millis();
+unsigned long micros();
+void delay(uint32_t ms);
+void delayMicroseconds(uint32_t us);
+void yield();
+void pinMode(uint8_t pin, uint8_t mode);
+int digitalRead(uint8_t pin);
+void digitalWrite(uint8_t pin, uint8_t val);
+void attachInterrupt(uint8_t pin, void (*fn)(void), int mode);
+void detachInterrupt(uint8_t pin);
+#define digitalPinToInterrupt(p) (p)
+long random(long max);
+long random(long min, long max);
+void randomSeed(unsigned long seed);
+long map(long x, long in_min, long in_max, long out_min, long out_max);
+
+uint32_t ledcSetup(uint8_t chan, uint32_t freq, uint8_t bits);
+void ledcAttachPin(uint8_t pin, uint8_t chan);
+void ledcWrite(uint8_t chan, uint32_t duty);
+uint32_t ledcRead(uint8_t chan);
+
+void *ps_malloc(size_t size);
+void *ps_calloc(size_t n, size_t size);
+
+class EspClass {
+public:
+    uint32_t getFreeHeap();
+    uint32_t getMinFreeHeap();
+    uint32_t getMaxAllocHeap();
+    uint32_t getHeapSize();
+    uint32_t getPsramSize();
+    uint32_t getFreePsram();
+    uint32_t getMinFreePsram();
+    uint32_t getMaxAllocPsram();
+    uint64_t getEfuseMac() { return 0x1234567890ull; }
+    void restart();
+    uint32_t getCpuFreqMHz() { return 240; }
+};
+extern EspClass ESP;
+
+using std::min;
+using std::max;
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+#define abs(x) ((x) > 0 ? (x) : -(x))
+
+void setup();
+void loop();
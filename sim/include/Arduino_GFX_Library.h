@@ -0,0 +1,71 @@
+#pragma once
+#include <Arduino.h>
+
+#define GFX_NOT_DEFINED -1
+#define BLACK 0x0000
+#define NAVY 0x000F
+#define DARKGREEN 0x03E0
+#define DARKCYAN 0x03EF
+#define MAROON 0x7800
+#define PURPLE 0x780F
+#define OLIVE 0x7BE0
+#define LIGHTGREY 0xC618
+#define DARKGREY 0x7BEF
+#define BLUE 0x001F
+#define GREEN 0x07E0
+#define CYAN 0x07FF
+#define RED 0xF800
+#define MAGENTA 0xF81F
+#define YELLOW 0xFFE0
+#define WHITE 0xFFFF
+#define ORANGE 0xFD20
+
+class Arduino_ESP32RGBPanel {
+public:
+    Arduino_ESP32RGBPanel(int8_t de, int8_t vsync, int8_t hsync, int8_t pclk,
+                          int8_t r0, int8_t r1, int8_t r2, int8_t r3, int8_t r4,
+                          int8_t g0, int8_t g1, int8_t g2, int8_t g3, int8_t g4, int8_t g5,
+                          int8_t b0, int8_t b1, int8_t b2, int8_t b3, int8_t b4,
+                          uint16_t hsync_polarity, uint16_t hsync_front_porch, uint16_t hsync_pulse_width, uint16_t hsync_back_porch,
+                          uint16_t vsync_polarity, uint16_t vsync_front_porch, uint16_t vsync_pulse_width, uint16_t vsync_back_porch,
+                          uint16_t pclk_active_neg = 0, int32_t prefer_speed = GFX_NOT_DEFINED, bool useBigEndian = false,
+                          uint16_t de_idle_high = 0, uint16_t pclk_idle_high = 0, size_t bounce_buffer_size_px = 0) {}
+};
+
+class Arduino_RGB_Display : public Print {
+public:
+    Arduino_RGB_Display(int16_t w, int16_t h, Arduino_ESP32RGBPanel *rgbpanel, uint8_t r = 0, bool auto_flush = true);
+    bool begin(int32_t speed = GFX_NOT_DEFINED);
+    void setRotation(uint8_t r);
+    uint8_t getRotation() const { return _rotation; }
+    int16_t width() const { return _width; }
+    int16_t height() const { return _height; }
+    void fillScreen(uint16_t color);
+    void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+    void drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+    void drawPixel(int16_t x, int16_t y, uint16_t color);
+    void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
+    void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color);
+    void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
+    void draw16bitRGBBitmap(int16_t x, int16_t y, uint16_t *bitmap, int16_t w, int16_t h);
+    void setCursor(int16_t x, int16_t y) { _cx = x; _cy = y; }
+    void setTextSize(uint8_t s) { _ts = s ? s : 1; }
+    void setTextColor(uint16_t c) { _tc = c; }
+    void setTextColor(uint16_t c, uint16_t bg) { _tc = c; }
+    uint16_t color565(uint8_t r, uint8_t g, uint8_t b) { return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3); }
+    uint16_t *getFramebuffer() { return _fb; }
+    void flush(bool force_flush = false);
+    size_t write(uint8_t c) override;
+    void startWrite() {}
+    void endWrite() {}
+
+    uint16_t readPixel(int16_t x, int16_t y);  // Simulator only, used for frame dumps
+
+protected:
+    uint16_t *pixelAddress(int16_t x, int16_t y);
+    void writePixelPreclipped(int16_t x, int16_t y, uint16_t color);
+    int16_t WIDTH, HEIGHT, _width, _height, _cx = 0, _cy = 0;
+    uint8_t _rotation = 0, _ts = 1;
+    uint16_t _tc = WHITE;
+    uint16_t *_fb = nullptr;
+};
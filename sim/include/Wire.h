@@ -0,0 +1,15 @@
+#pragma once
+#include <Arduino.h>
+class TwoWire {
+public:
+    bool begin(int sda = -1, int scl = -1, uint32_t frequency = 0);
+    void setClock(uint32_t frequency) {}
+    void beginTransmission(uint8_t address);
+    size_t write(uint8_t data);
+    size_t write(const uint8_t *data, size_t length);
+    uint8_t endTransmission(bool sendStop = true);
+    size_t requestFrom(uint8_t address, size_t length, bool sendStop = true);
+    int available();
+    int read();
+};
+extern TwoWire Wire;
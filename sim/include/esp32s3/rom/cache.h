@@ -0,0 +1,9 @@
+#pragma once
+#include <stdint.h>
+#ifdef __cplusplus
+extern "C" {
+#endif
+int Cache_WriteBack_Addr(uint32_t addr, uint32_t size);
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,7 @@
+#pragma once
+#include <stdint.h>
+#include <zlib.h>
+// The ROM routine is the zlib CRC32, chained the same way
+static inline uint32_t crc32_le(uint32_t crc, const uint8_t *buf, uint32_t len) {
+    return (uint32_t)crc32(crc, buf, len);
+}
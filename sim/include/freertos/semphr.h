@@ -0,0 +1,13 @@
+#pragma once
+#include "FreeRTOS.h"
+typedef struct SimSemaphore *SemaphoreHandle_t;
+SemaphoreHandle_t xSemaphoreCreateMutex();
+SemaphoreHandle_t xSemaphoreCreateRecursiveMutex();
+SemaphoreHandle_t xSemaphoreCreateBinary();
+SemaphoreHandle_t xSemaphoreCreateCounting(UBaseType_t max, UBaseType_t initial);
+BaseType_t xSemaphoreTake(SemaphoreHandle_t s, TickType_t wait);
+BaseType_t xSemaphoreGive(SemaphoreHandle_t s);
+BaseType_t xSemaphoreTakeRecursive(SemaphoreHandle_t s, TickType_t wait);
+BaseType_t xSemaphoreGiveRecursive(SemaphoreHandle_t s);
+BaseType_t xSemaphoreGiveFromISR(SemaphoreHandle_t s, BaseType_t *woken);
+void vSemaphoreDelete(SemaphoreHandle_t s);
@@ -0,0 +1,19 @@
+#pragma once
+#include "FreeRTOS.h"
+typedef void (*TaskFunction_t)(void *);
+typedef struct SimTask *TaskHandle_t;
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char *name, uint32_t stack, void *arg,
+                                   UBaseType_t prio, TaskHandle_t *handle, BaseType_t core);
+BaseType_t xTaskCreate(TaskFunction_t fn, const char *name, uint32_t stack, void *arg, UBaseType_t prio, TaskHandle_t *handle);
+void vTaskDelete(TaskHandle_t t);
+void vTaskDelay(TickType_t ticks);
+TickType_t xTaskGetTickCount();
+UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t t);
+BaseType_t xPortGetCoreID();
+void taskYIELD();
+void vTaskSuspend(TaskHandle_t t);
+void vTaskResume(TaskHandle_t t);
+uint32_t ulTaskNotifyTake(BaseType_t clear, TickType_t wait);
+BaseType_t xTaskNotifyGive(TaskHandle_t t);
+void vTaskNotifyGiveFromISR(TaskHandle_t t, BaseType_t *woken);
+TaskHandle_t xTaskGetCurrentTaskHandle();
@@ -0,0 +1,71 @@
+#ifndef SIM_H
+#define SIM_H
+
+// Internal interfaces shared by the simulator sources. Nothing here is
+// visible to the firmware, which only sees the headers in sim/include.
+
+#include <cstdint>
+#include <string>
+
+// ==================== Cost Model ====================
+// Virtual time charged for work that would take real time on the device.
+struct SimCosts {
+    double sdOpenUs = 300;          // Per file/directory open
+    double sdBytesPerUs = 2.0;      // Sustained SD read/write rate
+    double decodeNsPerPixel = 60;   // Full-scale JPEG decode, per source pixel
+    double blitNsPerPixel = 8;      // Framebuffer write through the driver, per pixel
+    double copyNsPerPixel = 2;      // Bulk copy straight into the framebuffer
+    double blitCallUs = 2;          // Fixed cost per draw call
+    double sdStallUs = 50000;       // Card busy erasing, once per sdStallBytes written
+    double sdStallBytes = 1 << 20;
+    double linkLatencyUs = 1000;    // USB-serial bridge turnaround, device to host
+};
+extern SimCosts simCosts;
+
+// ==================== Virtual Clock ====================
+uint64_t simNowUs();
+void simAdvanceUs(double us);       // Charge time to the running task
+void simAdvanceCoreUs(double us);   // Charge time to the task's core; other cores keep running
+void simSleepUntilUs(uint64_t us);  // Block the running task
+void simYield();
+
+// ==================== Tasks ====================
+void simSchedulerInit();
+void simStartTask(void (*fn)(void *), void *arg, const char *name);
+const char *simCurrentTaskName();
+
+// ==================== Inputs ====================
+void simSetButton(uint8_t pin, bool pressed);
+void simSerialInject(const std::string &bytes);     // Queued behind bytes still on the line
+uint64_t simSerialLineFreeUs();                     // When the last injected byte lands
+double simSerialByteUs();                           // One character time at the console rate
+typedef void (*SimSerialTap)(const uint8_t *buf, size_t n);
+void simSerialSetTap(SimSerialTap tap);             // Firmware output goes to tap, nullptr restores stdout
+void simSerialReport();                             // Bytes sent and time each task waited to send them
+void simHeapReport();                               // PSRAM requests and when the last one came
+void simGpioTriggerInterrupt(uint8_t pin);
+void simNoteInput(const char *what);  // Starts the latency clock for the next frame
+// Drags a finger from (x0, y0) to (x1, y1) in screen coordinates over ms
+void simTouchStroke(int x0, int y0, int x1, int y1, uint32_t ms);
+
+// Sends a host file with the serial upload protocol, as tools/upload.py
+// does, and logs the rate. Stops after cutBytes of data (0: never) as if
+// the cable was pulled; flipEvery > 0 corrupts every flipEvery-th frame.
+bool simUpload(const std::string &hostPath, const std::string &cardPath, uint32_t cutBytes, uint32_t flipEvery);
+
+// ==================== Display ====================
+void simDisplayDump(const std::string &path);
+void simDisplayNoteWrite(uint32_t pixels, uint32_t calls, double nsPerPixel);
+void simDisplayReport();
+
+// ==================== SD Card ====================
+bool simSdSetRoot(const std::string &dir);
+std::string simSdHostPath(const char *path);
+
+// ==================== Run Control ====================
+void simQuit(int code);
+int simBench(const std::string &name);   // Wall-clock kernel benchmark; returns an exit code
+int simFuzz(int casesPerSeed);            // Mutated files through the decoders; returns an exit code
+void simLog(const char *fmt, ...) __attribute__((format(printf, 1, 2)));
+
+#endif // SIM_H
@@ -0,0 +1,390 @@
+// Arduino core, ESP32 helpers and heap statistics for the simulator.
+
+#include "sim.h"
+#include <Arduino.h>
+#include <SPI.h>
+#include <esp_heap_caps.h>
+#include <driver/ledc.h>
+#include <cstdarg>
+#include <deque>
+#include <map>
+#include <malloc.h>
+
+#define SIM_INTERNAL_HEAP (320 * 1024)
+#define SIM_PSRAM_HEAP (8 * 1024 * 1024)
+
+// ==================== Print ====================
+size_t Print::printf(const char *fmt, ...) {
+    char stackBuf[256];
+    va_list args;
+    va_start(args, fmt);
+    int len = vsnprintf(stackBuf, sizeof(stackBuf), fmt, args);
+    va_end(args);
+    if (len < 0) return 0;
+    if (len < (int)sizeof(stackBuf)) return write((const uint8_t *)stackBuf, len);
+    
+    std::string big(len + 1, '\0');
+    va_start(args, fmt);
+    vsnprintf(&big[0], big.size(), fmt, args);
+    va_end(args);
+    return write((const uint8_t *)big.data(), len);
+}
+
+// ==================== Serial ====================
+// The console is a UART running at the rate passed to begin(): injected
+// bytes reach the receive buffer one character time apart, and bytes that
+// arrive while the buffer is full are lost, as on the device. Output leaves
+// at the same rate: a write returns once what is left of it fits in the
+// 128-byte transmit FIFO (plus any buffer from setTxBufferSize), so a
+// burst of prints blocks its task as uart_write_bytes() does. With a tap
+// installed the firmware's output goes to it instead of stdout.
+HardwareSerial Serial;
+SPIClass SPI;
+
+struct SerialSegment {
+    uint64_t startUs;       // Arrival of the first byte
+    std::string bytes;
+    size_t next;            // Bytes already moved to the buffer
+};
+
+static uint32_t serialBaud = 115200;
+static size_t rxCapacity = 256;     // Arduino core default
+static std::deque<uint8_t> serialRx;
+static std::deque<SerialSegment> serialLine;
+static uint64_t lineFreeUs = 0;
+static uint64_t rxDropped = 0;
+static size_t txCapacity = 128;     // Hardware FIFO; the Arduino core adds no buffer by default
+static double txIdleUs = 0;         // The last byte written has left the UART
+static uint64_t txBytes = 0;
+static std::map<std::string, double> txWaitUs;  // Per task
+static SimSerialTap serialTap = nullptr;
+
+double simSerialByteUs() {
+    return 10e6 / serialBaud;   // Start, 8 data and stop bit
+}
+
+static void pumpSerial() {
+    uint64_t now = simNowUs();
+    double byteUs = simSerialByteUs();
+    size_t dropped = 0;
+    while (!serialLine.empty()) {
+        SerialSegment &seg = serialLine.front();
+        while (seg.next < seg.bytes.size() && seg.startUs + (seg.next + 1) * byteUs <= now) {
+            if (serialRx.size() < rxCapacity) {
+                serialRx.push_back((uint8_t)seg.bytes[seg.next]);
+            } else {
+                dropped++;
+            }
+            seg.next++;
+        }
+        if (seg.next < seg.bytes.size()) break;
+        serialLine.pop_front();
+    }
+    if (dropped) {
+        rxDropped += dropped;
+        simLog("serial: receive buffer full, %zu bytes lost", dropped);
+    }
+}
+
+void HardwareSerial::begin(unsigned long baud) {
+    serialBaud = baud;
+}
+
+size_t HardwareSerial::setRxBufferSize(size_t n) {
+    rxCapacity = n;
+    return n;
+}
+
+size_t HardwareSerial::setTxBufferSize(size_t n) {
+    txCapacity = 128 + n;
+    return n;
+}
+
+size_t HardwareSerial::write(uint8_t c) {
+    return write(&c, 1);
+}
+
+size_t HardwareSerial::write(const uint8_t *buf, size_t n) {
+    double now = simNowUs();
+    double byteUs = simSerialByteUs();
+    txIdleUs = (txIdleUs > now ? txIdleUs : now) + n * byteUs;
+    
+    if (serialTap) {
+        serialTap(buf, n);
+    } else {
+        fwrite(buf, 1, n, stdout);
+    }
+    // Wait for the tail of the write to fit in the FIFO
+    double fitsUs = txIdleUs - txCapacity * byteUs;
+    txBytes += n;
+    if (fitsUs > now) {
+        txWaitUs[simCurrentTaskName()] += fitsUs - now;
+        simSleepUntilUs((uint64_t)(fitsUs + 0.5));
+    }
+    return n;
+}
+
+int HardwareSerial::available() {
+    pumpSerial();
+    return serialRx.size();
+}
+
+int HardwareSerial::read() {
+    pumpSerial();
+    if (serialRx.empty()) return -1;
+    int c = serialRx.front();
+    serialRx.pop_front();
+    return c;
+}
+
+void simSerialInject(const std::string &bytes) {
+    if (bytes.empty()) return;
+    uint64_t start = lineFreeUs > simNowUs() ? lineFreeUs : simNowUs();
+    serialLine.push_back({start, bytes, 0});
+    lineFreeUs = start + (uint64_t)(bytes.size() * simSerialByteUs() + 0.5);
+}
+
+uint64_t simSerialLineFreeUs() {
+    return lineFreeUs > simNowUs() ? lineFreeUs : simNowUs();
+}
+
+void simSerialSetTap(SimSerialTap tap) {
+    serialTap = tap;
+}
+
+void simSerialReport() {
+    std::string waits;
+    char part[64];
+    for (const auto &w : txWaitUs) {
+        snprintf(part, sizeof(part), " %s=%.1fms", w.first.c_str(), w.second / 1000);
+        waits += part;
+    }
+    simLog("serial totals: bytes out=%llu, waits for the UART:%s", (unsigned long long)txBytes,
+           waits.empty() ? " none" : waits.c_str());
+}
+
+// ==================== Time ====================
+unsigned long millis() {
+    return (unsigned long)(simNowUs() / 1000);
+}
+
+unsigned long micros() {
+    // Every read costs a little, so budget loops always make progress
+    simAdvanceUs(1);
+    return (unsigned long)simNowUs();
+}
+
+void delay(uint32_t ms) {
+    simSleepUntilUs(simNowUs() + (uint64_t)ms * 1000);
+}
+
+void delayMicroseconds(uint32_t us) {
+    simAdvanceUs(us);
+}
+
+void yield() {
+    simYield();
+}
+
+// ==================== GPIO ====================
+static bool pinLow[64];
+static void (*pinIsr[64])(void);
+
+void pinMode(uint8_t pin, uint8_t mode) {
+}
+
+int digitalRead(uint8_t pin) {
+    return pin < 64 && pinLow[pin] ? LOW : HIGH;
+}
+
+void digitalWrite(uint8_t pin, uint8_t val) {
+}
+
+void attachInterrupt(uint8_t pin, void (*fn)(void), int mode) {
+    if (pin < 64) pinIsr[pin] = fn;
+}
+
+void detachInterrupt(uint8_t pin) {
+    if (pin < 64) pinIsr[pin] = nullptr;
+}
+
+void simSetButton(uint8_t pin, bool pressed) {
+    if (pin >= 64) return;
+    bool changed = pinLow[pin] != pressed;
+    pinLow[pin] = pressed;
+    if (changed) simGpioTriggerInterrupt(pin);
+}
+
+void simGpioTriggerInterrupt(uint8_t pin) {
+    if (pin < 64 && pinIsr[pin]) pinIsr[pin]();
+}
+
+// ==================== Random ====================
+static uint32_t randomState = 1;
+
+void randomSeed(unsigned long seed) {
+    randomState = seed ? seed : 1;
+}
+
+static uint32_t nextRandom() {
+    // xorshift32
+    randomState ^= randomState << 13;
+    randomState ^= randomState >> 17;
+    randomState ^= randomState << 5;
+    return randomState;
+}
+
+long random(long max) {
+    return max <= 0 ? 0 : nextRandom() % max;
+}
+
+long random(long min, long max) {
+    return max <= min ? min : min + random(max - min);
+}
+
+long map(long x, long in_min, long in_max, long out_min, long out_max) {
+    return (x - in_min) * (out_max - out_min) / (in_max - in_min) + out_min;
+}
+
+// ==================== Backlight ====================
+static uint32_t ledcDuty[16];
+
+uint32_t ledcSetup(uint8_t chan, uint32_t freq, uint8_t bits) {
+    return freq;
+}
+
+void ledcAttachPin(uint8_t pin, uint8_t chan) {
+}
+
+void ledcWrite(uint8_t chan, uint32_t duty) {
+    if (chan < 16) ledcDuty[chan] = duty;
+}
+
+uint32_t ledcRead(uint8_t chan) {
+    return chan < 16 ? ledcDuty[chan] : 0;
+}
+
+esp_err_t ledc_fade_func_install(int intr_alloc_flags) {
+    return 0;
+}
+
+esp_err_t ledc_set_fade_time_and_start(ledc_mode_t speed_mode, ledc_channel_t channel, uint32_t target_duty,
+                                       uint32_t max_fade_time_ms, ledc_fade_mode_t fade_mode) {
+    if (ledcDuty[channel] != target_duty) {
+        simLog("backlight: duty %u -> %u over %u ms", ledcDuty[channel], target_duty, max_fade_time_ms);
+    }
+    ledcDuty[channel] = target_duty;
+    return 0;
+}
+
+// ==================== Heap ====================
+// Internal heap figures follow the host allocator, so leaks in the firmware
+// show up in the telemetry. PSRAM is reported as always free: the firmware
+// releases PSRAM buffers with plain free(), which the simulator cannot see.
+static size_t heapBaseline = 0;
+static size_t internalMinFree = SIM_INTERNAL_HEAP;
+
+static size_t internalFree() {
+    size_t inUse = mallinfo2().uordblks;
+    if (heapBaseline == 0) heapBaseline = inUse;
+    size_t used = inUse > heapBaseline ? inUse - heapBaseline : 0;
+    size_t free = used < SIM_INTERNAL_HEAP ? SIM_INTERNAL_HEAP - used : 0;
+    if (free < internalMinFree) internalMinFree = free;
+    return free;
+}
+
+static size_t psramFree() {
+    return SIM_PSRAM_HEAP;
+}
+
+// PSRAM requests are counted, so a run shows whether any come after boot
+static uint64_t psramRequests = 0;
+static uint64_t psramRequestBytes = 0;
+static uint64_t psramLastRequestUs = 0;
+
+static void notePsramRequest(size_t size, uint32_t caps) {
+    if (!(caps & MALLOC_CAP_SPIRAM)) return;
+    psramRequests++;
+    psramRequestBytes += size;
+    psramLastRequestUs = simNowUs();
+}
+
+void simHeapReport() {
+    simLog("heap totals: PSRAM requests=%llu (%llu KB), last at %.3f s", (unsigned long long)psramRequests,
+           (unsigned long long)psramRequestBytes / 1024, psramLastRequestUs / 1e6);
+}
+
+void *ps_malloc(size_t size) {
+    return heap_caps_malloc(size, MALLOC_CAP_SPIRAM);
+}
+
+void *ps_calloc(size_t n, size_t size) {
+    return heap_caps_calloc(n, size, MALLOC_CAP_SPIRAM);
+}
+
+void *heap_caps_malloc(size_t size, uint32_t caps) {
+    notePsramRequest(size, caps);
+    return malloc(size);
+}
+
+void *heap_caps_calloc(size_t n, size_t size, uint32_t caps) {
+    void *p = heap_caps_malloc(n * size, caps);
+    if (p) memset(p, 0, n * size);
+    return p;
+}
+
+void *heap_caps_aligned_alloc(size_t alignment, size_t size, uint32_t caps) {
+    notePsramRequest(size, caps);
+    return aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment);
+}
+
+void heap_caps_free(void *ptr) {
+    free(ptr);
+}
+
+size_t heap_caps_get_free_size(uint32_t caps) {
+    if (caps & MALLOC_CAP_SPIRAM) return psramFree();
+    if (caps & MALLOC_CAP_INTERNAL) return internalFree();
+    return internalFree() + psramFree();
+}
+
+size_t heap_caps_get_total_size(uint32_t caps) {
+    if (caps & MALLOC_CAP_SPIRAM) return SIM_PSRAM_HEAP;
+    if (caps & MALLOC_CAP_INTERNAL) return SIM_INTERNAL_HEAP;
+    return SIM_INTERNAL_HEAP + SIM_PSRAM_HEAP;
+}
+
+size_t heap_caps_get_minimum_free_size(uint32_t caps) {
+    heap_caps_get_free_size(caps);
+    if (caps & MALLOC_CAP_SPIRAM) return SIM_PSRAM_HEAP;
+    if (caps & MALLOC_CAP_INTERNAL) return internalMinFree;
+    return internalMinFree + SIM_PSRAM_HEAP;
+}
+
+size_t heap_caps_get_largest_free_block(uint32_t caps) {
+    return heap_caps_get_free_size(caps);
+}
+
+void heap_caps_get_info(multi_heap_info_t *info, uint32_t caps) {
+    memset(info, 0, sizeof(*info));
+    info->total_free_bytes = heap_caps_get_free_size(caps);
+    info->largest_free_block = heap_caps_get_largest_free_block(caps);
+    info->minimum_free_bytes = heap_caps_get_minimum_free_size(caps);
+    info->total_allocated_bytes = heap_caps_get_total_size(caps) - info->total_free_bytes;
+}
+
+EspClass ESP;
+
+uint32_t EspClass::getFreeHeap() { return heap_caps_get_free_size(MALLOC_CAP_INTERNAL); }
+uint32_t EspClass::getMinFreeHeap() { return heap_caps_get_minimum_free_size(MALLOC_CAP_INTERNAL); }
+uint32_t EspClass::getMaxAllocHeap() { return heap_caps_get_largest_free_block(MALLOC_CAP_INTERNAL); }
+uint32_t EspClass::getHeapSize() { return SIM_INTERNAL_HEAP; }
+uint32_t EspClass::getPsramSize() { return SIM_PSRAM_HEAP; }
+uint32_t EspClass::getFreePsram() { return heap_caps_get_free_size(MALLOC_CAP_SPIRAM); }
+uint32_t EspClass::getMinFreePsram() { return heap_caps_get_minimum_free_size(MALLOC_CAP_SPIRAM); }
+uint32_t EspClass::getMaxAllocPsram() { return heap_caps_get_largest_free_block(MALLOC_CAP_SPIRAM); }
+
+void EspClass::restart() {
+    simLog("ESP.restart()");
+    simQuit(0);
+}
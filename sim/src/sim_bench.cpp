@@ -0,0 +1,200 @@
+// Host benchmarks of firmware kernels, timed on the wall clock rather than
+// the virtual one. Absolute numbers are the host's; what carries over to
+// the device is how the kernels compare with each other and between
+// changes. The playlist sort also reports virtual time, which is mostly
+// the card.
+
+#include <chrono>    // Ahead of Arduino.h and its abs() macro
+#include "sim.h"
+#include <Arduino.h>
+#include "../../src/config.h"
+#include "../../src/letterbox.h"
+#include "../../src/color.h"
+#include "../../src/budget.h"
+#include "../../src/playlist.h"
+#include <SD.h>
+#include <malloc.h>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <string>
+#include <vector>
+
+// ==================== Heap Count ====================
+// Every operator new in the process, the firmware's Strings and vectors
+// included, so a benchmark can tell what it took from the heap. Kept out
+// of line, or GCC sees malloc meet delete and warns.
+static size_t heapLive = 0;
+static size_t heapPeak = 0;
+
+__attribute__((noinline)) void *operator new(size_t size) {
+    void *p = malloc(size ? size : 1);
+    if (!p) throw std::bad_alloc();
+    heapLive += malloc_usable_size(p);
+    if (heapLive > heapPeak) heapPeak = heapLive;
+    return p;
+}
+
+__attribute__((noinline)) void operator delete(void *p) noexcept {
+    if (!p) return;
+    heapLive -= malloc_usable_size(p);
+    free(p);
+}
+
+void operator delete(void *p, size_t) noexcept {
+    operator delete(p);
+}
+
+static double wallUs() {
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static uint64_t outputPixels = 0;
+
+static bool countOutput(int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t *bitmap) {
+    outputPixels += (uint32_t)w * h;
+    return true;
+}
+
+// Runs fn for about half a second and returns microseconds per call
+template <typename Fn>
+static double timeCalls(Fn fn, int &calls) {
+    calls = 0;
+    double start = wallUs();
+    double now = start;
+    while (now - start < 500000) {
+        fn();
+        calls++;
+        now = wallUs();
+    }
+    return (now - start) / calls;
+}
+
+static void benchLetterbox() {
+    const int cells = LETTERBOX_GRID_WIDTH * LETTERBOX_GRID_HEIGHT;
+    std::vector<uint16_t> source(cells * 3), grid(cells * 3);
+    for (int i = 0; i < cells * 3; i++) {
+        source[i] = (uint16_t)((i * 7919) % 256) << 8;
+    }
+    
+    int calls;
+    double us = timeCalls([&] {
+        memcpy(grid.data(), source.data(), cells * 6);
+        letterboxBlur(grid.data());
+    }, calls);
+    printf("letterbox blur:   %dx%d grid, %d passes radius %d: %8.1f us\n", LETTERBOX_GRID_WIDTH,
+           LETTERBOX_GRID_HEIGHT, LETTERBOX_BLUR_PASSES, LETTERBOX_BLUR_RADIUS, us);
+    
+    // Whole screen, then the bars around a 640x640 photo and a 800x480 one
+    struct Hole { const char *name; int16_t x, y, w, h; };
+    const Hole holes[] = {
+        {"full screen", 0, 0, 0, 0},
+        {"640x640 bars", 0, 80, 480, 640},
+        {"800x480 bars", 0, 160, 480, 480},
+    };
+    for (const Hole &hole : holes) {
+        outputPixels = 0;
+        us = timeCalls([&] {
+            letterboxRender(grid.data(), hole.x, hole.y, hole.w, hole.h, countOutput);
+        }, calls);
+        double pixels = (double)outputPixels / calls;
+        printf("letterbox render: %-13s %7.0f px: %8.1f us, %6.1f Mpx/s\n", hole.name, pixels, us, pixels / us);
+    }
+    
+    // The dithered conversion alone, for scale
+    std::vector<uint8_t> rgb(16 * 16 * 3, 90);
+    uint16_t block[16 * 16];
+    us = timeCalls([&] {
+        for (int i = 0; i < 480 * 800 / 256; i++) {
+            rgb888ToRgb565Dither(rgb.data(), block, 16, 16, 0, i);
+        }
+    }, calls);
+    printf("dither only:      full screen   %7d px: %8.1f us, %6.1f Mpx/s\n", 480 * 800, us, 480 * 800 / us);
+}
+
+// A synthetic library of PLAYLIST_BENCH_PHOTOS sorted onto a scratch card.
+// One photo in ten has no EXIF date and sorts by its mtime.
+#define PLAYLIST_BENCH_PHOTOS 100000
+
+static int benchPlaylist() {
+    char root[] = "/tmp/photoframe-bench-XXXXXX";
+    if (!mkdtemp(root) || !simSdSetRoot(root) || !SD.begin() || !budgetBegin()) {
+        fprintf(stderr, "cannot set up the scratch card\n");
+        return 1;
+    }
+    
+    srand(1);
+    imageFiles.clear();
+    imageFiles.reserve(PLAYLIST_BENCH_PHOTOS);
+    for (int i = 0; i < PLAYLIST_BENCH_PHOTOS; i++) {
+        ImageEntry image = {};
+        char path[64];
+        snprintf(path, sizeof(path), "/Album%02d/IMG_%05d.JPG", i % 40, i);
+        image.path = path;
+        image.size = 2000000 + rand() % 4000000;
+        image.mtime = 1600000000 + rand() % 100000000;
+        image.taken = rand() % 10 ? 1100000000 + rand() % 600000000 : 0;
+        imageFiles.push_back(image);
+    }
+    
+    const char *path = ALBUM_INDEX_DIR "/.all.dat";
+    uint32_t signature = playlistSignature();
+    size_t heapBefore = heapLive;
+    heapPeak = heapLive;
+    uint64_t virtualStart = simNowUs();
+    double wallStart = wallUs();
+    bool built = playlistBuild(path, signature);
+    double wallMs = (wallUs() - wallStart) / 1000;
+    double virtualMs = (simNowUs() - virtualStart) / 1000.0;
+    size_t heapGrowth = heapPeak - heapBefore;
+    
+    // Read back through the playback path: every photo once, in order
+    bool sorted = built && playlistCount() == PLAYLIST_BENCH_PHOTOS;
+    uint32_t lastKey = 0;
+    for (uint32_t i = 0; sorted && i < playlistCount(); i++) {
+        int index = atoi(playlistPeek().c_str() + 13);
+        uint32_t key = imageDateKey(imageFiles[index]);
+        sorted = key >= lastKey && imageFiles[index].path == playlistPeek();
+        lastKey = key;
+        playlistAdvance();
+    }
+    
+    // Resuming from a photo halfway through the library
+    const ImageEntry &middle = imageFiles[PLAYLIST_BENCH_PHOTOS / 2];
+    uint64_t seekStart = simNowUs();
+    double seekWallStart = wallUs();
+    playlistSeekAfter(middle);
+    double seekWallMs = (wallUs() - seekWallStart) / 1000;
+    double seekVirtualMs = (simNowUs() - seekStart) / 1000.0;
+    sorted = sorted && imageDateKey(middle) <= lastKey;
+    
+    File file = SD.open(path, FILE_READ);
+    uint32_t fileBytes = file ? file.size() : 0;
+    if (file) file.close();
+    
+    const PlaylistStats &stats = playlistStats();
+    printf("playlist sort:    %d photos, %u runs, %u merge passes, %u KB file\n", PLAYLIST_BENCH_PHOTOS,
+           stats.runs, stats.passes, fileBytes / 1024);
+    printf("                  %8.1f ms wall, %8.1f ms virtual\n", wallMs, virtualMs);
+    printf("                  %u KB arena working memory (%u KB decode arena peak), %zu KB heap growth\n",
+           stats.peakBytes / 1024, arenaStats(ARENA_DECODE).peak / 1024, heapGrowth / 1024);
+    printf("playlist seek:    %8.1f ms wall, %8.1f ms virtual\n", seekWallMs, seekVirtualMs);
+    printf("playlist order:   %s\n", sorted ? "ok" : "WRONG");
+    
+    playlistClose();
+    imageFiles.clear();
+    std::string cleanup = std::string("rm -rf ") + root;
+    if (system(cleanup.c_str()) != 0) fprintf(stderr, "could not remove %s\n", root);
+    return sorted ? 0 : 1;
+}
+
+int simBench(const std::string &name) {
+    if (name == "letterbox") {
+        benchLetterbox();
+        return 0;
+    }
+    if (name == "playlist") return benchPlaylist();
+    fprintf(stderr, "unknown benchmark %s (letterbox, playlist)\n", name.c_str());
+    return 2;
+}
@@ -0,0 +1,304 @@
+// RGB panel model: a native 800x480 RGB565 framebuffer with the same
+// rotation mapping as Arduino_RGB_Display, text in the classic 5x7 GFX font,
+// and counters for every pixel pushed. Writes are grouped into bursts
+// (activity separated by idle time) so each UI path reports its latency
+// and bytes pushed.
+
+#include "sim.h"
+#include <Arduino_GFX_Library.h>
+#include <vector>
+
+#define SIM_BURST_IDLE_US 50000    // Idle gap that ends a burst of writes
+#define SIM_INPUT_WINDOW_US 1000000 // Writes later than this are not a response
+
+static const uint8_t font5x7[95][5] = {
+    {0x00,0x00,0x00,0x00,0x00},{0x00,0x00,0x5F,0x00,0x00},{0x00,0x07,0x00,0x07,0x00},{0x14,0x7F,0x14,0x7F,0x14},
+    {0x24,0x2A,0x7F,0x2A,0x12},{0x23,0x13,0x08,0x64,0x62},{0x36,0x49,0x55,0x22,0x50},{0x00,0x05,0x03,0x00,0x00},
+    {0x00,0x1C,0x22,0x41,0x00},{0x00,0x41,0x22,0x1C,0x00},{0x08,0x2A,0x1C,0x2A,0x08},{0x08,0x08,0x3E,0x08,0x08},
+    {0x00,0x50,0x30,0x00,0x00},{0x08,0x08,0x08,0x08,0x08},{0x00,0x60,0x60,0x00,0x00},{0x20,0x10,0x08,0x04,0x02},
+    {0x3E,0x51,0x49,0x45,0x3E},{0x00,0x42,0x7F,0x40,0x00},{0x42,0x61,0x51,0x49,0x46},{0x21,0x41,0x45,0x4B,0x31},
+    {0x18,0x14,0x12,0x7F,0x10},{0x27,0x45,0x45,0x45,0x39},{0x3C,0x4A,0x49,0x49,0x30},{0x01,0x71,0x09,0x05,0x03},
+    {0x36,0x49,0x49,0x49,0x36},{0x06,0x49,0x49,0x29,0x1E},{0x00,0x36,0x36,0x00,0x00},{0x00,0x56,0x36,0x00,0x00},
+    {0x08,0x14,0x22,0x41,0x00},{0x14,0x14,0x14,0x14,0x14},{0x00,0x41,0x22,0x14,0x08},{0x02,0x01,0x51,0x09,0x06},
+    {0x32,0x49,0x79,0x41,0x3E},{0x7E,0x11,0x11,0x11,0x7E},{0x7F,0x49,0x49,0x49,0x36},{0x3E,0x41,0x41,0x41,0x22},
+    {0x7F,0x41,0x41,0x22,0x1C},{0x7F,0x49,0x49,0x49,0x41},{0x7F,0x09,0x09,0x01,0x01},{0x3E,0x41,0x41,0x51,0x32},
+    {0x7F,0x08,0x08,0x08,0x7F},{0x00,0x41,0x7F,0x41,0x00},{0x20,0x40,0x41,0x3F,0x01},{0x7F,0x08,0x14,0x22,0x41},
+    {0x7F,0x40,0x40,0x40,0x40},{0x7F,0x02,0x04,0x02,0x7F},{0x7F,0x04,0x08,0x10,0x7F},{0x3E,0x41,0x41,0x41,0x3E},
+    {0x7F,0x09,0x09,0x09,0x06},{0x3E,0x41,0x51,0x21,0x5E},{0x7F,0x09,0x19,0x29,0x46},{0x46,0x49,0x49,0x49,0x31},
+    {0x01,0x01,0x7F,0x01,0x01},{0x3F,0x40,0x40,0x40,0x3F},{0x1F,0x20,0x40,0x20,0x1F},{0x7F,0x20,0x18,0x20,0x7F},
+    {0x63,0x14,0x08,0x14,0x63},{0x03,0x04,0x78,0x04,0x03},{0x61,0x51,0x49,0x45,0x43},{0x00,0x00,0x7F,0x41,0x41},
+    {0x02,0x04,0x08,0x10,0x20},{0x41,0x41,0x7F,0x00,0x00},{0x04,0x02,0x01,0x02,0x04},{0x40,0x40,0x40,0x40,0x40},
+    {0x00,0x01,0x02,0x04,0x00},{0x20,0x54,0x54,0x54,0x78},{0x7F,0x48,0x44,0x44,0x38},{0x38,0x44,0x44,0x44,0x20},
+    {0x38,0x44,0x44,0x48,0x7F},{0x38,0x54,0x54,0x54,0x18},{0x08,0x7E,0x09,0x01,0x02},{0x08,0x14,0x54,0x54,0x3C},
+    {0x7F,0x08,0x04,0x04,0x78},{0x00,0x44,0x7D,0x40,0x00},{0x20,0x40,0x44,0x3D,0x00},{0x00,0x7F,0x10,0x28,0x44},
+    {0x00,0x41,0x7F,0x40,0x00},{0x7C,0x04,0x18,0x04,0x78},{0x7C,0x08,0x04,0x04,0x78},{0x38,0x44,0x44,0x44,0x38},
+    {0x7C,0x14,0x14,0x14,0x08},{0x08,0x14,0x14,0x18,0x7C},{0x7C,0x08,0x04,0x04,0x08},{0x48,0x54,0x54,0x54,0x20},
+    {0x04,0x3F,0x44,0x40,0x20},{0x3C,0x40,0x40,0x20,0x7C},{0x1C,0x20,0x40,0x20,0x1C},{0x3C,0x40,0x30,0x40,0x3C},
+    {0x44,0x28,0x10,0x28,0x44},{0x0C,0x50,0x50,0x50,0x3C},{0x44,0x64,0x54,0x4C,0x44},{0x00,0x08,0x36,0x41,0x00},
+    {0x00,0x00,0x7F,0x00,0x00},{0x00,0x41,0x36,0x08,0x00},{0x08,0x04,0x08,0x10,0x08},
+};
+
+static Arduino_RGB_Display *simDisplay = nullptr;
+
+// Framebuffer contents as of the last write the simulator saw, used to
+// account for firmware that writes the framebuffer directly. Plain memory
+// because the display object is constructed during static initialization.
+static uint16_t *shadow = nullptr;
+static size_t shadowSize = 0;
+
+// ==================== Write Accounting ====================
+struct SimBurst {
+    uint64_t startUs = 0;
+    uint64_t lastUs = 0;
+    uint64_t pixels = 0;
+    uint64_t calls = 0;
+    bool active = false;
+    bool input = false;         // Burst answers an input event
+    uint64_t inputUs = 0;
+    std::string inputName;
+};
+
+static SimBurst burst;
+static uint64_t inputUs = 0;
+static std::string inputName;
+static bool inputPending = false;
+static uint64_t totalPixels = 0;
+static uint64_t totalCalls = 0;
+static uint64_t burstCount = 0;
+
+static void closeBurst() {
+    if (!burst.active) return;
+    simLog("frame burst: start=%.3fs dur=%.1fms pixels=%llu bytes=%llu calls=%llu",
+           burst.startUs / 1e6, (burst.lastUs - burst.startUs) / 1e3,
+           (unsigned long long)burst.pixels, (unsigned long long)burst.pixels * 2,
+           (unsigned long long)burst.calls);
+    if (burst.input) {
+        simLog("  latency from %s: first write %.1fms, complete %.1fms", burst.inputName.c_str(),
+               (burst.startUs - burst.inputUs) / 1e3, (burst.lastUs - burst.inputUs) / 1e3);
+    }
+    burst.active = false;
+    burstCount++;
+}
+
+void simDisplayNoteWrite(uint32_t pixels, uint32_t calls, double nsPerPixel) {
+    uint64_t now = simNowUs();
+    if (burst.active && now - burst.lastUs > SIM_BURST_IDLE_US) closeBurst();
+    if (!burst.active) {
+        burst = SimBurst();
+        burst.active = true;
+        burst.startUs = now;
+        if (inputPending && now - inputUs <= SIM_INPUT_WINDOW_US) {
+            burst.input = true;
+            burst.inputUs = inputUs;
+            burst.inputName = inputName;
+        }
+        inputPending = false;
+    }
+    
+    simAdvanceUs(calls * simCosts.blitCallUs + pixels * nsPerPixel / 1000.0);
+    burst.lastUs = simNowUs();
+    burst.pixels += pixels;
+    burst.calls += calls;
+    totalPixels += pixels;
+    totalCalls += calls;
+}
+
+void simNoteInput(const char *what) {
+    inputUs = simNowUs();
+    inputName = what;
+    inputPending = true;
+}
+
+void simDisplayReport() {
+    closeBurst();
+    simLog("display totals: bursts=%llu pixels=%llu bytes=%llu calls=%llu",
+           (unsigned long long)burstCount, (unsigned long long)totalPixels,
+           (unsigned long long)totalPixels * 2, (unsigned long long)totalCalls);
+}
+
+// ==================== Frame Dumps ====================
+// Dumps what a viewer sees, i.e. the framebuffer read back through the
+// current rotation, as binary PPM.
+void simDisplayDump(const std::string &path) {
+    if (!simDisplay) return;
+    closeBurst();
+    
+    Arduino_RGB_Display &d = *simDisplay;
+    FILE *f = fopen(path.c_str(), "wb");
+    if (!f) {
+        simLog("cannot write %s", path.c_str());
+        return;
+    }
+    
+    int w = d.width(), h = d.height();
+    fprintf(f, "P6\n%d %d\n255\n", w, h);
+    std::vector<uint8_t> row(w * 3);
+    for (int y = 0; y < h; y++) {
+        for (int x = 0; x < w; x++) {
+            uint16_t c = d.readPixel(x, y);
+            row[x * 3 + 0] = ((c >> 11) & 0x1F) * 255 / 31;
+            row[x * 3 + 1] = ((c >> 5) & 0x3F) * 255 / 63;
+            row[x * 3 + 2] = (c & 0x1F) * 255 / 31;
+        }
+        fwrite(row.data(), 1, row.size(), f);
+    }
+    fclose(f);
+    simLog("dumped %s", path.c_str());
+}
+
+// ==================== Arduino_RGB_Display ====================
+Arduino_RGB_Display::Arduino_RGB_Display(int16_t w, int16_t h, Arduino_ESP32RGBPanel *rgbpanel, uint8_t r, bool auto_flush)
+    : WIDTH(w), HEIGHT(h), _width(w), _height(h) {
+    _fb = (uint16_t *)calloc((size_t)w * h, sizeof(uint16_t));
+    shadowSize = (size_t)w * h;
+    shadow = (uint16_t *)calloc(shadowSize, sizeof(uint16_t));
+    setRotation(r);
+    simDisplay = this;
+}
+
+bool Arduino_RGB_Display::begin(int32_t speed) {
+    return true;
+}
+
+void Arduino_RGB_Display::setRotation(uint8_t r) {
+    _rotation = r & 3;
+    _width = (_rotation & 1) ? HEIGHT : WIDTH;
+    _height = (_rotation & 1) ? WIDTH : HEIGHT;
+}
+
+uint16_t *Arduino_RGB_Display::pixelAddress(int16_t x, int16_t y) {
+    switch (_rotation) {
+        case 1:  return _fb + (int32_t)x * WIDTH + (WIDTH - 1 - y);
+        case 2:  return _fb + (int32_t)(HEIGHT - 1 - y) * WIDTH + (WIDTH - 1 - x);
+        case 3:  return _fb + (int32_t)(HEIGHT - 1 - x) * WIDTH + y;
+        default: return _fb + (int32_t)y * WIDTH + x;
+    }
+}
+
+void Arduino_RGB_Display::writePixelPreclipped(int16_t x, int16_t y, uint16_t color) {
+    uint16_t *p = pixelAddress(x, y);
+    *p = color;
+    shadow[p - _fb] = color;
+}
+
+// ==================== Direct Framebuffer Writes ====================
+// Firmware that copies into getFramebuffer() must write the cache back for
+// the panel DMA to see it, which is where those writes become visible here.
+// Pixels that changed since the last sighting count as pushed and are
+// charged as bulk copies.
+extern "C" int Cache_WriteBack_Addr(uint32_t addr, uint32_t size) {
+    if (!simDisplay || !shadow) return 0;
+    uint16_t *fb = simDisplay->getFramebuffer();
+    // Addresses arrive truncated to 32 bits; offsets survive the truncation
+    uint32_t offset = (addr - (uint32_t)(uintptr_t)fb) / 2;
+    uint32_t count = size / 2;
+    if (offset >= shadowSize) return 0;
+    if (offset + count > shadowSize) count = shadowSize - offset;
+    
+    uint32_t changed = 0;
+    for (uint32_t i = offset; i < offset + count; i++) {
+        if (fb[i] != shadow[i]) {
+            shadow[i] = fb[i];
+            changed++;
+        }
+    }
+    simDisplayNoteWrite(changed, 1, simCosts.copyNsPerPixel);
+    return 0;
+}
+
+uint16_t Arduino_RGB_Display::readPixel(int16_t x, int16_t y) {
+    if (x < 0 || y < 0 || x >= _width || y >= _height) return 0;
+    return *pixelAddress(x, y);
+}
+
+void Arduino_RGB_Display::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    int16_t x1 = std::min<int32_t>(_width, (int32_t)x + w), y1 = std::min<int32_t>(_height, (int32_t)y + h);
+    x = std::max<int16_t>(x, 0);
+    y = std::max<int16_t>(y, 0);
+    if (x >= x1 || y >= y1) return;
+    for (int16_t j = y; j < y1; j++)
+        for (int16_t i = x; i < x1; i++) writePixelPreclipped(i, j, color);
+    simDisplayNoteWrite((uint32_t)(x1 - x) * (y1 - y), 1, simCosts.blitNsPerPixel);
+}
+
+void Arduino_RGB_Display::fillScreen(uint16_t color) {
+    fillRect(0, 0, _width, _height, color);
+}
+
+void Arduino_RGB_Display::drawPixel(int16_t x, int16_t y, uint16_t color) {
+    if (x < 0 || y < 0 || x >= _width || y >= _height) return;
+    writePixelPreclipped(x, y, color);
+    simDisplayNoteWrite(1, 1, simCosts.blitNsPerPixel);
+}
+
+void Arduino_RGB_Display::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+    fillRect(x, y, w, 1, color);
+}
+
+void Arduino_RGB_Display::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+    fillRect(x, y, 1, h, color);
+}
+
+void Arduino_RGB_Display::drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    drawFastHLine(x, y, w, color);
+    drawFastHLine(x, y + h - 1, w, color);
+    drawFastVLine(x, y, h, color);
+    drawFastVLine(x + w - 1, y, h, color);
+}
+
+void Arduino_RGB_Display::drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+    int dx = abs(x1 - x0), dy = -abs(y1 - y0);
+    int sx = x0 < x1 ? 1 : -1, sy = y0 < y1 ? 1 : -1, err = dx + dy;
+    for (;;) {
+        drawPixel(x0, y0, color);
+        if (x0 == x1 && y0 == y1) break;
+        int e2 = 2 * err;
+        if (e2 >= dy) { err += dy; x0 += sx; }
+        if (e2 <= dx) { err += dx; y0 += sy; }
+    }
+}
+
+void Arduino_RGB_Display::draw16bitRGBBitmap(int16_t x, int16_t y, uint16_t *bitmap, int16_t w, int16_t h) {
+    uint32_t written = 0;
+    for (int16_t j = 0; j < h; j++) {
+        int16_t py = y + j;
+        if (py < 0 || py >= _height) continue;
+        for (int16_t i = 0; i < w; i++) {
+            int16_t px = x + i;
+            if (px < 0 || px >= _width) continue;
+            writePixelPreclipped(px, py, bitmap[(int32_t)j * w + i]);
+            written++;
+        }
+    }
+    simDisplayNoteWrite(written, 1, simCosts.blitNsPerPixel);
+}
+
+void Arduino_RGB_Display::flush(bool force_flush) {
+}
+
+size_t Arduino_RGB_Display::write(uint8_t c) {
+    if (c == '\n') {
+        _cx = 0;
+        _cy += 8 * _ts;
+        return 1;
+    }
+    if (c == '\r') return 1;
+    
+    if (_cx + 6 * _ts > _width) {
+        _cx = 0;
+        _cy += 8 * _ts;
+    }
+    
+    if (c >= 32 && c < 127) {
+        const uint8_t *glyph = font5x7[c - 32];
+        for (int col = 0; col < 5; col++) {
+            for (int row = 0; row < 8; row++) {
+                if (glyph[col] & (1 << row)) {
+                    fillRect(_cx + col * _ts, _cy + row * _ts, _ts, _ts, _tc);
+                }
+            }
+        }
+    }
+    _cx += 6 * _ts;
+    return 1;
+}
@@ -0,0 +1,279 @@
+// SD card backed by a host directory. Directory listings are sorted by name
+// so scans are deterministic; every open, read and write charges virtual
+// time from the cost model.
+
+#include "sim.h"
+#include <SD.h>
+#include <dirent.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#define SIM_CARD_BYTES (32ULL * 1024 * 1024 * 1024)
+
+static std::string sdRoot;
+static bool sdMounted = false;
+
+fs::SDFS SD;
+
+bool simSdSetRoot(const std::string &dir) {
+    struct stat st;
+    if (stat(dir.c_str(), &st) != 0 || !S_ISDIR(st.st_mode)) return false;
+    sdRoot = dir;
+    while (sdRoot.size() > 1 && sdRoot.back() == '/') sdRoot.pop_back();
+    return true;
+}
+
+std::string simSdHostPath(const char *path) {
+    std::string p = path ? path : "/";
+    if (p.empty() || p[0] != '/') p = "/" + p;
+    if (p.size() > 1 && p.back() == '/') p.pop_back();
+    return sdRoot + (p == "/" ? "" : p);
+}
+
+// Reads keep only their own core busy too, so a read-ahead task overlaps
+// decoding on the other core
+static void chargeBytes(size_t bytes) {
+    simAdvanceCoreUs(bytes / simCosts.sdBytesPerUs);
+}
+
+// Writes keep only their own core busy, so a writer task overlaps the
+// loop; every sdStallBytes the card stalls to erase
+static double writtenBytes = 0;
+
+static void chargeWrite(size_t bytes) {
+    double us = bytes / simCosts.sdBytesPerUs;
+    double before = writtenBytes;
+    writtenBytes += bytes;
+    if (simCosts.sdStallBytes > 0 && (uint64_t)(writtenBytes / simCosts.sdStallBytes) != (uint64_t)(before / simCosts.sdStallBytes)) {
+        us += simCosts.sdStallUs;
+    }
+    simAdvanceCoreUs(us);
+}
+
+// ==================== File Implementation ====================
+namespace fs {
+class FileImpl {
+public:
+    std::string path;
+    std::string host;
+    FILE *fp = nullptr;
+    bool dir = false;
+    std::vector<std::string> entries;
+    size_t next = 0;
+    
+    ~FileImpl() {
+        if (fp) fclose(fp);
+    }
+};
+}
+
+static fs::FileImplPtr openImpl(const std::string &path, const char *mode) {
+    if (!sdMounted) return fs::FileImplPtr();
+    simAdvanceUs(simCosts.sdOpenUs);
+    
+    std::string host = simSdHostPath(path.c_str());
+    struct stat st;
+    bool exists = stat(host.c_str(), &st) == 0;
+    
+    auto impl = std::make_shared<fs::FileImpl>();
+    impl->path = path.empty() ? "/" : path;
+    impl->host = host;
+    
+    if (exists && S_ISDIR(st.st_mode)) {
+        impl->dir = true;
+        DIR *d = opendir(host.c_str());
+        if (!d) return fs::FileImplPtr();
+        while (struct dirent *e = readdir(d)) {
+            std::string name = e->d_name;
+            if (name != "." && name != "..") impl->entries.push_back(name);
+        }
+        closedir(d);
+        std::sort(impl->entries.begin(), impl->entries.end());
+        return impl;
+    }
+    
+    std::string m = mode ? mode : "r";
+    if (m == "r" && !exists) return fs::FileImplPtr();
+    const char *hostMode = m == "w" ? "wb" : m == "a" ? "ab" : m == "r+" ? "r+b" : m == "w+" ? "w+b" : m == "a+" ? "a+b" : "rb";
+    impl->fp = fopen(host.c_str(), hostMode);
+    if (!impl->fp) return fs::FileImplPtr();
+    return impl;
+}
+
+namespace fs {
+
+size_t File::write(uint8_t c) {
+    return write(&c, 1);
+}
+
+size_t File::write(const uint8_t *buf, size_t size) {
+    if (!_p || !_p->fp) return 0;
+    chargeWrite(size);
+    return fwrite(buf, 1, size, _p->fp);
+}
+
+int File::available() {
+    if (!_p || !_p->fp) return 0;
+    long remaining = (long)size() - (long)position();
+    return remaining > 0 ? remaining : 0;
+}
+
+int File::read() {
+    uint8_t c;
+    return read(&c, 1) == 1 ? c : -1;
+}
+
+int File::peek() {
+    if (!_p || !_p->fp) return -1;
+    int c = fgetc(_p->fp);
+    if (c != EOF) ungetc(c, _p->fp);
+    return c == EOF ? -1 : c;
+}
+
+size_t File::read(uint8_t *buf, size_t size) {
+    if (!_p || !_p->fp) return 0;
+    size_t got = fread(buf, 1, size, _p->fp);
+    chargeBytes(got);
+    return got;
+}
+
+void File::flush() {
+    if (_p && _p->fp) fflush(_p->fp);
+}
+
+bool File::seek(uint32_t pos, SeekMode mode) {
+    if (!_p || !_p->fp) return false;
+    int whence = mode == SeekCur ? SEEK_CUR : mode == SeekEnd ? SEEK_END : SEEK_SET;
+    return fseek(_p->fp, pos, whence) == 0;
+}
+
+size_t File::position() const {
+    return _p && _p->fp ? ftell(_p->fp) : 0;
+}
+
+size_t File::size() const {
+    if (!_p) return 0;
+    if (_p->fp) {
+        fflush(_p->fp);
+        struct stat st;
+        return fstat(fileno(_p->fp), &st) == 0 ? st.st_size : 0;
+    }
+    return 0;
+}
+
+void File::close() {
+    _p.reset();
+}
+
+File::operator bool() const {
+    return (bool)_p;
+}
+
+time_t File::getLastWrite() {
+    struct stat st;
+    if (!_p || stat(_p->host.c_str(), &st) != 0) return 0;
+    return st.st_mtime;
+}
+
+const char *File::path() const {
+    return _p ? _p->path.c_str() : nullptr;
+}
+
+const char *File::name() const {
+    if (!_p) return nullptr;
+    size_t slash = _p->path.rfind('/');
+    return _p->path.c_str() + (slash == std::string::npos ? 0 : slash + 1);
+}
+
+bool File::isDirectory(void) {
+    return _p && _p->dir;
+}
+
+File File::openNextFile(const char *mode) {
+    if (!_p || !_p->dir) return File();
+    while (_p->next < _p->entries.size()) {
+        std::string child = (_p->path == "/" ? "" : _p->path) + "/" + _p->entries[_p->next++];
+        FileImplPtr impl = openImpl(child, mode);
+        if (impl) return File(impl);
+    }
+    return File();
+}
+
+void File::rewindDirectory(void) {
+    if (_p) _p->next = 0;
+}
+
+// ==================== File System ====================
+File FS::open(const char *path, const char *mode, const bool create) {
+    return File(openImpl(path ? path : "/", mode));
+}
+
+bool FS::exists(const char *path) {
+    if (!sdMounted) return false;
+    struct stat st;
+    return stat(simSdHostPath(path).c_str(), &st) == 0;
+}
+
+bool FS::remove(const char *path) {
+    return sdMounted && unlink(simSdHostPath(path).c_str()) == 0;
+}
+
+bool FS::rename(const char *from, const char *to) {
+    return sdMounted && ::rename(simSdHostPath(from).c_str(), simSdHostPath(to).c_str()) == 0;
+}
+
+bool FS::mkdir(const char *path) {
+    return sdMounted && ::mkdir(simSdHostPath(path).c_str(), 0755) == 0;
+}
+
+bool FS::rmdir(const char *path) {
+    return sdMounted && ::rmdir(simSdHostPath(path).c_str()) == 0;
+}
+
+// ==================== SD Card ====================
+bool SDFS::begin(uint8_t ssPin, SPIClass &spi, uint32_t frequency, const char *mountpoint,
+                 uint8_t max_files, bool format_if_empty) {
+    sdMounted = !sdRoot.empty();
+    return sdMounted;
+}
+
+void SDFS::end() {
+    sdMounted = false;
+}
+
+sdcard_type_t SDFS::cardType() {
+    return sdMounted ? CARD_SDHC : CARD_NONE;
+}
+
+uint64_t SDFS::cardSize() {
+    return sdMounted ? SIM_CARD_BYTES : 0;
+}
+
+uint64_t SDFS::totalBytes() {
+    return cardSize();
+}
+
+static uint64_t usedBytesIn(const std::string &dir) {
+    uint64_t total = 0;
+    DIR *d = opendir(dir.c_str());
+    if (!d) return 0;
+    while (struct dirent *e = readdir(d)) {
+        std::string name = e->d_name;
+        if (name == "." || name == "..") continue;
+        std::string child = dir + "/" + name;
+        struct stat st;
+        if (stat(child.c_str(), &st) != 0) continue;
+        total += S_ISDIR(st.st_mode) ? usedBytesIn(child) : (uint64_t)st.st_size;
+    }
+    closedir(d);
+    return total;
+}
+
+uint64_t SDFS::usedBytes() {
+    return sdMounted ? usedBytesIn(sdRoot) : 0;
+}
+
+} // namespace fs
@@ -0,0 +1,378 @@
+// Decoder fuzzing: truncates and bit-flips JPEG, PNG and BMP files, decodes
+// each through imageDecodeSd and checks that it returns a DecodeResult
+// within the decode time budget, with every block inside the image and the
+// decode arena released. The PNG and BMP decoders are the firmware's own;
+// JPEG entropy decoding is the host stand-in, so for JPEG this covers the
+// parsing, band split and parallel decode around it.
+//
+// Runs are reproducible: case n of a seed file is the same mutation every
+// time. A crash prints the case it was decoding.
+
+#include <chrono>    // Ahead of Arduino.h and its abs() macro
+#include "sim.h"
+#include "sim_jpeg.h"
+#include <Arduino.h>
+#include "../../src/config.h"
+#include "../../src/budget.h"
+#include "../../src/decoder.h"
+#include "../../src/benchimage.h"
+#include <SD.h>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <unistd.h>
+#include <zlib.h>
+
+// A decode may finish the block it is on after the budget runs out
+#define FUZZ_BUDGET_SLACK_MS 100
+#define FUZZ_HEADER_BYTES 128     // Where header mutations land
+
+static double wallMs() {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// ==================== Seed Files ====================
+// Odd sizes, so partial blocks and rows at the edges are covered too
+#define SEED_WIDTH 97
+#define SEED_HEIGHT 61
+
+struct Seed {
+    const char *name;
+    std::vector<uint8_t> data;
+};
+
+static uint8_t seedSample(int x, int y, int c) {
+    return (uint8_t)(x * 5 + y * 3 + c * 80 + ((x * 7919 + y * 104729) % 23));
+}
+
+// Baseline with a restart marker every MCU row, so the file splits across cores
+static std::vector<uint8_t> jpegSeed() {
+    const int width = 321, height = 243;
+    std::vector<uint8_t> rgb(width * height * 3);
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            for (int c = 0; c < 3; c++) rgb[(y * width + x) * 3 + c] = seedSample(x, y, c);
+        }
+    }
+    return simJpegEncode(rgb.data(), width, height, 80, 1);
+}
+
+static void putBE32(std::vector<uint8_t> &v, uint32_t x) {
+    for (int shift = 24; shift >= 0; shift -= 8) v.push_back(x >> shift);
+}
+
+static void pngChunk(std::vector<uint8_t> &png, const char *type, const std::vector<uint8_t> &body) {
+    putBE32(png, body.size());
+    size_t start = png.size();
+    png.insert(png.end(), type, type + 4);
+    png.insert(png.end(), body.begin(), body.end());
+    putBE32(png, crc32(0, png.data() + start, png.size() - start));
+}
+
+// Any bytes unfilter to some image, so rows cycle through all five filters
+static std::vector<uint8_t> pngSeed(uint8_t colorType, uint8_t depth) {
+    static const uint8_t channels[7] = {1, 0, 3, 1, 2, 0, 4};
+    uint32_t stride = (SEED_WIDTH * channels[colorType] * depth + 7) / 8;
+    std::vector<uint8_t> raw;
+    for (int y = 0; y < SEED_HEIGHT; y++) {
+        raw.push_back(y % 5);
+        for (uint32_t i = 0; i < stride; i++) raw.push_back(seedSample(i, y, 0));
+    }
+    
+    uLongf packedSize = compressBound(raw.size());
+    std::vector<uint8_t> packed(packedSize);
+    compress2(packed.data(), &packedSize, raw.data(), raw.size(), 6);
+    packed.resize(packedSize);
+    
+    std::vector<uint8_t> png = {0x89, 'P', 'N', 'G', 0x0D, 0x0A, 0x1A, 0x0A};
+    std::vector<uint8_t> ihdr;
+    putBE32(ihdr, SEED_WIDTH);
+    putBE32(ihdr, SEED_HEIGHT);
+    ihdr.insert(ihdr.end(), {depth, colorType, 0, 0, 0});
+    pngChunk(png, "IHDR", ihdr);
+    if (colorType == 3) {
+        std::vector<uint8_t> palette;
+        for (int i = 0; i < (1 << depth) * 3; i++) palette.push_back(seedSample(i, 0, 1));
+        pngChunk(png, "PLTE", palette);
+    }
+    
+    // Two IDATs, so a refill crosses a chunk boundary
+    size_t half = packed.size() / 2;
+    pngChunk(png, "IDAT", std::vector<uint8_t>(packed.begin(), packed.begin() + half));
+    pngChunk(png, "IDAT", std::vector<uint8_t>(packed.begin() + half, packed.end()));
+    pngChunk(png, "IEND", {});
+    return png;
+}
+
+static void putLE(std::vector<uint8_t> &v, uint32_t x, int bytes) {
+    for (int i = 0; i < bytes; i++) v.push_back(x >> (i * 8));
+}
+
+// 8-bit files carry a palette, 16-bit ones BI_BITFIELDS masks; topDown
+// stores a negative height
+static std::vector<uint8_t> bmpSeed(uint16_t bits, bool topDown) {
+    uint32_t stride = ((SEED_WIDTH * bits + 31) / 32) * 4;
+    uint32_t extra = bits == 8 ? 256 * 4 : bits == 16 ? 12 : 0;
+    uint32_t offset = 14 + 40 + extra;
+    
+    std::vector<uint8_t> bmp = {'B', 'M'};
+    putLE(bmp, offset + stride * SEED_HEIGHT, 4);
+    putLE(bmp, 0, 4);
+    putLE(bmp, offset, 4);
+    putLE(bmp, 40, 4);
+    putLE(bmp, SEED_WIDTH, 4);
+    putLE(bmp, topDown ? -SEED_HEIGHT : SEED_HEIGHT, 4);
+    putLE(bmp, 1, 2);
+    putLE(bmp, bits, 2);
+    putLE(bmp, bits == 16 ? 3 : 0, 4);
+    putLE(bmp, stride * SEED_HEIGHT, 4);
+    putLE(bmp, 2835, 4);
+    putLE(bmp, 2835, 4);
+    putLE(bmp, bits == 8 ? 256 : 0, 4);
+    putLE(bmp, 0, 4);
+    
+    if (bits == 8) {
+        for (int i = 0; i < 256; i++) putLE(bmp, seedSample(i, 0, 2) * 0x010101u, 4);
+    } else if (bits == 16) {
+        putLE(bmp, 0xF800, 4);
+        putLE(bmp, 0x07E0, 4);
+        putLE(bmp, 0x001F, 4);
+    }
+    for (int y = 0; y < SEED_HEIGHT; y++) {
+        for (uint32_t i = 0; i < stride; i++) bmp.push_back(seedSample(i, y, 2));
+    }
+    return bmp;
+}
+
+static std::vector<Seed> makeSeeds() {
+    std::vector<Seed> seeds;
+    seeds.push_back({"bench.jpg", std::vector<uint8_t>(benchImageJpeg, benchImageJpeg + sizeof(benchImageJpeg))});
+    seeds.push_back({"restart.jpg", jpegSeed()});
+    seeds.push_back({"rgb8.png", pngSeed(2, 8)});
+    seeds.push_back({"palette4.png", pngSeed(3, 4)});
+    seeds.push_back({"rgba16.png", pngSeed(6, 16)});
+    seeds.push_back({"gray1.png", pngSeed(0, 1)});
+    seeds.push_back({"rgb24.bmp", bmpSeed(24, false)});
+    seeds.push_back({"palette8.bmp", bmpSeed(8, true)});
+    seeds.push_back({"bitfields16.bmp", bmpSeed(16, false)});
+    return seeds;
+}
+
+// ==================== Mutations ====================
+// Small and self-contained, so case n means the same bytes on any host
+static uint32_t rngState;
+
+static uint32_t rngNext() {
+    rngState ^= rngState << 13;
+    rngState ^= rngState >> 17;
+    rngState ^= rngState << 5;
+    return rngState;
+}
+
+static std::string mutate(std::vector<uint8_t> &data, uint32_t seedIndex, int n) {
+    rngState = 0x9E3779B9u ^ (seedIndex * 0x85EBCA6Bu) ^ (n * 0xC2B2AE35u);
+    if (!rngState) rngState = 1;
+    
+    char what[96];
+    uint32_t kind = rngNext() % 4;
+    if (kind == 0) {
+        size_t length = rngNext() % data.size();
+        data.resize(length);
+        snprintf(what, sizeof(what), "cut at %zu", length);
+        return what;
+    }
+    
+    // Flips anywhere, flips in the headers, or a header byte set to an extreme
+    int count = 1 + rngNext() % 4;
+    std::string desc = kind == 3 ? "set" : "flip";
+    for (int i = 0; i < count; i++) {
+        size_t span = kind == 1 ? data.size() : std::min<size_t>(data.size(), FUZZ_HEADER_BYTES);
+        size_t at = rngNext() % span;
+        if (kind == 3) {
+            static const uint8_t extremes[4] = {0x00, 0xFF, 0x7F, 0x80};
+            data[at] = extremes[rngNext() % 4];
+            snprintf(what, sizeof(what), " %zu=%02x", at, data[at]);
+        } else {
+            int bit = rngNext() % 8;
+            data[at] ^= 1 << bit;
+            snprintf(what, sizeof(what), " %zu.%d", at, bit);
+        }
+        desc += what;
+    }
+    return desc;
+}
+
+// ==================== Checks ====================
+struct FuzzSink {
+    uint16_t width;     // At the decode scale; 0 when the size is unknown
+    uint16_t height;
+    uint32_t blocks;
+    bool outside;
+};
+
+static bool checkBlock(void *ctx, int16_t x, int16_t y, uint16_t w, uint16_t h, const uint8_t *rgb) {
+    FuzzSink *sink = (FuzzSink *)ctx;
+    sink->blocks++;
+    if (x < 0 || y < 0 || w == 0 || h == 0 || w > 16 || h > 16) sink->outside = true;
+    if (sink->width && (x + w > sink->width || y + h > sink->height)) sink->outside = true;
+    
+    // Touch every byte, so a short buffer shows under a memory checker
+    uint32_t sum = 0;
+    for (uint32_t i = 0; i < (uint32_t)w * h * 3; i++) sum += rgb[i];
+    return sum != 0xFFFFFFFF;
+}
+
+// Names the case being decoded if a decoder crashes
+static char currentCase[160];
+
+static void crashHandler(int sig) {
+    static const char prefix[] = "fuzz: crashed on ";
+    if (write(STDERR_FILENO, prefix, sizeof(prefix) - 1) < 0 ||
+        write(STDERR_FILENO, currentCase, strlen(currentCase)) < 0 ||
+        write(STDERR_FILENO, "\n", 1) < 0) {
+        // Nothing left to report to
+    }
+    signal(sig, SIG_DFL);
+    raise(sig);
+}
+
+struct FormatTally {
+    const char *decoder;
+    uint32_t cases;
+    uint32_t results[DECODE_UNSUPPORTED + 1];
+    double maxVirtualMs;
+    double maxWallMs;
+};
+
+static bool writeCard(const char *path, const std::vector<uint8_t> &data) {
+    FILE *f = fopen(simSdHostPath(path).c_str(), "wb");
+    if (!f) return false;
+    bool ok = fwrite(data.data(), 1, data.size(), f) == data.size();
+    return fclose(f) == 0 && ok;
+}
+
+// Decodes one file; returns false and says why if a check fails
+static bool runCase(const char *path, uint8_t scale, FormatTally &tally, std::string &why) {
+    uint16_t width = 0, height = 0;
+    FuzzSink sink = {};
+    if (imageGetSdSize(&width, &height, path) == DECODE_OK) {
+        sink.width = (width + (1 << scale) - 1) >> scale;
+        sink.height = (height + (1 << scale) - 1) >> scale;
+    }
+    
+    uint64_t virtualStart = simNowUs();
+    double wallStart = wallMs();
+    decodeSetBudget(DECODE_TIME_BUDGET);
+    int res = imageDecodeSd(path, scale, checkBlock, &sink);
+    decodeSetBudget(0);
+    double virtualMs = (simNowUs() - virtualStart) / 1000.0;
+    double wall = wallMs() - wallStart;
+    
+    tally.cases++;
+    tally.maxVirtualMs = std::max(tally.maxVirtualMs, virtualMs);
+    tally.maxWallMs = std::max(tally.maxWallMs, wall);
+    if (res >= DECODE_OK && res <= DECODE_UNSUPPORTED) tally.results[res]++;
+    
+    char buf[128];
+    if (res < DECODE_OK || res > DECODE_UNSUPPORTED) {
+        snprintf(buf, sizeof(buf), "result %d is not a DecodeResult", res);
+    } else if (virtualMs > DECODE_TIME_BUDGET + FUZZ_BUDGET_SLACK_MS || wall > DECODE_TIME_BUDGET + FUZZ_BUDGET_SLACK_MS) {
+        snprintf(buf, sizeof(buf), "took %.0f ms virtual, %.0f ms wall", virtualMs, wall);
+    } else if (sink.outside) {
+        snprintf(buf, sizeof(buf), "block outside the %ux%u image", sink.width, sink.height);
+    } else if (arenaStats(ARENA_DECODE).used != 0) {
+        snprintf(buf, sizeof(buf), "left %u bytes of the decode arena in use", arenaStats(ARENA_DECODE).used);
+    } else {
+        return true;
+    }
+    why = buf;
+    return false;
+}
+
+// ==================== Driver ====================
+int simFuzz(int casesPerSeed) {
+    char root[] = "/tmp/photoframe-fuzz-XXXXXX";
+    if (casesPerSeed <= 0 || !mkdtemp(root) || !simSdSetRoot(root) || !SD.begin() || !budgetBegin()) {
+        fprintf(stderr, "cannot set up the scratch card\n");
+        return 2;
+    }
+    simSchedulerInit();
+    signal(SIGSEGV, crashHandler);
+    signal(SIGABRT, crashHandler);
+    signal(SIGFPE, crashHandler);
+    signal(SIGBUS, crashHandler);
+    
+    std::vector<Seed> seeds = makeSeeds();
+    std::vector<FormatTally> tallies;
+    uint32_t failures = 0;
+    
+    for (uint32_t s = 0; s < seeds.size(); s++) {
+        const Seed &seed = seeds[s];
+        std::string path = std::string("/") + seed.name;
+        
+        // Case -1 is the seed itself, which must decode
+        for (int n = -1; n < casesPerSeed; n++) {
+            std::vector<uint8_t> data = seed.data;
+            std::string what = n < 0 ? "unmodified" : mutate(data, s, n);
+            uint8_t scale = n < 0 ? 0 : rngNext() % 4;
+            snprintf(currentCase, sizeof(currentCase), "%s case %d scale %u: %s", seed.name, n, scale, what.c_str());
+            if (!writeCard(path.c_str(), data)) {
+                fprintf(stderr, "cannot write %s\n", path.c_str());
+                return 2;
+            }
+            
+            FormatTally scratch = {};
+            std::string why;
+            bool passed = runCase(path.c_str(), scale, scratch, why);
+            if (n < 0 && passed && scratch.results[DECODE_OK] != 1) {
+                passed = false;
+                why = "the seed does not decode";
+            }
+            
+            // Fold into the tally of the decoder that took the file
+            const char *decoder = lastDecodeStats().decoder;
+            FormatTally *tally = nullptr;
+            for (FormatTally &t : tallies) {
+                if (strcmp(t.decoder, decoder) == 0) tally = &t;
+            }
+            if (!tally) {
+                tallies.push_back(FormatTally{decoder});
+                tally = &tallies.back();
+            }
+            tally->cases += scratch.cases;
+            for (int r = 0; r <= DECODE_UNSUPPORTED; r++) tally->results[r] += scratch.results[r];
+            tally->maxVirtualMs = std::max(tally->maxVirtualMs, scratch.maxVirtualMs);
+            tally->maxWallMs = std::max(tally->maxWallMs, scratch.maxWallMs);
+            
+            if (!passed) {
+                failures++;
+                printf("FAIL %s: %s\n", currentCase, why.c_str());
+                char kept[96];
+                snprintf(kept, sizeof(kept), "/fail-%u-%d-%s", s, n, seed.name);
+                writeCard(kept, data);
+            }
+        }
+    }
+    
+    printf("fuzz: %zu seeds, %d cases each, decode budget %d ms\n", seeds.size(), casesPerSeed, DECODE_TIME_BUDGET);
+    for (const FormatTally &t : tallies) {
+        printf("  %-5s %6u cases: %u ok, %u interrupted, %u read, %u memory, %u parameter, %u corrupt,"
+               " %u structure, %u unsupported; max %.1f ms virtual, %.1f ms wall\n",
+               t.decoder, t.cases, t.results[DECODE_OK], t.results[DECODE_INTERRUPTED], t.results[DECODE_READ_ERROR],
+               t.results[DECODE_NO_MEMORY] + t.results[DECODE_NO_MEMORY_INPUT], t.results[DECODE_BAD_PARAMETER],
+               t.results[DECODE_CORRUPT], t.results[DECODE_BAD_STRUCTURE], t.results[DECODE_UNSUPPORTED],
+               t.maxVirtualMs, t.maxWallMs);
+    }
+    
+    if (failures) {
+        printf("fuzz: %u failures, files kept in %s\n", failures, root);
+        return 1;
+    }
+    printf("fuzz: ok\n");
+    std::string cleanup = std::string("rm -rf ") + root;
+    if (system(cleanup.c_str()) != 0) fprintf(stderr, "could not remove %s\n", root);
+    return 0;
+}
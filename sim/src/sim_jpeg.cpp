@@ -0,0 +1,162 @@
+// Baseline JPEG decoding for the simulator. Progressive files are rejected
+// the same way tjpgd rejects them, and decode time is charged from the cost
+// model rather than measured, so runs are reproducible on any host.
+
+#include "sim_jpeg.h"
+#include "sim.h"
+#include <cstdio>
+#include <cstdlib>
+#include <csetjmp>
+#include <cstring>
+#include <algorithm>
+#include <jpeglib.h>
+
+struct SimJpegError {
+    jpeg_error_mgr mgr;
+    jmp_buf jump;
+};
+
+static void errorExit(j_common_ptr cinfo) {
+    longjmp(((SimJpegError *)cinfo->err)->jump, 1);
+}
+
+static void quietMessage(j_common_ptr cinfo) {
+}
+
+// Decoding at 1/8 only touches DC coefficients, so it is much cheaper
+static const double scaleCost[4] = {1.0, 0.6, 0.45, 0.3};
+
+static int readHeader(jpeg_decompress_struct &cinfo, const std::vector<uint8_t> &data, SimJpegInfo &info) {
+    if (data.size() < 4 || data[0] != 0xFF || data[1] != 0xD8) return SIM_JDR_FMT1;
+    
+    jpeg_mem_src(&cinfo, data.data(), data.size());
+    if (jpeg_read_header(&cinfo, TRUE) != JPEG_HEADER_OK) return SIM_JDR_INP;
+    
+    info.width = cinfo.image_width;
+    info.height = cinfo.image_height;
+    info.msx = cinfo.num_components == 1 ? 1 : cinfo.comp_info[0].h_samp_factor;
+    info.msy = cinfo.num_components == 1 ? 1 : cinfo.comp_info[0].v_samp_factor;
+    info.progressive = cinfo.progressive_mode;
+    
+    if (info.progressive) return SIM_JDR_FMT3;
+    if (cinfo.num_components != 1 && cinfo.num_components != 3) return SIM_JDR_FMT3;
+    if (info.msx > 2 || info.msy > 2) return SIM_JDR_FMT3;
+    return SIM_JDR_OK;
+}
+
+int simJpegInfo(const std::vector<uint8_t> &data, SimJpegInfo &info) {
+    jpeg_decompress_struct cinfo;
+    SimJpegError err;
+    cinfo.err = jpeg_std_error(&err.mgr);
+    err.mgr.error_exit = errorExit;
+    err.mgr.output_message = quietMessage;
+    
+    if (setjmp(err.jump)) {
+        jpeg_destroy_decompress(&cinfo);
+        return SIM_JDR_FMT1;
+    }
+    
+    jpeg_create_decompress(&cinfo);
+    int res = readHeader(cinfo, data, info);
+    jpeg_destroy_decompress(&cinfo);
+    return res;
+}
+
+int simJpegDecode(const std::vector<uint8_t> &data, uint8_t scale, SimJpegSink sink) {
+    jpeg_decompress_struct cinfo;
+    SimJpegError err;
+    cinfo.err = jpeg_std_error(&err.mgr);
+    err.mgr.error_exit = errorExit;
+    err.mgr.output_message = quietMessage;
+    
+    // Everything touched after setjmp lives on the heap or in cinfo
+    std::vector<uint8_t> band;
+    std::vector<uint8_t> block;
+    
+    if (setjmp(err.jump)) {
+        jpeg_destroy_decompress(&cinfo);
+        return SIM_JDR_FMT1;
+    }
+    
+    jpeg_create_decompress(&cinfo);
+    SimJpegInfo info;
+    int res = readHeader(cinfo, data, info);
+    if (res != SIM_JDR_OK) {
+        jpeg_destroy_decompress(&cinfo);
+        return res;
+    }
+    
+    scale &= 3;
+    cinfo.out_color_space = JCS_RGB;
+    cinfo.scale_num = 1;
+    cinfo.scale_denom = 1 << scale;
+    cinfo.dct_method = JDCT_ISLOW;
+    // tjpgd replicates chroma inside each MCU; fancy upsampling would blend
+    // across MCU rows and make band splits visible
+    cinfo.do_fancy_upsampling = FALSE;
+    jpeg_start_decompress(&cinfo);
+    
+    int outW = cinfo.output_width;
+    int outH = cinfo.output_height;
+    int mcuW = (8 * info.msx) >> scale;
+    int mcuH = (8 * info.msy) >> scale;
+    double rowCostUs = (double)info.width * (8 * info.msy) * simCosts.decodeNsPerPixel * scaleCost[scale] / 1000.0;
+    
+    band.resize((size_t)outW * mcuH * 3);
+    block.resize((size_t)mcuW * mcuH * 3);
+    
+    res = SIM_JDR_OK;
+    for (int y = 0; y < outH && res == SIM_JDR_OK; y += mcuH) {
+        int rows = std::min(mcuH, outH - y);
+        for (int r = 0; r < rows; r++) {
+            JSAMPROW row = band.data() + (size_t)r * outW * 3;
+            jpeg_read_scanlines(&cinfo, &row, 1);
+        }
+        simAdvanceCoreUs(rowCostUs);
+        
+        for (int x = 0; x < outW; x += mcuW) {
+            int cols = std::min(mcuW, outW - x);
+            for (int r = 0; r < rows; r++) {
+                memcpy(block.data() + (size_t)r * cols * 3, band.data() + ((size_t)r * outW + x) * 3, cols * 3);
+            }
+            if (!sink(x, y, cols, rows, block.data())) {
+                res = SIM_JDR_INTR;
+                break;
+            }
+        }
+    }
+    
+    // Finishing would complain about unread scanlines after an interrupt
+    jpeg_destroy_decompress(&cinfo);
+    return res;
+}
+
+std::vector<uint8_t> simJpegEncode(const uint8_t *rgb, int width, int height, int quality, int restartRows) {
+    jpeg_compress_struct cinfo;
+    jpeg_error_mgr err;
+    cinfo.err = jpeg_std_error(&err);
+    jpeg_create_compress(&cinfo);
+    
+    unsigned char *out = nullptr;
+    unsigned long size = 0;
+    jpeg_mem_dest(&cinfo, &out, &size);
+    cinfo.image_width = width;
+    cinfo.image_height = height;
+    cinfo.input_components = 3;
+    cinfo.in_color_space = JCS_RGB;
+    jpeg_set_defaults(&cinfo);
+    jpeg_set_quality(&cinfo, quality, TRUE);
+    cinfo.restart_in_rows = restartRows;
+    jpeg_start_compress(&cinfo, TRUE);
+    
+    while (cinfo.next_scanline < cinfo.image_height) {
+        JSAMPROW row = (JSAMPROW)rgb + (size_t)cinfo.next_scanline * width * 3;
+        jpeg_write_scanlines(&cinfo, &row, 1);
+    }
+    jpeg_finish_compress(&cinfo);
+    jpeg_destroy_compress(&cinfo);
+    
+    std::vector<uint8_t> data(out, out + size);
+    free(out);
+    return data;
+}
@@ -0,0 +1,45 @@
+#ifndef SIM_JPEG_H
+#define SIM_JPEG_H
+
+// libjpeg-backed decoding behind the ROM tjpgd model.
+// Results use the tjpgd JRESULT numbering so the wrapper can pass them
+// through unchanged.
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+enum {
+    SIM_JDR_OK = 0,
+    SIM_JDR_INTR,
+    SIM_JDR_INP,
+    SIM_JDR_MEM1,
+    SIM_JDR_MEM2,
+    SIM_JDR_PAR,
+    SIM_JDR_FMT1,
+    SIM_JDR_FMT2,
+    SIM_JDR_FMT3
+};
+
+struct SimJpegInfo {
+    uint16_t width;
+    uint16_t height;
+    uint8_t msx;  // MCU size in 8-pixel blocks
+    uint8_t msy;
+    bool progressive;
+};
+
+// Receives one block of packed RGB888; returning false interrupts the decode
+typedef std::function<bool(int x, int y, int w, int h, const uint8_t *rgb)> SimJpegSink;
+
+int simJpegInfo(const std::vector<uint8_t> &data, SimJpegInfo &info);
+
+// Decodes at 1/(1 << scale) and hands out MCU-sized blocks in raster order,
+// charging virtual decode time per MCU row
+int simJpegDecode(const std::vector<uint8_t> &data, uint8_t scale, SimJpegSink sink);
+
+// Baseline 4:2:0 file from packed RGB888, with a restart marker every
+// restartRows MCU rows (0: none), for test input
+std::vector<uint8_t> simJpegEncode(const uint8_t *rgb, int width, int height, int quality, int restartRows);
+
+#endif // SIM_JPEG_H
@@ -0,0 +1,231 @@
+// Simulator entry point: mounts a host directory as the SD card, runs the
+// unmodified firmware setup()/loop() on the virtual clock and replays a
+// timed input script against it.
+//
+//   photoframe-sim --sd DIR [--script FILE] [--out DIR] [--run-ms N]
+//       [--sd-bytes-per-us X] [--decode-ns-per-pixel X] [--blit-ns-per-pixel X]
+//       [--copy-ns-per-pixel X] [--sd-stall-ms X]
+//   photoframe-sim --bench letterbox|playlist
+//   photoframe-sim --fuzz N     N truncated or bit-flipped copies of each
+//                               seed image through the decoders
+//
+// Script lines are "<time_ms> <command> [args]", times counted from boot:
+//   press <ms>              hold the BOOT button for <ms>
+//   tap <x> <y> [ms]        touch the screen at (x, y), 80 ms unless given
+//   swipe <x0> <y0> <x1> <y1> [ms]
+//                           drag a finger across the screen, 200 ms unless given
+//   serial <text>           send <text> plus newline to the serial port
+//   upload <host> <card> [cut <bytes>] [flip <n>]
+//                           send a host file with the serial upload protocol;
+//                           cut drops the link after <bytes> of data, flip
+//                           corrupts every <n>th data frame
+//   dump [name]             write the visible screen to <out>/<name>.ppm
+//   sd add <host> <card>    copy a host file onto the card
+//   sd rm <card>            delete a file from the card
+//   quit                    stop the run and print the summary
+
+#include "sim.h"
+#include <Arduino.h>
+#include "../../src/config.h"
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <vector>
+
+void setup();
+void loop();
+
+SimCosts simCosts;
+
+struct ScriptLine {
+    uint64_t atMs;
+    std::string cmd;
+    std::string args;
+    int line;
+};
+
+static std::vector<ScriptLine> script;
+static std::string outDir = ".";
+static uint64_t runMs = 0;
+static int dumpCount = 0;
+
+// ==================== Run Control ====================
+void simLog(const char *fmt, ...) {
+    fprintf(stderr, "[sim %9.3f %-10s] ", simNowUs() / 1e6, simCurrentTaskName());
+    va_list args;
+    va_start(args, fmt);
+    vfprintf(stderr, fmt, args);
+    va_end(args);
+    fputc('\n', stderr);
+}
+
+void simQuit(int code) {
+    fflush(stdout);
+    simDisplayReport();
+    simSerialReport();
+    simHeapReport();
+    simLog("run ended after %.3f s virtual time", simNowUs() / 1e6);
+    fflush(stderr);
+    exit(code);
+}
+
+// ==================== Script ====================
+static bool loadScript(const char *path) {
+    std::ifstream in(path);
+    if (!in) return false;
+    
+    std::string text;
+    int lineNo = 0;
+    while (std::getline(in, text)) {
+        lineNo++;
+        size_t hash = text.find('#');
+        if (hash != std::string::npos) text.erase(hash);
+        
+        std::istringstream ss(text);
+        ScriptLine line;
+        if (!(ss >> line.atMs >> line.cmd)) continue;
+        std::getline(ss, line.args);
+        size_t start = line.args.find_first_not_of(" \t");
+        line.args = start == std::string::npos ? "" : line.args.substr(start);
+        line.line = lineNo;
+        script.push_back(line);
+    }
+    return true;
+}
+
+static bool copyHostFile(const std::string &from, const std::string &to) {
+    std::ifstream in(from, std::ios::binary);
+    std::ofstream out(to, std::ios::binary);
+    if (!in || !out) return false;
+    out << in.rdbuf();
+    return true;
+}
+
+static void runLine(const ScriptLine &line) {
+    std::istringstream ss(line.args);
+    
+    if (line.cmd == "press") {
+        uint32_t ms = 100;
+        ss >> ms;
+        uint64_t down = simNowUs();
+        simSetButton(BOOT_BUTTON_PIN, true);
+        // A long press acts while held, a short one on release
+        if (ms > LONG_PRESS_TIME) {
+            simSleepUntilUs(down + LONG_PRESS_TIME * 1000ULL);
+            simNoteInput("long press");
+        }
+        simSleepUntilUs(down + (uint64_t)ms * 1000);
+        simSetButton(BOOT_BUTTON_PIN, false);
+        if (ms <= LONG_PRESS_TIME) simNoteInput("short press");
+    } else if (line.cmd == "tap") {
+        int x = 0, y = 0;
+        uint32_t ms = 80;
+        ss >> x >> y >> ms;
+        simTouchStroke(x, y, x, y, ms);
+    } else if (line.cmd == "swipe") {
+        int x0 = 0, y0 = 0, x1 = 0, y1 = 0;
+        uint32_t ms = 200;
+        ss >> x0 >> y0 >> x1 >> y1 >> ms;
+        simTouchStroke(x0, y0, x1, y1, ms);
+    } else if (line.cmd == "serial") {
+        simSerialInject(line.args + "\n");
+        simNoteInput("serial");
+    } else if (line.cmd == "upload") {
+        std::string host, card, option;
+        uint32_t cut = 0, flip = 0, value;
+        ss >> host >> card;
+        while (ss >> option >> value) {
+            if (option == "cut") cut = value;
+            else if (option == "flip") flip = value;
+        }
+        simNoteInput("upload");
+        simUpload(host, card, cut, flip);
+    } else if (line.cmd == "dump") {
+        std::string name;
+        if (!(ss >> name)) name = "frame" + std::to_string(dumpCount);
+        dumpCount++;
+        simDisplayDump(outDir + "/" + name + ".ppm");
+    } else if (line.cmd == "sd") {
+        std::string op, a, b;
+        ss >> op >> a >> b;
+        if (op == "add" && copyHostFile(a, simSdHostPath(b.c_str()))) {
+            simLog("card: added %s", b.c_str());
+        } else if (op == "rm" && remove(simSdHostPath(a.c_str()).c_str()) == 0) {
+            simLog("card: removed %s", a.c_str());
+        } else {
+            simLog("script line %d: sd %s failed", line.line, line.args.c_str());
+        }
+    } else if (line.cmd == "quit") {
+        simQuit(0);
+    } else {
+        simLog("script line %d: unknown command '%s'", line.line, line.cmd.c_str());
+    }
+}
+
+static void scriptTask(void *arg) {
+    for (const ScriptLine &line : script) {
+        simSleepUntilUs(line.atMs * 1000);
+        runLine(line);
+    }
+    if (runMs) {
+        simSleepUntilUs(runMs * 1000);
+        simQuit(0);
+    }
+}
+
+// ==================== Entry Point ====================
+static void usage() {
+    fprintf(stderr,
+            "usage: photoframe-sim --sd DIR [--script FILE] [--out DIR] [--run-ms N]\n"
+            "                      [--sd-bytes-per-us X] [--decode-ns-per-pixel X] [--blit-ns-per-pixel X]\n"
+            "                      [--copy-ns-per-pixel X] [--sd-stall-ms X]\n"
+            "       photoframe-sim --bench letterbox|playlist\n"
+            "       photoframe-sim --fuzz N\n");
+    exit(2);
+}
+
+int main(int argc, char **argv) {
+    const char *sdDir = nullptr;
+    
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (i + 1 >= argc) usage();
+        const char *val = argv[++i];
+        if (arg == "--sd") sdDir = val;
+        else if (arg == "--script") {
+            if (!loadScript(val)) {
+                fprintf(stderr, "cannot read script %s\n", val);
+                return 2;
+            }
+        }
+        else if (arg == "--out") outDir = val;
+        else if (arg == "--run-ms") runMs = strtoull(val, nullptr, 10);
+        else if (arg == "--sd-bytes-per-us") simCosts.sdBytesPerUs = atof(val);
+        else if (arg == "--decode-ns-per-pixel") simCosts.decodeNsPerPixel = atof(val);
+        else if (arg == "--blit-ns-per-pixel") simCosts.blitNsPerPixel = atof(val);
+        else if (arg == "--copy-ns-per-pixel") simCosts.copyNsPerPixel = atof(val);
+        else if (arg == "--sd-stall-ms") simCosts.sdStallUs = atof(val) * 1000;
+        else if (arg == "--bench") return simBench(val);
+        else if (arg == "--fuzz") return simFuzz(atoi(val));
+        else usage();
+    }
+    
+    if (!sdDir || !simSdSetRoot(sdDir)) {
+        fprintf(stderr, "--sd must name an existing directory\n");
+        return 2;
+    }
+    // Without a script or limit, run a minute of device time
+    if (script.empty() && !runMs) runMs = 60000;
+    
+    setvbuf(stdout, nullptr, _IOLBF, 0);
+    simSchedulerInit();
+    simStartTask(scriptTask, nullptr, "script");
+    
+    setup();
+    for (;;) {
+        loop();
+    }
+}
@@ -0,0 +1,42 @@
+// tinfl_decompress() on zlib. zlib keeps its own window, so the caller's
+// wrapping output buffer is only ever written forward, as with the ROM.
+// Decompressors are often fresh mallocs, so streams are kept by address
+// rather than inside the struct.
+
+#include <esp32s3/rom/miniz.h>
+#include <zlib.h>
+#include <map>
+
+static std::map<tinfl_decompressor *, z_stream *> streams;
+
+tinfl_status tinfl_decompress(tinfl_decompressor *r, const mz_uint8 *pIn_buf_next, size_t *pIn_buf_size,
+                              mz_uint8 *pOut_buf_start, mz_uint8 *pOut_buf_next, size_t *pOut_buf_size,
+                              const mz_uint32 decomp_flags) {
+    z_stream *&zs = streams[r];
+    if (r->m_state == 0) {
+        // tinfl_init() only resets the state; drop any stream left from before
+        if (zs) {
+            inflateEnd(zs);
+        } else {
+            zs = new z_stream();
+        }
+        *zs = z_stream();
+        int windowBits = (decomp_flags & TINFL_FLAG_PARSE_ZLIB_HEADER) ? 15 : -15;
+        if (inflateInit2(zs, windowBits) != Z_OK) return TINFL_STATUS_FAILED;
+        r->m_state = 1;
+    }
+    
+    zs->next_in = (Bytef *)pIn_buf_next;
+    zs->avail_in = (uInt)*pIn_buf_size;
+    zs->next_out = pOut_buf_next;
+    zs->avail_out = (uInt)*pOut_buf_size;
+    
+    int ret = inflate(zs, Z_NO_FLUSH);
+    *pIn_buf_size -= zs->avail_in;
+    *pOut_buf_size -= zs->avail_out;
+    
+    if (ret == Z_STREAM_END) return TINFL_STATUS_DONE;
+    if (ret != Z_OK && ret != Z_BUF_ERROR) return TINFL_STATUS_FAILED;
+    if (zs->avail_out == 0) return TINFL_STATUS_HAS_MORE_OUTPUT;
+    return (decomp_flags & TINFL_FLAG_HAS_MORE_INPUT) ? TINFL_STATUS_NEEDS_MORE_INPUT : TINFL_STATUS_FAILED;
+}
@@ -0,0 +1,95 @@
+// ROM tjpgd model. jd_prepare pulls only the header segments through the
+// caller's input function, as the real decoder does, so size queries cost
+// what they cost on the device; jd_decomp pulls the entropy data and then
+// decodes it with libjpeg.
+
+#include "sim.h"
+#include "sim_jpeg.h"
+#include <esp32s3/rom/tjpgd.h>
+#include <cstring>
+#include <map>
+
+#define SIM_TJPGD_CHUNK 512  // tjpgd input buffer size
+
+// Header bytes consumed by jd_prepare, keyed by decoder object
+static std::map<JDEC *, std::vector<uint8_t>> prepared;
+
+static bool pull(JDEC *jd, std::vector<uint8_t> &buf, size_t n) {
+    size_t at = buf.size();
+    buf.resize(at + n);
+    while (n > 0) {
+        UINT got = jd->infunc(jd, buf.data() + at, n);
+        if (got == 0) {
+            buf.resize(at);
+            return false;
+        }
+        at += got;
+        n -= got;
+    }
+    return true;
+}
+
+JRESULT jd_prepare(JDEC *jd, UINT (*infunc)(JDEC *, BYTE *, UINT), void *pool, UINT sz_pool, void *dev) {
+    memset(jd, 0, sizeof(*jd));
+    jd->infunc = infunc;
+    jd->device = dev;
+    jd->pool = pool;
+    jd->sz_pool = sz_pool;
+    
+    std::vector<uint8_t> &buf = prepared[jd];
+    buf.clear();
+    
+    if (!pull(jd, buf, 2)) return JDR_INP;
+    if (buf[0] != 0xFF || buf[1] != 0xD8) return JDR_FMT1;
+    
+    // Walk segments up to and including SOS
+    for (;;) {
+        size_t at = buf.size();
+        if (!pull(jd, buf, 4)) return JDR_INP;
+        if (buf[at] != 0xFF) return JDR_FMT1;
+        uint8_t marker = buf[at + 1];
+        size_t len = (buf[at + 2] << 8) | buf[at + 3];
+        if (len < 2) return JDR_FMT1;
+        if (!pull(jd, buf, len - 2)) return JDR_INP;
+        if (marker == 0xDA) break;
+    }
+    
+    SimJpegInfo info;
+    int res = simJpegInfo(buf, info);
+    if (res != SIM_JDR_OK) return (JRESULT)res;
+    
+    jd->width = info.width;
+    jd->height = info.height;
+    jd->msx = info.msx;
+    jd->msy = info.msy;
+    return JDR_OK;
+}
+
+JRESULT jd_decomp(JDEC *jd, UINT (*outfunc)(JDEC *, void *, JRECT *), BYTE scale) {
+    auto it = prepared.find(jd);
+    if (it == prepared.end()) return JDR_PAR;
+    std::vector<uint8_t> data;
+    data.swap(it->second);
+    prepared.erase(it);
+    
+    // Pull the rest of the stream; ending without EOI means the file was
+    // truncated or the input function gave up (e.g. decode budget)
+    BYTE chunk[SIM_TJPGD_CHUNK];
+    for (;;) {
+        UINT got = jd->infunc(jd, chunk, sizeof(chunk));
+        if (got == 0) break;
+        data.insert(data.end(), chunk, chunk + got);
+    }
+    size_t n = data.size();
+    if (n < 2 || data[n - 2] != 0xFF || data[n - 1] != 0xD9) return JDR_INP;
+    
+    int res = simJpegDecode(data, scale, [&](int x, int y, int w, int h, const uint8_t *rgb) {
+        JRECT rect;
+        rect.left = x;
+        rect.top = y;
+        rect.right = x + w - 1;
+        rect.bottom = y + h - 1;
+        return outfunc(jd, (void *)rgb, &rect) != 0;
+    });
+    return (JRESULT)res;
+}
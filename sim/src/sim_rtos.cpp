@@ -0,0 +1,322 @@
+// Cooperative FreeRTOS stand-in. Every task runs on its own ucontext stack
+// and only yields at blocking calls (delay, vTaskDelay, semaphore or queue
+// waits), so a run is fully deterministic. The task with the earliest wake
+// time runs next; ties go to the task created first.
+
+#include "sim.h"
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/semphr.h>
+#include <freertos/queue.h>
+#include <ucontext.h>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <vector>
+
+#define SIM_TASK_STACK (512 * 1024)
+
+struct SimTask {
+    ucontext_t ctx;
+    uint64_t wakeUs;
+    TaskFunction_t fn;
+    void *arg;
+    bool done;
+    int id;
+    char name[24];
+    char *stack;
+    uint32_t notify;
+    int core;       // Pinned core, -1 for the script task
+};
+
+static std::vector<SimTask *> simTasks;
+static SimTask *currentTask = nullptr;
+static uint64_t clockUs = 0;
+static double coreFreeUs[2] = {0, 0};
+
+// ==================== Clock ====================
+uint64_t simNowUs() {
+    return clockUs;
+}
+
+void simAdvanceUs(double us) {
+    if (us > 0) clockUs += (uint64_t)(us + 0.5);
+}
+
+void simAdvanceCoreUs(double us) {
+    int core = currentTask ? currentTask->core : -1;
+    if (core < 0 || core > 1) {
+        simAdvanceUs(us);
+        return;
+    }
+    // Queue behind earlier work on the same core, then let other tasks run
+    double start = coreFreeUs[core] > clockUs ? coreFreeUs[core] : clockUs;
+    coreFreeUs[core] = start + us;
+    simSleepUntilUs((uint64_t)(coreFreeUs[core] + 0.5));
+}
+
+// ==================== Scheduler ====================
+static void switchToNext() {
+    SimTask *next = nullptr;
+    for (SimTask *t : simTasks) {
+        if (t->done) continue;
+        if (!next || t->wakeUs < next->wakeUs) next = t;
+    }
+    if (!next) simQuit(0);
+    
+    if (next->wakeUs > clockUs) clockUs = next->wakeUs;
+    if (next == currentTask) return;
+    
+    SimTask *prev = currentTask;
+    currentTask = next;
+    swapcontext(&prev->ctx, &next->ctx);
+}
+
+void simSleepUntilUs(uint64_t us) {
+    currentTask->wakeUs = us < clockUs ? clockUs : us;
+    switchToNext();
+}
+
+void simYield() {
+    simSleepUntilUs(clockUs);
+}
+
+static void taskTrampoline(unsigned int hi, unsigned int lo) {
+    SimTask *t = (SimTask *)(((uintptr_t)hi << 32) | lo);
+    t->fn(t->arg);
+    // FreeRTOS tasks must not return; treat it like vTaskDelete(NULL)
+    t->done = true;
+    switchToNext();
+}
+
+void simSchedulerInit() {
+    SimTask *main = new SimTask();
+    main->id = 0;
+    main->core = 1;
+    strcpy(main->name, "loopTask");
+    simTasks.push_back(main);
+    currentTask = main;
+}
+
+void simStartTask(void (*fn)(void *), void *arg, const char *name) {
+    SimTask *t = new SimTask();
+    t->fn = fn;
+    t->arg = arg;
+    t->id = simTasks.size();
+    t->core = -1;
+    t->wakeUs = clockUs;
+    strncpy(t->name, name ? name : "task", sizeof(t->name) - 1);
+    t->stack = (char *)malloc(SIM_TASK_STACK);
+    
+    getcontext(&t->ctx);
+    t->ctx.uc_stack.ss_sp = t->stack;
+    t->ctx.uc_stack.ss_size = SIM_TASK_STACK;
+    t->ctx.uc_link = nullptr;
+    uintptr_t p = (uintptr_t)t;
+    makecontext(&t->ctx, (void (*)())taskTrampoline, 2, (unsigned int)(p >> 32), (unsigned int)p);
+    simTasks.push_back(t);
+}
+
+const char *simCurrentTaskName() {
+    return currentTask ? currentTask->name : "?";
+}
+
+// ==================== Task API ====================
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char *name, uint32_t stack, void *arg,
+                                   UBaseType_t prio, TaskHandle_t *handle, BaseType_t core) {
+    simStartTask(fn, arg, name);
+    simTasks.back()->core = core == tskNO_AFFINITY ? 0 : core;
+    if (handle) *handle = (TaskHandle_t)simTasks.back();
+    return pdPASS;
+}
+
+BaseType_t xTaskCreate(TaskFunction_t fn, const char *name, uint32_t stack, void *arg, UBaseType_t prio, TaskHandle_t *handle) {
+    return xTaskCreatePinnedToCore(fn, name, stack, arg, prio, handle, tskNO_AFFINITY);
+}
+
+void vTaskDelete(TaskHandle_t t) {
+    SimTask *task = t ? (SimTask *)t : currentTask;
+    task->done = true;
+    if (task == currentTask) switchToNext();
+}
+
+void vTaskDelay(TickType_t ticks) {
+    simSleepUntilUs(clockUs + (uint64_t)ticks * 1000);
+}
+
+TickType_t xTaskGetTickCount() {
+    return (TickType_t)(clockUs / 1000);
+}
+
+UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t t) {
+    return SIM_TASK_STACK;
+}
+
+BaseType_t xPortGetCoreID() {
+    return currentTask && currentTask->core > 0 ? currentTask->core : 0;
+}
+
+void taskYIELD() {
+    simYield();
+}
+
+void vTaskSuspend(TaskHandle_t t) {
+}
+
+void vTaskResume(TaskHandle_t t) {
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle() {
+    return (TaskHandle_t)currentTask;
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clear, TickType_t wait) {
+    uint64_t deadline = wait == portMAX_DELAY ? UINT64_MAX : clockUs + (uint64_t)wait * 1000;
+    while (currentTask->notify == 0) {
+        if (clockUs >= deadline) return 0;
+        simSleepUntilUs(clockUs + 1000);
+    }
+    uint32_t value = currentTask->notify;
+    currentTask->notify = clear ? 0 : value - 1;
+    return value;
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t t) {
+    ((SimTask *)t)->notify++;
+    return pdPASS;
+}
+
+void vTaskNotifyGiveFromISR(TaskHandle_t t, BaseType_t *woken) {
+    xTaskNotifyGive(t);
+    if (woken) *woken = pdFALSE;
+}
+
+// ==================== Semaphores ====================
+// Blocking waits poll once per tick; with cooperative tasks that keeps the
+// order of wake-ups deterministic.
+struct SimSemaphore {
+    int count;
+    int max;
+    SimTask *owner;
+    int depth;
+    bool mutex;
+};
+
+static bool pollUntil(bool (*ready)(void *), void *ctx, TickType_t wait) {
+    uint64_t deadline = wait == portMAX_DELAY ? UINT64_MAX : clockUs + (uint64_t)wait * 1000;
+    while (!ready(ctx)) {
+        if (clockUs >= deadline) return false;
+        simSleepUntilUs(clockUs + 1000);
+    }
+    return true;
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutex() {
+    return new SimSemaphore{1, 1, nullptr, 0, true};
+}
+
+SemaphoreHandle_t xSemaphoreCreateRecursiveMutex() {
+    return xSemaphoreCreateMutex();
+}
+
+SemaphoreHandle_t xSemaphoreCreateBinary() {
+    return new SimSemaphore{0, 1, nullptr, 0, false};
+}
+
+SemaphoreHandle_t xSemaphoreCreateCounting(UBaseType_t max, UBaseType_t initial) {
+    return new SimSemaphore{(int)initial, (int)max, nullptr, 0, false};
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t s, TickType_t wait) {
+    if (!pollUntil([](void *p) { return ((SimSemaphore *)p)->count > 0; }, s, wait)) return pdFALSE;
+    s->count--;
+    s->owner = currentTask;
+    return pdTRUE;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t s) {
+    if (s->count >= s->max) return pdFALSE;
+    s->count++;
+    s->owner = nullptr;
+    return pdTRUE;
+}
+
+BaseType_t xSemaphoreTakeRecursive(SemaphoreHandle_t s, TickType_t wait) {
+    if (s->owner == currentTask && s->depth > 0) {
+        s->depth++;
+        return pdTRUE;
+    }
+    if (xSemaphoreTake(s, wait) != pdTRUE) return pdFALSE;
+    s->depth = 1;
+    return pdTRUE;
+}
+
+BaseType_t xSemaphoreGiveRecursive(SemaphoreHandle_t s) {
+    if (s->owner != currentTask || s->depth == 0) return pdFALSE;
+    if (--s->depth > 0) return pdTRUE;
+    return xSemaphoreGive(s);
+}
+
+BaseType_t xSemaphoreGiveFromISR(SemaphoreHandle_t s, BaseType_t *woken) {
+    if (woken) *woken = pdFALSE;
+    return xSemaphoreGive(s);
+}
+
+void vSemaphoreDelete(SemaphoreHandle_t s) {
+    delete s;
+}
+
+// ==================== Queues ====================
+struct SimQueue {
+    UBaseType_t length;
+    UBaseType_t itemSize;
+    std::deque<std::vector<uint8_t>> items;
+};
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t itemSize) {
+    return new SimQueue{length, itemSize, {}};
+}
+
+BaseType_t xQueueSend(QueueHandle_t q, const void *item, TickType_t wait) {
+    if (!pollUntil([](void *p) { SimQueue *sq = (SimQueue *)p; return sq->items.size() < sq->length; }, q, wait)) {
+        return pdFALSE;
+    }
+    const uint8_t *bytes = (const uint8_t *)item;
+    q->items.emplace_back(bytes, bytes + q->itemSize);
+    return pdTRUE;
+}
+
+BaseType_t xQueueSendFromISR(QueueHandle_t q, const void *item, BaseType_t *woken) {
+    if (woken) *woken = pdFALSE;
+    return xQueueSend(q, item, 0);
+}
+
+BaseType_t xQueueReceive(QueueHandle_t q, void *item, TickType_t wait) {
+    if (!pollUntil([](void *p) { return !((SimQueue *)p)->items.empty(); }, q, wait)) return pdFALSE;
+    memcpy(item, q->items.front().data(), q->itemSize);
+    q->items.pop_front();
+    return pdTRUE;
+}
+
+BaseType_t xQueuePeek(QueueHandle_t q, void *item, TickType_t wait) {
+    if (!pollUntil([](void *p) { return !((SimQueue *)p)->items.empty(); }, q, wait)) return pdFALSE;
+    memcpy(item, q->items.front().data(), q->itemSize);
+    return pdTRUE;
+}
+
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t q) {
+    return q->items.size();
+}
+
+UBaseType_t uxQueueSpacesAvailable(QueueHandle_t q) {
+    return q->length - q->items.size();
+}
+
+BaseType_t xQueueReset(QueueHandle_t q) {
+    q->items.clear();
+    return pdPASS;
+}
+
+void vQueueDelete(QueueHandle_t q) {
+    delete q;
+}
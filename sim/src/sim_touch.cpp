@@ -0,0 +1,141 @@
+// GT911 touch controller on a simulated I2C bus. The script moves a finger
+// in screen coordinates; the model turns that into the controller's native
+// landscape reports, posts one every GT911_REPORT_US while the finger is
+// down plus one on release, and pulses INT for each like the real part.
+
+#include "sim.h"
+#include <Arduino.h>
+#include <Wire.h>
+#include "../../src/config.h"
+#include <cstring>
+#include <vector>
+
+#define GT911_ADDR 0x5D
+#define GT911_REPORT_US 10000
+#define I2C_BYTE_US 23          // 9 clocks at 400 kHz
+
+// ==================== Controller Model ====================
+static uint8_t regs[0x200];     // 0x8040-0x823F
+static uint16_t regPointer = 0;
+
+static uint8_t *reg(uint16_t address) {
+    return address >= 0x8040 && address < 0x8040 + sizeof(regs) ? &regs[address - 0x8040] : nullptr;
+}
+
+static void initRegisters() {
+    static bool done = false;
+    if (done) return;
+    done = true;
+    memcpy(reg(0x8140), "911\0", 4);
+    // Native resolution in the config block
+    *reg(0x8048) = 800 & 0xFF;
+    *reg(0x8049) = 800 >> 8;
+    *reg(0x804A) = 480 & 0xFF;
+    *reg(0x804B) = 480 >> 8;
+}
+
+// Posts a report; the firmware acknowledges it by clearing the status
+static void postReport(bool down, int x, int y) {
+    initRegisters();
+    int nx, ny;
+    switch (DISPLAY_ROTATION & 3) {
+        case 1:  nx = 799 - y; ny = x;       break;
+        case 2:  nx = 799 - x; ny = 479 - y; break;
+        case 3:  nx = y;       ny = 479 - x; break;
+        default: nx = x;       ny = y;       break;
+    }
+    uint8_t *status = reg(0x814E);
+    uint8_t *point = reg(0x814F);
+    *status = 0x80 | (down ? 1 : 0);
+    point[0] = 0;
+    point[1] = nx & 0xFF;
+    point[2] = nx >> 8;
+    point[3] = ny & 0xFF;
+    point[4] = ny >> 8;
+    point[5] = 30;
+    point[6] = 0;
+    simGpioTriggerInterrupt(TOUCH_INT_PIN);
+}
+
+void simTouchStroke(int x0, int y0, int x1, int y1, uint32_t ms) {
+    uint64_t start = simNowUs();
+    uint64_t end = start + (uint64_t)ms * 1000;
+    bool moves = x0 != x1 || y0 != y1;
+    bool held = false;
+    
+    for (uint64_t t = start; t < end; t += GT911_REPORT_US) {
+        simSleepUntilUs(t);
+        double f = ms ? (double)(t - start) / (end - start) : 1;
+        postReport(true, x0 + (int)((x1 - x0) * f), y0 + (int)((y1 - y0) * f));
+        if (!moves && !held && t - start >= TOUCH_LONG_PRESS_TIME * 1000ULL) {
+            held = true;
+            simNoteInput("touch hold");
+        }
+    }
+    simSleepUntilUs(end);
+    postReport(true, x1, y1);
+    simSleepUntilUs(end + GT911_REPORT_US);
+    postReport(false, x1, y1);
+    if (!held) simNoteInput(moves ? "swipe" : "tap");
+}
+
+// ==================== Wire ====================
+TwoWire Wire;
+static uint8_t txAddress = 0;
+static std::vector<uint8_t> txData;
+static std::vector<uint8_t> rxData;
+static size_t rxPos = 0;
+
+bool TwoWire::begin(int sda, int scl, uint32_t frequency) {
+    initRegisters();
+    return true;
+}
+
+void TwoWire::beginTransmission(uint8_t address) {
+    txAddress = address;
+    txData.clear();
+}
+
+size_t TwoWire::write(uint8_t data) {
+    txData.push_back(data);
+    return 1;
+}
+
+size_t TwoWire::write(const uint8_t *data, size_t length) {
+    txData.insert(txData.end(), data, data + length);
+    return length;
+}
+
+uint8_t TwoWire::endTransmission(bool sendStop) {
+    simAdvanceUs((txData.size() + 1) * I2C_BYTE_US);
+    if (txAddress != GT911_ADDR) return 2;  // Address NACK
+    if (txData.size() < 2) return 0;
+    
+    regPointer = (txData[0] << 8) | txData[1];
+    for (size_t i = 2; i < txData.size(); i++) {
+        uint8_t *r = reg(regPointer + i - 2);
+        if (r) *r = txData[i];
+    }
+    return 0;
+}
+
+size_t TwoWire::requestFrom(uint8_t address, size_t length, bool sendStop) {
+    simAdvanceUs((length + 1) * I2C_BYTE_US);
+    rxData.clear();
+    rxPos = 0;
+    if (address != GT911_ADDR) return 0;
+    
+    for (size_t i = 0; i < length; i++) {
+        uint8_t *r = reg(regPointer + i);
+        rxData.push_back(r ? *r : 0);
+    }
+    return length;
+}
+
+int TwoWire::available() {
+    return rxData.size() - rxPos;
+}
+
+int TwoWire::read() {
+    return rxPos < rxData.size() ? rxData[rxPos++] : -1;
+}
@@ -0,0 +1,205 @@
+// Host side of the serial upload (src/upload.h) for the simulator. Speaks
+// the protocol the way tools/upload.py does, over the modeled UART, so a
+// script can measure the sustained rate and exercise resume and resend.
+
+#include "sim.h"
+#include <Arduino.h>
+#include "../../src/config.h"
+#include "../../src/upload.h"
+#include <zlib.h>
+#include <cstring>
+#include <deque>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+#define REPLY_TIMEOUT_US 1000000
+
+struct Reply {
+    uint64_t atUs;          // When it reaches the host
+    uint8_t type;
+    uint8_t status;
+    uint32_t offset;
+    uint32_t crc;
+    uint16_t chunk;
+    uint8_t window;
+};
+
+static std::deque<Reply> replies;
+static std::vector<uint8_t> txFrame;    // Reply frame being collected from the firmware
+
+static uint32_t get32(const uint8_t *p) {
+    return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+// Splits the firmware's output into reply frames and console text
+static void tapOutput(const uint8_t *buf, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        uint8_t c = buf[i];
+        if (txFrame.empty() && c != UPLOAD_SYNC) {
+            fputc(c, stdout);
+            continue;
+        }
+        txFrame.push_back(c);
+        if (txFrame.size() < 5) continue;
+        
+        size_t total = 5 + (txFrame[3] | (txFrame[4] << 8)) + 4;
+        if (txFrame.size() < total) continue;
+        
+        uint32_t crc = (uint32_t)crc32(0, txFrame.data() + 2, total - 6);
+        if (txFrame[1] == UPLOAD_SYNC2 && txFrame[2] == UPLOAD_REPLY && total == 5 + 13 + 4 &&
+            crc == get32(txFrame.data() + total - 4)) {
+            const uint8_t *p = txFrame.data() + 5;
+            Reply r;
+            r.atUs = simNowUs() + (uint64_t)(total * simSerialByteUs() + simCosts.linkLatencyUs);
+            r.type = p[0];
+            r.status = p[1];
+            r.offset = get32(p + 2);
+            r.crc = get32(p + 6);
+            r.chunk = p[10] | (p[11] << 8);
+            r.window = p[12];
+            replies.push_back(r);
+        } else {
+            simLog("upload: bad reply frame");
+        }
+        txFrame.clear();
+    }
+}
+
+static void sendFrame(uint8_t type, const std::vector<uint8_t> &payload, bool corrupt) {
+    std::string out;
+    out += (char)UPLOAD_SYNC;
+    out += (char)UPLOAD_SYNC2;
+    out += (char)type;
+    out += (char)(payload.size() & 0xFF);
+    out += (char)(payload.size() >> 8);
+    out.append(payload.begin(), payload.end());
+    uint32_t crc = (uint32_t)crc32(0, (const uint8_t *)out.data() + 2, out.size() - 2);
+    for (int i = 0; i < 4; i++) out += (char)(crc >> (8 * i));
+    if (corrupt) out[out.size() / 2] ^= 0x40;
+    simSerialInject(out);
+}
+
+static void put32(std::vector<uint8_t> &v, uint32_t x) {
+    for (int i = 0; i < 4; i++) v.push_back((uint8_t)(x >> (8 * i)));
+}
+
+// Next reply, or false after REPLY_TIMEOUT_US of silence
+static bool waitReply(Reply &r) {
+    uint64_t deadline = simNowUs() + REPLY_TIMEOUT_US;
+    while (replies.empty() || replies.front().atUs > simNowUs()) {
+        if (simNowUs() >= deadline) return false;
+        uint64_t wake = replies.empty() ? simNowUs() + 200 : replies.front().atUs;
+        simSleepUntilUs(wake < deadline ? wake : deadline);
+    }
+    r = replies.front();
+    replies.pop_front();
+    return true;
+}
+
+static bool begin(const std::string &cardPath, uint32_t size, uint8_t flags, Reply &r) {
+    std::vector<uint8_t> payload;
+    put32(payload, size);
+    payload.push_back(flags);
+    payload.insert(payload.end(), cardPath.begin(), cardPath.end());
+    for (int attempt = 0; attempt < 3; attempt++) {
+        sendFrame(UPLOAD_BEGIN, payload, false);
+        while (waitReply(r)) {
+            if (r.type == UPLOAD_BEGIN) return true;
+        }
+    }
+    return false;
+}
+
+bool simUpload(const std::string &hostPath, const std::string &cardPath, uint32_t cutBytes, uint32_t flipEvery) {
+    std::ifstream in(hostPath, std::ios::binary);
+    if (!in) {
+        simLog("upload: cannot read %s", hostPath.c_str());
+        return false;
+    }
+    std::vector<uint8_t> data((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    uint32_t size = data.size();
+    
+    replies.clear();
+    txFrame.clear();
+    simSerialSetTap(tapOutput);
+    
+    uint64_t startUs = simNowUs();
+    Reply r;
+    bool ok = begin(cardPath, size, 0, r);
+    if (ok && r.status == UPLOAD_OK && r.offset > 0) {
+        if ((uint32_t)crc32(0, data.data(), r.offset) == r.crc) {
+            simLog("upload: resuming %s at %u", cardPath.c_str(), r.offset);
+        } else {
+            simLog("upload: partial copy differs, starting over");
+            ok = begin(cardPath, size, UPLOAD_RESTART, r);
+        }
+    }
+    if (!ok || r.status != UPLOAD_OK) {
+        simLog("upload: %s refused (%s, status %d)", cardPath.c_str(), ok ? "reply" : "no reply", ok ? r.status : -1);
+        simSerialSetTap(nullptr);
+        return false;
+    }
+    
+    uint32_t resumed = r.offset;
+    uint32_t chunk = r.chunk;
+    uint32_t inFlight = r.chunk * r.window;
+    uint32_t acked = r.offset;
+    uint32_t next = r.offset;
+    uint32_t frames = 0, resends = 0, timeouts = 0, sent = 0;
+    bool endSent = false;
+    uint32_t fileCrc = (uint32_t)crc32(0, data.data(), size);
+    
+    while (true) {
+        while (!endSent && next < size && next - acked < inFlight) {
+            if (cutBytes && sent >= cutBytes) break;
+            uint32_t n = size - next < chunk ? size - next : chunk;
+            std::vector<uint8_t> payload;
+            put32(payload, next);
+            payload.insert(payload.end(), data.begin() + next, data.begin() + next + n);
+            frames++;
+            sendFrame(UPLOAD_DATA, payload, flipEvery && frames % flipEvery == 0);
+            next += n;
+            sent += n;
+        }
+        if (cutBytes && sent >= cutBytes && acked >= next) {
+            simLog("upload: link cut after %u bytes", sent);
+            simSerialSetTap(nullptr);
+            return false;
+        }
+        if (!endSent && acked == size) {
+            std::vector<uint8_t> payload;
+            put32(payload, fileCrc);
+            sendFrame(UPLOAD_END, payload, false);
+            endSent = true;
+        }
+        
+        if (!waitReply(r)) {
+            // Go back to the last byte confirmed
+            timeouts++;
+            next = acked;
+            endSent = false;
+            continue;
+        }
+        if (r.status == UPLOAD_OK) {
+            if (r.type == UPLOAD_END) break;
+            if (r.offset > acked) acked = r.offset;
+        } else if (r.status == UPLOAD_RESEND) {
+            resends++;
+            acked = next = r.offset;
+            endSent = false;
+        } else {
+            simLog("upload: %s failed, status %d", cardPath.c_str(), r.status);
+            simSerialSetTap(nullptr);
+            return false;
+        }
+    }
+    
+    double seconds = (simNowUs() - startUs) / 1e6;
+    double link = 1e6 / simSerialByteUs() / 1024;
+    simLog("upload: %s -> %s, %u bytes in %.3f s, %.1f KB/s of %.1f KB/s link (%u resends, %u timeouts)",
+           hostPath.c_str(), cardPath.c_str(), size - resumed, seconds,
+           (size - resumed) / 1024.0 / seconds, link, resends, timeouts);
+    simSerialSetTap(nullptr);
+    return true;
+}
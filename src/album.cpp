@@ -0,0 +1,228 @@
+#include "album.h"
+#include "config.h"
+#include "library.h"
+#include "memstats.h"
+#include "log.h"
+#include <SD.h>
+#include <algorithm>
+
+// ==================== Album State ====================
+std::vector<Album> albums;
+int currentAlbum = ALBUM_ALL;
+
+#define SHUFFLE_MAGIC 0x31465253  // "SRF1"
+
+struct ShuffleHeader {
+    uint32_t magic;
+    uint32_t count;
+    uint32_t position;
+    uint32_t current;
+};
+
+// ==================== Discovery ====================
+static bool isAlbumDirectory(const String& name) {
+    if (name.startsWith(".")) return false;
+    if (name.equalsIgnoreCase("System Volume Information")) return false;
+    return true;
+}
+
+static bool albumLess(const Album& a, const Album& b) {
+    return a.name < b.name;
+}
+
+// Lists the root once: directories become albums, and loose images there
+// decide whether the root album is offered at all. Safe to call again while
+// an album plays; currentAlbum follows its directory.
+void discoverAlbums() {
+    String playing = currentAlbum == ALBUM_ALL ? String("") : albums[currentAlbum].dir;
+    albums.clear();
+    currentAlbum = ALBUM_ALL;
+    
+    File root = SD.open("/");
+    if (!root) return;
+    
+    int rootImages = 0;
+    while (true) {
+        File entry = root.openNextFile();
+        if (!entry) break;
+        
+        String name = entry.name();
+        if (entry.isDirectory()) {
+            if (isAlbumDirectory(name)) {
+                Album album;
+                album.name = name;
+                album.dir = "/" + name;
+                albums.push_back(album);
+            }
+        } else if (!isSystemFile(name) && isImageFile(name)) {
+            rootImages++;
+        }
+        entry.close();
+    }
+    root.close();
+    
+    std::sort(albums.begin(), albums.end(), albumLess);
+    
+    if (rootImages > 0) {
+        Album album;
+        album.name = ALBUM_ROOT_NAME;
+        album.dir = "/";
+        albums.insert(albums.begin(), album);
+    }
+    
+    for (int i = 0; i < albums.size(); i++) {
+        albums[i].count = libraryIndexCount(albums[i].dir);
+        if (albums[i].dir == playing) currentAlbum = i;
+    }
+    
+    LOG_I("Found %d albums\n", albums.size());
+}
+
+String albumLabel(int album) {
+    if (album < 0 || album >= albums.size()) return "All Albums";
+    return albums[album].name;
+}
+
+// ==================== Selection ====================
+void loadAlbumSelection() {
+    currentAlbum = ALBUM_ALL;
+    
+    File file = SD.open(ALBUM_FILENAME, FILE_READ);
+    if (!file) return;
+    String dir = file.readString();
+    file.close();
+    dir.trim();
+    
+    for (int i = 0; i < albums.size(); i++) {
+        if (albums[i].dir == dir) {
+            currentAlbum = i;
+            break;
+        }
+    }
+    LOG_I("Album loaded from SD: %s\n", albumLabel(currentAlbum).c_str());
+}
+
+static void saveAlbumSelection() {
+    File file = SD.open(ALBUM_FILENAME, FILE_WRITE);
+    if (!file) {
+        LOG_E("Failed to save album to SD card!\n");
+        return;
+    }
+    file.print(currentAlbum == ALBUM_ALL ? String("*") : albums[currentAlbum].dir);
+    file.close();
+}
+
+// ==================== Shuffle State ====================
+String albumStatePath(int album, const char* extension) {
+    if (album < 0 || album >= albums.size()) return String(ALBUM_INDEX_DIR) + "/.all" + extension;
+    return libraryIndexPath(albums[album].dir, extension);
+}
+
+static void saveShuffleState(int album) {
+    if (shuffledIndices.empty()) return;
+    
+    SD.mkdir(ALBUM_INDEX_DIR);
+    File file = SD.open(albumStatePath(album, ".shf"), FILE_WRITE);
+    if (!file) return;
+    
+    ShuffleHeader header = {SHUFFLE_MAGIC, (uint32_t)shuffledIndices.size(),
+                            (uint32_t)currentShuffleIndex, (uint32_t)currentImageIndex};
+    file.write((const uint8_t*)&header, sizeof(header));
+    file.write((const uint8_t*)shuffledIndices.data(), shuffledIndices.size() * sizeof(int));
+    file.close();
+}
+
+// Only accepted if it still matches the playlist it was saved for
+static bool restoreShuffleState(int album) {
+    File file = SD.open(albumStatePath(album, ".shf"), FILE_READ);
+    if (!file) return false;
+    
+    ShuffleHeader header;
+    bool valid = file.read((uint8_t*)&header, sizeof(header)) == sizeof(header) &&
+                 header.magic == SHUFFLE_MAGIC && header.count == imageFiles.size() &&
+                 header.position < header.count && header.current < header.count;
+    
+    if (valid) {
+        shuffledIndices.resize(header.count);
+        size_t bytes = header.count * sizeof(int);
+        valid = file.read((uint8_t*)shuffledIndices.data(), bytes) == bytes;
+    }
+    file.close();
+    
+    for (int i = 0; valid && i < shuffledIndices.size(); i++) {
+        if (shuffledIndices[i] < 0 || shuffledIndices[i] >= imageFiles.size()) valid = false;
+    }
+    
+    if (!valid) {
+        shuffledIndices.clear();
+        return false;
+    }
+    currentShuffleIndex = header.position;
+    currentImageIndex = header.current;
+    return true;
+}
+
+// ==================== Loading ====================
+void loadAlbum(int album) {
+    MemScope scope(MEM_SCAN);
+    unsigned long loadStart = millis();
+    
+    std::vector<String> dirs;
+    if (album == ALBUM_ALL) {
+        // The root is always watched so a card that starts empty recovers
+        if (albums.empty() || albums[0].dir != "/") dirs.push_back("/");
+        for (int i = 0; i < albums.size(); i++) dirs.push_back(albums[i].dir);
+    } else {
+        dirs.push_back(albums[album].dir);
+    }
+    
+    imageFiles.clear();
+    shuffledIndices.clear();
+    currentShuffleIndex = 0;
+    currentImageIndex = 0;
+    
+    std::vector<String> built;
+    for (int i = 0; i < dirs.size(); i++) {
+        if (!loadLibraryIndex(dirs[i], imageFiles)) {
+            LOG_I("Indexing %s...\n", dirs[i].c_str());
+            scanLibraryDir(dirs[i], imageFiles);
+            built.push_back(dirs[i]);
+        }
+    }
+    
+    imageFiles.erase(std::remove_if(imageFiles.begin(), imageFiles.end(), isQuarantined), imageFiles.end());
+    for (int i = 0; i < built.size(); i++) {
+        saveLibraryIndex(built[i]);
+    }
+    
+    // Refresh the picker counts; images arrive grouped by directory
+    for (int i = 0; i < albums.size(); i++) {
+        if (album == ALBUM_ALL || album == i) albums[i].count = 0;
+    }
+    int counted = -1;
+    String countedDir;
+    for (int k = 0; k < imageFiles.size(); k++) {
+        String dir = dirOf(imageFiles[k].path);
+        if (k == 0 || dir != countedDir) {
+            countedDir = dir;
+            counted = -1;
+            for (int i = 0; i < albums.size(); i++) {
+                if (albums[i].dir == dir) counted = i;
+            }
+        }
+        if (counted >= 0) albums[counted].count++;
+    }
+    
+    setLibraryScope(dirs);
+    bool restored = restoreShuffleState(album);
+    
+    LOG_I("Album %s: %d images in %lu ms%s\n", albumLabel(album).c_str(), imageFiles.size(),
+          millis() - loadStart, restored ? ", shuffle restored" : "");
+}
+
+void selectAlbum(int album) {
+    saveShuffleState(currentAlbum);
+    currentAlbum = album;
+    saveAlbumSelection();
+    loadAlbum(album);
+}
@@ -0,0 +1,41 @@
+#ifndef ALBUM_H
+#define ALBUM_H
+
+#include <Arduino.h>
+#include <vector>
+
+// ==================== Albums ====================
+// Every top-level directory is an album; images directly in the root form
+// one more. The slideshow plays one album or all of them. Each album keeps
+// a directory index (see library.h) and its own shuffle state, so switching
+// costs one index read per directory rather than a card walk.
+#define ALBUM_ALL -1
+
+struct Album {
+    String name;     // Shown in the picker
+    String dir;      // "/" for the root album
+    int32_t count;   // Images in the index, -1 if not indexed yet
+};
+
+extern std::vector<Album> albums;
+extern int currentAlbum;
+
+// ==================== Album Functions ====================
+void discoverAlbums();
+void loadAlbumSelection();
+String albumLabel(int album);
+
+// A file of per-album state in ALBUM_INDEX_DIR, e.g. ".shf" for the shuffle
+String albumStatePath(int album, const char* extension);
+
+// Rebuilds imageFiles for an album from its indexes, building any that are
+// missing, and restores its shuffle state. shuffledIndices is left empty
+// when there was no usable state to restore.
+void loadAlbum(int album);
+
+// Saves the shuffle state of the album playing, then loads another and
+// remembers the choice across reboots. The caller holds the SD lock, so
+// saveImageHashes() goes first.
+void selectAlbum(int album);
+
+#endif // ALBUM_H
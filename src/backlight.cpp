@@ -0,0 +1,69 @@
+#include "backlight.h"
+#include "config.h"
+#include "display.h"
+
+static uint8_t ceiling = BRIGHTNESS_DEFAULT;
+static uint8_t percent = 100;
+static uint8_t level = BRIGHTNESS_DEFAULT;
+
+// Duty integrated over time, actual and at the setting
+static uint64_t dutyTime = 0;
+static uint64_t ceilingTime = 0;
+static unsigned long lastAccount = 0;
+
+static void account() {
+    unsigned long now = millis();
+    dutyTime += (uint64_t)level * (now - lastAccount);
+    ceilingTime += (uint64_t)ceiling * (now - lastAccount);
+    lastAccount = now;
+}
+
+static void apply(uint16_t fadeMs) {
+    account();
+    uint32_t target = (uint32_t)ceiling * percent / 100;
+    if (target < MIN_BRIGHTNESS) target = min<uint32_t>(ceiling, MIN_BRIGHTNESS);
+    if (target == level) return;
+    level = target;
+    fade_brightness(level, fadeMs);
+}
+
+uint8_t backlightPercent(const LumaHistogram& luma) {
+    if (!BACKLIGHT_ADAPTIVE || luma.pixels == 0) return 100;
+    
+    // Enough light for the highlights to reach the setting's white
+    uint32_t highlight = lumaPercentile(luma, BACKLIGHT_HIGHLIGHT_PERCENTILE);
+    int32_t result = BACKLIGHT_FLOOR_PERCENT + (100 - BACKLIGHT_FLOOR_PERCENT) * (highlight + 1) / 256;
+    
+    // Mostly white photos glare at full light
+    uint32_t mean = lumaMean(luma);
+    if (mean > BACKLIGHT_BRIGHT_MEAN) {
+        result -= BACKLIGHT_BRIGHT_CUT_PERCENT * (mean - BACKLIGHT_BRIGHT_MEAN) / (255 - BACKLIGHT_BRIGHT_MEAN);
+    }
+    return constrain(result, BACKLIGHT_FLOOR_PERCENT, 100);
+}
+
+void backlightSetCeiling(uint8_t setting) {
+    account();
+    ceiling = setting;
+    apply(0);
+}
+
+void backlightShowPhoto(uint8_t photoPercent) {
+    percent = photoPercent;
+    apply(BACKLIGHT_FADE_MS);
+}
+
+void backlightShowFull() {
+    percent = 100;
+    apply(0);
+}
+
+uint8_t backlightSavedPercent() {
+    account();
+    if (ceilingTime == 0) return 0;
+    return 100 - dutyTime * 100 / ceilingTime;
+}
+
+uint8_t backlightLevel() {
+    return level;
+}
@@ -0,0 +1,25 @@
+#ifndef BACKLIGHT_H
+#define BACKLIGHT_H
+
+#include <Arduino.h>
+#include "color.h"
+
+// ==================== Adaptive Backlight ====================
+// Each photo gets a share of the brightness setting picked from the
+// luminance histogram its decode gathered: photos without highlights
+// need less light, very bright ones are toned down. The LEDC fades to
+// the new level in hardware as the slide changes; menus get the full
+// setting.
+
+// Share of the brightness setting for a photo, percent
+uint8_t backlightPercent(const LumaHistogram& luma);
+
+void backlightSetCeiling(uint8_t level);   // The brightness setting, applied at once
+void backlightShowPhoto(uint8_t percent);  // Fades to the photo's level
+void backlightShowFull();                  // Menus and messages
+
+// Backlight duty saved against running at the setting, percent, since boot
+uint8_t backlightSavedPercent();
+uint8_t backlightLevel();
+
+#endif // BACKLIGHT_H
@@ -0,0 +1,169 @@
+#include "bench.h"
+#include "benchimage.h"
+#include "budget.h"
+#include "config.h"
+#include "decoder.h"
+#include "display.h"
+#include "jpeg.h"
+#include "library.h"
+#include "log.h"
+#include <limits.h>
+
+#define FRAME_BYTES (FRAME_PIXELS * sizeof(uint16_t))
+
+// Bytes per microsecond is MB/s
+static float rateMBs(uint32_t bytes, unsigned long us) {
+    return us ? (float)bytes / us : 0.0f;
+}
+
+// ==================== SD Card ====================
+// Writes the scratch file, reads it back in order and then a cluster at a
+// time from random offsets; the caller holds the SD lock
+static bool benchSd(BenchResults& results) {
+    ArenaScope scope(ARENA_DECODE);
+    uint8_t* buffer = (uint8_t*)scope.alloc(BENCH_CHUNK_SIZE);
+    if (!buffer) return false;
+    for (uint32_t i = 0; i < BENCH_CHUNK_SIZE; i++) {
+        buffer[i] = i * 7;
+    }
+    
+    File file = SD.open(BENCH_TEST_FILENAME, FILE_WRITE);
+    if (!file) return false;
+    uint32_t written = 0;
+    unsigned long start = micros();
+    while (written < BENCH_FILE_SIZE && file.write(buffer, BENCH_CHUNK_SIZE) == BENCH_CHUNK_SIZE) {
+        written += BENCH_CHUNK_SIZE;
+    }
+    // The close flushes, so it counts toward the write
+    file.close();
+    results.writeMBs = rateMBs(written, micros() - start);
+    
+    file = SD.open(BENCH_TEST_FILENAME, FILE_READ);
+    if (written < BENCH_FILE_SIZE || !file) {
+        SD.remove(BENCH_TEST_FILENAME);
+        return false;
+    }
+    
+    uint32_t got = 0;
+    start = micros();
+    while (got < BENCH_FILE_SIZE) {
+        int n = file.read(buffer, BENCH_CHUNK_SIZE);
+        if (n <= 0) break;
+        got += n;
+    }
+    results.seqReadMBs = rateMBs(got, micros() - start);
+    
+    uint32_t clusters = BENCH_FILE_SIZE / BENCH_RANDOM_SIZE;
+    int reads = 0;
+    start = micros();
+    for (int i = 0; i < BENCH_RANDOM_READS; i++) {
+        file.seek(random(clusters) * BENCH_RANDOM_SIZE);
+        if (file.read(buffer, BENCH_RANDOM_SIZE) == BENCH_RANDOM_SIZE) reads++;
+    }
+    unsigned long elapsed = micros() - start;
+    file.close();
+    SD.remove(BENCH_TEST_FILENAME);
+    
+    results.randReadMBs = rateMBs(reads * BENCH_RANDOM_SIZE, elapsed);
+    results.randReadMs = reads ? elapsed / 1000.0f / reads : 0.0f;
+    return got == BENCH_FILE_SIZE && reads == BENCH_RANDOM_READS;
+}
+
+// ==================== Decode ====================
+static bool discardBlocks(void* ctx, int16_t x, int16_t y, uint16_t w, uint16_t h, const uint8_t* rgb) {
+    return true;
+}
+
+static bool benchJpeg(BenchResults& results) {
+    bool ok = true;
+    unsigned long best = ULONG_MAX;
+    for (int i = 0; i < BENCH_REPEATS; i++) {
+        unsigned long start = micros();
+        ok = jpegDecodeBuffer(benchImageJpeg, sizeof(benchImageJpeg), 0, discardBlocks, NULL) == DECODE_OK && ok;
+        best = min(best, micros() - start);
+    }
+    results.jpegMs = best / 1000.0f;
+    return ok;
+}
+
+// ==================== Screen ====================
+static void benchScreen(BenchResults& results) {
+    unsigned long fill = ULONG_MAX;
+    unsigned long blit = ULONG_MAX;
+    for (int i = 0; i < BENCH_REPEATS; i++) {
+        unsigned long start = micros();
+        gfx.fillScreen((i & 1) ? DARKGREY : BLACK);
+        fill = min(fill, micros() - start);
+        blit = min(blit, blitFrameMicros(1));
+    }
+    results.fillMs = fill / 1000.0f;
+    results.fillMBs = rateMBs(FRAME_BYTES, fill);
+    results.blitMs = blit / 1000.0f;
+    results.blitMBs = rateMBs(FRAME_BYTES, blit);
+}
+
+// ==================== Results File ====================
+static bool saveResults(const BenchResults& results) {
+    bool fresh = !SD.exists(BENCH_RESULTS_FILENAME);
+    File file = SD.open(BENCH_RESULTS_FILENAME, FILE_APPEND);
+    if (!file) return false;
+    
+    if (fresh) {
+        file.print("device,uptime_s,cpu_mhz,sd_clock_mhz,card_mb,write_mbs,seq_read_mbs,"
+                   "rand_read_mbs,rand_read_ms,jpeg_ms,fill_ms,blit_ms\n");
+    }
+    // A failed test leaves its columns empty rather than zero
+    file.printf("%012llx,%lu,%lu,%lu,%llu,", (unsigned long long)ESP.getEfuseMac(),
+                millis() / 1000, (unsigned long)ESP.getCpuFreqMHz(),
+                (unsigned long)(results.sdClockHz / 1000000), (unsigned long long)(SD.cardSize() >> 20));
+    if (results.sdOk) {
+        file.printf("%.2f,%.2f,%.2f,%.2f,", results.writeMBs, results.seqReadMBs,
+                    results.randReadMBs, results.randReadMs);
+    } else {
+        file.print(",,,,");
+    }
+    if (results.jpegOk) file.printf("%.1f", results.jpegMs);
+    file.printf(",%.2f,%.2f\n", results.fillMs, results.blitMs);
+    
+    file.close();
+    return true;
+}
+
+// ==================== Suite ====================
+void runBenchmark(uint32_t sdClockHz, BenchResults& results) {
+    results = BenchResults();
+    results.sdClockHz = sdClockHz;
+    
+    lockSD();
+    results.sdOk = benchSd(results);
+    unlockSD();
+    results.jpegOk = benchJpeg(results);
+    benchScreen(results);
+    
+    lockSD();
+    results.saved = saveResults(results);
+    unlockSD();
+    
+    if (!results.sdOk) LOG_W("Benchmark: SD test failed\n");
+    if (!results.saved) LOG_W("Benchmark: could not write %s\n", BENCH_RESULTS_FILENAME);
+}
+
+// ==================== Serial Report ====================
+void printBenchmark(const BenchResults& results) {
+    Serial.printf("Benchmark: SD at %lu MHz\n", (unsigned long)(results.sdClockHz / 1000000));
+    if (results.sdOk) {
+        Serial.printf("  SD write      %6.2f MB/s\n", results.writeMBs);
+        Serial.printf("  SD read seq   %6.2f MB/s\n", results.seqReadMBs);
+        Serial.printf("  SD read rand  %6.2f MB/s, %.2f ms each\n", results.randReadMBs, results.randReadMs);
+    } else {
+        Serial.println("  SD            FAILED");
+    }
+    if (results.jpegOk) {
+        Serial.printf("  JPEG decode   %6.1f ms (800x480 reference)\n", results.jpegMs);
+    } else {
+        Serial.println("  JPEG decode   FAILED");
+    }
+    Serial.printf("  Screen fill   %6.2f ms, %.1f MB/s\n", results.fillMs, results.fillMBs);
+    Serial.printf("  Screen blit   %6.2f ms, %.1f MB/s\n", results.blitMs, results.blitMBs);
+    if (results.saved) Serial.printf("  Appended to %s\n", BENCH_RESULTS_FILENAME);
+}
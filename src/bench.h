@@ -0,0 +1,33 @@
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <Arduino.h>
+
+// ==================== On-device Benchmark ====================
+// A fixed suite that runs the same on every frame: SD transfer rates at
+// the clock the card mounted at, a decode of the built-in reference photo,
+// and whole-screen fills and blits. Each run is appended to
+// BENCH_RESULTS_FILENAME under the board's ID, so results from a fleet of
+// frames can be lined up against each other.
+
+struct BenchResults {
+    uint32_t sdClockHz;
+    float writeMBs;         // Sequential, BENCH_CHUNK_SIZE at a time
+    float seqReadMBs;
+    float randReadMBs;      // BENCH_RANDOM_SIZE at random offsets
+    float randReadMs;       // Per random read
+    float jpegMs;           // Reference photo at full scale, output discarded
+    float fillMs;           // One screen cleared
+    float fillMBs;
+    float blitMs;           // One screen of 16x16 decoder blocks
+    float blitMBs;
+    bool sdOk;
+    bool jpegOk;
+    bool saved;             // Appended to the results file
+};
+
+// Runs on the loop task; takes the SD lock and leaves the screen dirty
+void runBenchmark(uint32_t sdClockHz, BenchResults& results);
+void printBenchmark(const BenchResults& results);
+
+#endif // BENCH_H
@@ -0,0 +1,2057 @@
+#ifndef BENCHIMAGE_H
+#define BENCHIMAGE_H
+
+#include <Arduino.h>
+
+// ==================== Benchmark Reference Photo ====================
+// An 800x480 baseline JPEG at quality 75, 4:2:0: sky, hills and grass
+// with sensor-like noise, so every frame decodes the same bits and
+// results from different frames compare. Generated; do not edit.
+
+static const uint8_t benchImageJpeg[32674] = {
+    0xff, 0xd8, 0xff, 0xe0, 0x00, 0x10, 0x4a, 0x46, 0x49, 0x46, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x01, 0x00, 0x00, 0xff, 0xdb, 0x00, 0x43, 0x00, 0x08, 0x06, 0x06, 0x07, 0x06, 0x05, 0x08,
+    0x07, 0x07, 0x07, 0x09, 0x09, 0x08, 0x0a, 0x0c, 0x14, 0x0d, 0x0c, 0x0b, 0x0b, 0x0c, 0x19, 0x12,
+    0x13, 0x0f, 0x14, 0x1d, 0x1a, 0x1f, 0x1e, 0x1d, 0x1a, 0x1c, 0x1c, 0x20, 0x24, 0x2e, 0x27, 0x20,
+    0x22, 0x2c, 0x23, 0x1c, 0x1c, 0x28, 0x37, 0x29, 0x2c, 0x30, 0x31, 0x34, 0x34, 0x34, 0x1f, 0x27,
+    0x39, 0x3d, 0x38, 0x32, 0x3c, 0x2e, 0x33, 0x34, 0x32, 0xff, 0xdb, 0x00, 0x43, 0x01, 0x09, 0x09,
+    0x09, 0x0c, 0x0b, 0x0c, 0x18, 0x0d, 0x0d, 0x18, 0x32, 0x21, 0x1c, 0x21, 0x32, 0x32, 0x32, 0x32,
+    0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+    0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+    0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0xff, 0xc0,
+    0x00, 0x11, 0x08, 0x01, 0xe0, 0x03, 0x20, 0x03, 0x01, 0x22, 0x00, 0x02, 0x11, 0x01, 0x03, 0x11,
+    0x01, 0xff, 0xc4, 0x00, 0x1f, 0x00, 0x00, 0x01, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
+    0x0a, 0x0b, 0xff, 0xc4, 0x00, 0xb5, 0x10, 0x00, 0x02, 0x01, 0x03, 0x03, 0x02, 0x04, 0x03, 0x05,
+    0x05, 0x04, 0x04, 0x00, 0x00, 0x01, 0x7d, 0x01, 0x02, 0x03, 0x00, 0x04, 0x11, 0x05, 0x12, 0x21,
+    0x31, 0x41, 0x06, 0x13, 0x51, 0x61, 0x07, 0x22, 0x71, 0x14, 0x32, 0x81, 0x91, 0xa1, 0x08, 0x23,
+    0x42, 0xb1, 0xc1, 0x15, 0x52, 0xd1, 0xf0, 0x24, 0x33, 0x62, 0x72, 0x82, 0x09, 0x0a, 0x16, 0x17,
+    0x18, 0x19, 0x1a, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a,
+    0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a,
+    0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a,
+    0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99,
+    0x9a, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7,
+    0xb8, 0xb9, 0xba, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xd2, 0xd3, 0xd4, 0xd5,
+    0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xe1, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xf1,
+    0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0xff, 0xc4, 0x00, 0x1f, 0x01, 0x00, 0x03,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0xff, 0xc4, 0x00, 0xb5, 0x11, 0x00,
+    0x02, 0x01, 0x02, 0x04, 0x04, 0x03, 0x04, 0x07, 0x05, 0x04, 0x04, 0x00, 0x01, 0x02, 0x77, 0x00,
+    0x01, 0x02, 0x03, 0x11, 0x04, 0x05, 0x21, 0x31, 0x06, 0x12, 0x41, 0x51, 0x07, 0x61, 0x71, 0x13,
+    0x22, 0x32, 0x81, 0x08, 0x14, 0x42, 0x91, 0xa1, 0xb1, 0xc1, 0x09, 0x23, 0x33, 0x52, 0xf0, 0x15,
+    0x62, 0x72, 0xd1, 0x0a, 0x16, 0x24, 0x34, 0xe1, 0x25, 0xf1, 0x17, 0x18, 0x19, 0x1a, 0x26, 0x27,
+    0x28, 0x29, 0x2a, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49,
+    0x4a, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69,
+    0x6a, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88,
+    0x89, 0x8a, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6,
+    0xa7, 0xa8, 0xa9, 0xaa, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xc2, 0xc3, 0xc4,
+    0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xe2,
+    0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9,
+    0xfa, 0xff, 0xda, 0x00, 0x0c, 0x03, 0x01, 0x00, 0x02, 0x11, 0x03, 0x11, 0x00, 0x3f, 0x00, 0xb1,
+    0x8a, 0x31, 0x4b, 0x8a, 0x31, 0x5f, 0x5e, 0x78, 0x62, 0x62, 0x8c, 0x52, 0xe2, 0x8c, 0x50, 0x02,
+    0x62, 0x8c, 0x52, 0xe2, 0x8c, 0x50, 0x02, 0x62, 0x8c, 0x52, 0xe2, 0x8c, 0x50, 0x02, 0x62, 0x8c,
+    0x52, 0xe2, 0x8c, 0x50, 0x02, 0x62, 0x8c, 0x52, 0xe2, 0x8c, 0x50, 0x02, 0x62, 0x8c, 0x52, 0xe2,
+    0x8c, 0x50, 0x02, 0x62, 0x8c, 0x52, 0xe2, 0x8c, 0x50, 0x02, 0x62, 0x8c, 0x52, 0xe2, 0x8c, 0x50,
+    0x02, 0x62, 0x8c, 0x52, 0xe2, 0x8c, 0x50, 0x02, 0x62, 0x8c, 0x52, 0xe2, 0x8c, 0x50, 0x02, 0x62,
+    0x8c, 0x52, 0xe2, 0x8c, 0x50, 0x02, 0x62, 0x8c, 0x52, 0xe2, 0x8c, 0x50, 0x02, 0x62, 0x8c, 0x52,
+    0xe2, 0x8c, 0x50, 0x02, 0x62, 0x8c, 0x52, 0xe2, 0x8c, 0x50, 0x02, 0x62, 0x8c, 0x52, 0xe2, 0x8c,
+    0x50, 0x02, 0x62, 0x8c, 0x52, 0xe2, 0x8c, 0x50, 0x02, 0x62, 0x8c, 0x52, 0xe2, 0x8c, 0x50, 0x02,
+    0x62, 0x8c, 0x52, 0xe2, 0x8c, 0x50, 0x02, 0x62, 0x8c, 0x52, 0xe2, 0x8c, 0x50, 0x02, 0x62, 0x8c,
+    0x52, 0xe2, 0x8c, 0x50, 0x02, 0x62, 0x8c, 0x52, 0xe2, 0x8c, 0x50, 0x02, 0x62, 0x8c, 0x52, 0xe2,
+    0x8c, 0x50, 0x02, 0x62, 0x8c, 0x52, 0xe2, 0x8c, 0x50, 0x02, 0x62, 0x8c, 0x52, 0xe2, 0x8c, 0x50,
+    0x02, 0x62, 0x8c, 0x52, 0xe2, 0x8c, 0x50, 0x02, 0x62, 0x8c, 0x52, 0xe2, 0x8c, 0x50, 0x02, 0x62,
+    0x8c, 0x52, 0xe2, 0x8c, 0x50, 0x02, 0x62, 0x8c, 0x52, 0xe2, 0x8c, 0x50, 0x02, 0x62, 0x8c, 0x52,
+    0xe2, 0x8c, 0x50, 0x02, 0x62, 0x8c, 0x52, 0xe2, 0x8c, 0x50, 0x02, 0x62, 0x8c, 0x52, 0xe2, 0x8c,
+    0x50, 0x02, 0x62, 0x8c, 0x52, 0xe2, 0x8c, 0x50, 0x02, 0x62, 0x8c, 0x52, 0xe2, 0x8c, 0x50, 0x02,
+    0x62, 0x8c, 0x52, 0xe2, 0x8c, 0x50, 0x02, 0x62, 0x8c, 0x52, 0xe2, 0x8c, 0x50, 0x02, 0x62, 0x8c,
+    0x52, 0xe2, 0x8c, 0x50, 0x02, 0x62, 0x8c, 0x52, 0xe2, 0x8c, 0x50, 0x02, 0x62, 0x8c, 0x52, 0xe2,
+    0x8c, 0x50, 0x02, 0x62, 0x8c, 0x52, 0xe2, 0x8c, 0x50, 0x02, 0x62, 0x8c, 0x52, 0xe2, 0x8c, 0x50,
+    0x02, 0x62, 0x8c, 0x52, 0xe2, 0x8c, 0x50, 0x02, 0x62, 0x8c, 0x52, 0xe2, 0x8c, 0x50, 0x02, 0x62,
+    0x8c, 0x52, 0xe2, 0x8c, 0x50, 0x02, 0x62, 0x8c, 0x52, 0xe2, 0x8c, 0x50, 0x02, 0x62, 0x8c, 0x52,
+    0xe2, 0x8c, 0x50, 0x02, 0x62, 0x8c, 0x52, 0xe2, 0x8c, 0x50, 0x02, 0x62, 0x8c, 0x52, 0xe2, 0x8c,
+    0x50, 0x02, 0x62, 0x8c, 0x52, 0xe2, 0x8c, 0x50, 0x02, 0x62, 0x8c, 0x52, 0xe2, 0x8c, 0x50, 0x03,
+    0xb1, 0x46, 0x29, 0x71, 0x46, 0x2a, 0x2e, 0x02, 0x62, 0x8c, 0x52, 0xe2, 0x8c, 0x51, 0x70, 0x13,
+    0x14, 0x62, 0x97, 0x14, 0x62, 0x8b, 0x80, 0x98, 0xa3, 0x14, 0xb8, 0xa3, 0x14, 0x5c, 0x04, 0xc5,
+    0x18, 0xa5, 0xc5, 0x18, 0xa2, 0xe0, 0x26, 0x28, 0xc5, 0x2e, 0x28, 0xc5, 0x17, 0x01, 0x31, 0x46,
+    0x29, 0x71, 0x46, 0x28, 0xb8, 0x09, 0x8a, 0x31, 0x4b, 0x8a, 0x31, 0x45, 0xc0, 0x4c, 0x51, 0x8a,
+    0x5c, 0x51, 0x8a, 0x2e, 0x02, 0x62, 0x8c, 0x52, 0xe2, 0x8c, 0x51, 0x70, 0x13, 0x14, 0x62, 0x97,
+    0x14, 0x62, 0x8b, 0x80, 0x98, 0xa3, 0x14, 0xb8, 0xa3, 0x14, 0x5c, 0x04, 0xc5, 0x18, 0xa5, 0xc5,
+    0x18, 0xa2, 0xe0, 0x26, 0x28, 0xc5, 0x2e, 0x28, 0xc5, 0x17, 0x01, 0x31, 0x46, 0x29, 0x71, 0x46,
+    0x28, 0xb8, 0x09, 0x8a, 0x31, 0x4b, 0x8a, 0x31, 0x45, 0xc0, 0x4c, 0x51, 0x8a, 0x5c, 0x51, 0x8a,
+    0x2e, 0x02, 0x62, 0x8c, 0x52, 0xe2, 0x8c, 0x51, 0x70, 0x13, 0x14, 0x62, 0x97, 0x14, 0x62, 0x8b,
+    0x80, 0x98, 0xa3, 0x14, 0xb8, 0xa3, 0x14, 0x5c, 0x04, 0xc5, 0x18, 0xa5, 0xc5, 0x18, 0xa2, 0xe0,
+    0x26, 0x28, 0xc5, 0x2e, 0x28, 0xc5, 0x17, 0x01, 0x31, 0x46, 0x29, 0x71, 0x46, 0x28, 0xb8, 0x09,
+    0x8a, 0x31, 0x4b, 0x8a, 0x31, 0x45, 0xc0, 0x4c, 0x51, 0x8a, 0x5c, 0x51, 0x8a, 0x2e, 0x02, 0x62,
+    0x8c, 0x52, 0xe2, 0x8c, 0x51, 0x70, 0x13, 0x14, 0x62, 0x97, 0x14, 0x62, 0x8b, 0x80, 0x98, 0xa3,
+    0x14, 0xb8, 0xa3, 0x14, 0x5c, 0x04, 0xc5, 0x18, 0xa5, 0xc5, 0x18, 0xa2, 0xe0, 0x26, 0x28, 0xc5,
+    0x2e, 0x28, 0xc5, 0x17, 0x01, 0x31, 0x46, 0x29, 0x71, 0x46, 0x28, 0xb8, 0x09, 0x8a, 0x31, 0x4b,
+    0x8a, 0x31, 0x45, 0xc0, 0x4c, 0x51, 0x8a, 0x5c, 0x51, 0x8a, 0x2e, 0x02, 0x62, 0x8c, 0x52, 0xe2,
+    0x8c, 0x51, 0x70, 0x13, 0x14, 0x62, 0x97, 0x14, 0x62, 0x8b, 0x80, 0x98, 0xa3, 0x14, 0xb8, 0xa3,
+    0x14, 0x5c, 0x04, 0xc5, 0x18, 0xa5, 0xc5, 0x18, 0xa2, 0xe0, 0x26, 0x28, 0xc5, 0x2e, 0x28, 0xc5,
+    0x17, 0x01, 0x31, 0x46, 0x29, 0x71, 0x46, 0x28, 0xb8, 0x09, 0x8a, 0x31, 0x4b, 0x8a, 0x31, 0x45,
+    0xc0, 0x4c, 0x51, 0x8a, 0x5c, 0x51, 0x8a, 0x2e, 0x02, 0x62, 0x8c, 0x52, 0xe2, 0x8c, 0x51, 0x70,
+    0x13, 0x14, 0x62, 0x97, 0x14, 0x62, 0x8b, 0x80, 0x98, 0xa3, 0x14, 0xb8, 0xa3, 0x14, 0x5c, 0x04,
+    0xc5, 0x18, 0xa5, 0xc5, 0x18, 0xa2, 0xe0, 0x26, 0x28, 0xc5, 0x2e, 0x28, 0xc5, 0x17, 0x01, 0x31,
+    0x46, 0x29, 0x71, 0x46, 0x28, 0xb8, 0x09, 0x8a, 0x31, 0x4b, 0x8a, 0x31, 0x45, 0xc0, 0x4c, 0x51,
+    0x8a, 0x5c, 0x51, 0x8a, 0x2e, 0x02, 0x62, 0x8c, 0x52, 0xe2, 0x8c, 0x51, 0x70, 0x1d, 0x8a, 0x31,
+    0x4b, 0x8a, 0x31, 0x53, 0x71, 0x89, 0x8a, 0x31, 0x4b, 0x8a, 0x31, 0x45, 0xc0, 0x4c, 0x51, 0x8a,
+    0x5c, 0x51, 0x8a, 0x2e, 0x02, 0x62, 0x8c, 0x52, 0xe2, 0x8c, 0x51, 0x70, 0x13, 0x14, 0x62, 0x97,
+    0x14, 0x62, 0x8b, 0x80, 0x98, 0xa3, 0x14, 0xb8, 0xa3, 0x14, 0x5c, 0x04, 0xc5, 0x18, 0xa5, 0xc5,
+    0x18, 0xa2, 0xe0, 0x26, 0x28, 0xc5, 0x2e, 0x28, 0xc5, 0x17, 0x01, 0x31, 0x46, 0x29, 0x71, 0x46,
+    0x28, 0xb8, 0x09, 0x8a, 0x31, 0x4b, 0x8a, 0x31, 0x45, 0xc0, 0x4c, 0x51, 0x8a, 0x5c, 0x51, 0x8a,
+    0x2e, 0x02, 0x62, 0x8c, 0x52, 0xe2, 0x8c, 0x51, 0x70, 0x13, 0x14, 0x62, 0x97, 0x14, 0x62, 0x8b,
+    0x80, 0x98, 0xa3, 0x14, 0xb8, 0xa3, 0x14, 0x5c, 0x04, 0xc5, 0x18, 0xa5, 0xc5, 0x18, 0xa2, 0xe0,
+    0x26, 0x28, 0xc5, 0x2e, 0x28, 0xc5, 0x17, 0x01, 0x31, 0x46, 0x29, 0x71, 0x46, 0x28, 0xb8, 0x09,
+    0x8a, 0x31, 0x4b, 0x8a, 0x31, 0x45, 0xc0, 0x4c, 0x51, 0x8a, 0x5c, 0x51, 0x8a, 0x2e, 0x02, 0x62,
+    0x8c, 0x52, 0xe2, 0x8c, 0x51, 0x70, 0x13, 0x14, 0x62, 0x97, 0x14, 0x62, 0x8b, 0x80, 0x98, 0xa3,
+    0x14, 0xb8, 0xa3, 0x14, 0x5c, 0x04, 0xc5, 0x18, 0xa5, 0xc5, 0x18, 0xa2, 0xe0, 0x26, 0x28, 0xc5,
+    0x2e, 0x28, 0xc5, 0x17, 0x01, 0x31, 0x46, 0x29, 0x71, 0x46, 0x28, 0xb8, 0x09, 0x8a, 0x31, 0x4b,
+    0x8a, 0x31, 0x45, 0xc0, 0x4c, 0x51, 0x8a, 0x5c, 0x51, 0x8a, 0x2e, 0x02, 0x62, 0x8c, 0x52, 0xe2,
+    0x8c, 0x51, 0x70, 0x13, 0x14, 0x62, 0x97, 0x14, 0x62, 0x8b, 0x80, 0x98, 0xa3, 0x14, 0xb8, 0xa3,
+    0x14, 0x5c, 0x04, 0xc5, 0x18, 0xa5, 0xc5, 0x18, 0xa2, 0xe0, 0x26, 0x28, 0xc5, 0x2e, 0x28, 0xc5,
+    0x17, 0x01, 0x31, 0x46, 0x29, 0x71, 0x46, 0x28, 0xb8, 0x09, 0x8a, 0x31, 0x4b, 0x8a, 0x31, 0x45,
+    0xc0, 0x4c, 0x51, 0x8a, 0x5c, 0x51, 0x8a, 0x2e, 0x02, 0x62, 0x8c, 0x52, 0xe2, 0x8c, 0x51, 0x70,
+    0x13, 0x14, 0x62, 0x97, 0x14, 0x62, 0x8b, 0x80, 0x98, 0xa3, 0x14, 0xb8, 0xa3, 0x14, 0x5c, 0x04,
+    0xc5, 0x18, 0xa5, 0xc5, 0x18, 0xa2, 0xe0, 0x26, 0x28, 0xc5, 0x2e, 0x28, 0xc5, 0x17, 0x01, 0x31,
+    0x46, 0x29, 0x71, 0x46, 0x28, 0xb8, 0x09, 0x8a, 0x31, 0x4b, 0x8a, 0x31, 0x45, 0xc0, 0x4c, 0x51,
+    0x8a, 0x5c, 0x51, 0x8a, 0x2e, 0x02, 0x62, 0x8c, 0x52, 0xe2, 0x8c, 0x51, 0x70, 0x13, 0x14, 0x62,
+    0x97, 0x14, 0x62, 0x8b, 0x80, 0x98, 0xa3, 0x14, 0xb8, 0xa3, 0x14, 0x5c, 0x04, 0xc5, 0x18, 0xa5,
+    0xc5, 0x18, 0xa2, 0xe0, 0x26, 0x28, 0xc5, 0x2e, 0x28, 0xc5, 0x17, 0x01, 0x31, 0x46, 0x29, 0x71,
+    0x46, 0x28, 0xb8, 0x09, 0x8a, 0x31, 0x4b, 0x8a, 0x31, 0x45, 0xc0, 0x5c, 0x51, 0x8a, 0x76, 0x28,
+    0xc5, 0x45, 0xc6, 0x37, 0x14, 0x62, 0x9d, 0x8a, 0x31, 0x45, 0xc0, 0x6e, 0x28, 0xc5, 0x3b, 0x14,
+    0x62, 0x8b, 0x80, 0xdc, 0x51, 0x8a, 0x76, 0x28, 0xc5, 0x17, 0x01, 0xb8, 0xa3, 0x14, 0xec, 0x51,
+    0x8a, 0x2e, 0x03, 0x71, 0x46, 0x29, 0xd8, 0xa3, 0x14, 0x5c, 0x06, 0xe2, 0x8c, 0x53, 0xb1, 0x46,
+    0x28, 0xb8, 0x0d, 0xc5, 0x18, 0xa7, 0x62, 0x8c, 0x51, 0x70, 0x1b, 0x8a, 0x31, 0x4e, 0xc5, 0x18,
+    0xa2, 0xe0, 0x37, 0x14, 0x62, 0x9d, 0x8a, 0x31, 0x45, 0xc0, 0x6e, 0x28, 0xc5, 0x3b, 0x14, 0x62,
+    0x8b, 0x80, 0xdc, 0x51, 0x8a, 0x76, 0x28, 0xc5, 0x17, 0x01, 0xb8, 0xa3, 0x14, 0xec, 0x51, 0x8a,
+    0x2e, 0x03, 0x71, 0x46, 0x29, 0xd8, 0xa3, 0x14, 0x5c, 0x06, 0xe2, 0x8c, 0x53, 0xb1, 0x46, 0x28,
+    0xb8, 0x0d, 0xc5, 0x18, 0xa7, 0x62, 0x8c, 0x51, 0x70, 0x1b, 0x8a, 0x31, 0x4e, 0xc5, 0x18, 0xa2,
+    0xe0, 0x37, 0x14, 0x62, 0x9d, 0x8a, 0x31, 0x45, 0xc0, 0x6e, 0x28, 0xc5, 0x3b, 0x14, 0x62, 0x8b,
+    0x80, 0xdc, 0x51, 0x8a, 0x76, 0x28, 0xc5, 0x17, 0x01, 0xb8, 0xa3, 0x14, 0xec, 0x51, 0x8a, 0x2e,
+    0x03, 0x71, 0x46, 0x29, 0xd8, 0xa3, 0x14, 0x5c, 0x06, 0xe2, 0x8c, 0x53, 0xb1, 0x46, 0x28, 0xb8,
+    0x0d, 0xc5, 0x18, 0xa7, 0x62, 0x8c, 0x51, 0x70, 0x1b, 0x8a, 0x31, 0x4e, 0xc5, 0x18, 0xa2, 0xe0,
+    0x37, 0x14, 0x62, 0x9d, 0x8a, 0x31, 0x45, 0xc0, 0x6e, 0x28, 0xc5, 0x3b, 0x14, 0x62, 0x8b, 0x80,
+    0xdc, 0x51, 0x8a, 0x76, 0x28, 0xc5, 0x17, 0x01, 0xb8, 0xa3, 0x14, 0xec, 0x51, 0x8a, 0x2e, 0x03,
+    0x71, 0x46, 0x29, 0xd8, 0xa3, 0x14, 0x5c, 0x06, 0xe2, 0x8c, 0x53, 0xb1, 0x46, 0x28, 0xb8, 0x0d,
+    0xc5, 0x18, 0xa7, 0x62, 0x8c, 0x51, 0x70, 0x1b, 0x8a, 0x31, 0x4e, 0xc5, 0x18, 0xa2, 0xe0, 0x37,
+    0x14, 0x62, 0x9d, 0x8a, 0x31, 0x45, 0xc0, 0x6e, 0x28, 0xc5, 0x3b, 0x14, 0x62, 0x8b, 0x80, 0xdc,
+    0x51, 0x8a, 0x76, 0x2b, 0x57, 0x43, 0xd0, 0xe5, 0xd5, 0xe7, 0xc9, 0xca, 0x5a, 0xa1, 0xfd, 0xe4,
+    0x9e, 0xbf, 0xec, 0x8f, 0x7f, 0xe5, 0xf9, 0x03, 0x15, 0x6a, 0xc2, 0x94, 0x1c, 0xe6, 0xec, 0x91,
+    0x50, 0x83, 0x9b, 0xe5, 0x8e, 0xe6, 0x75, 0xb5, 0xa4, 0xf7, 0x93, 0x08, 0x6d, 0xa1, 0x79, 0x64,
+    0x3d, 0x94, 0x74, 0xed, 0x93, 0xe8, 0x39, 0xeb, 0x5d, 0x15, 0xaf, 0x82, 0x6e, 0xa4, 0x4d, 0xd7,
+    0x37, 0x31, 0xc2, 0x48, 0x04, 0x2a, 0xae, 0xf2, 0x3d, 0x41, 0xe8, 0x3f, 0x2c, 0xd7, 0x5d, 0x63,
+    0x63, 0x06, 0x9d, 0x6a, 0xb6, 0xf6, 0xe9, 0xb5, 0x17, 0x92, 0x4f, 0x56, 0x3e, 0xa7, 0xde, 0xac,
+    0xd7, 0xce, 0x62, 0x33, 0x9a, 0xb2, 0x76, 0xa3, 0xa2, 0xfc, 0x4f, 0x52, 0x96, 0x02, 0x09, 0x5e,
+    0x7a, 0xb3, 0x9b, 0xff, 0x00, 0x84, 0x2b, 0x4d, 0xff, 0x00, 0x9e, 0xd7, 0x7f, 0xf7, 0xda, 0xff,
+    0x00, 0xf1, 0x34, 0x7f, 0xc2, 0x15, 0xa6, 0xff, 0x00, 0xcf, 0x6b, 0xbf, 0xfb, 0xed, 0x7f, 0xf8,
+    0x9a, 0xe9, 0x28, 0xae, 0x1f, 0xed, 0x0c, 0x57, 0xf3, 0xb3, 0xa3, 0xea, 0xd4, 0x7f, 0x94, 0xe3,
+    0x2e, 0x7c, 0x0f, 0x20, 0xc9, 0xb4, 0xbc, 0x46, 0xcb, 0x70, 0xb2, 0xa9, 0x5c, 0x2f, 0xd4, 0x67,
+    0x27, 0xa7, 0x61, 0x5c, 0xe5, 0xe6, 0x9f, 0x77, 0xa7, 0xc8, 0x23, 0xba, 0x81, 0xe2, 0x27, 0xa1,
+    0x3d, 0x0f, 0xd0, 0x8e, 0x0f, 0x51, 0xd2, 0xbd, 0x5a, 0xa3, 0xb8, 0xb7, 0x8a, 0xea, 0x07, 0x82,
+    0x74, 0x0f, 0x13, 0x8c, 0x32, 0x9e, 0xf5, 0xd9, 0x87, 0xce, 0x6b, 0x41, 0xda, 0xaf, 0xbc, 0xbf,
+    0x13, 0x0a, 0x98, 0x18, 0x49, 0x7b, 0x9a, 0x33, 0xc9, 0x31, 0x46, 0x2b, 0x7f, 0x5e, 0xf0, 0xe3,
+    0xe9, 0x78, 0x9e, 0xdc, 0xbc, 0xb6, 0x87, 0x00, 0x96, 0xfb, 0xc8, 0x7d, 0xf1, 0xd8, 0xfa, 0xfe,
+    0x1f, 0x5c, 0x2c, 0x57, 0xd1, 0xd1, 0xaf, 0x0a, 0xd0, 0x53, 0x83, 0xba, 0x3c, 0xb9, 0xd3, 0x95,
+    0x39, 0x72, 0xc8, 0x6e, 0x28, 0xc5, 0x3b, 0x14, 0x62, 0xb5, 0xb9, 0x03, 0x71, 0x46, 0x29, 0xd8,
+    0xa3, 0x14, 0x5c, 0x06, 0xe2, 0x8c, 0x53, 0xb1, 0x46, 0x28, 0xb8, 0x0d, 0xc5, 0x18, 0xa7, 0x62,
+    0x8c, 0x51, 0x70, 0x1b, 0x8a, 0x31, 0x4e, 0xc5, 0x18, 0xa2, 0xe0, 0x37, 0x14, 0x62, 0x9d, 0x8a,
+    0x31, 0x45, 0xc0, 0x6e, 0x28, 0xc5, 0x3b, 0x14, 0x62, 0x8b, 0x80, 0xdc, 0x51, 0x8a, 0x76, 0x28,
+    0xc5, 0x17, 0x01, 0xb8, 0xa3, 0x14, 0xec, 0x51, 0x8a, 0x2e, 0x03, 0x71, 0x46, 0x29, 0xd8, 0xa3,
+    0x14, 0x5c, 0x05, 0xc5, 0x18, 0xa7, 0x62, 0x8c, 0x54, 0x8c, 0x6e, 0x28, 0xc5, 0x3b, 0x14, 0x62,
+    0x80, 0x1b, 0x8a, 0x31, 0x4e, 0xc5, 0x18, 0xa0, 0x06, 0xe2, 0x8c, 0x53, 0xb1, 0x46, 0x28, 0x01,
+    0xb8, 0xa3, 0x14, 0xec, 0x51, 0x8a, 0x00, 0x6e, 0x28, 0xc5, 0x3b, 0x14, 0x62, 0x80, 0x1b, 0x8a,
+    0x31, 0x4e, 0xc5, 0x18, 0xa0, 0x06, 0xe2, 0x8c, 0x53, 0xb1, 0x46, 0x28, 0x01, 0xb8, 0xa3, 0x14,
+    0xec, 0x51, 0x8a, 0x00, 0x6e, 0x28, 0xc5, 0x3b, 0x14, 0x62, 0x80, 0x1b, 0x8a, 0x31, 0x4e, 0xc5,
+    0x18, 0xa0, 0x06, 0xe2, 0x8c, 0x53, 0xb1, 0x46, 0x28, 0x01, 0xb8, 0xa3, 0x14, 0xec, 0x51, 0x8a,
+    0x00, 0x6e, 0x28, 0xc5, 0x3b, 0x14, 0x62, 0x80, 0x1b, 0x8a, 0x31, 0x4e, 0xc5, 0x18, 0xa0, 0x06,
+    0xe2, 0x8c, 0x53, 0xb1, 0x46, 0x28, 0x01, 0xb8, 0xa3, 0x14, 0xec, 0x51, 0x8a, 0x00, 0x6e, 0x28,
+    0xc5, 0x3b, 0x14, 0x62, 0x80, 0x1b, 0x8a, 0x31, 0x4e, 0xc5, 0x18, 0xa0, 0x06, 0xe2, 0x8c, 0x53,
+    0xb1, 0x46, 0x28, 0x01, 0xb8, 0xa3, 0x14, 0xec, 0x51, 0x8a, 0x00, 0x6e, 0x28, 0xc5, 0x3b, 0x14,
+    0x62, 0x80, 0x1b, 0x8a, 0x31, 0x4e, 0xc5, 0x18, 0xa0, 0x06, 0xe2, 0x8c, 0x53, 0xb1, 0x46, 0x28,
+    0x01, 0xb8, 0xa3, 0x14, 0xec, 0x51, 0x8a, 0x00, 0x6e, 0x28, 0xc5, 0x3b, 0x14, 0x62, 0x80, 0x1b,
+    0x8a, 0x31, 0x4e, 0xc5, 0x18, 0xa0, 0x06, 0xe2, 0x8c, 0x53, 0xb1, 0x46, 0x28, 0x01, 0xb8, 0xa3,
+    0x14, 0xec, 0x51, 0x8a, 0x00, 0x6e, 0x28, 0xc5, 0x3b, 0x14, 0x62, 0x80, 0x1b, 0x8a, 0x31, 0x4e,
+    0xc5, 0x18, 0xa0, 0x06, 0xe2, 0x8c, 0x53, 0xb1, 0x46, 0x28, 0x01, 0xb8, 0xa3, 0x14, 0xec, 0x51,
+    0x8a, 0x00, 0x6e, 0x28, 0xc5, 0x3b, 0x14, 0x62, 0x80, 0x1b, 0x8a, 0x31, 0x4e, 0xc5, 0x18, 0xa0,
+    0x0b, 0x5a, 0x66, 0x9d, 0x26, 0xa7, 0x7d, 0x1d, 0xb4, 0x67, 0x6e, 0xee, 0x59, 0xf1, 0x90, 0xa0,
+    0x75, 0x3f, 0xe7, 0xb9, 0x15, 0xe9, 0x56, 0xb6, 0xd1, 0xd9, 0xda, 0xc5, 0x6f, 0x08, 0xc4, 0x71,
+    0xa8, 0x51, 0xd3, 0x9f, 0x73, 0x8e, 0xe7, 0xad, 0x60, 0x78, 0x3a, 0xc4, 0x45, 0x63, 0x25, 0xe3,
+    0x27, 0xcf, 0x33, 0x6d, 0x52, 0x71, 0xf7, 0x07, 0xa7, 0x71, 0xce, 0x7f, 0x21, 0x5d, 0x2d, 0x7c,
+    0xb6, 0x6b, 0x8a, 0x75, 0x6a, 0xfb, 0x35, 0xb4, 0x7f, 0x33, 0xd7, 0xc1, 0xd1, 0x50, 0x87, 0x33,
+    0xdd, 0x85, 0x14, 0x51, 0x5e, 0x51, 0xda, 0x14, 0x51, 0x45, 0x00, 0x14, 0x51, 0x45, 0x00, 0x23,
+    0xa2, 0xc8, 0x8c, 0x8e, 0xa1, 0x95, 0x86, 0x0a, 0x91, 0x90, 0x47, 0xa5, 0x79, 0xbe, 0xb7, 0xa4,
+    0x36, 0x91, 0x7b, 0xe5, 0x86, 0x2f, 0x0b, 0x8d, 0xd1, 0xb9, 0x1d, 0xbd, 0x0f, 0xb8, 0xff, 0x00,
+    0x0f, 0x5a, 0xf4, 0x9a, 0xc6, 0xf1, 0x3d, 0x88, 0xbc, 0xd1, 0xe4, 0x90, 0x26, 0x65, 0x83, 0xf7,
+    0x8a, 0x46, 0x3a, 0x7f, 0x17, 0x5e, 0xd8, 0xe7, 0xf0, 0x15, 0xe8, 0xe5, 0xb8, 0xa7, 0x46, 0xb2,
+    0x8b, 0xda, 0x5a, 0x3f, 0xd0, 0xe5, 0xc5, 0xd1, 0x55, 0x21, 0x7e, 0xa8, 0xf3, 0xcc, 0x51, 0x8a,
+    0x76, 0x28, 0xc5, 0x7d, 0x69, 0xe2, 0x8d, 0xc5, 0x18, 0xa7, 0x62, 0x8c, 0x50, 0x03, 0x71, 0x46,
+    0x29, 0xd8, 0xa3, 0x14, 0x00, 0xdc, 0x51, 0x8a, 0x76, 0x28, 0xc5, 0x00, 0x37, 0x14, 0x62, 0x9d,
+    0x8a, 0x31, 0x40, 0x0d, 0xc5, 0x18, 0xa7, 0x62, 0x8c, 0x50, 0x03, 0x71, 0x46, 0x29, 0xd8, 0xa3,
+    0x14, 0x00, 0xdc, 0x51, 0x8a, 0x76, 0x28, 0xc5, 0x00, 0x37, 0x14, 0x62, 0x9d, 0x8a, 0x31, 0x40,
+    0x0d, 0xc5, 0x18, 0xa7, 0x62, 0x8c, 0x50, 0x02, 0xd1, 0x4b, 0x45, 0x4d, 0xc0, 0x4a, 0x29, 0x68,
+    0xa2, 0xe0, 0x25, 0x14, 0xb4, 0x51, 0x70, 0x12, 0x8a, 0x5a, 0x28, 0xb8, 0x09, 0x45, 0x2d, 0x14,
+    0x5c, 0x04, 0xa2, 0x96, 0x8a, 0x2e, 0x02, 0x51, 0x4b, 0x45, 0x17, 0x01, 0x28, 0xa5, 0xa2, 0x8b,
+    0x80, 0x94, 0x52, 0xd1, 0x45, 0xc0, 0x4a, 0x29, 0x68, 0xa2, 0xe0, 0x25, 0x14, 0xb4, 0x51, 0x70,
+    0x12, 0x8a, 0x5a, 0x28, 0xb8, 0x09, 0x45, 0x2d, 0x14, 0x5c, 0x04, 0xa2, 0x96, 0x8a, 0x2e, 0x02,
+    0x51, 0x4b, 0x45, 0x17, 0x01, 0x28, 0xa5, 0xa2, 0x8b, 0x80, 0x94, 0x52, 0xd1, 0x45, 0xc0, 0x4a,
+    0x29, 0x68, 0xa2, 0xe0, 0x25, 0x14, 0xb4, 0x51, 0x70, 0x12, 0x8a, 0x5a, 0x28, 0xb8, 0x09, 0x45,
+    0x2d, 0x14, 0x5c, 0x04, 0xa2, 0x96, 0x8a, 0x2e, 0x02, 0x51, 0x4b, 0x45, 0x17, 0x01, 0x28, 0xa5,
+    0xa2, 0x8b, 0x80, 0x94, 0x52, 0xd1, 0x45, 0xc0, 0x4a, 0x29, 0x68, 0xa2, 0xe0, 0x25, 0x14, 0xb4,
+    0x51, 0x70, 0x12, 0x8a, 0x5a, 0x28, 0xb8, 0x09, 0x45, 0x2d, 0x14, 0x5c, 0x04, 0xa2, 0x96, 0x8a,
+    0x2e, 0x02, 0x51, 0x4b, 0x45, 0x17, 0x01, 0x28, 0xa5, 0xa2, 0x8b, 0x80, 0x94, 0x52, 0xd1, 0x45,
+    0xc0, 0x4a, 0x29, 0x68, 0xa2, 0xe0, 0x25, 0x14, 0xb4, 0x51, 0x70, 0x3d, 0x2b, 0x46, 0x89, 0x21,
+    0xd1, 0x6c, 0xd5, 0x06, 0x01, 0x85, 0x5b, 0xaf, 0x72, 0x32, 0x7f, 0x52, 0x6a, 0xf5, 0x54, 0xd2,
+    0xff, 0x00, 0xe4, 0x11, 0x65, 0xff, 0x00, 0x5c, 0x13, 0xff, 0x00, 0x41, 0x15, 0x6e, 0xbe, 0x1e,
+    0xb3, 0xbd, 0x49, 0x37, 0xdd, 0x9f, 0x43, 0x0f, 0x85, 0x05, 0x14, 0x51, 0x59, 0x96, 0x14, 0x51,
+    0x45, 0x00, 0x14, 0x51, 0x45, 0x00, 0x14, 0xc9, 0x62, 0x49, 0xe1, 0x78, 0xa4, 0x1b, 0x91, 0xd4,
+    0xab, 0x0c, 0xe3, 0x20, 0xf0, 0x69, 0xf4, 0x53, 0x4e, 0xda, 0xa1, 0x1e, 0x4d, 0x45, 0x2d, 0x15,
+    0xf7, 0x77, 0x3e, 0x70, 0x4a, 0x29, 0x68, 0xa2, 0xe0, 0x25, 0x14, 0xb4, 0x51, 0x70, 0x12, 0x8a,
+    0x5a, 0x28, 0xb8, 0x09, 0x45, 0x2d, 0x14, 0x5c, 0x04, 0xa2, 0x96, 0x8a, 0x2e, 0x02, 0x51, 0x4b,
+    0x45, 0x17, 0x01, 0x28, 0xa5, 0xa2, 0x8b, 0x80, 0x94, 0x52, 0xd1, 0x45, 0xc0, 0x4a, 0x29, 0x68,
+    0xa2, 0xe0, 0x3b, 0x14, 0x62, 0x97, 0x14, 0x62, 0xa2, 0xe3, 0x13, 0x14, 0x62, 0x97, 0x14, 0x62,
+    0x8b, 0x80, 0x98, 0xa3, 0x14, 0xb8, 0xa3, 0x14, 0x5c, 0x04, 0xc5, 0x18, 0xa5, 0xc5, 0x18, 0xa2,
+    0xe0, 0x26, 0x28, 0xc5, 0x2e, 0x28, 0xc5, 0x17, 0x01, 0x31, 0x46, 0x29, 0x71, 0x46, 0x28, 0xb8,
+    0x09, 0x8a, 0x31, 0x4b, 0x8a, 0x31, 0x45, 0xc0, 0x4c, 0x51, 0x8a, 0x5c, 0x51, 0x8a, 0x2e, 0x02,
+    0x62, 0x8c, 0x52, 0xe2, 0x8c, 0x51, 0x70, 0x13, 0x14, 0x62, 0x97, 0x14, 0x62, 0x8b, 0x80, 0x98,
+    0xa3, 0x14, 0xb8, 0xa3, 0x14, 0x5c, 0x04, 0xc5, 0x18, 0xa5, 0xc5, 0x18, 0xa2, 0xe0, 0x26, 0x28,
+    0xc5, 0x2e, 0x28, 0xc5, 0x17, 0x01, 0x31, 0x46, 0x29, 0x71, 0x46, 0x28, 0xb8, 0x09, 0x8a, 0x31,
+    0x4b, 0x8a, 0x31, 0x45, 0xc0, 0x4c, 0x51, 0x8a, 0x5c, 0x51, 0x8a, 0x2e, 0x02, 0x62, 0x8c, 0x52,
+    0xe2, 0x8c, 0x51, 0x70, 0x13, 0x14, 0x62, 0x97, 0x14, 0x62, 0x8b, 0x80, 0x98, 0xa3, 0x14, 0xb8,
+    0xa3, 0x14, 0x5c, 0x04, 0xc5, 0x18, 0xa5, 0xc5, 0x18, 0xa2, 0xe0, 0x26, 0x28, 0xc5, 0x2e, 0x28,
+    0xc5, 0x17, 0x01, 0x31, 0x46, 0x29, 0x71, 0x46, 0x28, 0xb8, 0x09, 0x8a, 0x31, 0x4b, 0x8a, 0x31,
+    0x45, 0xc0, 0x4c, 0x51, 0x8a, 0x5c, 0x51, 0x8a, 0x2e, 0x02, 0x62, 0x8c, 0x52, 0xe2, 0x8c, 0x51,
+    0x70, 0x13, 0x14, 0x62, 0x97, 0x14, 0x62, 0x8b, 0x80, 0x98, 0xa3, 0x14, 0xb8, 0xa3, 0x14, 0x5c,
+    0x04, 0xc5, 0x18, 0xa5, 0xc5, 0x18, 0xa2, 0xe0, 0x26, 0x28, 0xc5, 0x2e, 0x28, 0xc5, 0x17, 0x01,
+    0x31, 0x46, 0x29, 0x71, 0x46, 0x28, 0xb8, 0x09, 0x8a, 0x31, 0x4b, 0x8a, 0x31, 0x45, 0xc0, 0x4c,
+    0x51, 0x8a, 0x5c, 0x51, 0x8a, 0x2e, 0x02, 0x62, 0x8c, 0x52, 0xe2, 0x8c, 0x51, 0x70, 0x13, 0x14,
+    0x62, 0x97, 0x14, 0x62, 0x8b, 0x80, 0x98, 0xa3, 0x14, 0xb8, 0xa3, 0x14, 0x5c, 0x0f, 0x42, 0xf0,
+    0xfd, 0xc7, 0xda, 0x74, 0x4b, 0x66, 0x25, 0x77, 0x22, 0xf9, 0x64, 0x2f, 0x6d, 0xbc, 0x0c, 0xfb,
+    0xe3, 0x07, 0xf1, 0xad, 0x3a, 0xe3, 0xfc, 0x23, 0x7f, 0xe5, 0xdc, 0x49, 0x62, 0xe7, 0xe5, 0x97,
+    0xe7, 0x8f, 0xfd, 0xe0, 0x39, 0x1d, 0x3b, 0x81, 0xfa, 0x7b, 0xd7, 0x61, 0x5f, 0x23, 0x8e, 0xa2,
+    0xe9, 0x57, 0x92, 0xe8, 0xf5, 0x5f, 0x33, 0xdc, 0xc3, 0xcf, 0x9e, 0x9a, 0x61, 0x45, 0x14, 0x57,
+    0x21, 0xb8, 0x51, 0x45, 0x14, 0x00, 0x51, 0x45, 0x14, 0x00, 0x55, 0x7b, 0xfb, 0x8f, 0xb2, 0x58,
+    0x5c, 0x5c, 0x65, 0x41, 0x8e, 0x32, 0xcb, 0xbf, 0xa1, 0x38, 0xe0, 0x7e, 0x78, 0xab, 0x15, 0xcd,
+    0x78, 0xba, 0xff, 0x00, 0xcb, 0xb7, 0x8e, 0xc5, 0x0f, 0xcd, 0x2f, 0xcf, 0x27, 0xfb, 0xa0, 0xf0,
+    0x3a, 0x77, 0x23, 0xf4, 0xf7, 0xae, 0x8c, 0x2d, 0x17, 0x5a, 0xb4, 0x61, 0xfd, 0x58, 0xca, 0xb4,
+    0xf9, 0x20, 0xe4, 0x71, 0xd8, 0xa3, 0x14, 0xb8, 0xa3, 0x15, 0xf6, 0x37, 0x3c, 0x11, 0x31, 0x46,
+    0x29, 0x71, 0x46, 0x28, 0xb8, 0x09, 0x8a, 0x31, 0x4b, 0x8a, 0x31, 0x45, 0xc0, 0x4c, 0x51, 0x8a,
+    0x5c, 0x51, 0x8a, 0x2e, 0x02, 0x62, 0x8c, 0x52, 0xe2, 0x8c, 0x51, 0x70, 0x13, 0x14, 0x62, 0x97,
+    0x14, 0x62, 0x8b, 0x80, 0x98, 0xa3, 0x14, 0xb8, 0xa3, 0x14, 0x5c, 0x04, 0xc5, 0x18, 0xa5, 0xc5,
+    0x18, 0xa2, 0xe0, 0x26, 0x28, 0xc5, 0x2e, 0x28, 0xc5, 0x17, 0x01, 0x31, 0x46, 0x29, 0x71, 0x46,
+    0x28, 0xb8, 0x0e, 0xc5, 0x18, 0xa5, 0xc5, 0x18, 0xa9, 0xb8, 0xc4, 0xc5, 0x18, 0xa5, 0xc5, 0x18,
+    0xa2, 0xe0, 0x26, 0x28, 0xc5, 0x2e, 0x28, 0xc5, 0x17, 0x01, 0x31, 0x46, 0x29, 0x71, 0x46, 0x28,
+    0xb8, 0x09, 0x8a, 0x31, 0x4b, 0x8a, 0x31, 0x45, 0xc0, 0x4c, 0x51, 0x8a, 0x5c, 0x51, 0x8a, 0x2e,
+    0x02, 0x62, 0x8c, 0x52, 0xe2, 0x8c, 0x51, 0x70, 0x13, 0x14, 0x62, 0x97, 0x14, 0x62, 0x8b, 0x80,
+    0x98, 0xa3, 0x14, 0xb8, 0xa3, 0x14, 0x5c, 0x04, 0xc5, 0x18, 0xa5, 0xc5, 0x18, 0xa2, 0xe0, 0x26,
+    0x28, 0xc5, 0x2e, 0x28, 0xc5, 0x17, 0x01, 0x31, 0x46, 0x29, 0x71, 0x46, 0x28, 0xb8, 0x09, 0x8a,
+    0x31, 0x4b, 0x8a, 0x31, 0x45, 0xc0, 0x4c, 0x51, 0x8a, 0x5c, 0x51, 0x8a, 0x2e, 0x02, 0x62, 0x8c,
+    0x52, 0xe2, 0x8c, 0x51, 0x70, 0x13, 0x14, 0x62, 0x97, 0x14, 0x62, 0x8b, 0x80, 0x98, 0xa3, 0x14,
+    0xb8, 0xa3, 0x14, 0x5c, 0x04, 0xc5, 0x18, 0xa5, 0xc5, 0x18, 0xa2, 0xe0, 0x26, 0x28, 0xc5, 0x2e,
+    0x28, 0xc5, 0x17, 0x01, 0x31, 0x46, 0x29, 0x71, 0x46, 0x28, 0xb8, 0x09, 0x8a, 0x31, 0x4b, 0x8a,
+    0x31, 0x45, 0xc0, 0x4c, 0x51, 0x8a, 0x5c, 0x51, 0x8a, 0x2e, 0x02, 0x62, 0x8c, 0x52, 0xe2, 0x8c,
+    0x51, 0x70, 0x13, 0x14, 0x62, 0x97, 0x14, 0x62, 0x8b, 0x80, 0x98, 0xa3, 0x14, 0xb8, 0xa3, 0x14,
+    0x5c, 0x04, 0xc5, 0x18, 0xa5, 0xc5, 0x18, 0xa2, 0xe0, 0x26, 0x28, 0xc5, 0x2e, 0x28, 0xc5, 0x17,
+    0x01, 0x31, 0x46, 0x29, 0x71, 0x46, 0x28, 0xb8, 0x09, 0x8a, 0x31, 0x4b, 0x8a, 0x31, 0x45, 0xc0,
+    0x4c, 0x51, 0x8a, 0x5c, 0x51, 0x8a, 0x2e, 0x02, 0x62, 0x8c, 0x52, 0xe2, 0x8c, 0x51, 0x70, 0x13,
+    0x14, 0x62, 0x97, 0x14, 0x62, 0x8b, 0x80, 0x98, 0xa3, 0x14, 0xb8, 0xa3, 0x14, 0x5c, 0x04, 0xc5,
+    0x18, 0xa5, 0xc5, 0x18, 0xa2, 0xe0, 0x26, 0x28, 0xc5, 0x2e, 0x28, 0xc5, 0x17, 0x00, 0x56, 0x64,
+    0x75, 0x74, 0x62, 0xac, 0xa7, 0x20, 0x83, 0x82, 0x0d, 0x77, 0xba, 0x26, 0xaf, 0x1e, 0xa7, 0x6c,
+    0x15, 0x9b, 0x17, 0x31, 0xa8, 0xf3, 0x14, 0xff, 0x00, 0x17, 0xfb, 0x43, 0xdb, 0xf9, 0x7e, 0x55,
+    0xc1, 0x62, 0xa4, 0x82, 0x69, 0x6d, 0xa6, 0x49, 0xa1, 0x72, 0x92, 0x21, 0xca, 0xb0, 0xed, 0x5c,
+    0x78, 0xcc, 0x2c, 0x71, 0x10, 0xb6, 0xcd, 0x6c, 0x6f, 0x42, 0xbb, 0xa5, 0x2b, 0xf4, 0x3d, 0x3a,
+    0x8a, 0xe7, 0xb4, 0xbf, 0x13, 0x43, 0x34, 0x69, 0x15, 0xf3, 0x79, 0x73, 0x74, 0xf3, 0x31, 0xf2,
+    0xb7, 0xd7, 0xd0, 0xfe, 0x9c, 0x7e, 0x15, 0xd0, 0x2b, 0x2b, 0xa0, 0x74, 0x60, 0xca, 0xc3, 0x20,
+    0x83, 0x90, 0x45, 0x7c, 0xd5, 0x6a, 0x15, 0x28, 0xcb, 0x96, 0x68, 0xf5, 0xe9, 0xd4, 0x8d, 0x45,
+    0x78, 0xb1, 0x68, 0xa2, 0x8a, 0xc4, 0xd0, 0x28, 0xa2, 0xb1, 0x35, 0x1f, 0x12, 0x5a, 0x5a, 0xa3,
+    0x25, 0xbb, 0x0b, 0x89, 0xf1, 0xc6, 0xde, 0x50, 0x1f, 0x73, 0xdf, 0xaf, 0x6f, 0x4e, 0xd5, 0xa5,
+    0x2a, 0x33, 0xab, 0x2e, 0x58, 0x2b, 0x91, 0x3a, 0x91, 0x82, 0xbc, 0x99, 0x7b, 0x53, 0xd4, 0xe0,
+    0xd2, 0xed, 0xbc, 0xd9, 0x7e, 0x67, 0x3c, 0x24, 0x60, 0xf2, 0xc7, 0xfc, 0x3d, 0xeb, 0xcf, 0x67,
+    0x9a, 0x5b, 0x99, 0xde, 0x69, 0x9c, 0xbc, 0x8e, 0x72, 0xcc, 0x7b, 0xd4, 0x97, 0x57, 0x77, 0x17,
+    0xb3, 0x19, 0xae, 0x24, 0x32, 0x3e, 0x31, 0x93, 0xc6, 0x07, 0xb0, 0xed, 0x50, 0x62, 0xbe, 0x97,
+    0x05, 0x83, 0x58, 0x78, 0xeb, 0xac, 0x9e, 0xe7, 0x91, 0x88, 0xae, 0xea, 0xbf, 0x21, 0x31, 0x46,
+    0x29, 0x71, 0x46, 0x2b, 0xba, 0xe7, 0x38, 0x98, 0xa3, 0x14, 0xb8, 0xa3, 0x14, 0x5c, 0x04, 0xc5,
+    0x18, 0xa5, 0xc5, 0x18, 0xa2, 0xe0, 0x26, 0x28, 0xc5, 0x2e, 0x28, 0xc5, 0x17, 0x01, 0x31, 0x46,
+    0x29, 0x71, 0x46, 0x28, 0xb8, 0x09, 0x8a, 0x31, 0x4b, 0x8a, 0x31, 0x45, 0xc0, 0x4c, 0x51, 0x8a,
+    0x5c, 0x51, 0x8a, 0x2e, 0x02, 0x62, 0x8c, 0x52, 0xe2, 0x8c, 0x51, 0x70, 0x13, 0x14, 0x62, 0x97,
+    0x14, 0x62, 0x8b, 0x80, 0x98, 0xa3, 0x14, 0xb8, 0xa3, 0x14, 0x5c, 0x07, 0x62, 0x8c, 0x52, 0xe2,
+    0x8c, 0x54, 0x5c, 0x62, 0x62, 0x8c, 0x52, 0xe2, 0x8c, 0x51, 0x70, 0x13, 0x14, 0x62, 0x97, 0x14,
+    0x62, 0x8b, 0x80, 0x98, 0xa3, 0x14, 0xb8, 0xa3, 0x14, 0x5c, 0x04, 0xc5, 0x18, 0xa5, 0xc5, 0x18,
+    0xa2, 0xe0, 0x26, 0x28, 0xc5, 0x2e, 0x28, 0xc5, 0x17, 0x01, 0x31, 0x46, 0x29, 0x71, 0x46, 0x28,
+    0xb8, 0x09, 0x8a, 0x31, 0x4b, 0x8a, 0x31, 0x45, 0xc0, 0x4c, 0x51, 0x8a, 0x5c, 0x51, 0x8a, 0x2e,
+    0x02, 0x62, 0x8c, 0x52, 0xe2, 0x8c, 0x51, 0x70, 0x13, 0x14, 0x62, 0x97, 0x14, 0x62, 0x8b, 0x80,
+    0x98, 0xa3, 0x14, 0xb8, 0xa3, 0x14, 0x5c, 0x04, 0xc5, 0x18, 0xa5, 0xc5, 0x18, 0xa2, 0xe0, 0x26,
+    0x28, 0xc5, 0x2e, 0x28, 0xc5, 0x17, 0x01, 0x31, 0x46, 0x29, 0x71, 0x46, 0x28, 0xb8, 0x09, 0x8a,
+    0x31, 0x4b, 0x8a, 0x31, 0x45, 0xc0, 0x4c, 0x51, 0x8a, 0x5c, 0x51, 0x8a, 0x2e, 0x02, 0x62, 0x8c,
+    0x52, 0xe2, 0x8c, 0x51, 0x70, 0x13, 0x14, 0x62, 0x97, 0x14, 0x62, 0x8b, 0x80, 0x98, 0xa3, 0x14,
+    0xb8, 0xa3, 0x14, 0x5c, 0x04, 0xc5, 0x18, 0xa5, 0xc5, 0x18, 0xa2, 0xe0, 0x26, 0x28, 0xc5, 0x2e,
+    0x28, 0xc5, 0x17, 0x01, 0x31, 0x46, 0x29, 0x71, 0x46, 0x28, 0xb8, 0x09, 0x8a, 0x31, 0x4b, 0x8a,
+    0x31, 0x45, 0xc0, 0x4c, 0x51, 0x8a, 0x5c, 0x51, 0x8a, 0x2e, 0x02, 0x62, 0x8c, 0x52, 0xe2, 0x8c,
+    0x51, 0x70, 0x13, 0x14, 0x62, 0x97, 0x14, 0x62, 0x8b, 0x80, 0x98, 0xa3, 0x14, 0xb8, 0xa3, 0x14,
+    0x5c, 0x04, 0xc5, 0x18, 0xa5, 0xc5, 0x18, 0xa2, 0xe0, 0x26, 0x28, 0xc5, 0x2e, 0x28, 0xc5, 0x17,
+    0x01, 0x31, 0x46, 0x29, 0x71, 0x46, 0x28, 0xb8, 0x09, 0x8a, 0x31, 0x4b, 0x8a, 0x31, 0x45, 0xc0,
+    0x4c, 0x51, 0x8a, 0x5c, 0x51, 0x8a, 0x2e, 0x02, 0x62, 0x8c, 0x52, 0xe2, 0x8c, 0x51, 0x70, 0x13,
+    0x14, 0x62, 0x97, 0x14, 0x62, 0x8b, 0x80, 0x98, 0xa3, 0x14, 0xb8, 0xa3, 0x14, 0x5c, 0x04, 0xc5,
+    0x4b, 0x0d, 0xcd, 0xc5, 0xbe, 0xef, 0x22, 0x79, 0x62, 0xdd, 0xd7, 0x63, 0x95, 0xcf, 0xe5, 0x51,
+    0xe2, 0x8c, 0x52, 0x69, 0x35, 0x66, 0x09, 0xb5, 0xb1, 0xa7, 0xff, 0x00, 0x09, 0x16, 0xab, 0xff,
+    0x00, 0x3f, 0x7f, 0xf9, 0x0d, 0x7f, 0xc2, 0x8f, 0xf8, 0x48, 0xb5, 0x5f, 0xf9, 0xfb, 0xff, 0x00,
+    0xc8, 0x6b, 0xfe, 0x15, 0x99, 0x8a, 0x31, 0x59, 0x7d, 0x5a, 0x8f, 0xf2, 0x2f, 0xb9, 0x1a, 0x7b,
+    0x6a, 0x9f, 0xcc, 0xfe, 0xf2, 0x6b, 0x8b, 0xdb, 0xab, 0xbc, 0xf9, 0xf7, 0x12, 0xc8, 0x0b, 0x6e,
+    0xda, 0xcc, 0x70, 0x0f, 0xb0, 0xe8, 0x2a, 0x0c, 0x52, 0xe2, 0x8c, 0x56, 0xb1, 0x4a, 0x2a, 0xc9,
+    0x19, 0xb6, 0xde, 0xac, 0x4c, 0x51, 0x8a, 0x5c, 0x51, 0x8a, 0x77, 0x01, 0x31, 0x46, 0x29, 0x71,
+    0x46, 0x28, 0xb8, 0x09, 0x8a, 0x31, 0x4b, 0x8a, 0x31, 0x45, 0xc0, 0x4c, 0x51, 0x8a, 0x5c, 0x51,
+    0x8a, 0x2e, 0x02, 0x62, 0x8c, 0x52, 0xe2, 0x8c, 0x51, 0x70, 0x13, 0x14, 0x62, 0x97, 0x14, 0x62,
+    0x8b, 0x80, 0x98, 0xa3, 0x14, 0xb8, 0xa3, 0x14, 0x5c, 0x04, 0xc5, 0x18, 0xa5, 0xc5, 0x18, 0xa2,
+    0xe0, 0x26, 0x28, 0xc5, 0x2e, 0x28, 0xc5, 0x17, 0x01, 0x31, 0x46, 0x29, 0x71, 0x46, 0x28, 0xb8,
+    0x09, 0x8a, 0x31, 0x4b, 0x8a, 0x31, 0x45, 0xc0, 0x5c, 0x51, 0x8a, 0x76, 0x28, 0xc5, 0x4d, 0xc0,
+    0x6e, 0x28, 0xc5, 0x3b, 0x14, 0x62, 0x8b, 0x80, 0xdc, 0x51, 0x8a, 0x76, 0x28, 0xc5, 0x17, 0x01,
+    0xb8, 0xa3, 0x14, 0xec, 0x51, 0x8a, 0x2e, 0x03, 0x71, 0x46, 0x29, 0xd8, 0xa3, 0x14, 0x5c, 0x06,
+    0xe2, 0x8c, 0x53, 0xb1, 0x46, 0x28, 0xb8, 0x0d, 0xc5, 0x18, 0xa7, 0x62, 0x8c, 0x51, 0x70, 0x1b,
+    0x8a, 0x31, 0x4e, 0xc5, 0x18, 0xa2, 0xe0, 0x37, 0x14, 0x62, 0x9d, 0x8a, 0x31, 0x45, 0xc0, 0x6e,
+    0x28, 0xc5, 0x3b, 0x14, 0x62, 0x8b, 0x80, 0xdc, 0x51, 0x8a, 0x76, 0x28, 0xc5, 0x17, 0x01, 0xb8,
+    0xa3, 0x14, 0xec, 0x51, 0x8a, 0x2e, 0x03, 0x71, 0x46, 0x29, 0xd8, 0xa3, 0x14, 0x5c, 0x06, 0xe2,
+    0x8c, 0x53, 0xb1, 0x46, 0x28, 0xb8, 0x0d, 0xc5, 0x18, 0xa7, 0x62, 0x8c, 0x51, 0x70, 0x1b, 0x8a,
+    0x31, 0x4e, 0xc5, 0x18, 0xa2, 0xe0, 0x37, 0x14, 0x62, 0x9d, 0x8a, 0x31, 0x45, 0xc0, 0x6e, 0x28,
+    0xc5, 0x3b, 0x14, 0x62, 0x8b, 0x80, 0xdc, 0x51, 0x8a, 0x76, 0x28, 0xc5, 0x17, 0x01, 0xb8, 0xa3,
+    0x14, 0xec, 0x51, 0x8a, 0x2e, 0x03, 0x71, 0x46, 0x29, 0xd8, 0xa3, 0x14, 0x5c, 0x06, 0xe2, 0x8c,
+    0x53, 0xb1, 0x46, 0x28, 0xb8, 0x0d, 0xc5, 0x18, 0xa7, 0x62, 0x8c, 0x51, 0x70, 0x1b, 0x8a, 0x31,
+    0x4e, 0xc5, 0x18, 0xa2, 0xe0, 0x37, 0x14, 0x62, 0x9d, 0x8a, 0x31, 0x45, 0xc0, 0x6e, 0x28, 0xc5,
+    0x3b, 0x14, 0x62, 0x8b, 0x80, 0xdc, 0x51, 0x8a, 0x76, 0x28, 0xc5, 0x17, 0x01, 0xb8, 0xa3, 0x14,
+    0xec, 0x51, 0x8a, 0x2e, 0x03, 0x71, 0x46, 0x29, 0xd8, 0xa3, 0x14, 0x5c, 0x06, 0xe2, 0x8c, 0x53,
+    0xb1, 0x46, 0x28, 0xb8, 0x0d, 0xc5, 0x18, 0xa7, 0x62, 0x8c, 0x51, 0x70, 0x1b, 0x8a, 0x31, 0x4e,
+    0xc5, 0x18, 0xa2, 0xe0, 0x37, 0x14, 0x62, 0x9d, 0x8a, 0x31, 0x45, 0xc0, 0x6e, 0x28, 0xc5, 0x3b,
+    0x14, 0x62, 0x8b, 0x80, 0xdc, 0x51, 0x8a, 0x76, 0x28, 0xc5, 0x17, 0x01, 0xb8, 0xa3, 0x14, 0xec,
+    0x51, 0x8a, 0x2e, 0x03, 0x71, 0x46, 0x29, 0xd8, 0xa3, 0x14, 0x5c, 0x06, 0xe2, 0x8c, 0x53, 0xb1,
+    0x46, 0x28, 0xb8, 0x0d, 0xc5, 0x18, 0xa7, 0x62, 0x8c, 0x51, 0x70, 0x1b, 0x8a, 0x31, 0x4e, 0xc5,
+    0x18, 0xa2, 0xe0, 0x37, 0x14, 0x62, 0x9d, 0x8a, 0x31, 0x45, 0xc0, 0x6e, 0x28, 0xc5, 0x3b, 0x14,
+    0x62, 0x8b, 0x80, 0xdc, 0x51, 0x8a, 0x76, 0x28, 0xc5, 0x17, 0x01, 0xb8, 0xa3, 0x14, 0xec, 0x51,
+    0x8a, 0x2e, 0x03, 0x71, 0x46, 0x29, 0xd8, 0xa3, 0x14, 0x5c, 0x06, 0xe2, 0x8c, 0x53, 0xb1, 0x46,
+    0x28, 0xb8, 0x0d, 0xc5, 0x18, 0xa7, 0x62, 0x8c, 0x51, 0x70, 0x1b, 0x8a, 0x31, 0x4e, 0xc5, 0x18,
+    0xa2, 0xe0, 0x37, 0x14, 0x62, 0x9d, 0x8a, 0x31, 0x45, 0xc0, 0x6e, 0x28, 0xc5, 0x3b, 0x14, 0x62,
+    0x8b, 0x80, 0xb8, 0xa3, 0x14, 0xec, 0x51, 0x8a, 0x8b, 0x8c, 0x6e, 0x28, 0xc5, 0x3b, 0x14, 0x62,
+    0x8b, 0x80, 0xdc, 0x51, 0x8a, 0x76, 0x28, 0xc5, 0x17, 0x01, 0xb8, 0xa3, 0x14, 0xec, 0x51, 0x8a,
+    0x2e, 0x03, 0x71, 0x46, 0x29, 0xd8, 0xa3, 0x14, 0x5c, 0x06, 0xe2, 0x8c, 0x53, 0xb1, 0x46, 0x28,
+    0xb8, 0x0d, 0xc5, 0x18, 0xa7, 0x62, 0x8c, 0x51, 0x70, 0x1b, 0x8a, 0x31, 0x4e, 0xc5, 0x18, 0xa2,
+    0xe0, 0x37, 0x14, 0x62, 0x9d, 0x8a, 0x31, 0x45, 0xc0, 0x6e, 0x28, 0xc5, 0x3b, 0x14, 0x62, 0x8b,
+    0x80, 0xdc, 0x51, 0x8a, 0x76, 0x28, 0xc5, 0x17, 0x01, 0xb8, 0xa3, 0x14, 0xec, 0x51, 0x8a, 0x2e,
+    0x03, 0x71, 0x46, 0x29, 0xd8, 0xa3, 0x14, 0x5c, 0x06, 0xe2, 0x8c, 0x53, 0xb1, 0x46, 0x28, 0xb8,
+    0x0d, 0xc5, 0x18, 0xa7, 0x62, 0x8c, 0x51, 0x70, 0x1b, 0x8a, 0x31, 0x4e, 0xc5, 0x18, 0xa2, 0xe0,
+    0x37, 0x14, 0x62, 0x9d, 0x8a, 0x31, 0x45, 0xc0, 0x6e, 0x28, 0xc5, 0x3b, 0x14, 0x62, 0x8b, 0x80,
+    0xdc, 0x51, 0x8a, 0x76, 0x28, 0xc5, 0x17, 0x01, 0xb8, 0xa3, 0x14, 0xec, 0x51, 0x8a, 0x2e, 0x03,
+    0x71, 0x46, 0x29, 0xd8, 0xa3, 0x14, 0x5c, 0x06, 0xe2, 0x8c, 0x53, 0xb1, 0x46, 0x28, 0xb8, 0x0d,
+    0xc5, 0x18, 0xa7, 0x62, 0x8c, 0x51, 0x70, 0x1b, 0x8a, 0x31, 0x4e, 0xc5, 0x18, 0xa2, 0xe0, 0x37,
+    0x14, 0x62, 0x9d, 0x8a, 0x31, 0x45, 0xc0, 0x6e, 0x28, 0xc5, 0x3b, 0x14, 0x62, 0x8b, 0x80, 0xdc,
+    0x51, 0x8a, 0x76, 0x28, 0xc5, 0x17, 0x01, 0xb8, 0xa3, 0x14, 0xec, 0x51, 0x8a, 0x2e, 0x03, 0x71,
+    0x46, 0x29, 0xd8, 0xa3, 0x14, 0x5c, 0x06, 0xe2, 0x8c, 0x53, 0xb1, 0x46, 0x28, 0xb8, 0x0d, 0xc5,
+    0x18, 0xa7, 0x62, 0x8c, 0x51, 0x70, 0x1b, 0x8a, 0x31, 0x4e, 0xc5, 0x18, 0xa2, 0xe0, 0x37, 0x14,
+    0x62, 0x9d, 0x8a, 0x31, 0x45, 0xc0, 0x6e, 0x28, 0xc5, 0x3b, 0x14, 0x62, 0x8b, 0x80, 0xdc, 0x51,
+    0x8a, 0x76, 0x28, 0xc5, 0x17, 0x01, 0xb8, 0xa3, 0x14, 0xec, 0x51, 0x8a, 0x2e, 0x03, 0x71, 0x46,
+    0x29, 0xd8, 0xa3, 0x14, 0x5c, 0x06, 0xe2, 0x8c, 0x53, 0xb1, 0x46, 0x28, 0xb8, 0x0d, 0xc5, 0x18,
+    0xa7, 0x62, 0x8c, 0x51, 0x70, 0x1b, 0x8a, 0x31, 0x4e, 0xc5, 0x18, 0xa2, 0xe0, 0x37, 0x14, 0x62,
+    0x9d, 0x8a, 0x31, 0x45, 0xc0, 0x6e, 0x28, 0xc5, 0x3b, 0x14, 0x62, 0x8b, 0x80, 0xdc, 0x51, 0x8a,
+    0x76, 0x28, 0xc5, 0x17, 0x01, 0xb8, 0xa3, 0x14, 0xec, 0x51, 0x8a, 0x2e, 0x03, 0x71, 0x46, 0x29,
+    0xd8, 0xa3, 0x14, 0x5c, 0x06, 0xe2, 0x8c, 0x53, 0xb1, 0x46, 0x28, 0xb8, 0x0d, 0xc5, 0x18, 0xa7,
+    0x62, 0x8c, 0x51, 0x70, 0x1b, 0x8a, 0x31, 0x4e, 0xc5, 0x18, 0xa2, 0xe0, 0x37, 0x14, 0x62, 0x9d,
+    0x8a, 0x31, 0x45, 0xc0, 0x6e, 0x28, 0xc5, 0x3b, 0x14, 0x62, 0x8b, 0x80, 0xb4, 0x52, 0xd1, 0x53,
+    0x71, 0x89, 0x45, 0x2d, 0x14, 0x5c, 0x04, 0xa2, 0x96, 0x8a, 0x2e, 0x02, 0x51, 0x4b, 0x45, 0x17,
+    0x01, 0x28, 0xa5, 0xa2, 0x8b, 0x80, 0x94, 0x52, 0xd1, 0x45, 0xc0, 0x4a, 0x29, 0x68, 0xa2, 0xe0,
+    0x25, 0x14, 0xb4, 0x51, 0x70, 0x12, 0x8a, 0x5a, 0x28, 0xb8, 0x09, 0x45, 0x2d, 0x14, 0x5c, 0x04,
+    0xa2, 0x96, 0x8a, 0x2e, 0x02, 0x51, 0x4b, 0x45, 0x17, 0x01, 0x28, 0xa5, 0xa2, 0x8b, 0x80, 0x94,
+    0x52, 0xd1, 0x45, 0xc0, 0x4a, 0x29, 0x68, 0xa2, 0xe0, 0x25, 0x14, 0xb4, 0x51, 0x70, 0x12, 0x8a,
+    0x5a, 0x28, 0xb8, 0x09, 0x45, 0x2d, 0x14, 0x5c, 0x04, 0xa2, 0x96, 0x8a, 0x2e, 0x02, 0x51, 0x4b,
+    0x45, 0x17, 0x01, 0x28, 0xa5, 0xa2, 0x8b, 0x80, 0x94, 0x52, 0xd1, 0x45, 0xc0, 0x4a, 0x29, 0x68,
+    0xa2, 0xe0, 0x25, 0x14, 0xb4, 0x51, 0x70, 0x12, 0x8a, 0x5a, 0x28, 0xb8, 0x09, 0x45, 0x2d, 0x14,
+    0x5c, 0x04, 0xa2, 0x96, 0x8a, 0x2e, 0x02, 0x51, 0x4b, 0x45, 0x17, 0x01, 0x28, 0xa5, 0xa2, 0x8b,
+    0x80, 0x94, 0x52, 0xd1, 0x45, 0xc0, 0x4a, 0x29, 0x68, 0xa2, 0xe0, 0x25, 0x14, 0xb4, 0x51, 0x70,
+    0x12, 0x8a, 0x5a, 0x28, 0xb8, 0x09, 0x45, 0x2d, 0x14, 0x5c, 0x04, 0xa2, 0x96, 0x8a, 0x2e, 0x02,
+    0x51, 0x4b, 0x45, 0x17, 0x01, 0x28, 0xa5, 0xa2, 0x8b, 0x80, 0x94, 0x52, 0xd1, 0x45, 0xc0, 0x4a,
+    0x29, 0x68, 0xa2, 0xe0, 0x25, 0x14, 0xb4, 0x51, 0x70, 0x12, 0x8a, 0x5a, 0x28, 0xb8, 0x09, 0x45,
+    0x2d, 0x14, 0x5c, 0x04, 0xa2, 0x96, 0x8a, 0x2e, 0x02, 0x51, 0x4b, 0x45, 0x17, 0x01, 0x28, 0xa5,
+    0xa2, 0x8b, 0x80, 0x94, 0x52, 0xd1, 0x45, 0xc0, 0x4a, 0x29, 0x68, 0xa2, 0xe0, 0x25, 0x14, 0xb4,
+    0x51, 0x70, 0x12, 0x8a, 0x5a, 0x28, 0xb8, 0x09, 0x45, 0x2d, 0x14, 0x5c, 0x07, 0x62, 0x8c, 0x52,
+    0xe2, 0x8c, 0x54, 0xdc, 0x04, 0xc5, 0x18, 0xa5, 0xc5, 0x18, 0xa2, 0xe0, 0x26, 0x28, 0xc5, 0x2e,
+    0x28, 0xc5, 0x17, 0x01, 0x31, 0x46, 0x29, 0x71, 0x46, 0x28, 0xb8, 0x09, 0x8a, 0x31, 0x4b, 0x8a,
+    0x31, 0x45, 0xc0, 0x4c, 0x51, 0x8a, 0x5c, 0x51, 0x8a, 0x2e, 0x02, 0x62, 0x8c, 0x52, 0xe2, 0x8c,
+    0x51, 0x70, 0x13, 0x14, 0x62, 0x97, 0x15, 0xe7, 0x3a, 0x9e, 0xa7, 0x7f, 0x1e, 0xab, 0x78, 0x89,
+    0x7d, 0x72, 0xaa, 0xb3, 0xb8, 0x0a, 0x25, 0x60, 0x00, 0xdc, 0x78, 0xeb, 0x58, 0x57, 0xc4, 0x2a,
+    0x29, 0x36, 0x8e, 0x8a, 0x18, 0x77, 0x59, 0xb4, 0x9d, 0xac, 0x7a, 0x2e, 0x28, 0xc5, 0x79, 0x9a,
+    0xea, 0x9a, 0x86, 0xd1, 0xfe, 0x9f, 0x75, 0xff, 0x00, 0x7f, 0x9b, 0xfc, 0x6a, 0x44, 0xd4, 0xf5,
+    0x03, 0x9f, 0xf4, 0xeb, 0x9f, 0xfb, 0xfa, 0xdf, 0xe3, 0x5c, 0x8f, 0x32, 0x8f, 0xf2, 0x9d, 0xd1,
+    0xca, 0xa7, 0x2f, 0xb4, 0x8f, 0x48, 0xc5, 0x18, 0xaf, 0x37, 0x93, 0x53, 0xd4, 0x04, 0x64, 0x8b,
+    0xeb, 0x9f, 0xfb, 0xfa, 0xdf, 0xe3, 0x55, 0xff, 0x00, 0xb5, 0x75, 0x1f, 0xf9, 0xff, 0x00, 0xba,
+    0xff, 0x00, 0xbf, 0xcd, 0xfe, 0x34, 0xd6, 0x63, 0x17, 0xf6, 0x49, 0x9e, 0x57, 0x38, 0x3b, 0x73,
+    0x23, 0xd4, 0x31, 0x46, 0x2b, 0xcd, 0x7f, 0xb5, 0x35, 0x0f, 0xf9, 0xfe, 0xba, 0xff, 0x00, 0xbf,
+    0xcd, 0xfe, 0x34, 0xf5, 0xd4, 0xef, 0xf6, 0xff, 0x00, 0xc7, 0xf5, 0xcf, 0xfd, 0xfd, 0x6f, 0xf1,
+    0xa5, 0xfd, 0xa5, 0x1f, 0xe5, 0x2e, 0x39, 0x4c, 0xdf, 0xda, 0x47, 0xa3, 0xe2, 0x8c, 0x57, 0x9a,
+    0x4d, 0xaa, 0x6a, 0x03, 0x6e, 0x2f, 0xee, 0x87, 0xfd, 0xb6, 0x6f, 0xf1, 0xa6, 0x2e, 0xab, 0xa8,
+    0xee, 0x1f, 0xe9, 0xf7, 0x5f, 0xf7, 0xf9, 0xbf, 0xc6, 0x9a, 0xcc, 0x63, 0x6b, 0xf2, 0x91, 0x2c,
+    0xae, 0x71, 0x97, 0x2f, 0x31, 0xe9, 0xd8, 0xa3, 0x15, 0xe6, 0xbf, 0xda, 0x9a, 0x87, 0xfc, 0xff,
+    0x00, 0x5d, 0x7f, 0xdf, 0xe6, 0xff, 0x00, 0x1a, 0x93, 0xfb, 0x4e, 0xff, 0x00, 0xfe, 0x7f, 0xae,
+    0x7f, 0xef, 0xeb, 0x7f, 0x8d, 0x27, 0x99, 0x47, 0xf9, 0x4b, 0x8e, 0x51, 0x37, 0xf6, 0x91, 0xe8,
+    0xd8, 0xa3, 0x15, 0xe6, 0x52, 0x6a, 0xba, 0x88, 0x90, 0x81, 0x7f, 0x75, 0xff, 0x00, 0x7f, 0x9b,
+    0xfc, 0x6b, 0xa6, 0xf0, 0x75, 0xd5, 0xcd, 0xd7, 0xdb, 0x7e, 0xd1, 0x71, 0x2c, 0xbb, 0x76, 0x6d,
+    0xf3, 0x1c, 0xb6, 0x3e, 0xf7, 0x4c, 0xd6, 0xb4, 0x71, 0xb1, 0xa9, 0x25, 0x14, 0xb7, 0x39, 0xab,
+    0xe0, 0x65, 0x46, 0x2e, 0x4d, 0xec, 0x74, 0xf8, 0xa3, 0x14, 0xb8, 0xa3, 0x15, 0xdb, 0x73, 0x84,
+    0x4c, 0x51, 0x8a, 0x5c, 0x51, 0x8a, 0x2e, 0x02, 0x62, 0x8c, 0x52, 0xe2, 0x8c, 0x51, 0x70, 0x13,
+    0x14, 0x62, 0x97, 0x14, 0x62, 0x8b, 0x80, 0x98, 0xa3, 0x14, 0xb8, 0xa3, 0x14, 0x5c, 0x04, 0xc5,
+    0x18, 0xa5, 0xc5, 0x18, 0xa2, 0xe0, 0x26, 0x28, 0xc5, 0x2e, 0x28, 0xc5, 0x17, 0x01, 0x31, 0x46,
+    0x29, 0x71, 0x46, 0x28, 0xb8, 0x09, 0x8a, 0x31, 0x4b, 0x8a, 0x31, 0x45, 0xc0, 0x4c, 0x51, 0x8a,
+    0x5c, 0x51, 0x8a, 0x2e, 0x02, 0x62, 0x8c, 0x52, 0xe2, 0x8c, 0x51, 0x70, 0x13, 0x14, 0x62, 0x97,
+    0x14, 0x62, 0x8b, 0x80, 0x98, 0xa3, 0x14, 0xb8, 0xa3, 0x14, 0x5c, 0x04, 0xc5, 0x18, 0xa5, 0xc5,
+    0x18, 0xa2, 0xe0, 0x26, 0x28, 0xc5, 0x2e, 0x28, 0xc5, 0x17, 0x01, 0x31, 0x46, 0x29, 0x71, 0x46,
+    0x28, 0xb8, 0x09, 0x8a, 0x31, 0x4b, 0x8a, 0x31, 0x45, 0xc0, 0x4c, 0x51, 0x8a, 0x5c, 0x51, 0x8a,
+    0x2e, 0x02, 0x62, 0x8c, 0x52, 0xe2, 0x8c, 0x51, 0x70, 0x13, 0x14, 0x62, 0x97, 0x14, 0x62, 0x8b,
+    0x80, 0x98, 0xa3, 0x14, 0xb8, 0xa3, 0x14, 0x5c, 0x04, 0xc5, 0x18, 0xa5, 0xc5, 0x18, 0xa2, 0xe0,
+    0x26, 0x28, 0xc5, 0x2e, 0x28, 0xc5, 0x17, 0x01, 0x31, 0x46, 0x29, 0x71, 0x46, 0x28, 0xb8, 0x09,
+    0x8a, 0x31, 0x4b, 0x8a, 0x31, 0x45, 0xc0, 0x4c, 0x51, 0x8a, 0x5c, 0x51, 0x8a, 0x2e, 0x02, 0x62,
+    0x8c, 0x52, 0xe2, 0x8c, 0x51, 0x70, 0x13, 0x14, 0x62, 0x97, 0x14, 0x62, 0x8b, 0x80, 0x98, 0xa3,
+    0x14, 0xb8, 0xa3, 0x14, 0x5c, 0x04, 0xc5, 0x18, 0xa5, 0xc5, 0x18, 0xa2, 0xe0, 0x26, 0x28, 0xc5,
+    0x2e, 0x28, 0xc5, 0x17, 0x01, 0x31, 0x46, 0x29, 0x71, 0x46, 0x28, 0xb8, 0x09, 0x8a, 0x31, 0x4b,
+    0x8a, 0x31, 0x45, 0xc0, 0x4c, 0x51, 0x8a, 0x5c, 0x51, 0x8a, 0x2e, 0x02, 0x62, 0x8c, 0x52, 0xe2,
+    0x8c, 0x51, 0x70, 0x13, 0x14, 0x62, 0x97, 0x14, 0x62, 0x8b, 0x80, 0xea, 0x29, 0xd8, 0xa3, 0x15,
+    0x17, 0x18, 0xda, 0x29, 0xd8, 0xa3, 0x14, 0x5c, 0x06, 0xd1, 0x4e, 0xc5, 0x18, 0xa2, 0xe0, 0x36,
+    0x8a, 0x76, 0x28, 0xc5, 0x17, 0x01, 0xb4, 0x53, 0xb1, 0x46, 0x28, 0xb8, 0x0d, 0xa2, 0x9d, 0x8a,
+    0x31, 0x45, 0xc0, 0x6d, 0x14, 0xec, 0x51, 0x8a, 0x2e, 0x03, 0x6b, 0xcb, 0xb5, 0x55, 0x3f, 0xdb,
+    0x17, 0xdc, 0x7f, 0xcb, 0xc4, 0x9f, 0xfa, 0x11, 0xaf, 0x53, 0xc5, 0x79, 0x86, 0xab, 0xff, 0x00,
+    0x21, 0x7b, 0xdf, 0xfa, 0xef, 0x27, 0xfe, 0x84, 0x6b, 0xcf, 0xcc, 0x1f, 0xbb, 0x13, 0xd3, 0xcb,
+    0x23, 0x79, 0xcb, 0xd0, 0xa8, 0xaa, 0x76, 0x8e, 0x29, 0xc0, 0x84, 0xfb, 0xdc, 0x66, 0x9c, 0xbf,
+    0x74, 0x54, 0x53, 0xff, 0x00, 0x0d, 0x79, 0x3b, 0xbb, 0x1e, 0xfb, 0x5c, 0x91, 0xe6, 0x43, 0x9d,
+    0xd5, 0x94, 0x80, 0x72, 0x4d, 0x43, 0xb1, 0xbd, 0x28, 0x4f, 0xbc, 0x2a, 0x5a, 0xad, 0x8c, 0xbf,
+    0x89, 0xab, 0x17, 0x69, 0xf4, 0xa5, 0xde, 0xab, 0xc1, 0x38, 0x34, 0xfa, 0xaf, 0x2f, 0xfa, 0xc3,
+    0x52, 0xb5, 0x35, 0x9f, 0xee, 0xd5, 0xd0, 0xe9, 0x08, 0x7c, 0x6d, 0xe7, 0x14, 0xd5, 0x56, 0xdc,
+    0x38, 0xa2, 0x3e, 0xf5, 0x22, 0xfd, 0xe1, 0x4f, 0x6d, 0x0c, 0xd2, 0xe7, 0x7c, 0xcc, 0x36, 0x9f,
+    0x4a, 0x5f, 0x35, 0x3d, 0x7f, 0x4a, 0x7d, 0x54, 0xa4, 0x95, 0xcb, 0xa9, 0x27, 0x4f, 0x61, 0xee,
+    0x37, 0x39, 0x23, 0x90, 0x6b, 0xad, 0xf0, 0x3a, 0x91, 0xf6, 0xfc, 0xff, 0x00, 0xd3, 0x3f, 0xfd,
+    0x9a, 0xb9, 0x34, 0xfb, 0xa2, 0xba, 0xff, 0x00, 0x04, 0xff, 0x00, 0xcb, 0xf7, 0xfd, 0xb3, 0xff,
+    0x00, 0xd9, 0xab, 0xaf, 0x06, 0xff, 0x00, 0x7d, 0x1f, 0xeb, 0xa1, 0xe7, 0xe3, 0x95, 0xe8, 0x4a,
+    0x5e, 0x9f, 0x99, 0xd5, 0xd1, 0x4e, 0xc5, 0x18, 0xaf, 0x6e, 0xe7, 0xcf, 0x0d, 0xa2, 0x9d, 0x8a,
+    0x31, 0x45, 0xc0, 0x6d, 0x14, 0xec, 0x51, 0x8a, 0x2e, 0x03, 0x68, 0xa7, 0x62, 0x8c, 0x51, 0x70,
+    0x1b, 0x45, 0x3b, 0x14, 0x62, 0x8b, 0x80, 0xda, 0x29, 0xd8, 0xa3, 0x14, 0x5c, 0x06, 0xd1, 0x4e,
+    0xc5, 0x18, 0xa2, 0xe0, 0x36, 0x8a, 0x76, 0x28, 0xc5, 0x17, 0x01, 0xb4, 0x53, 0xb1, 0x46, 0x28,
+    0xb8, 0x0d, 0xa2, 0x9d, 0x8a, 0x31, 0x45, 0xc0, 0x6d, 0x14, 0xec, 0x51, 0x8a, 0x2e, 0x03, 0x68,
+    0xa7, 0x62, 0x8c, 0x51, 0x70, 0x1b, 0x45, 0x3b, 0x14, 0x62, 0x8b, 0x80, 0xda, 0x29, 0xd8, 0xa3,
+    0x14, 0x5c, 0x06, 0xd1, 0x4e, 0xc5, 0x18, 0xa2, 0xe0, 0x36, 0x8a, 0x76, 0x28, 0xc5, 0x17, 0x01,
+    0xb4, 0x53, 0xb1, 0x46, 0x28, 0xb8, 0x0d, 0xa2, 0x9d, 0x8a, 0x31, 0x45, 0xc0, 0x6d, 0x14, 0xec,
+    0x51, 0x8a, 0x2e, 0x03, 0x68, 0xa7, 0x62, 0x8c, 0x51, 0x70, 0x1b, 0x45, 0x3b, 0x14, 0x62, 0x8b,
+    0x80, 0xda, 0x29, 0xd8, 0xa3, 0x14, 0x5c, 0x06, 0xd1, 0x4e, 0xc5, 0x18, 0xa2, 0xe0, 0x36, 0x8a,
+    0x76, 0x28, 0xc5, 0x17, 0x01, 0xb4, 0x53, 0xb1, 0x46, 0x28, 0xb8, 0x0d, 0xa2, 0x9d, 0x8a, 0x31,
+    0x45, 0xc0, 0x6d, 0x14, 0xec, 0x51, 0x8a, 0x2e, 0x03, 0x68, 0xa7, 0x62, 0x8c, 0x51, 0x70, 0x1b,
+    0x45, 0x3b, 0x14, 0x62, 0x8b, 0x80, 0xda, 0x29, 0xd8, 0xa3, 0x14, 0x5c, 0x06, 0xd1, 0x4e, 0xc5,
+    0x18, 0xa2, 0xe0, 0x36, 0x8a, 0x76, 0x28, 0xc5, 0x17, 0x01, 0xb4, 0x53, 0xb1, 0x46, 0x28, 0xb8,
+    0x0d, 0xa2, 0x9d, 0x8a, 0x31, 0x45, 0xc0, 0x6d, 0x14, 0xec, 0x51, 0x8a, 0x2e, 0x03, 0x68, 0xa7,
+    0x62, 0x8c, 0x51, 0x70, 0x17, 0x14, 0x62, 0x97, 0x14, 0x62, 0xa6, 0xe3, 0x13, 0x14, 0x62, 0x97,
+    0x14, 0x62, 0x8b, 0x80, 0x98, 0xa3, 0x14, 0xb8, 0xa3, 0x14, 0x5c, 0x04, 0xc5, 0x18, 0xa5, 0xc5,
+    0x18, 0xa2, 0xe0, 0x26, 0x28, 0xc5, 0x2e, 0x28, 0xc5, 0x17, 0x01, 0x31, 0x46, 0x29, 0x71, 0x46,
+    0x28, 0xb8, 0x09, 0x8a, 0x31, 0x4b, 0x8a, 0x31, 0x45, 0xc0, 0x4c, 0x57, 0x98, 0xea, 0x89, 0xff,
+    0x00, 0x13, 0x7b, 0xde, 0x7f, 0xe5, 0xbb, 0xff, 0x00, 0xe8, 0x46, 0xbd, 0x3f, 0x15, 0xe6, 0x7a,
+    0xa7, 0xfc, 0x85, 0xef, 0x7f, 0xeb, 0xbb, 0xff, 0x00, 0xe8, 0x46, 0xbc, 0xec, 0xc1, 0xfb, 0xb1,
+    0x3d, 0x7c, 0xa1, 0x27, 0x39, 0x5f, 0xb1, 0x9e, 0x64, 0xd8, 0x76, 0xe3, 0x38, 0xf7, 0xa6, 0xb3,
+    0x79, 0xbe, 0xd8, 0xa4, 0x97, 0xfd, 0x61, 0xa2, 0x3e, 0xf5, 0xe7, 0x5b, 0x4b, 0x9e, 0xab, 0x93,
+    0x72, 0x71, 0x7b, 0x0a, 0xa9, 0xf3, 0x0e, 0x6a, 0x4d, 0x9e, 0xf4, 0x8b, 0xf7, 0x85, 0x49, 0x52,
+    0xd9, 0xb5, 0x38, 0x46, 0xc4, 0x3e, 0x7f, 0xfb, 0x3f, 0xad, 0x21, 0x1b, 0xce, 0xee, 0x99, 0xa8,
+    0xea, 0x44, 0xfb, 0xa2, 0xaa, 0xd6, 0xd8, 0xc1, 0x49, 0xcf, 0x49, 0x0e, 0x44, 0xeb, 0xcd, 0x38,
+    0x8d, 0x83, 0x77, 0x5c, 0x50, 0x9d, 0xe8, 0x97, 0xfd, 0x59, 0xa9, 0xbe, 0xa6, 0xea, 0x29, 0x42,
+    0xe8, 0x67, 0x9f, 0xfe, 0xcf, 0xeb, 0x4d, 0xf2, 0xfd, 0xe9, 0x95, 0x35, 0x56, 0xdb, 0x18, 0x26,
+    0xe7, 0xf1, 0x0a, 0xa9, 0xf2, 0x8e, 0x6b, 0xae, 0xf0, 0x52, 0xe3, 0xed, 0xdc, 0xff, 0x00, 0xcf,
+    0x3f, 0xfd, 0x9a, 0xb9, 0x45, 0xfb, 0xa2, 0xba, 0xcf, 0x05, 0xff, 0x00, 0xcb, 0xf7, 0xfd, 0xb3,
+    0xff, 0x00, 0xd9, 0xab, 0x6c, 0x23, 0xfd, 0xfa, 0xf9, 0xfe, 0x46, 0x79, 0x84, 0x52, 0xc2, 0xcb,
+    0xe5, 0xf9, 0xa3, 0xab, 0xc5, 0x18, 0xa5, 0xc5, 0x18, 0xaf, 0x72, 0xe7, 0xcc, 0x09, 0x8a, 0x31,
+    0x4b, 0x8a, 0x31, 0x45, 0xc0, 0x4c, 0x51, 0x8a, 0x5c, 0x51, 0x8a, 0x2e, 0x02, 0x62, 0x8c, 0x52,
+    0xe2, 0x8c, 0x51, 0x70, 0x13, 0x14, 0x62, 0x97, 0x14, 0x62, 0x8b, 0x80, 0x98, 0xa3, 0x14, 0xb8,
+    0xa3, 0x14, 0x5c, 0x04, 0xc5, 0x18, 0xa5, 0xc5, 0x18, 0xa2, 0xe0, 0x26, 0x28, 0xc5, 0x2e, 0x28,
+    0xc5, 0x17, 0x01, 0x31, 0x46, 0x29, 0x71, 0x46, 0x28, 0xb8, 0x09, 0x8a, 0x31, 0x4b, 0x8a, 0x31,
+    0x45, 0xc0, 0x4c, 0x51, 0x8a, 0x5c, 0x51, 0x8a, 0x2e, 0x02, 0x62, 0x8c, 0x52, 0xe2, 0x8c, 0x51,
+    0x70, 0x13, 0x14, 0x62, 0x97, 0x14, 0x62, 0x8b, 0x80, 0x98, 0xa3, 0x14, 0xb8, 0xa3, 0x14, 0x5c,
+    0x04, 0xc5, 0x18, 0xa5, 0xc5, 0x18, 0xa2, 0xe0, 0x26, 0x28, 0xc5, 0x2e, 0x28, 0xc5, 0x17, 0x01,
+    0x31, 0x46, 0x29, 0x71, 0x46, 0x28, 0xb8, 0x09, 0x8a, 0x31, 0x4b, 0x8a, 0x31, 0x45, 0xc0, 0x4c,
+    0x51, 0x8a, 0x5c, 0x51, 0x8a, 0x2e, 0x02, 0x62, 0x8c, 0x52, 0xe2, 0x8c, 0x51, 0x70, 0x13, 0x14,
+    0x62, 0x97, 0x14, 0x62, 0x8b, 0x80, 0x98, 0xa3, 0x14, 0xb8, 0xa3, 0x14, 0x5c, 0x04, 0xc5, 0x18,
+    0xa5, 0xc5, 0x18, 0xa2, 0xe0, 0x26, 0x28, 0xc5, 0x2e, 0x28, 0xc5, 0x17, 0x01, 0x31, 0x46, 0x29,
+    0x71, 0x46, 0x28, 0xb8, 0x09, 0x8a, 0x31, 0x4b, 0x8a, 0x31, 0x45, 0xc0, 0x4c, 0x51, 0x8a, 0x5c,
+    0x51, 0x8a, 0x2e, 0x02, 0x62, 0x8c, 0x52, 0xe2, 0x8c, 0x51, 0x70, 0x13, 0x14, 0x62, 0x97, 0x14,
+    0x62, 0x8b, 0x80, 0x98, 0xa3, 0x14, 0xb8, 0xa3, 0x14, 0x5c, 0x04, 0xc5, 0x18, 0xa5, 0xc5, 0x18,
+    0xa2, 0xe0, 0x26, 0x28, 0xc5, 0x2e, 0x28, 0xc5, 0x17, 0x01, 0x31, 0x46, 0x29, 0x71, 0x46, 0x28,
+    0xb8, 0x09, 0x8a, 0x31, 0x4b, 0x8a, 0x31, 0x45, 0xc0, 0x4c, 0x51, 0x8a, 0x5c, 0x51, 0x8a, 0x2e,
+    0x02, 0x62, 0x8c, 0x52, 0xe2, 0x8c, 0x51, 0x70, 0x17, 0x14, 0x62, 0x9d, 0x8a, 0x31, 0x50, 0x31,
+    0xb8, 0xa3, 0x14, 0xec, 0x51, 0x8a, 0x00, 0x6e, 0x28, 0xc5, 0x3b, 0x14, 0x62, 0x80, 0x1b, 0x8a,
+    0x31, 0x4e, 0xc5, 0x18, 0xa0, 0x06, 0xe2, 0x8c, 0x53, 0xb1, 0x46, 0x28, 0x01, 0xb8, 0xa3, 0x14,
+    0xec, 0x51, 0x8a, 0x00, 0x6e, 0x28, 0xc5, 0x3b, 0x14, 0x62, 0x80, 0x1b, 0x8a, 0xf2, 0xbd, 0x5a,
+    0x47, 0x1a, 0xcd, 0xf0, 0xcf, 0xfc, 0xbc, 0x49, 0xff, 0x00, 0xa1, 0x1a, 0xf5, 0x6c, 0x57, 0x93,
+    0xea, 0xff, 0x00, 0xf2, 0x1a, 0xbf, 0xff, 0x00, 0xaf, 0x89, 0x3f, 0xf4, 0x23, 0x5c, 0x58, 0xdd,
+    0x62, 0x8f, 0x47, 0x2e, 0x6d, 0x4a, 0x56, 0x2b, 0x01, 0xb8, 0x64, 0xf2, 0x4d, 0x3d, 0x14, 0x73,
+    0xc5, 0x31, 0x3e, 0xe8, 0xa9, 0x13, 0xbd, 0x79, 0x8c, 0xf7, 0x69, 0xa4, 0xda, 0x6c, 0x1f, 0xe5,
+    0x42, 0x47, 0x06, 0xa2, 0xf3, 0x5f, 0xd7, 0xf4, 0xa9, 0x65, 0xff, 0x00, 0x56, 0x6a, 0xbd, 0x11,
+    0xd8, 0x9a, 0xcd, 0xc6, 0x56, 0x44, 0x9b, 0x17, 0xd2, 0xa4, 0x55, 0x1b, 0x47, 0x14, 0xda, 0x91,
+    0x7e, 0xe8, 0xa4, 0xcd, 0x29, 0xc5, 0x5c, 0x8e, 0x42, 0x53, 0x1b, 0x78, 0xcd, 0x30, 0x3b, 0x31,
+    0xc1, 0x39, 0x06, 0x9d, 0x3f, 0xf0, 0xd4, 0x69, 0xf7, 0x85, 0x35, 0xb1, 0x95, 0x46, 0xd4, 0xed,
+    0xd0, 0x7e, 0xc5, 0xf4, 0xa9, 0xb6, 0x8f, 0x4a, 0x8e, 0xa5, 0xa4, 0xcd, 0xa9, 0xc5, 0x6a, 0x40,
+    0xee, 0xca, 0xe4, 0x03, 0x81, 0x5d, 0x7f, 0x81, 0x59, 0x9b, 0xed, 0xf9, 0x3d, 0x3c, 0xbf, 0xfd,
+    0x9a, 0xb8, 0xf9, 0x7f, 0xd6, 0x1a, 0xeb, 0xfc, 0x05, 0xff, 0x00, 0x31, 0x0f, 0xfb, 0x67, 0xff,
+    0x00, 0xb3, 0x57, 0x56, 0x17, 0xf8, 0xb1, 0xfe, 0xba, 0x1e, 0x6e, 0x3e, 0x4f, 0xd9, 0x49, 0x5f,
+    0xfa, 0xb9, 0xd8, 0xe2, 0x8c, 0x53, 0xb1, 0x46, 0x2b, 0xd7, 0x3c, 0x01, 0xb8, 0xa3, 0x14, 0xec,
+    0x51, 0x8a, 0x00, 0x6e, 0x28, 0xc5, 0x3b, 0x14, 0x62, 0x80, 0x1b, 0x8a, 0x31, 0x4e, 0xc5, 0x18,
+    0xa0, 0x06, 0xe2, 0x8c, 0x53, 0xb1, 0x46, 0x28, 0x01, 0xb8, 0xa3, 0x14, 0xec, 0x51, 0x8a, 0x00,
+    0x6e, 0x28, 0xc5, 0x3b, 0x14, 0x62, 0x80, 0x1b, 0x8a, 0x31, 0x4e, 0xc5, 0x18, 0xa0, 0x06, 0xe2,
+    0xa9, 0xdf, 0xea, 0x96, 0xba, 0x72, 0x66, 0x67, 0xcb, 0x9c, 0x62, 0x24, 0x20, 0xb9, 0x1e, 0xb8,
+    0xf4, 0xeb, 0xcd, 0x43, 0xac, 0xeb, 0x11, 0xe9, 0x70, 0x61, 0x40, 0x7b, 0x97, 0x1f, 0x24, 0x79,
+    0xe9, 0xee, 0x7d, 0xbf, 0x9f, 0xe6, 0x47, 0x0b, 0x71, 0x70, 0xd7, 0x33, 0xbc, 0xf3, 0x33, 0x3c,
+    0xac, 0x72, 0x4f, 0x73, 0xfe, 0x1d, 0x2b, 0x93, 0x11, 0x8a, 0x54, 0xfd, 0xd8, 0xee, 0x44, 0xa5,
+    0x6d, 0x11, 0xa9, 0x77, 0xe2, 0x6d, 0x42, 0xe3, 0x72, 0xc6, 0x52, 0xd9, 0x39, 0x1f, 0x27, 0x27,
+    0x07, 0xa7, 0x27, 0xb8, 0xf6, 0xc7, 0xf8, 0x66, 0xb6, 0xaf, 0x7d, 0x83, 0xb6, 0xfe, 0xe7, 0x23,
+    0x9f, 0xf5, 0x87, 0xa7, 0xe7, 0x54, 0xde, 0x75, 0xc1, 0xed, 0xdc, 0x60, 0x73, 0x55, 0x1e, 0x4c,
+    0xf5, 0x3d, 0x41, 0xce, 0x4f, 0x4a, 0xf3, 0xf9, 0xaa, 0x4d, 0xde, 0x4c, 0x71, 0x83, 0x7b, 0x9d,
+    0x25, 0xb7, 0x8c, 0xf5, 0x0b, 0x77, 0x0b, 0x71, 0x14, 0x77, 0x09, 0x9e, 0x4f, 0xdd, 0x3f, 0x4c,
+    0x81, 0x81, 0xf9, 0x7f, 0xf5, 0xbb, 0x1d, 0x3b, 0x54, 0xb4, 0xd5, 0x61, 0x32, 0x5a, 0x4a, 0x1b,
+    0x6e, 0x03, 0xa1, 0x18, 0x64, 0x27, 0xb1, 0x1f, 0xe4, 0x70, 0x6b, 0xca, 0x3c, 0xb0, 0xdd, 0x47,
+    0x00, 0xf3, 0xfe, 0x73, 0x57, 0x2c, 0xde, 0x6b, 0x39, 0x56, 0x68, 0x64, 0x68, 0xe4, 0x43, 0x90,
+    0xde, 0x87, 0xd7, 0xdf, 0xd3, 0xdf, 0xa5, 0x74, 0xc3, 0x13, 0x28, 0x7c, 0x5a, 0x97, 0x24, 0x92,
+    0x3d, 0x5f, 0x14, 0x62, 0xb2, 0xf4, 0x8d, 0x76, 0x0d, 0x49, 0x12, 0x27, 0x22, 0x3b, 0xbc, 0x73,
+    0x19, 0xc8, 0xce, 0x3b, 0x8f, 0xf0, 0xeb, 0xd7, 0xeb, 0x5a, 0xd8, 0xaf, 0x42, 0x13, 0x8c, 0xd5,
+    0xe2, 0x4a, 0xd4, 0x6e, 0x28, 0xc5, 0x3b, 0x14, 0x62, 0xa8, 0x63, 0x71, 0x46, 0x29, 0xd8, 0xa3,
+    0x14, 0x00, 0xdc, 0x51, 0x8a, 0x76, 0x28, 0xc5, 0x00, 0x37, 0x14, 0x62, 0x9d, 0x8a, 0x31, 0x40,
+    0x0d, 0xc5, 0x18, 0xa7, 0x62, 0x8c, 0x50, 0x03, 0x71, 0x46, 0x29, 0xd8, 0xac, 0xbb, 0x9f, 0x11,
+    0xe8, 0xf6, 0xbb, 0x7c, 0xcd, 0x42, 0x12, 0x5b, 0xa0, 0x8c, 0xf9, 0x9f, 0x9e, 0xdc, 0xe2, 0x93,
+    0x92, 0x5b, 0x85, 0x8d, 0x2c, 0x51, 0x8a, 0xa1, 0x6b, 0xae, 0x69, 0x77, 0xb8, 0xf2, 0x2f, 0xa1,
+    0x25, 0x9b, 0x62, 0xab, 0x36, 0xc6, 0x63, 0xe8, 0x01, 0xc1, 0x3d, 0x6b, 0x47, 0x14, 0x29, 0x27,
+    0xb0, 0x58, 0x6e, 0x28, 0xc5, 0x3b, 0x14, 0x62, 0x98, 0x0d, 0xc5, 0x18, 0xa7, 0x62, 0x8c, 0x50,
+    0x03, 0x71, 0x46, 0x29, 0xd8, 0xa3, 0x14, 0x00, 0xdc, 0x51, 0x8a, 0x76, 0x28, 0xc5, 0x00, 0x37,
+    0x14, 0x62, 0x9d, 0x8a, 0x31, 0x40, 0x0d, 0xc5, 0x18, 0xa7, 0x62, 0x8c, 0x50, 0x03, 0x71, 0x46,
+    0x29, 0xd8, 0xa3, 0x14, 0x00, 0xdc, 0x51, 0x8a, 0x76, 0x28, 0xc5, 0x00, 0x37, 0x14, 0x62, 0x9d,
+    0x8a, 0x31, 0x40, 0x0d, 0xc5, 0x18, 0xa7, 0x62, 0x8c, 0x50, 0x03, 0x71, 0x46, 0x29, 0xd8, 0xa3,
+    0x14, 0x00, 0xdc, 0x51, 0x8a, 0x76, 0x28, 0xc5, 0x00, 0x37, 0x14, 0x62, 0x9d, 0x8a, 0x31, 0x40,
+    0x0d, 0xc5, 0x18, 0xa7, 0x62, 0x8c, 0x50, 0x03, 0x71, 0x46, 0x29, 0xd8, 0xa3, 0x14, 0x00, 0xdc,
+    0x51, 0x8a, 0x76, 0x28, 0xc5, 0x00, 0x37, 0x14, 0x62, 0x9d, 0x8a, 0x31, 0x40, 0x0e, 0xc5, 0x18,
+    0xa5, 0xc5, 0x18, 0xa9, 0xb8, 0x09, 0x8a, 0x31, 0x4b, 0x8a, 0x31, 0x45, 0xc0, 0x4c, 0x51, 0x8a,
+    0x5c, 0x51, 0x8a, 0x2e, 0x02, 0x62, 0x8c, 0x52, 0xe2, 0x8c, 0x51, 0x70, 0x13, 0x14, 0x62, 0x97,
+    0x14, 0x62, 0x8b, 0x80, 0x98, 0xa3, 0x14, 0xb8, 0xa3, 0x14, 0x5c, 0x04, 0xc5, 0x18, 0xa5, 0xc5,
+    0x18, 0xa2, 0xe0, 0x26, 0x2b, 0xca, 0xb5, 0x6f, 0xf9, 0x0c, 0xdf, 0x7f, 0xd7, 0xc4, 0x9f, 0xfa,
+    0x11, 0xaf, 0x56, 0xc5, 0x79, 0x56, 0xac, 0xa7, 0xfb, 0x66, 0xfb, 0x8f, 0xf9, 0x78, 0x93, 0xff,
+    0x00, 0x42, 0x35, 0xc5, 0x8d, 0x7e, 0xea, 0x3d, 0x4c, 0xad, 0x5e, 0x72, 0xf4, 0x2b, 0x2f, 0xdd,
+    0x15, 0x14, 0xff, 0x00, 0xc3, 0x4f, 0xde, 0xab, 0xc1, 0x38, 0x34, 0xc9, 0x08, 0x7c, 0x6d, 0xe7,
+    0x15, 0xe6, 0xad, 0xcf, 0x72, 0xa3, 0x4e, 0x16, 0xea, 0x46, 0x9f, 0x78, 0x54, 0xb4, 0xc5, 0x56,
+    0xdc, 0x38, 0xa9, 0x36, 0x9f, 0x4a, 0x6c, 0xca, 0x9c, 0x5d, 0x89, 0x2a, 0xbc, 0xbf, 0xeb, 0x0d,
+    0x4b, 0xe6, 0xa7, 0xaf, 0xe9, 0x51, 0x38, 0xdc, 0xe4, 0x8e, 0x41, 0xa5, 0x1d, 0xcd, 0x2b, 0x35,
+    0x28, 0xd9, 0x04, 0x7d, 0xea, 0x45, 0xfb, 0xc2, 0x98, 0x8a, 0x79, 0xe2, 0x9f, 0xf7, 0x79, 0x3c,
+    0x0a, 0x6c, 0x9a, 0x69, 0xa4, 0x9b, 0x24, 0xaa, 0x95, 0x63, 0xcd, 0x4f, 0x5f, 0xd2, 0xa0, 0xd8,
+    0xde, 0x94, 0x47, 0x40, 0xae, 0xd4, 0xad, 0x61, 0xe9, 0xf7, 0x45, 0x76, 0x5e, 0x05, 0xff, 0x00,
+    0x97, 0xff, 0x00, 0xfb, 0x67, 0xff, 0x00, 0xb3, 0x57, 0x1e, 0xaa, 0x76, 0x8e, 0x2b, 0xb1, 0xf0,
+    0x28, 0x23, 0xed, 0xf9, 0xff, 0x00, 0xa6, 0x7f, 0xfb, 0x35, 0x6f, 0x86, 0x7f, 0xbe, 0x47, 0x26,
+    0x35, 0x3f, 0xab, 0x3f, 0x97, 0xe6, 0x8e, 0xc3, 0x14, 0x62, 0x97, 0x14, 0x62, 0xbd, 0x7b, 0x9f,
+    0x3a, 0x26, 0x28, 0xc5, 0x2e, 0x28, 0xc5, 0x17, 0x01, 0x31, 0x46, 0x29, 0x71, 0x46, 0x28, 0xb8,
+    0x09, 0x8a, 0x31, 0x4b, 0x8a, 0x31, 0x45, 0xc0, 0x4c, 0x51, 0x8a, 0x5c, 0x51, 0x8a, 0x2e, 0x02,
+    0x62, 0x8c, 0x52, 0xe2, 0x8c, 0x51, 0x70, 0x13, 0x14, 0x62, 0x97, 0x14, 0x62, 0x8b, 0x80, 0x98,
+    0xaa, 0x7a, 0x96, 0xa1, 0x16, 0x99, 0x66, 0xd7, 0x12, 0x82, 0xdc, 0xed, 0x55, 0x1f, 0xc4, 0x7f,
+    0xa5, 0x5b, 0x76, 0x58, 0xd1, 0x9d, 0xd8, 0x2a, 0xa8, 0xc9, 0x62, 0x70, 0x00, 0xaf, 0x35, 0xd7,
+    0x35, 0x83, 0xaa, 0x5e, 0xb4, 0x80, 0xb8, 0x85, 0x78, 0x8d, 0x5b, 0xa2, 0x81, 0x8e, 0x71, 0xea,
+    0x7f, 0xfa, 0xdd, 0xab, 0x0a, 0xf5, 0xbd, 0x9c, 0x74, 0xdd, 0x89, 0xf9, 0x10, 0xdd, 0x5d, 0xc9,
+    0x73, 0x73, 0x25, 0xcb, 0xee, 0x69, 0x5d, 0x89, 0x3e, 0xde, 0xc3, 0xdb, 0xda, 0xb3, 0xde, 0x51,
+    0x8c, 0x10, 0x33, 0x9f, 0xc6, 0x9a, 0xf2, 0xf2, 0x00, 0x3e, 0xdb, 0x46, 0x41, 0x06, 0x9a, 0x17,
+    0x2f, 0xb4, 0x03, 0x9f, 0x6e, 0xdf, 0xe7, 0x35, 0xe6, 0x28, 0xf5, 0x65, 0x46, 0x9d, 0xb5, 0x63,
+    0x18, 0xe7, 0x25, 0x49, 0xce, 0x3a, 0xd4, 0xa9, 0x1f, 0xca, 0x09, 0xe3, 0x9c, 0x1c, 0x8e, 0x9f,
+    0xe7, 0x9a, 0x7c, 0x70, 0xb0, 0x23, 0xb9, 0xc7, 0x19, 0xed, 0x56, 0x42, 0x00, 0x7e, 0x6e, 0x47,
+    0xe2, 0x41, 0x34, 0x4a, 0x76, 0xd8, 0x25, 0x51, 0x2d, 0x11, 0x1c, 0x70, 0x82, 0x80, 0xe3, 0xa6,
+    0x30, 0x07, 0x35, 0x63, 0x28, 0x99, 0x25, 0x87, 0x1c, 0x70, 0x7f, 0xa5, 0x34, 0xc8, 0xab, 0xd0,
+    0x65, 0x87, 0x38, 0x2d, 0x55, 0xa4, 0x98, 0x10, 0x57, 0xa3, 0x7a, 0x66, 0xb3, 0xb3, 0x91, 0x92,
+    0x4e, 0x4c, 0x92, 0x4b, 0x97, 0x8a, 0x4d, 0xea, 0x59, 0x5c, 0x7c, 0xca, 0xc8, 0x70, 0x54, 0xfa,
+    0xd7, 0x73, 0xe1, 0xcf, 0x11, 0xa6, 0xa8, 0x82, 0xda, 0xe1, 0x82, 0xde, 0x28, 0xe0, 0xe3, 0x02,
+    0x51, 0xea, 0x3d, 0xfd, 0x47, 0xe2, 0x3b, 0x81, 0xe7, 0x2c, 0xe1, 0xb1, 0x82, 0x70, 0x0e, 0x33,
+    0x8e, 0xb5, 0x2d, 0xb9, 0x92, 0xde, 0xe2, 0x19, 0x92, 0x43, 0xe6, 0xc6, 0xc1, 0x81, 0xe0, 0xed,
+    0x61, 0xcf, 0x7a, 0xea, 0xa3, 0x37, 0x49, 0xdc, 0xd9, 0x41, 0x45, 0x1e, 0xc5, 0x8a, 0x31, 0x59,
+    0x7a, 0x26, 0xb3, 0x1e, 0xad, 0x6e, 0x03, 0x81, 0x1d, 0xd2, 0x8f, 0xde, 0x47, 0xfd, 0x47, 0xb7,
+    0xf2, 0xfc, 0x89, 0xd5, 0xc5, 0x7a, 0x51, 0x9a, 0x92, 0xba, 0x24, 0x4c, 0x51, 0x8a, 0x5c, 0x51,
+    0x8a, 0xab, 0x80, 0x98, 0xa3, 0x14, 0xb8, 0xa3, 0x14, 0x5c, 0x04, 0xc5, 0x18, 0xa5, 0xc5, 0x18,
+    0xa2, 0xe0, 0x26, 0x2b, 0x1f, 0x58, 0xf1, 0x15, 0xa6, 0x92, 0x1a, 0x3f, 0xf5, 0xd7, 0x23, 0x07,
+    0xc9, 0x53, 0x8c, 0x03, 0xea, 0x7a, 0x0f, 0xe7, 0xd2, 0xb1, 0xfc, 0x41, 0xe2, 0xd4, 0x58, 0xe4,
+    0xb5, 0xd3, 0x64, 0xf9, 0xf3, 0xb5, 0xae, 0x32, 0x31, 0x8f, 0xf6, 0x7f, 0xc7, 0xf2, 0xf5, 0xae,
+    0x2e, 0x59, 0x1a, 0x77, 0x2e, 0xee, 0xcc, 0xce, 0x72, 0x58, 0xe4, 0x92, 0x7b, 0x9a, 0xe5, 0xab,
+    0x88, 0xb6, 0x90, 0x29, 0x46, 0xe5, 0xcd, 0x4b, 0x5b, 0xbe, 0xd5, 0x5b, 0x33, 0x4a, 0x5d, 0x73,
+    0x91, 0x1a, 0xf0, 0xab, 0xd7, 0xb7, 0xe2, 0x46, 0x7a, 0xf1, 0xd6, 0xb3, 0xc0, 0x0c, 0xd9, 0x2a,
+    0x49, 0x03, 0x3e, 0xb8, 0xff, 0x00, 0x3f, 0xd6, 0x9f, 0x14, 0x1b, 0x8f, 0x29, 0x93, 0x91, 0x81,
+    0xdc, 0x75, 0xab, 0x11, 0x44, 0x58, 0x6d, 0xc9, 0xe9, 0x8e, 0x07, 0xe9, 0x5c, 0x32, 0x9f, 0x56,
+    0x0e, 0x4a, 0x23, 0x52, 0x0e, 0x01, 0x01, 0x80, 0xf5, 0x1e, 0x9d, 0xeb, 0xa0, 0xd2, 0xf5, 0xfb,
+    0xcd, 0x3c, 0xaa, 0xb3, 0x19, 0xed, 0xb1, 0xfe, 0xad, 0xce, 0x36, 0xf1, 0xc6, 0x0f, 0x60, 0x31,
+    0x8c, 0x74, 0xac, 0xa0, 0xaa, 0x80, 0x80, 0x70, 0x40, 0x19, 0xc1, 0xfd, 0x2a, 0x19, 0x27, 0xc7,
+    0x43, 0xc6, 0x7a, 0xff, 0x00, 0x8f, 0xa5, 0x67, 0x1a, 0x93, 0x4e, 0xf1, 0x66, 0x3c, 0xce, 0x4f,
+    0x43, 0xd4, 0x6c, 0x6f, 0x6d, 0xf5, 0x0b, 0x55, 0xb8, 0xb7, 0x7d, 0xc8, 0x78, 0x23, 0xba, 0x9f,
+    0x43, 0xef, 0x56, 0x71, 0x5e, 0x57, 0xa4, 0xeb, 0x73, 0x69, 0x37, 0xbe, 0x74, 0x3c, 0xa3, 0x7f,
+    0xad, 0x88, 0x9e, 0x1d, 0x7f, 0xfa, 0xd9, 0xeb, 0xff, 0x00, 0xea, 0xaf, 0x4c, 0xb1, 0xbc, 0x87,
+    0x50, 0xb2, 0x8a, 0xee, 0x02, 0xde, 0x5c, 0x83, 0x23, 0x70, 0xc1, 0x1c, 0xe0, 0x83, 0xf8, 0x83,
+    0x5e, 0xb5, 0x1a, 0xdc, 0xeb, 0x5d, 0xcd, 0x6c, 0xfa, 0x96, 0x31, 0x46, 0x29, 0x71, 0x46, 0x2b,
+    0x6b, 0x88, 0x4c, 0x51, 0x8a, 0x5c, 0x51, 0x8a, 0x2e, 0x02, 0x62, 0x8c, 0x52, 0xe2, 0x8c, 0x51,
+    0x70, 0x13, 0x14, 0x62, 0x97, 0x14, 0x62, 0x8b, 0x80, 0x98, 0xa3, 0x14, 0xb8, 0xa3, 0x14, 0x5c,
+    0x04, 0xc5, 0x18, 0xa5, 0xc5, 0x18, 0xa2, 0xe0, 0x26, 0x28, 0xc5, 0x2e, 0x28, 0xc5, 0x17, 0x01,
+    0x31, 0x46, 0x29, 0x71, 0x46, 0x28, 0xb8, 0x09, 0x8a, 0x31, 0x4b, 0x8a, 0x31, 0x45, 0xc0, 0x4c,
+    0x51, 0x8a, 0x5c, 0x51, 0x8a, 0x2e, 0x02, 0x62, 0x8c, 0x52, 0xe2, 0x8c, 0x51, 0x70, 0x13, 0x14,
+    0x62, 0x97, 0x14, 0x62, 0x8b, 0x80, 0x98, 0xa3, 0x14, 0xb8, 0xa3, 0x14, 0x5c, 0x04, 0xc5, 0x18,
+    0xa5, 0xc5, 0x18, 0xa2, 0xe0, 0x26, 0x28, 0xc5, 0x2e, 0x28, 0xc5, 0x17, 0x01, 0x31, 0x46, 0x29,
+    0x71, 0x46, 0x28, 0xb8, 0x0b, 0x8a, 0x31, 0x4b, 0x8a, 0x31, 0x53, 0x71, 0x89, 0x8a, 0x31, 0x4b,
+    0x8a, 0x31, 0x45, 0xc0, 0x4c, 0x51, 0x8a, 0x5c, 0x51, 0x8a, 0x2e, 0x02, 0x62, 0x8c, 0x52, 0xe2,
+    0x8c, 0x51, 0x70, 0x13, 0x14, 0x62, 0x97, 0x14, 0x62, 0x8b, 0x80, 0x98, 0xa3, 0x14, 0xb8, 0xa3,
+    0x14, 0x5c, 0x04, 0xc5, 0x18, 0xa5, 0xc5, 0x18, 0xa2, 0xe0, 0x26, 0x2b, 0xcb, 0x75, 0x6f, 0xf9,
+    0x0c, 0x5f, 0x7f, 0xd7, 0xc4, 0x9f, 0xfa, 0x11, 0xaf, 0x53, 0xc5, 0x79, 0x3e, 0xaf, 0x36, 0x35,
+    0xab, 0xf1, 0xb7, 0xa5, 0xc4, 0x9d, 0xff, 0x00, 0xda, 0x35, 0xc5, 0x8d, 0xd6, 0x28, 0xf5, 0x72,
+    0xa9, 0x28, 0xce, 0x57, 0xec, 0x50, 0x97, 0xfd, 0x61, 0xa2, 0x3e, 0xf4, 0xa4, 0x6f, 0x3b, 0xba,
+    0x66, 0x9c, 0x89, 0xd7, 0x9a, 0xe1, 0xbe, 0x87, 0xa8, 0xa2, 0xdc, 0xee, 0x85, 0x5f, 0xbc, 0x2a,
+    0x4a, 0x61, 0x1b, 0x06, 0xee, 0xb8, 0xa6, 0x79, 0xff, 0x00, 0xec, 0xfe, 0xb5, 0x36, 0xbe, 0xc6,
+    0xea, 0x4a, 0x1a, 0x48, 0x8a, 0xa4, 0x4f, 0xba, 0x29, 0x3c, 0xbf, 0x7a, 0x91, 0x53, 0xe5, 0x1c,
+    0xd5, 0x36, 0x61, 0x4e, 0x12, 0xb8, 0xa9, 0xde, 0x89, 0x7f, 0xd5, 0x9a, 0x46, 0x6f, 0x2f, 0xb6,
+    0x73, 0x4d, 0x32, 0x6f, 0x1b, 0x71, 0x8c, 0xd4, 0xdb, 0x5b, 0x9b, 0x39, 0x25, 0x17, 0x17, 0xb9,
+    0x15, 0x4d, 0x4c, 0xf2, 0xfd, 0xea, 0x5d, 0x9e, 0xf4, 0xdb, 0x32, 0xa7, 0x09, 0x6a, 0x39, 0x7e,
+    0xe8, 0xae, 0xc3, 0xc0, 0xdf, 0xf2, 0xff, 0x00, 0xff, 0x00, 0x6c, 0xff, 0x00, 0xf6, 0x6a, 0xe2,
+    0xcc, 0x9b, 0x0e, 0xdc, 0x67, 0x1e, 0xf5, 0xd9, 0x78, 0x09, 0xf7, 0xff, 0x00, 0x68, 0x71, 0x8c,
+    0x79, 0x7f, 0xfb, 0x35, 0x6d, 0x86, 0x5f, 0xbd, 0x4c, 0xc7, 0x1f, 0x38, 0xfd, 0x5a, 0x51, 0xeb,
+    0xa7, 0xe6, 0x8e, 0xc7, 0x14, 0x62, 0x97, 0x14, 0x62, 0xbd, 0x6b, 0x9f, 0x36, 0x26, 0x28, 0xc5,
+    0x2e, 0x28, 0xc5, 0x17, 0x01, 0x31, 0x46, 0x29, 0x71, 0x46, 0x28, 0xb8, 0x09, 0x8a, 0x31, 0x4b,
+    0x8a, 0x31, 0x45, 0xc0, 0x4c, 0x51, 0x8a, 0x5c, 0x51, 0x8a, 0x2e, 0x02, 0x62, 0x8c, 0x52, 0xe2,
+    0x8c, 0x51, 0x70, 0x13, 0x14, 0x62, 0x97, 0x15, 0x8d, 0xe2, 0x4d, 0x69, 0x74, 0x6d, 0x3c, 0x95,
+    0xc9, 0xb9, 0x95, 0x58, 0x42, 0x00, 0xe8, 0x40, 0xe5, 0x8f, 0x18, 0xe3, 0x23, 0x8e, 0xf5, 0x2e,
+    0x49, 0x2b, 0xb0, 0x30, 0x3c, 0x63, 0xad, 0x2c, 0xac, 0x74, 0xd8, 0x1c, 0x14, 0x8c, 0x86, 0x9d,
+    0x95, 0xbf, 0x8b, 0xfb, 0xa7, 0xb7, 0x1c, 0x1e, 0xfc, 0xe3, 0xd2, 0xb8, 0xe6, 0x6c, 0xf4, 0x51,
+    0x8e, 0xe4, 0x9e, 0x9f, 0xe7, 0xa5, 0x35, 0x9a, 0x49, 0xa7, 0x66, 0x91, 0xcb, 0x3b, 0x31, 0x24,
+    0xb1, 0xc9, 0x3e, 0xe7, 0xd6, 0xa5, 0x86, 0x10, 0x47, 0x61, 0x8f, 0x7f, 0xf1, 0xaf, 0x3a, 0x73,
+    0xe6, 0x97, 0x33, 0x2b, 0x48, 0xea, 0xc6, 0x47, 0x19, 0x7e, 0x83, 0x77, 0x6e, 0x9c, 0x93, 0xfe,
+    0x7f, 0x9d, 0x5a, 0x8a, 0x11, 0xc3, 0x63, 0x18, 0xeb, 0x52, 0x2c, 0x0a, 0x17, 0xe6, 0x50, 0x72,
+    0x3b, 0x0f, 0xe5, 0x4f, 0x66, 0x55, 0x07, 0x2a, 0x7a, 0xf3, 0x9c, 0xff, 0x00, 0x9f, 0x5a, 0xc2,
+    0x53, 0xbe, 0xc6, 0x52, 0xa8, 0xde, 0x88, 0x02, 0x00, 0x33, 0x8e, 0x7a, 0x54, 0x2d, 0x23, 0x21,
+    0xc8, 0xe0, 0x73, 0x9f, 0xf3, 0xd3, 0xb5, 0x23, 0xc9, 0xf3, 0x71, 0xef, 0xcf, 0x6c, 0x71, 0x54,
+    0xdd, 0xb7, 0x60, 0x0c, 0x12, 0x4f, 0x40, 0x7d, 0xbb, 0x51, 0x18, 0x5f, 0x70, 0x8d, 0x36, 0xf5,
+    0x64, 0xb2, 0xca, 0x64, 0x03, 0x27, 0x90, 0x00, 0xe7, 0x80, 0x3a, 0xd4, 0x7b, 0x9b, 0xb8, 0x3b,
+    0xbb, 0x7f, 0xf5, 0xff, 0x00, 0x5a, 0x44, 0x52, 0xcc, 0xbc, 0x71, 0x8e, 0x48, 0x3f, 0x80, 0x35,
+    0x6e, 0x38, 0x32, 0x3e, 0x51, 0xb7, 0xb8, 0x3f, 0x8f, 0xb5, 0x5b, 0x6a, 0x26, 0xad, 0xa8, 0xa2,
+    0x28, 0xed, 0xc7, 0xcc, 0x0a, 0xf3, 0xd8, 0x77, 0x02, 0xad, 0x47, 0x10, 0x53, 0x92, 0x46, 0x00,
+    0x18, 0xef, 0xf9, 0xff, 0x00, 0x9e, 0xf4, 0xfd, 0xa0, 0x1e, 0x98, 0xf5, 0xe7, 0x19, 0xff, 0x00,
+    0x3f, 0xd6, 0xa3, 0x92, 0x6d, 0xb8, 0x0c, 0x32, 0x48, 0xc9, 0x20, 0x9a, 0xc9, 0xc9, 0xc8, 0xc1,
+    0xc9, 0xc8, 0x90, 0x3b, 0x42, 0xe1, 0xd1, 0x99, 0x5c, 0x36, 0x55, 0x81, 0xdb, 0x83, 0x9e, 0xa2,
+    0xbb, 0x6d, 0x07, 0xc4, 0xb0, 0xea, 0x08, 0x2d, 0xee, 0x9d, 0x23, 0xba, 0x1c, 0x02, 0x48, 0x02,
+    0x5e, 0xdc, 0x7b, 0xfb, 0x7e, 0x5d, 0xf1, 0xe7, 0x72, 0x4a, 0xc4, 0x95, 0x40, 0x70, 0x0f, 0x1c,
+    0xf4, 0xf7, 0xa8, 0xc1, 0x24, 0x29, 0x38, 0xc1, 0xfc, 0x07, 0x4f, 0xff, 0x00, 0x5d, 0x74, 0x51,
+    0x94, 0xa9, 0xbb, 0x9a, 0x42, 0x16, 0x3d, 0xa7, 0x14, 0x62, 0xbc, 0xff, 0x00, 0x44, 0xf1, 0x75,
+    0xe5, 0xa2, 0xac, 0x17, 0xa1, 0xae, 0xa3, 0xc9, 0xf9, 0x89, 0x26, 0x45, 0xe4, 0x77, 0x3d, 0x7b,
+    0xf0, 0x79, 0xe7, 0xaf, 0x6a, 0xeb, 0x2d, 0x3c, 0x47, 0xa5, 0xde, 0x01, 0x8b, 0x91, 0x13, 0x60,
+    0x9d, 0xb3, 0x7c, 0x98, 0xe7, 0xd7, 0xa7, 0xbf, 0x5a, 0xee, 0x8d, 0x78, 0x4b, 0xa8, 0xee, 0x8d,
+    0x4c, 0x51, 0x8a, 0xa5, 0x2e, 0xb3, 0xa6, 0xc3, 0x13, 0x48, 0xf7, 0xd0, 0x15, 0x5e, 0xa1, 0x1c,
+    0x31, 0xfc, 0x86, 0x4d, 0x61, 0xea, 0x3e, 0x37, 0xb3, 0x80, 0x3a, 0x59, 0x43, 0x24, 0xf2, 0xf4,
+    0x56, 0x61, 0xb5, 0x39, 0x1d, 0x79, 0xe4, 0xf3, 0xdb, 0x03, 0xeb, 0x54, 0xea, 0xc1, 0x6e, 0xc0,
+    0xe8, 0xee, 0x6e, 0xad, 0xec, 0xa1, 0x32, 0xdc, 0xcc, 0x91, 0x20, 0xee, 0xc7, 0x19, 0x38, 0xce,
+    0x07, 0xa9, 0xe0, 0xf1, 0x5e, 0x7f, 0xaf, 0xf8, 0xaa, 0x5d, 0x45, 0x8c, 0x36, 0x66, 0x48, 0x6d,
+    0x40, 0x21, 0x81, 0xe1, 0xa4, 0xc8, 0x20, 0xee, 0xc7, 0x6f, 0x6f, 0xcf, 0xb6, 0x31, 0xf5, 0x4d,
+    0x52, 0xef, 0x54, 0xba, 0xf3, 0x6e, 0x25, 0x66, 0xee, 0x10, 0x1f, 0x95, 0x33, 0xd9, 0x47, 0x6e,
+    0x00, 0xf7, 0xaa, 0xca, 0x9b, 0xc6, 0x72, 0x40, 0xee, 0x47, 0x73, 0x5c, 0xb5, 0x2b, 0xb9, 0x68,
+    0xb4, 0x45, 0x25, 0x6d, 0xc6, 0x61, 0x89, 0x19, 0xdc, 0x1b, 0xa8, 0xa9, 0xa3, 0x88, 0xee, 0xfd,
+    0xe0, 0xea, 0x71, 0xcf, 0x38, 0xa9, 0x56, 0x13, 0xe6, 0x0c, 0x2e, 0x0e, 0x3b, 0x01, 0x56, 0x02,
+    0xe0, 0x06, 0xe0, 0x7b, 0x76, 0x1f, 0xe7, 0xfc, 0x6b, 0x92, 0x53, 0xec, 0x44, 0xea, 0x74, 0x43,
+    0x23, 0x88, 0x28, 0xe8, 0x48, 0x23, 0xf2, 0xef, 0xda, 0x9e, 0xcc, 0xa0, 0x7c, 0xbc, 0x67, 0xd3,
+    0x9e, 0x29, 0xb2, 0x4a, 0x41, 0x3c, 0x8f, 0x5e, 0xbd, 0x3f, 0xc8, 0xaa, 0x6f, 0x28, 0x0c, 0x01,
+    0x0b, 0xc8, 0xc9, 0xf4, 0xa8, 0x51, 0x72, 0x33, 0x51, 0x72, 0x7a, 0x93, 0xc9, 0x26, 0x49, 0x6c,
+    0x90, 0x09, 0xe6, 0xa9, 0xbb, 0xee, 0x60, 0xbb, 0x81, 0xc7, 0x4c, 0x51, 0x9d, 0xe4, 0x92, 0x1b,
+    0x27, 0xa7, 0x4e, 0x2a, 0x68, 0xa3, 0x23, 0x1c, 0x76, 0xce, 0x07, 0x4a, 0xd9, 0x25, 0x13, 0x74,
+    0x94, 0x51, 0x12, 0xc6, 0x49, 0xc6, 0x3e, 0x6e, 0x3e, 0x60, 0x3e, 0x95, 0xd2, 0x78, 0x6f, 0x56,
+    0x7d, 0x2a, 0xe7, 0x6c, 0xb2, 0x37, 0xd8, 0xa4, 0xff, 0x00, 0x58, 0x08, 0xc8, 0x53, 0x8c, 0x06,
+    0x1e, 0xfd, 0x33, 0xed, 0xf4, 0x15, 0x94, 0x89, 0xf4, 0x3e, 0xd8, 0xf5, 0xa9, 0x19, 0xf1, 0x11,
+    0xec, 0x7d, 0x73, 0xeb, 0xda, 0xa3, 0xda, 0xb5, 0x2b, 0xc4, 0xca, 0x55, 0x1b, 0xd8, 0xf5, 0x45,
+    0x65, 0x74, 0x57, 0x46, 0x0c, 0xac, 0x32, 0x08, 0x39, 0x04, 0x53, 0xb1, 0x5c, 0xa7, 0x84, 0x75,
+    0xbf, 0x3c, 0x7f, 0x66, 0xce, 0xc4, 0xc8, 0x01, 0x68, 0x59, 0x98, 0x7d, 0xd1, 0xc6, 0xcf, 0x5c,
+    0x8e, 0xbd, 0xf8, 0xcf, 0xa5, 0x75, 0x98, 0xaf, 0x5a, 0x9d, 0x45, 0x38, 0xf3, 0x16, 0x84, 0xc5,
+    0x18, 0xa5, 0xc5, 0x18, 0xab, 0xb8, 0x09, 0x8a, 0x31, 0x4b, 0x8a, 0x31, 0x45, 0xc0, 0x4c, 0x51,
+    0x8a, 0x5c, 0x51, 0x8a, 0x2e, 0x02, 0x62, 0x8c, 0x52, 0xe2, 0x8c, 0x51, 0x70, 0x13, 0x14, 0x62,
+    0x97, 0x14, 0x62, 0x8b, 0x80, 0x98, 0xa3, 0x14, 0xb8, 0xa3, 0x14, 0x5c, 0x04, 0xc5, 0x18, 0xa5,
+    0xc5, 0x18, 0xa2, 0xe0, 0x26, 0x28, 0xc5, 0x2e, 0x28, 0xc5, 0x17, 0x01, 0x31, 0x46, 0x29, 0x71,
+    0x46, 0x28, 0xb8, 0x09, 0x8a, 0x31, 0x4b, 0x8a, 0x31, 0x45, 0xc0, 0x4c, 0x51, 0x8a, 0x5c, 0x51,
+    0x8a, 0x2e, 0x02, 0x62, 0x8c, 0x52, 0xe2, 0x8c, 0x51, 0x70, 0x13, 0x14, 0x62, 0x97, 0x14, 0x62,
+    0x8b, 0x80, 0x98, 0xa3, 0x14, 0xb8, 0xa3, 0x14, 0x5c, 0x04, 0xc5, 0x18, 0xa5, 0xc5, 0x18, 0xa2,
+    0xe0, 0x3b, 0x14, 0x62, 0x9d, 0x8a, 0x31, 0x51, 0x71, 0x8d, 0xc5, 0x18, 0xa7, 0x62, 0x8c, 0x51,
+    0x70, 0x1b, 0x8a, 0x31, 0x4e, 0xc5, 0x18, 0xa2, 0xe0, 0x37, 0x14, 0x62, 0x9d, 0x8a, 0x31, 0x45,
+    0xc0, 0x6e, 0x28, 0xc5, 0x3b, 0x14, 0x62, 0x8b, 0x80, 0xdc, 0x51, 0x8a, 0x76, 0x28, 0xc5, 0x17,
+    0x01, 0xb8, 0xa3, 0x14, 0xec, 0x51, 0x8a, 0x2e, 0x03, 0x71, 0x5e, 0x41, 0xac, 0xff, 0x00, 0xc8,
+    0x73, 0x50, 0xff, 0x00, 0xaf, 0x99, 0x3f, 0xf4, 0x23, 0x5e, 0xc3, 0x8a, 0xf2, 0x3d, 0x61, 0x47,
+    0xf6, 0xdd, 0xff, 0x00, 0x1f, 0xf2, 0xf3, 0x27, 0xfe, 0x84, 0x6b, 0x97, 0x14, 0xf4, 0x47, 0xa1,
+    0x97, 0x46, 0xf2, 0x91, 0x45, 0x3e, 0xe8, 0xa9, 0x13, 0xbd, 0x0a, 0xa3, 0x68, 0xe2, 0x9b, 0x21,
+    0x29, 0x8d, 0xbc, 0x66, 0xbc, 0xfd, 0xf4, 0x3d, 0xd4, 0xb9, 0x17, 0x33, 0x1d, 0x2f, 0xfa, 0xb3,
+    0x55, 0xe9, 0xe1, 0xd9, 0x8e, 0x09, 0xc8, 0x34, 0xbb, 0x17, 0xd2, 0xa9, 0x68, 0x67, 0x3f, 0xde,
+    0x3b, 0xa1, 0xd5, 0x22, 0xfd, 0xd1, 0x46, 0xd1, 0xe9, 0x50, 0xbb, 0xb2, 0xb9, 0x00, 0xe0, 0x54,
+    0xee, 0x6b, 0xfc, 0x3d, 0x58, 0xb3, 0xff, 0x00, 0x0d, 0x46, 0x9f, 0x78, 0x53, 0xc1, 0x2f, 0xf7,
+    0xb9, 0xc5, 0x39, 0x55, 0x77, 0x0e, 0x2a, 0xb6, 0x56, 0x32, 0x6b, 0x9e, 0x5c, 0xc8, 0x2a, 0x5a,
+    0x4d, 0xa3, 0xd2, 0xa0, 0xf3, 0x5f, 0xd7, 0xf4, 0xa9, 0xb5, 0xcd, 0x5c, 0x95, 0x3d, 0xc2, 0x5f,
+    0xf5, 0x86, 0xbb, 0x3f, 0x87, 0xdf, 0xf3, 0x11, 0xff, 0x00, 0xb6, 0x5f, 0xfb, 0x3d, 0x71, 0xa0,
+    0x6e, 0x19, 0x3c, 0x93, 0x5d, 0x47, 0x84, 0xb5, 0x3b, 0x2d, 0x22, 0xdb, 0x52, 0x9e, 0xee, 0x65,
+    0x41, 0x88, 0xca, 0xa6, 0x7e, 0x67, 0xc6, 0xee, 0x14, 0x77, 0xea, 0x3e, 0x99, 0xe6, 0xba, 0x28,
+    0x34, 0xa6, 0xae, 0x79, 0xd8, 0xd8, 0xb7, 0x46, 0x52, 0xfe, 0xb7, 0x3d, 0x03, 0x14, 0x62, 0xbc,
+    0xdf, 0x54, 0xf1, 0xa6, 0xa1, 0x7b, 0x33, 0xa5, 0x8c, 0x82, 0xda, 0xdc, 0xe5, 0x54, 0x28, 0x05,
+    0xd9, 0x48, 0xc6, 0x4b, 0x76, 0x3f, 0x4c, 0x63, 0x3d, 0x4f, 0x5a, 0xc2, 0x9a, 0x4b, 0x8b, 0xd9,
+    0x44, 0x97, 0x52, 0x4b, 0x33, 0x01, 0xb4, 0x19, 0x5c, 0xb1, 0x03, 0xaf, 0x7e, 0x83, 0x93, 0x5d,
+    0x72, 0xc4, 0x45, 0x6c, 0x78, 0x76, 0xb6, 0xe7, 0xb2, 0xe2, 0x8c, 0x57, 0x95, 0x59, 0x5c, 0xde,
+    0x58, 0xe3, 0xec, 0xb7, 0x33, 0x44, 0x8a, 0xdb, 0xf6, 0x23, 0x10, 0xac, 0xde, 0xbb, 0x7a, 0x7e,
+    0x7e, 0x95, 0xd1, 0x69, 0xfe, 0x32, 0x96, 0x12, 0x23, 0xd4, 0x63, 0xf3, 0x07, 0xfc, 0xf4, 0x41,
+    0xb5, 0xbb, 0xf6, 0xe8, 0x7b, 0x7a, 0x71, 0xeb, 0x53, 0x1c, 0x54, 0x1b, 0xb3, 0xd0, 0xcf, 0x9d,
+    0x5e, 0xc7, 0x67, 0x8a, 0x31, 0x55, 0xec, 0xf5, 0x0b, 0x4d, 0x41, 0x0b, 0xda, 0x5c, 0x24, 0xa0,
+    0x7d, 0xe0, 0x0f, 0x2b, 0xd7, 0xa8, 0xea, 0x3a, 0x1a, 0xb5, 0x8a, 0xe8, 0x4d, 0x3d, 0x51, 0x63,
+    0x71, 0x46, 0x29, 0xd8, 0xa3, 0x14, 0xee, 0x03, 0x71, 0x46, 0x29, 0xd8, 0xa3, 0x14, 0x5c, 0x06,
+    0xe2, 0x8c, 0x53, 0xb1, 0x4d, 0x77, 0x48, 0xe3, 0x69, 0x24, 0x75, 0x54, 0x50, 0x4b, 0x33, 0x1c,
+    0x00, 0x07, 0x72, 0x68, 0xb8, 0x10, 0x5e, 0x5d, 0x45, 0x63, 0x67, 0x35, 0xd4, 0xc7, 0x11, 0xc4,
+    0xa5, 0x8f, 0x23, 0x27, 0xd8, 0x67, 0xb9, 0xe8, 0x2b, 0xc9, 0xf5, 0x5d, 0x42, 0x5d, 0x66, 0xfa,
+    0x5b, 0xc9, 0x86, 0xdd, 0xc7, 0x0b, 0x18, 0x6c, 0x84, 0x51, 0xc0, 0x5f, 0xf3, 0xdc, 0xfb, 0xd6,
+    0xbf, 0x89, 0x75, 0xd1, 0xad, 0xdd, 0x47, 0x15, 0xb2, 0xb7, 0xd8, 0xe1, 0x39, 0x56, 0xc9, 0x1b,
+    0xcf, 0xf7, 0x88, 0xfc, 0x38, 0xef, 0xc9, 0xf5, 0xc0, 0xc8, 0x8a, 0x15, 0xe0, 0x91, 0xdb, 0x9f,
+    0x43, 0xcd, 0x70, 0xd7, 0xac, 0x9e, 0x88, 0x4e, 0x4a, 0x24, 0x71, 0xc0, 0x0e, 0xd6, 0x03, 0x00,
+    0xf5, 0xc1, 0xe7, 0xda, 0xa7, 0x58, 0xd5, 0x54, 0xe0, 0x10, 0x00, 0x3d, 0xff, 0x00, 0x1a, 0x72,
+    0x04, 0x50, 0x3a, 0x10, 0x4f, 0x4c, 0x67, 0xd7, 0xfc, 0x6a, 0x29, 0x66, 0xd8, 0xbc, 0x6e, 0x19,
+    0x19, 0xce, 0x47, 0x5a, 0xe4, 0xbb, 0x91, 0x93, 0x6e, 0x4c, 0x73, 0x32, 0x21, 0xc0, 0x18, 0x07,
+    0xf4, 0xaa, 0xad, 0x36, 0x7a, 0x71, 0xdf, 0xea, 0x4f, 0xa5, 0x31, 0xa5, 0x62, 0x76, 0xb8, 0xc8,
+    0x3c, 0x63, 0x91, 0x9f, 0xf3, 0xcd, 0x37, 0x6e, 0xf6, 0xcb, 0x15, 0xc7, 0xbf, 0x5a, 0xd2, 0x30,
+    0x4b, 0x73, 0x58, 0xd3, 0x4b, 0x56, 0x21, 0x1b, 0xdb, 0x83, 0x91, 0x92, 0x4d, 0x4b, 0x14, 0x65,
+    0xd9, 0xb7, 0x67, 0x19, 0xe3, 0x9f, 0xeb, 0x52, 0xc5, 0x16, 0x57, 0xa1, 0xce, 0x3b, 0xff, 0x00,
+    0x9c, 0xe6, 0xa7, 0x11, 0x85, 0x63, 0x85, 0xc8, 0x03, 0x91, 0x44, 0xa7, 0x6d, 0x85, 0x2a, 0x96,
+    0xd1, 0x09, 0x1c, 0x23, 0x1b, 0xce, 0x47, 0x4e, 0x79, 0xa7, 0x64, 0x06, 0x23, 0x24, 0x8e, 0xe0,
+    0xd2, 0x3c, 0xa0, 0x06, 0x04, 0x80, 0x3b, 0x55, 0x59, 0x26, 0x1b, 0x8f, 0x42, 0x3a, 0x01, 0xd6,
+    0xb3, 0x49, 0xc8, 0xcd, 0x27, 0x26, 0x4f, 0x2c, 0xa4, 0x92, 0x01, 0x38, 0xcf, 0x53, 0xde, 0xaa,
+    0x3c, 0xc5, 0xce, 0xdd, 0xd8, 0x39, 0xe9, 0xdc, 0xfe, 0x14, 0xd2, 0x43, 0x9e, 0xbc, 0x93, 0xcf,
+    0xf8, 0xd3, 0x84, 0x40, 0xe4, 0xae, 0x4f, 0xbf, 0x4e, 0x6b, 0x55, 0x15, 0x13, 0x65, 0x15, 0x14,
+    0x32, 0x30, 0x08, 0x19, 0x1f, 0x88, 0x1d, 0x07, 0xff, 0x00, 0xae, 0xad, 0x24, 0x0a, 0xb9, 0x3b,
+    0x70, 0x07, 0x06, 0x9d, 0x1c, 0x07, 0xb0, 0x1e, 0x98, 0x3f, 0x8d, 0x58, 0xf9, 0x00, 0x24, 0x75,
+    0xe4, 0x75, 0xa8, 0x94, 0xfb, 0x19, 0xce, 0xa5, 0xf4, 0x43, 0x42, 0x94, 0x2b, 0x91, 0x81, 0xd3,
+    0xf0, 0xa4, 0x32, 0x2a, 0x29, 0x03, 0x9c, 0x77, 0xc6, 0x38, 0xa6, 0x4b, 0x2a, 0xe7, 0x00, 0xed,
+    0x20, 0xf3, 0xc8, 0x1c, 0xd5, 0x43, 0x29, 0x6e, 0x84, 0x0c, 0xf6, 0x07, 0xad, 0x28, 0xc1, 0xbd,
+    0xc5, 0x18, 0x37, 0xb9, 0x24, 0xb2, 0x64, 0xf3, 0xc1, 0x24, 0x81, 0xcf, 0xe5, 0x50, 0x30, 0x0e,
+    0x0f, 0x50, 0x4f, 0x3c, 0x9e, 0x28, 0xc3, 0xba, 0xb1, 0x07, 0x39, 0xeb, 0xde, 0xac, 0x43, 0x1e,
+    0x72, 0xa0, 0x12, 0x7a, 0x9e, 0xf5, 0xae, 0x91, 0x36, 0xd2, 0x28, 0x8e, 0x38, 0x73, 0x81, 0x9c,
+    0x73, 0x91, 0xff, 0x00, 0xea, 0xab, 0x6b, 0x10, 0xc6, 0x5c, 0x60, 0x74, 0xcd, 0x38, 0x27, 0x18,
+    0xc7, 0x6e, 0xa3, 0x8f, 0xce, 0x95, 0xe5, 0x01, 0x5b, 0x04, 0xf4, 0xc7, 0x5e, 0x6b, 0x27, 0x26,
+    0xcc, 0x65, 0x37, 0x2d, 0x85, 0x3f, 0x77, 0xa8, 0xf7, 0xf5, 0xa8, 0x26, 0x94, 0x6d, 0xe7, 0x00,
+    0xe0, 0xf4, 0xe3, 0x1f, 0xe7, 0x35, 0x1c, 0x92, 0x82, 0x84, 0x80, 0x38, 0x07, 0xa7, 0x39, 0xfc,
+    0x6a, 0xb1, 0x76, 0x72, 0x70, 0xd9, 0x5c, 0x63, 0x8f, 0xf0, 0xaa, 0x8c, 0x3b, 0x95, 0x0a, 0x7d,
+    0x59, 0x2b, 0xca, 0xcc, 0x40, 0x0c, 0x0f, 0x4c, 0x1c, 0x62, 0x98, 0x23, 0xce, 0x01, 0x39, 0x5e,
+    0xc4, 0x54, 0x89, 0x18, 0x73, 0x9c, 0x1e, 0x4f, 0xf1, 0x71, 0x9f, 0xa7, 0xe5, 0x56, 0x63, 0x88,
+    0xf0, 0x30, 0x72, 0x3e, 0xe8, 0x35, 0x4e, 0x4a, 0x25, 0xca, 0x6a, 0x3b, 0x11, 0xc7, 0x16, 0x00,
+    0x67, 0x5c, 0x67, 0x9e, 0x06, 0x2a, 0xc8, 0x55, 0xf9, 0x54, 0x63, 0x1d, 0x49, 0xeb, 0xfe, 0x7b,
+    0x50, 0x08, 0x18, 0x2a, 0x41, 0xe7, 0xad, 0x45, 0x25, 0xc1, 0xdc, 0x77, 0x0f, 0x97, 0x9c, 0x1c,
+    0x1a, 0xca, 0xee, 0x46, 0x2d, 0xb9, 0x32, 0x46, 0x94, 0x2f, 0x38, 0x20, 0x7f, 0x9f, 0xfe, 0xb7,
+    0x35, 0x56, 0x59, 0x06, 0xec, 0xe3, 0xe9, 0x8e, 0xdc, 0xd4, 0x52, 0x4b, 0xb9, 0x71, 0xb4, 0x0c,
+    0xe3, 0x3e, 0xde, 0xdc, 0xd3, 0x08, 0xde, 0xc0, 0x8e, 0x9d, 0x86, 0x07, 0x3f, 0x9f, 0xe1, 0x5a,
+    0x46, 0x09, 0x6e, 0x6b, 0x1a, 0x69, 0x6a, 0xc7, 0xc5, 0x71, 0x34, 0x73, 0xa4, 0xf1, 0x61, 0x5e,
+    0x37, 0x12, 0x21, 0xf4, 0x61, 0xc8, 0x3c, 0xf0, 0x7a, 0x57, 0xac, 0xe8, 0xba, 0xa2, 0x6a, 0xfa,
+    0x6c, 0x77, 0x2a, 0x30, 0xe3, 0xe4, 0x95, 0x76, 0xe3, 0x0f, 0x81, 0x9c, 0x7b, 0x73, 0x91, 0xec,
+    0x6b, 0xca, 0xe3, 0x84, 0xb1, 0xfe, 0xf7, 0x23, 0x27, 0x35, 0xbd, 0xe1, 0xfd, 0x48, 0xe9, 0x3a,
+    0x82, 0xb1, 0x6c, 0xc1, 0x29, 0xd9, 0x20, 0xc9, 0xe0, 0x7f, 0x7b, 0x03, 0xb8, 0xfe, 0x59, 0xad,
+    0xa9, 0xd6, 0x50, 0x95, 0xba, 0x04, 0xa6, 0xb6, 0x3d, 0x1f, 0x14, 0x62, 0x85, 0x65, 0x74, 0x57,
+    0x46, 0x0c, 0xac, 0x32, 0x08, 0x39, 0x04, 0x53, 0xb1, 0x5d, 0xf7, 0x18, 0xdc, 0x51, 0x8a, 0x76,
+    0x28, 0xc5, 0x17, 0x01, 0xb8, 0xa3, 0x14, 0xec, 0x51, 0x8a, 0x2e, 0x03, 0x71, 0x46, 0x29, 0xd8,
+    0xa3, 0x14, 0x5c, 0x06, 0xe2, 0x8c, 0x53, 0xb1, 0x46, 0x28, 0xb8, 0x0d, 0xc5, 0x18, 0xa7, 0x62,
+    0x8c, 0x51, 0x70, 0x1b, 0x8a, 0x31, 0x4e, 0xc5, 0x18, 0xa2, 0xe0, 0x37, 0x14, 0x62, 0x9d, 0x8a,
+    0x31, 0x45, 0xc0, 0x6e, 0x28, 0xc5, 0x3b, 0x14, 0x62, 0x8b, 0x80, 0xdc, 0x51, 0x8a, 0x76, 0x28,
+    0xc5, 0x17, 0x01, 0xb8, 0xa3, 0x14, 0xec, 0x51, 0x8a, 0x2e, 0x03, 0x71, 0x46, 0x29, 0xd8, 0xa3,
+    0x14, 0x5c, 0x06, 0xe2, 0x8c, 0x53, 0xb1, 0x46, 0x28, 0xb8, 0x0d, 0xc5, 0x18, 0xa7, 0x62, 0x8c,
+    0x51, 0x70, 0x1b, 0x8a, 0x31, 0x4e, 0xc5, 0x73, 0x5e, 0x28, 0xf1, 0x3a, 0xe9, 0x11, 0x9b, 0x5b,
+    0x52, 0x1e, 0xf9, 0x87, 0xa6, 0x44, 0x43, 0xd4, 0xfb, 0xfa, 0x0f, 0xc4, 0xf6, 0xca, 0x94, 0x94,
+    0x55, 0xd8, 0x58, 0xe9, 0xa8, 0xa5, 0xa2, 0x90, 0x09, 0x45, 0x2d, 0x14, 0x00, 0x94, 0x52, 0xd1,
+    0x40, 0x09, 0x45, 0x56, 0xbf, 0xd4, 0x6d, 0x74, 0xdb, 0x73, 0x2d, 0xcc, 0x81, 0x78, 0x25, 0x50,
+    0x72, 0xcf, 0x8e, 0xc0, 0x77, 0xea, 0x2b, 0x84, 0xd6, 0xbc, 0x51, 0x73, 0xa8, 0x96, 0x86, 0x2d,
+    0xd0, 0x5a, 0xe4, 0xe0, 0x29, 0xc3, 0x38, 0x23, 0x1f, 0x37, 0xeb, 0xc7, 0x4f, 0xad, 0x65, 0x3a,
+    0xb1, 0x87, 0xa8, 0x9b, 0xb1, 0xd6, 0x6a, 0x5e, 0x26, 0xd3, 0x34, 0xc6, 0x29, 0x24, 0xa6, 0x59,
+    0x41, 0xc1, 0x8e, 0x10, 0x18, 0x8c, 0x67, 0x39, 0x39, 0xc6, 0x46, 0x3a, 0x67, 0x3e, 0xd5, 0xcd,
+    0xdd, 0xf8, 0xfa, 0xe3, 0x2a, 0x2d, 0xad, 0x21, 0x8f, 0xae, 0x7c, 0xc6, 0x2f, 0xbb, 0xa6, 0x31,
+    0x8d, 0xb8, 0xef, 0xeb, 0x5c, 0x84, 0xb3, 0x6e, 0x24, 0x03, 0x8e, 0xfc, 0x8e, 0xf4, 0xc0, 0x7c,
+    0xd6, 0x3c, 0x3f, 0xbe, 0xda, 0xc1, 0xd5, 0x9b, 0xf2, 0x29, 0x27, 0xd4, 0xeb, 0xed, 0xfe, 0x21,
+    0xdc, 0x2c, 0x78, 0xb9, 0xd3, 0xe3, 0x91, 0xc9, 0xeb, 0x1b, 0x94, 0x00, 0x7d, 0x08, 0x3c, 0xfe,
+    0x35, 0xd5, 0xe9, 0x7e, 0x20, 0xd3, 0xb5, 0x6c, 0x2d, 0xbc, 0xdb, 0x65, 0xff, 0x00, 0x9e, 0x32,
+    0x70, 0xfd, 0xfa, 0x76, 0x3c, 0x0c, 0xf1, 0x9a, 0xf2, 0x88, 0xe0, 0x27, 0x05, 0x86, 0x5b, 0x1e,
+    0xdf, 0x37, 0x3c, 0xd5, 0xa4, 0x85, 0x57, 0x76, 0x0e, 0xe2, 0x3a, 0xe7, 0xa5, 0x2f, 0xac, 0xb8,
+    0xf9, 0x93, 0x29, 0xa4, 0x7b, 0x0d, 0x15, 0xc7, 0xe8, 0x7e, 0x2b, 0x61, 0x22, 0x5a, 0xea, 0x6e,
+    0xbb, 0x48, 0x0a, 0x93, 0xf7, 0x07, 0x3f, 0xc7, 0xf9, 0x8e, 0x7f, 0x3e, 0xe4, 0x76, 0x35, 0xd3,
+    0x0a, 0x8a, 0x6a, 0xe8, 0x13, 0xba, 0x12, 0xbc, 0x8f, 0x58, 0xff, 0x00, 0x90, 0xdd, 0xff, 0x00,
+    0xfd, 0x7c, 0xc9, 0xff, 0x00, 0xa1, 0x1a, 0xf5, 0xda, 0xf2, 0x7d, 0x5f, 0xfe, 0x43, 0x57, 0xff,
+    0x00, 0xf5, 0xf1, 0x27, 0xfe, 0x84, 0x6b, 0x0c, 0x53, 0xd1, 0x1e, 0xb6, 0x55, 0x1b, 0xce, 0x5e,
+    0x85, 0x15, 0xfb, 0xa2, 0xa2, 0x9f, 0xf8, 0x69, 0xb2, 0xff, 0x00, 0xac, 0x34, 0x47, 0xde, 0xb8,
+    0xd2, 0xea, 0x7a, 0xd2, 0xa9, 0x7f, 0x70, 0x6a, 0x7d, 0xe1, 0x52, 0xd2, 0xaf, 0xde, 0x15, 0x25,
+    0x26, 0xca, 0xa7, 0x4f, 0x4d, 0xc2, 0xab, 0xcb, 0xfe, 0xb0, 0xd3, 0x2a, 0x44, 0xfb, 0xa2, 0x9a,
+    0x56, 0x22, 0x55, 0x3d, 0xa2, 0xb0, 0x91, 0xf7, 0xa9, 0x17, 0xef, 0x0a, 0x54, 0xef, 0x44, 0xbf,
+    0xea, 0xcd, 0x26, 0xee, 0xcb, 0x8c, 0x39, 0x63, 0x71, 0xf5, 0x52, 0x8a, 0x9a, 0x9a, 0x56, 0x33,
+    0x94, 0xbd, 0xa7, 0x95, 0x86, 0xa7, 0xdd, 0x14, 0xd9, 0x06, 0x59, 0x47, 0xd6, 0xac, 0x2f, 0xdd,
+    0x14, 0xf4, 0x8c, 0x3b, 0x72, 0x70, 0x05, 0x0a, 0x56, 0x66, 0x18, 0xe8, 0xf2, 0xe1, 0x64, 0xfd,
+    0x3f, 0x34, 0x45, 0x1c, 0x0c, 0x54, 0x30, 0x50, 0x38, 0xce, 0x3a, 0x8a, 0xb3, 0x1a, 0x36, 0xdf,
+    0x9b, 0x3f, 0x97, 0x3f, 0x4a, 0x5e, 0x14, 0x00, 0x06, 0x0e, 0x73, 0x80, 0x73, 0x8a, 0x89, 0xe7,
+    0xc0, 0xe5, 0x81, 0xe4, 0x96, 0x03, 0x9a, 0x1b, 0x72, 0x3e, 0x5d, 0xc9, 0xc9, 0x93, 0x33, 0x28,
+    0x42, 0x54, 0xf1, 0xdc, 0x1a, 0xa6, 0xf2, 0xb0, 0x04, 0x71, 0xc7, 0xad, 0x31, 0xe4, 0x6c, 0x90,
+    0xa0, 0x9e, 0x3a, 0xf0, 0x7f, 0x4a, 0x8b, 0x0c, 0x58, 0x8c, 0x12, 0x47, 0xeb, 0xf8, 0x56, 0x91,
+    0x85, 0xb7, 0x34, 0x85, 0x3b, 0x6a, 0xc9, 0xed, 0x35, 0x0b, 0xab, 0x3b, 0x85, 0x9e, 0xd2, 0x67,
+    0x86, 0x4c, 0xf5, 0x43, 0x8c, 0x8c, 0xf4, 0xc7, 0x71, 0xec, 0x78, 0xae, 0xff, 0x00, 0x46, 0xf1,
+    0xa5, 0xb5, 0xd8, 0x58, 0x75, 0x00, 0x2d, 0xee, 0x0b, 0x63, 0x7a, 0x83, 0xe5, 0x9e, 0x78, 0x1e,
+    0xa0, 0xfd, 0x78, 0xe3, 0xaf, 0x6a, 0xe0, 0x12, 0x2d, 0xe5, 0x82, 0x9e, 0x3b, 0x8c, 0xd5, 0x98,
+    0x63, 0x55, 0xda, 0x09, 0xe4, 0x74, 0x39, 0xfd, 0x2a, 0xd5, 0x67, 0x0d, 0x87, 0x29, 0xa4, 0x7b,
+    0x05, 0x15, 0xe6, 0xba, 0x67, 0x88, 0x6e, 0xf4, 0x8f, 0x95, 0x58, 0x4d, 0x07, 0x43, 0x1b, 0x1f,
+    0x97, 0xae, 0x4e, 0x0f, 0x6e, 0xa7, 0x9f, 0x7e, 0x6b, 0xa7, 0xb3, 0xf1, 0xb6, 0x99, 0x32, 0x1f,
+    0xb5, 0x6f, 0xb5, 0x90, 0x76, 0x2a, 0x5d, 0x4f, 0x5e, 0x84, 0x0f, 0x4c, 0x75, 0x03, 0xaf, 0x7a,
+    0xe9, 0xa7, 0x5e, 0x33, 0xf2, 0x08, 0xca, 0xe7, 0x47, 0x45, 0x52, 0xfe, 0xda, 0xd2, 0xb3, 0x8f,
+    0xed, 0x3b, 0x2f, 0x4f, 0xf5, 0xeb, 0xfe, 0x35, 0x46, 0xef, 0xc5, 0x9a, 0x4d, 0xa9, 0xda, 0x93,
+    0x9b, 0x97, 0xc8, 0x04, 0x5b, 0x8d, 0xc3, 0xa6, 0x73, 0x9e, 0x06, 0x3e, 0x86, 0xb5, 0x73, 0x4b,
+    0x76, 0x33, 0x65, 0xdd, 0x22, 0x8d, 0xa4, 0x91, 0x95, 0x11, 0x41, 0x66, 0x66, 0x38, 0x00, 0x0e,
+    0xa4, 0x9a, 0xe1, 0xbc, 0x49, 0xe2, 0x5f, 0xb7, 0xc6, 0x6c, 0xb4, 0xf7, 0x22, 0xd9, 0xc6, 0x25,
+    0x97, 0x95, 0x2f, 0xc7, 0xdd, 0x03, 0xa8, 0x1e, 0xbe, 0xbf, 0x4e, 0xb4, 0x75, 0x7f, 0x10, 0xde,
+    0x6b, 0x39, 0x88, 0x8f, 0x22, 0xdb, 0x20, 0xf9, 0x2a, 0x73, 0x92, 0x3d, 0x4f, 0x19, 0xfa, 0x63,
+    0x1d, 0x3b, 0x8c, 0xd6, 0x5e, 0x4a, 0xae, 0x32, 0x33, 0xeb, 0xe9, 0x5c, 0x75, 0xb1, 0x17, 0xf7,
+    0x62, 0x67, 0x29, 0xf6, 0x18, 0x90, 0xaa, 0xae, 0xf5, 0x1d, 0x06, 0x79, 0xf6, 0xff, 0x00, 0x3f,
+    0xad, 0x3c, 0xc9, 0xc7, 0x3c, 0x76, 0x3c, 0x1a, 0x8a, 0x49, 0x8a, 0x06, 0xce, 0x00, 0x03, 0x83,
+    0xeb, 0xf9, 0x55, 0x69, 0x66, 0x24, 0x71, 0x9e, 0x47, 0x5a, 0xe7, 0x51, 0x6c, 0x98, 0xc1, 0xcb,
+    0x72, 0x49, 0x6e, 0x19, 0x83, 0x0e, 0x31, 0x82, 0x73, 0x9e, 0xd5, 0x5f, 0x76, 0x5b, 0x23, 0x07,
+    0x8d, 0xdd, 0x7d, 0xe9, 0xac, 0xa5, 0x94, 0xec, 0x27, 0x71, 0x18, 0xe2, 0xa7, 0x8e, 0xdc, 0xe7,
+    0x27, 0x18, 0x1c, 0x8c, 0x8c, 0x8c, 0x56, 0xb6, 0x51, 0x37, 0xb2, 0x8a, 0x1a, 0x21, 0xdc, 0x08,
+    0x50, 0x7f, 0x01, 0xd6, 0xad, 0x2c, 0x03, 0x68, 0xc0, 0xe3, 0xaf, 0xd2, 0x9c, 0xa8, 0x13, 0xd3,
+    0x1e, 0xff, 0x00, 0xca, 0x9c, 0x59, 0x51, 0x71, 0x80, 0x0e, 0x7b, 0x0e, 0x4f, 0xe7, 0xde, 0xb2,
+    0x94, 0xdb, 0xd8, 0xc6, 0x53, 0x6f, 0x60, 0xff, 0x00, 0x0e, 0xb5, 0x14, 0xd2, 0x2a, 0x93, 0xdb,
+    0xaf, 0x4e, 0x94, 0xc9, 0x26, 0x2b, 0xb5, 0x43, 0x0e, 0x39, 0xe6, 0xaa, 0x96, 0x66, 0xe3, 0xe6,
+    0x53, 0xdb, 0xbf, 0x14, 0xe3, 0x0b, 0xee, 0x38, 0x53, 0xbe, 0xac, 0x7c, 0x92, 0x87, 0x3c, 0x64,
+    0x75, 0xc6, 0x0f, 0xe5, 0xf4, 0xa6, 0x14, 0xc9, 0x3f, 0x97, 0x5e, 0x45, 0x39, 0x50, 0xb1, 0xe3,
+    0x94, 0xc8, 0xeb, 0x9c, 0x55, 0xa8, 0xe1, 0x3b, 0xb2, 0x70, 0x30, 0x70, 0x3d, 0x33, 0xcd, 0x5b,
+    0x6a, 0x26, 0x8e, 0x4a, 0x28, 0x8a, 0x08, 0x79, 0x1b, 0x8a, 0xfb, 0x03, 0xdb, 0xf1, 0xab, 0x6b,
+    0x1a, 0xc7, 0x83, 0xb7, 0x0c, 0x78, 0x3d, 0x29, 0xdb, 0x47, 0x61, 0x85, 0xcf, 0x61, 0x8e, 0xf4,
+    0xc9, 0x26, 0x20, 0xe3, 0x03, 0xa7, 0x52, 0x47, 0x41, 0x59, 0x36, 0xe4, 0x62, 0xe4, 0xe4, 0xc5,
+    0x67, 0xda, 0x4a, 0x83, 0xcf, 0x23, 0x8e, 0x6a, 0xac, 0xb2, 0x70, 0x0e, 0xec, 0x60, 0xf5, 0xc0,
+    0xa6, 0xc9, 0x21, 0x62, 0x07, 0x7f, 0x73, 0x51, 0x1c, 0xb9, 0x2d, 0xd5, 0x5b, 0xae, 0x7f, 0xcf,
+    0xf9, 0xc5, 0x69, 0x18, 0x5b, 0x73, 0x48, 0x53, 0xb6, 0xac, 0x32, 0x64, 0xfb, 0xe4, 0xe4, 0x9c,
+    0xf2, 0x38, 0xe3, 0xff, 0x00, 0xd7, 0x4f, 0x48, 0xfa, 0x29, 0x0b, 0xeb, 0xd3, 0x1d, 0xbf, 0xcf,
+    0x5a, 0x92, 0x28, 0x70, 0xc4, 0xe7, 0x03, 0x38, 0xe9, 0xdb, 0xeb, 0x56, 0x56, 0x3e, 0x32, 0x5b,
+    0xe9, 0x81, 0xda, 0x89, 0x4d, 0x2d, 0x87, 0x29, 0xa5, 0xa2, 0x23, 0x8d, 0x36, 0xe4, 0x03, 0xcf,
+    0xaf, 0xf2, 0xab, 0x1c, 0x05, 0xdd, 0xc2, 0x9e, 0xbf, 0x87, 0xff, 0x00, 0xaa, 0x99, 0xb8, 0x00,
+    0x57, 0x72, 0xfe, 0x75, 0x5a, 0x49, 0xca, 0x9e, 0xa4, 0xe0, 0x6e, 0xcf, 0xa8, 0xac, 0xf5, 0x91,
+    0x95, 0x9c, 0x99, 0x2c, 0xb3, 0x9e, 0xa1, 0x47, 0x5e, 0xfd, 0x2a, 0xab, 0x48, 0xc5, 0x86, 0xd7,
+    0xe3, 0xb9, 0x27, 0xa5, 0x21, 0x62, 0x4f, 0xca, 0xf8, 0xed, 0xc7, 0xf9, 0xe6, 0x91, 0x55, 0x8b,
+    0x0c, 0x10, 0x79, 0xf4, 0xf6, 0xad, 0x54, 0x52, 0x36, 0x8c, 0x14, 0x77, 0x10, 0x31, 0x70, 0x31,
+    0xc8, 0x27, 0x92, 0x7f, 0x95, 0x58, 0x8e, 0x12, 0x17, 0x39, 0x07, 0xbd, 0x3e, 0x38, 0x78, 0x19,
+    0x6c, 0x1e, 0xa3, 0xb6, 0x2a, 0x6d, 0xb8, 0x0a, 0x80, 0x11, 0x8e, 0xb8, 0xe9, 0x53, 0x29, 0xf6,
+    0x22, 0x75, 0x3a, 0x21, 0xb1, 0xc6, 0xa0, 0x73, 0xc9, 0x3c, 0xe0, 0x8c, 0x73, 0x4e, 0x77, 0x50,
+    0xb8, 0x62, 0x49, 0xe9, 0x80, 0x0f, 0xf9, 0x34, 0xd7, 0x70, 0x09, 0x20, 0x83, 0x81, 0x8e, 0x3b,
+    0xd5, 0x47, 0x9c, 0x64, 0x73, 0xbb, 0x3d, 0xbb, 0x71, 0x52, 0xa2, 0xd9, 0x11, 0x83, 0x96, 0xe4,
+    0x92, 0xc8, 0x42, 0xe0, 0x9c, 0x81, 0xd0, 0x75, 0xaa, 0xac, 0x59, 0x81, 0xc9, 0x1c, 0x75, 0x04,
+    0xf5, 0xfa, 0xd2, 0x82, 0xce, 0x55, 0x78, 0x23, 0xa7, 0x4e, 0xbc, 0xd4, 0xf1, 0x40, 0x37, 0xee,
+    0x03, 0x23, 0xb1, 0x1c, 0x8a, 0xd7, 0x48, 0x9b, 0xd9, 0x45, 0x0c, 0x48, 0xb2, 0x70, 0x41, 0xc6,
+    0x72, 0x4e, 0x7e, 0xb5, 0x61, 0x20, 0xcb, 0x6e, 0x3c, 0x81, 0xdc, 0x9c, 0xe6, 0xa4, 0x44, 0x20,
+    0x80, 0x78, 0x23, 0xaf, 0x38, 0xa7, 0x34, 0x98, 0x04, 0x90, 0x3e, 0x5f, 0x5f, 0xf3, 0xed, 0x59,
+    0x4a, 0x6d, 0xec, 0x63, 0x29, 0xb7, 0xb0, 0xa0, 0x2a, 0x0c, 0xb1, 0xe8, 0x33, 0x81, 0xfc, 0xea,
+    0x39, 0x64, 0xce, 0x42, 0xe0, 0x0e, 0x3d, 0xb8, 0xa8, 0xa4, 0x94, 0x28, 0x75, 0xfc, 0x09, 0x3d,
+    0xfd, 0x4d, 0x56, 0x77, 0x62, 0x30, 0x46, 0x70, 0x30, 0x39, 0xc5, 0x38, 0xc2, 0xfb, 0x8e, 0x14,
+    0xef, 0xab, 0x3b, 0xef, 0x05, 0xeb, 0xff, 0x00, 0x69, 0x07, 0x4c, 0xb8, 0x90, 0xb4, 0xaa, 0x0b,
+    0x42, 0xce, 0x46, 0x4a, 0x8f, 0xe1, 0xfc, 0x3a, 0x8e, 0xbc, 0x7a, 0x62, 0xbb, 0x1a, 0xf1, 0x78,
+    0x99, 0xed, 0xee, 0xa3, 0x9e, 0x26, 0x29, 0x24, 0x4c, 0x1d, 0x48, 0x19, 0xc1, 0x07, 0x20, 0xf3,
+    0xc7, 0x6a, 0xf5, 0x6d, 0x0f, 0x56, 0x5d, 0x5f, 0x4e, 0x49, 0x8e, 0xc5, 0x9d, 0x78, 0x96, 0x35,
+    0x3f, 0x74, 0xfa, 0xfd, 0x0f, 0x5f, 0xd3, 0x3c, 0x57, 0x75, 0x2a, 0x8b, 0xe1, 0x35, 0x76, 0xd8,
+    0xd2, 0xa2, 0x96, 0x8a, 0xdc, 0x42, 0x51, 0x4b, 0x45, 0x00, 0x25, 0x14, 0xb4, 0x50, 0x02, 0x51,
+    0x4b, 0x55, 0x75, 0x0d, 0x42, 0xdb, 0x4b, 0xb3, 0x7b, 0xab, 0xa7, 0xdb, 0x1a, 0xf4, 0x03, 0x92,
+    0xc7, 0xd0, 0x0e, 0xe6, 0x95, 0xec, 0x05, 0x9a, 0x82, 0xe6, 0xf6, 0xd2, 0xcf, 0x6f, 0xda, 0xae,
+    0xa0, 0x83, 0x7e, 0x76, 0xf9, 0xb2, 0x05, 0xce, 0x3a, 0xe3, 0x3f, 0x51, 0x5c, 0x06, 0xaf, 0xe3,
+    0x8b, 0xeb, 0xc1, 0x24, 0x5a, 0x7a, 0x7d, 0x96, 0x20, 0x70, 0x5f, 0x20, 0xb9, 0x1c, 0x8e, 0xbd,
+    0x17, 0xb7, 0x4e, 0x41, 0x1d, 0x6b, 0x9a, 0x2a, 0xf3, 0xbb, 0xc9, 0x2b, 0x16, 0x66, 0x39, 0x67,
+    0x66, 0xc9, 0x27, 0xb9, 0x24, 0xd6, 0x32, 0xae, 0x96, 0xc3, 0xb7, 0x73, 0xd5, 0xa2, 0xf1, 0x26,
+    0x8f, 0x2d, 0xc3, 0xc0, 0xb7, 0xf1, 0x07, 0x4c, 0xe4, 0xbe, 0x55, 0x4e, 0x0e, 0x38, 0x63, 0xc1,
+    0xfc, 0x0d, 0x69, 0x43, 0x34, 0x57, 0x11, 0x09, 0x61, 0x91, 0x24, 0x8d, 0xba, 0x3a, 0x30, 0x20,
+    0xfe, 0x22, 0xbc, 0x72, 0x38, 0x4e, 0x4b, 0x10, 0x30, 0x3d, 0x47, 0x40, 0x6b, 0x46, 0xda, 0xea,
+    0x5b, 0x09, 0x96, 0x4b, 0x49, 0x9e, 0x36, 0xee, 0xcb, 0x9f, 0xaf, 0x3e, 0xa3, 0xd8, 0xd6, 0x5f,
+    0x5a, 0xb3, 0xd5, 0x19, 0xb9, 0xa4, 0xcf, 0x55, 0xa2, 0xb9, 0x4d, 0x17, 0xc6, 0x31, 0x4e, 0x4c,
+    0x1a, 0x93, 0x24, 0x4e, 0x30, 0x16, 0x6c, 0x61, 0x5b, 0xa0, 0xf9, 0xbd, 0x0f, 0x7c, 0xf0, 0x3e,
+    0x98, 0xe7, 0xac, 0xae, 0x98, 0x4d, 0x4d, 0x5d, 0x16, 0x9d, 0xc4, 0xa2, 0x96, 0x8a, 0xb0, 0x12,
+    0x8a, 0x5a, 0x28, 0x01, 0x28, 0xa5, 0xa2, 0x80, 0x12, 0x8a, 0x5a, 0x28, 0x01, 0x28, 0xa5, 0xa2,
+    0x80, 0x12, 0x8a, 0x5a, 0xcc, 0xd7, 0x35, 0x98, 0x74, 0x6b, 0x06, 0x95, 0xc8, 0x33, 0xb8, 0x22,
+    0x08, 0xfa, 0x97, 0x6f, 0xa7, 0xa0, 0xe3, 0x27, 0xfa, 0x91, 0x49, 0xbb, 0x2b, 0xb0, 0x33, 0x7c,
+    0x55, 0xe2, 0x5f, 0xec, 0x68, 0xd6, 0xd6, 0xd8, 0x66, 0xf6, 0x55, 0xdc, 0xa4, 0x8e, 0x23, 0x5e,
+    0x9b, 0xbd, 0xcf, 0x07, 0x03, 0xf3, 0xf4, 0x3e, 0x70, 0xc2, 0x59, 0xe4, 0x76, 0x90, 0xbb, 0xb9,
+    0x39, 0x66, 0x63, 0x92, 0x73, 0xdc, 0xf3, 0xcd, 0x4d, 0x2c, 0x93, 0xde, 0x5d, 0xb5, 0xcd, 0xcb,
+    0x34, 0x93, 0x3b, 0x6e, 0x76, 0x70, 0x79, 0x3e, 0xde, 0xc3, 0xd3, 0xe9, 0x53, 0x22, 0x81, 0xd4,
+    0x64, 0x37, 0xe7, 0xde, 0xb8, 0x2a, 0xd6, 0xbb, 0x14, 0xa6, 0x96, 0xc7, 0x75, 0xa0, 0xf8, 0xb2,
+    0x3b, 0xe9, 0x63, 0xb2, 0xbd, 0x2a, 0x97, 0x24, 0x00, 0xb2, 0x0e, 0x16, 0x46, 0xf4, 0xc7, 0x63,
+    0xd3, 0xd8, 0x9f, 0x4e, 0x05, 0x75, 0x18, 0xaf, 0x0e, 0x77, 0xcf, 0x53, 0xef, 0xcf, 0xe3, 0x8a,
+    0xe8, 0x74, 0x5f, 0x18, 0xdf, 0xe9, 0xa8, 0xb0, 0x4b, 0xb6, 0xe6, 0xdd, 0x00, 0x50, 0x8f, 0xc3,
+    0x28, 0xe7, 0xa3, 0x75, 0xfc, 0xc1, 0xe8, 0x00, 0xc5, 0x6d, 0x4e, 0xab, 0x4a, 0xd2, 0x29, 0x26,
+    0x96, 0xa7, 0xa8, 0x62, 0x8c, 0x57, 0x31, 0x17, 0x8e, 0x74, 0xe7, 0x8d, 0x4b, 0x5b, 0xdc, 0x86,
+    0xc0, 0xdc, 0x14, 0x29, 0x00, 0xfb, 0x1c, 0x8c, 0xfe, 0x54, 0x93, 0xf8, 0xde, 0xd1, 0x50, 0x18,
+    0x2c, 0xe7, 0x76, 0xce, 0x08, 0x90, 0x84, 0x00, 0x7d, 0x46, 0x6a, 0xdd, 0x68, 0x2e, 0xa4, 0xb9,
+    0x24, 0x75, 0x18, 0xae, 0x77, 0x56, 0xf1, 0x6d, 0x9d, 0x92, 0xec, 0xb3, 0x64, 0xba, 0x9c, 0x9c,
+    0x7c, 0x87, 0x28, 0xbc, 0x75, 0x24, 0x75, 0xfa, 0x0f, 0x43, 0xc8, 0xae, 0x5b, 0x53, 0xf1, 0x2e,
+    0xa3, 0x7e, 0x9e, 0x53, 0xca, 0xb1, 0x44, 0xc3, 0x95, 0x87, 0x2a, 0x18, 0x7b, 0xe7, 0x24, 0xe7,
+    0x38, 0xc6, 0x71, 0x58, 0x12, 0xcc, 0x3b, 0x11, 0x92, 0x3d, 0x6b, 0x29, 0x57, 0x72, 0xd2, 0x02,
+    0xbb, 0x96, 0xc5, 0x8b, 0xdd, 0x46, 0x7b, 0xb6, 0x33, 0x5c, 0xcd, 0x23, 0xc8, 0x47, 0x2c, 0xcd,
+    0xdb, 0xae, 0x07, 0xa0, 0xf6, 0xe9, 0x54, 0x24, 0x73, 0x21, 0x38, 0x3b, 0x49, 0xce, 0x3d, 0xe9,
+    0xa4, 0xab, 0x13, 0xdc, 0x83, 0x8e, 0x7a, 0x66, 0xa4, 0x48, 0x41, 0x6c, 0x01, 0xf2, 0x83, 0xcf,
+    0x19, 0xc7, 0xe5, 0x59, 0x59, 0x2d, 0x59, 0x69, 0x28, 0xee, 0x30, 0x47, 0xba, 0x40, 0x59, 0x40,
+    0x52, 0x7f, 0x88, 0x55, 0x98, 0xa3, 0xc3, 0x12, 0x40, 0xc8, 0xeb, 0x9e, 0xff, 0x00, 0xfd, 0x7a,
+    0x92, 0x28, 0x8a, 0xa7, 0x00, 0x90, 0x47, 0x6e, 0xdf, 0xfd, 0x7a, 0x94, 0xe1, 0x7a, 0x82, 0x47,
+    0x3c, 0xfa, 0xd6, 0x72, 0x9d, 0xf6, 0x32, 0x95, 0x4b, 0xe8, 0x84, 0x50, 0xaa, 0x31, 0x8c, 0x2e,
+    0xde, 0x05, 0x32, 0x46, 0x5d, 0xa0, 0x2e, 0x00, 0xc6, 0x33, 0xeb, 0xef, 0x4c, 0x79, 0xca, 0x86,
+    0x39, 0x24, 0x9e, 0xd9, 0xaa, 0xb2, 0x48, 0xc4, 0x82, 0x4e, 0xd3, 0xef, 0xd2, 0x94, 0x60, 0xde,
+    0xe2, 0x8c, 0x1b, 0xdc, 0x91, 0xae, 0x41, 0x18, 0x1c, 0x71, 0xd3, 0xfc, 0xfa, 0x57, 0x59, 0xe1,
+    0x3f, 0x15, 0xfd, 0x9b, 0x66, 0x9d, 0xa8, 0xcb, 0x98, 0x3e, 0xec, 0x33, 0x37, 0xfc, 0xb3, 0xff,
+    0x00, 0x64, 0x9f, 0xee, 0xfa, 0x1e, 0xdf, 0x4e, 0x9c, 0x6a, 0xa3, 0x1f, 0x98, 0x9c, 0x64, 0x7e,
+    0x5f, 0x5a, 0xb5, 0x14, 0x44, 0x9c, 0xe3, 0x92, 0x38, 0x22, 0xb6, 0x52, 0xe4, 0xd5, 0x1a, 0xbb,
+    0x45, 0x1e, 0xd3, 0x8a, 0xf2, 0x2d, 0x62, 0x44, 0x1a, 0xe5, 0xf8, 0x27, 0xfe, 0x5e, 0x64, 0xff,
+    0x00, 0xd0, 0x8d, 0x76, 0x1e, 0x16, 0xd7, 0xe3, 0xd9, 0x1e, 0x97, 0x76, 0xdb, 0x5d, 0x4e, 0xd8,
+    0x64, 0x27, 0x86, 0xff, 0x00, 0x64, 0xe7, 0xa1, 0xf4, 0xed, 0xd0, 0x75, 0xeb, 0xc4, 0x6b, 0x7f,
+    0xf2, 0x1e, 0xd4, 0x7f, 0xeb, 0xea, 0x5f, 0xfd, 0x08, 0xd5, 0x56, 0x92, 0xa9, 0x14, 0xd1, 0xe9,
+    0x65, 0x95, 0x6d, 0x29, 0x34, 0x54, 0x71, 0xb9, 0xc9, 0x1c, 0x83, 0x4a, 0x8a, 0x79, 0xe2, 0x84,
+    0xfb, 0xa2, 0xa4, 0x4e, 0xf5, 0xcc, 0xde, 0x87, 0xb1, 0x08, 0xa9, 0x4a, 0xec, 0x4f, 0xbb, 0xc9,
+    0xe0, 0x52, 0xf9, 0xa9, 0xeb, 0xfa, 0x51, 0x2f, 0xfa, 0xb3, 0x55, 0xe8, 0x4a, 0xe5, 0x4e, 0x6e,
+    0x9b, 0xb2, 0x17, 0x63, 0x7a, 0x54, 0xaa, 0xa7, 0x68, 0xe2, 0x8a, 0x91, 0x7e, 0xe8, 0xa1, 0xb1,
+    0x53, 0xa6, 0xae, 0x34, 0x10, 0x9f, 0x7b, 0x8c, 0xd2, 0x3b, 0xab, 0x29, 0x00, 0xe4, 0x9a, 0x6c,
+    0xff, 0x00, 0xc3, 0x51, 0xa7, 0xde, 0x14, 0x25, 0xd4, 0x27, 0x36, 0x9f, 0x27, 0x40, 0xd8, 0xde,
+    0x95, 0x36, 0xd3, 0xe9, 0x49, 0x52, 0xd2, 0x6c, 0xaa, 0x74, 0xd6, 0xa3, 0x37, 0xaa, 0xf0, 0x4e,
+    0x0d, 0x3e, 0x39, 0x01, 0x3f, 0x29, 0xef, 0xe9, 0x55, 0xe5, 0xff, 0x00, 0x58, 0x69, 0x16, 0x42,
+    0x9d, 0x3a, 0x93, 0xd2, 0xa9, 0x46, 0xe7, 0x0e, 0x61, 0x37, 0x2a, 0x12, 0x87, 0xa7, 0xe6, 0x58,
+    0x92, 0x5e, 0x09, 0xc0, 0xda, 0x00, 0xea, 0x3a, 0x55, 0x77, 0x72, 0x4e, 0x4e, 0x09, 0xe3, 0xd6,
+    0xa3, 0x66, 0x2f, 0x85, 0x19, 0x23, 0xe9, 0xd2, 0xa5, 0x8e, 0x20, 0x5b, 0x38, 0x3b, 0x7f, 0xba,
+    0x3b, 0xff, 0x00, 0x9c, 0x56, 0x89, 0x28, 0x9e, 0x02, 0x8a, 0x88, 0xd5, 0x56, 0x76, 0x1f, 0x29,
+    0xce, 0x7b, 0x8e, 0x3d, 0xea, 0xca, 0x42, 0xc4, 0x12, 0x41, 0xe9, 0xc6, 0x3d, 0x2a, 0x44, 0x8d,
+    0x7e, 0x6e, 0x4e, 0x47, 0x1e, 0xbf, 0xe7, 0xff, 0x00, 0xad, 0x52, 0xe4, 0x05, 0x3f, 0xdd, 0x1f,
+    0xdd, 0xf4, 0xa8, 0x94, 0xef, 0xb1, 0x9c, 0xaa, 0x5f, 0x44, 0x37, 0x09, 0x1e, 0xec, 0xe3, 0x3c,
+    0x74, 0xfd, 0x69, 0x8f, 0x22, 0xe4, 0x81, 0x82, 0x4f, 0x63, 0xc7, 0xa7, 0xff, 0x00, 0x5e, 0x9a,
+    0xf3, 0x1d, 0xac, 0xc3, 0x1c, 0x77, 0x38, 0xfa, 0xf3, 0x54, 0xa4, 0x76, 0x24, 0x96, 0xcf, 0x5e,
+    0xb8, 0xc5, 0x28, 0xc1, 0xbd, 0xc5, 0x18, 0x37, 0xb9, 0x33, 0xdc, 0x06, 0xcf, 0x3d, 0xf9, 0x04,
+    0xf7, 0xa8, 0x18, 0x37, 0x6c, 0x6e, 0xce, 0x7a, 0xff, 0x00, 0xfa, 0xa9, 0x50, 0x6f, 0x9b, 0xd3,
+    0xb9, 0x35, 0x3c, 0x50, 0xb1, 0xc9, 0xdb, 0x9c, 0x9e, 0x4f, 0x7a, 0xd6, 0xea, 0x26, 0xd7, 0x51,
+    0x40, 0xb0, 0x92, 0x73, 0xeb, 0xd0, 0x66, 0xac, 0x88, 0x87, 0x53, 0xf7, 0x47, 0x6c, 0xd2, 0xaa,
+    0x2c, 0x41, 0x4e, 0x46, 0x41, 0xfe, 0x1e, 0x7e, 0xb4, 0x48, 0xf8, 0x5c, 0xa9, 0x03, 0x9f, 0xa7,
+    0x5a, 0xc5, 0xc9, 0xb3, 0x09, 0x4d, 0xcb, 0x61, 0xc5, 0x80, 0x20, 0x73, 0x81, 0xd8, 0x71, 0x55,
+    0xe5, 0x95, 0x72, 0x11, 0x72, 0x06, 0x39, 0xfa, 0x7b, 0xd4, 0x53, 0x4c, 0xce, 0x32, 0x77, 0x60,
+    0x73, 0x8c, 0x76, 0xa8, 0x30, 0x1c, 0x76, 0xcf, 0x03, 0x1e, 0xfd, 0xba, 0xd5, 0xc6, 0x1d, 0xcb,
+    0x85, 0x3e, 0xac, 0x71, 0x90, 0x96, 0x23, 0x19, 0xef, 0x8f, 0x5a, 0x15, 0x0b, 0xf2, 0xc3, 0xfc,
+    0x7b, 0xd4, 0x91, 0x47, 0xb8, 0x28, 0x7c, 0x80, 0x3a, 0x1f, 0x7f, 0xf3, 0x9a, 0xb3, 0x14, 0x24,
+    0x1f, 0x4e, 0x33, 0xcf, 0x6a, 0xa7, 0x24, 0xb6, 0x2e, 0x53, 0x51, 0xd8, 0x6c, 0x50, 0xe7, 0x9c,
+    0xf2, 0x31, 0xcf, 0x5a, 0x9c, 0x2a, 0xa0, 0xc9, 0xdb, 0x81, 0xe9, 0x43, 0x31, 0x19, 0xc2, 0xe7,
+    0xdc, 0x73, 0xfe, 0x7b, 0x54, 0x33, 0x4d, 0x8c, 0xb7, 0x53, 0xe9, 0xec, 0x7a, 0xe2, 0xb2, 0xd6,
+    0x46, 0x3a, 0xc9, 0x8f, 0x92, 0x51, 0x8c, 0x6e, 0xf4, 0xcf, 0x1f, 0x85, 0x54, 0x79, 0xba, 0x0c,
+    0x9d, 0xc0, 0x80, 0x31, 0x4d, 0x92, 0x57, 0x70, 0x18, 0x75, 0xeb, 0x82, 0x29, 0x8a, 0x87, 0x7a,
+    0x81, 0x93, 0xcf, 0xcb, 0x8f, 0xd6, 0xb4, 0x8c, 0x12, 0xdc, 0xd6, 0x30, 0x4b, 0x56, 0x19, 0x2e,
+    0xa0, 0x67, 0x39, 0x3c, 0x8c, 0x60, 0x7a, 0x54, 0xb1, 0x42, 0x15, 0xb3, 0xc6, 0x7f, 0xbb, 0xfe,
+    0x47, 0xb5, 0x49, 0x05, 0xbe, 0x7e, 0x60, 0x38, 0xee, 0x7d, 0x6a, 0xcc, 0x68, 0x14, 0x67, 0xf8,
+    0xb1, 0x8e, 0x94, 0xa5, 0x3e, 0xc2, 0x9d, 0x4b, 0x68, 0x86, 0x22, 0x6c, 0xf9, 0xc8, 0x20, 0x8e,
+    0x3a, 0xe0, 0xd3, 0xdd, 0xb0, 0x0e, 0x38, 0xe3, 0x91, 0x8e, 0x48, 0xcd, 0x21, 0x70, 0xa3, 0x85,
+    0x50, 0x0e, 0x72, 0x45, 0x55, 0x96, 0x40, 0x19, 0x98, 0x82, 0xc4, 0x77, 0xc7, 0xe7, 0x50, 0x93,
+    0x91, 0x9a, 0x8b, 0x93, 0x24, 0x92, 0x55, 0x46, 0x24, 0x64, 0x02, 0x78, 0xc9, 0xc5, 0x56, 0x92,
+    0x42, 0xc7, 0xa1, 0xe4, 0x9e, 0xa7, 0x82, 0x69, 0x0e, 0xe9, 0x31, 0x9c, 0x01, 0xf9, 0x80, 0x29,
+    0xf1, 0x44, 0x58, 0x12, 0x72, 0x47, 0x72, 0x3a, 0x56, 0xa9, 0x28, 0x9b, 0x28, 0xa8, 0xa1, 0xa9,
+    0x1b, 0x33, 0x12, 0x3b, 0x8e, 0xfd, 0xc5, 0x59, 0x8a, 0x13, 0xbb, 0xb0, 0x03, 0x00, 0x92, 0x3a,
+    0x7f, 0x9f, 0xeb, 0x52, 0xc5, 0x18, 0x04, 0x93, 0x90, 0x71, 0x8c, 0x67, 0xfc, 0xf1, 0x52, 0x19,
+    0x02, 0x7c, 0xbf, 0x80, 0x24, 0x72, 0x0d, 0x44, 0xa7, 0x7d, 0x8c, 0xe5, 0x52, 0xfa, 0x21, 0x02,
+    0x88, 0xd3, 0x05, 0x4e, 0xd0, 0x33, 0xc9, 0xcf, 0xbd, 0x35, 0xa5, 0x2a, 0x39, 0xe1, 0x89, 0xe8,
+    0x38, 0xfa, 0x54, 0x72, 0xce, 0x40, 0x23, 0xa1, 0xcf, 0xf5, 0xff, 0x00, 0xeb, 0x55, 0x46, 0x72,
+    0x58, 0x0c, 0x60, 0xe3, 0xf1, 0xff, 0x00, 0x1f, 0xf2, 0x69, 0x46, 0x0d, 0xee, 0x28, 0xd3, 0x6f,
+    0x56, 0x3e, 0x59, 0x32, 0x46, 0x09, 0xda, 0x78, 0x20, 0xfa, 0xd4, 0x60, 0x97, 0x27, 0x3c, 0xb0,
+    0xe3, 0x27, 0xeb, 0x49, 0x1a, 0xb3, 0x38, 0x19, 0x1c, 0x60, 0x71, 0xcf, 0x4a, 0xb5, 0x1c, 0x4a,
+    0xc7, 0x6e, 0xd2, 0x0e, 0x7a, 0xd6, 0xb7, 0x51, 0x36, 0x6d, 0x45, 0x10, 0xc7, 0x18, 0x62, 0xa0,
+    0x29, 0x38, 0xe3, 0x9e, 0x99, 0xab, 0x68, 0x98, 0x56, 0x20, 0x67, 0x9e, 0x73, 0xd3, 0xd6, 0xa4,
+    0x11, 0x85, 0x61, 0x85, 0x19, 0xcf, 0x27, 0xfc, 0xfe, 0x34, 0x9e, 0x6a, 0x88, 0xf1, 0x8c, 0x11,
+    0xce, 0x47, 0xf3, 0xfa, 0xd6, 0x2e, 0x4e, 0x46, 0x12, 0x9b, 0x96, 0xc1, 0xb5, 0x46, 0x43, 0x11,
+    0xc6, 0x3b, 0x71, 0x50, 0xcd, 0x26, 0x7a, 0x7d, 0xd6, 0xe7, 0x19, 0xef, 0x51, 0x3c, 0xc0, 0x93,
+    0xd0, 0x91, 0xc0, 0xe3, 0xa7, 0xb5, 0x57, 0x7c, 0x96, 0x0a, 0x14, 0x7b, 0x0c, 0xf7, 0xab, 0x8c,
+    0x3b, 0x97, 0x0a, 0x7d, 0x58, 0xe7, 0x95, 0xd9, 0x89, 0x07, 0x82, 0x0f, 0x18, 0xcf, 0xe1, 0x4a,
+    0x80, 0xb9, 0x03, 0x07, 0xf1, 0x34, 0xf8, 0xe3, 0xf9, 0x8f, 0x1e, 0x99, 0xc7, 0x38, 0xab, 0x51,
+    0x40, 0x36, 0xe3, 0xa7, 0x24, 0x7f, 0xf5, 0xaa, 0x9c, 0x92, 0xd8, 0xb9, 0x4d, 0x47, 0x62, 0x18,
+    0xa1, 0x51, 0xb7, 0xa1, 0xe3, 0xa8, 0xef, 0xed, 0x56, 0xf6, 0xa8, 0xf9, 0x5b, 0x18, 0x3d, 0xff,
+    0x00, 0xc6, 0x9a, 0xc1, 0x54, 0x9c, 0x8f, 0x7c, 0x01, 0xd6, 0xa1, 0x92, 0x70, 0x49, 0x24, 0x9c,
+    0x8c, 0xe3, 0x9e, 0xa3, 0xeb, 0x59, 0x6b, 0x23, 0x1d, 0x64, 0xc9, 0x59, 0xc9, 0xce, 0x36, 0x95,
+    0xcf, 0x53, 0x55, 0xa4, 0x98, 0x9f, 0xba, 0x72, 0x6a, 0x26, 0x62, 0xe0, 0xae, 0xd5, 0x52, 0x0f,
+    0x41, 0xd6, 0x9a, 0x91, 0x92, 0x06, 0x77, 0x64, 0xf3, 0xf4, 0xad, 0x23, 0x04, 0xb7, 0x35, 0x8c,
+    0x12, 0xd5, 0x88, 0x4b, 0x39, 0x05, 0x7b, 0x1c, 0x67, 0xff, 0x00, 0xd7, 0x52, 0x45, 0x6f, 0x97,
+    0xc8, 0xc6, 0x73, 0x8c, 0x02, 0x38, 0xa9, 0xa1, 0x89, 0x40, 0xf9, 0x57, 0x3c, 0x75, 0xe4, 0xe6,
+    0xac, 0x05, 0x11, 0x90, 0x78, 0xc6, 0x32, 0x31, 0x4a, 0x53, 0xec, 0x29, 0xd4, 0xb6, 0x88, 0x8d,
+    0x17, 0x2c, 0x37, 0x0c, 0x6d, 0xe7, 0x03, 0x9e, 0x7f, 0xfd, 0x75, 0xa3, 0xa6, 0x6a, 0x6d, 0xa5,
+    0xea, 0x31, 0xdc, 0x44, 0x0b, 0x63, 0xef, 0xae, 0x70, 0x19, 0x7b, 0x8f, 0xf3, 0xdc, 0x0f, 0x4a,
+    0xa0, 0x66, 0x0a, 0xa4, 0x86, 0x04, 0xe7, 0xa9, 0x38, 0xc5, 0x55, 0x92, 0x51, 0xfe, 0xee, 0x39,
+    0xc7, 0xe1, 0xff, 0x00, 0xd6, 0xa9, 0x8a, 0x93, 0x77, 0x33, 0x8a, 0x72, 0x77, 0x3d, 0x8f, 0x4f,
+    0xbf, 0xb7, 0xd4, 0xed, 0x16, 0xe6, 0xd9, 0xf7, 0x23, 0x70, 0x41, 0xea, 0xa7, 0xb8, 0x3e, 0xf5,
+    0x6b, 0x15, 0xe3, 0xfa, 0x2e, 0xb3, 0x73, 0xa2, 0xde, 0x8b, 0x88, 0x0e, 0xe8, 0xdb, 0x02, 0x48,
+    0xb9, 0xda, 0xeb, 0xef, 0xe8, 0x7d, 0x0f, 0x6e, 0x7d, 0x48, 0x3e, 0x9b, 0xa2, 0xeb, 0xb6, 0x9a,
+    0xdd, 0xaa, 0xc9, 0x0b, 0x2a, 0x4d, 0x8c, 0xc9, 0x01, 0x60, 0x59, 0x08, 0xc6, 0x7e, 0xa3, 0x91,
+    0xcf, 0xbf, 0x63, 0xc5, 0x7a, 0x10, 0xa9, 0x7d, 0xf7, 0x37, 0xb1, 0xa7, 0x8a, 0x31, 0x4b, 0x8a,
+    0x31, 0x57, 0x70, 0x13, 0x14, 0x62, 0xa1, 0xbb, 0xbc, 0xb6, 0xb0, 0xb7, 0x33, 0xdd, 0xcc, 0x90,
+    0xc6, 0x3f, 0x89, 0x8f, 0x53, 0x8c, 0xe0, 0x7a, 0x9e, 0x0f, 0x03, 0x9a, 0xe0, 0xf5, 0xff, 0x00,
+    0x1b, 0x4d, 0x70, 0x64, 0xb6, 0xd2, 0x4b, 0x43, 0x18, 0xc8, 0x37, 0x1f, 0xc4, 0xe3, 0xa7, 0x19,
+    0xfb, 0xbe, 0xb9, 0xeb, 0xd3, 0xa7, 0x4a, 0x99, 0x4d, 0x20, 0xb1, 0xd0, 0xf8, 0x87, 0xc5, 0x36,
+    0xda, 0x2e, 0x6d, 0xe3, 0x5f, 0x3a, 0xf0, 0xae, 0x42, 0x8f, 0xba, 0x9e, 0x9b, 0x8f, 0xd3, 0x9c,
+    0x0f, 0x4e, 0xd9, 0xcd, 0x79, 0xb5, 0xee, 0xa3, 0x75, 0xa9, 0xdd, 0x1b, 0xab, 0xcb, 0x8f, 0x32,
+    0x5c, 0x05, 0x19, 0x1c, 0x2e, 0x3d, 0x00, 0xe0, 0x7f, 0xf5, 0xea, 0xa8, 0x46, 0x2b, 0x8e, 0x70,
+    0x79, 0x1c, 0xf4, 0xab, 0x71, 0xc7, 0xc0, 0x18, 0x1c, 0x0e, 0x47, 0x4c, 0xfb, 0x57, 0x35, 0x4a,
+    0xb7, 0xdc, 0x1c, 0x94, 0x48, 0xa3, 0x87, 0x1c, 0x93, 0xd0, 0x02, 0x32, 0x4f, 0xad, 0x59, 0x10,
+    0xec, 0x1f, 0x74, 0x0f, 0xd2, 0xa4, 0x55, 0xc7, 0x00, 0x8c, 0xe3, 0x9e, 0xbc, 0x53, 0x59, 0xd5,
+    0x54, 0xfc, 0xb9, 0x51, 0xc6, 0x4f, 0xd6, 0xb9, 0x9c, 0x9c, 0x8c, 0x25, 0x27, 0x2d, 0x87, 0xb3,
+    0x2a, 0x0c, 0x2a, 0x80, 0x33, 0xc7, 0xf8, 0xd5, 0x79, 0x65, 0x21, 0xb6, 0xee, 0xeb, 0xd8, 0xff,
+    0x00, 0x9e, 0x6a, 0x39, 0x26, 0x20, 0x70, 0xc7, 0xbf, 0x15, 0x07, 0xcc, 0xdb, 0x94, 0x81, 0x83,
+    0xf3, 0x67, 0x39, 0xab, 0x8c, 0x3b, 0x97, 0x0a, 0x7d, 0x58, 0xed, 0xd9, 0x20, 0x64, 0x86, 0x04,
+    0x74, 0xfe, 0x55, 0xd8, 0x78, 0x47, 0xc5, 0x2d, 0x6e, 0xb1, 0xe9, 0xfa, 0x8b, 0xfe, 0xe3, 0xee,
+    0xc3, 0x33, 0x1e, 0x53, 0xd9, 0xbf, 0xd9, 0xf7, 0xed, 0xf4, 0xe9, 0xc9, 0x24, 0x25, 0xb2, 0x7e,
+    0x6c, 0x81, 0xc7, 0xd6, 0xac, 0xc7, 0x11, 0x0d, 0x80, 0x00, 0xfa, 0x0c, 0x55, 0xfb, 0x4e, 0x4d,
+    0x8a, 0x94, 0xd2, 0x3d, 0x97, 0x14, 0x62, 0xb8, 0x9f, 0x0d, 0xf8, 0x94, 0x5b, 0x94, 0xb0, 0xbe,
+    0x90, 0x08, 0x3a, 0x45, 0x2b, 0x1f, 0xb9, 0xfe, 0xcb, 0x7b, 0x7f, 0x2f, 0xa7, 0x4e, 0xdf, 0x15,
+    0xd7, 0x0a, 0x8a, 0x6a, 0xe8, 0x71, 0x69, 0xab, 0x89, 0x8a, 0x31, 0x4b, 0x8a, 0x31, 0x57, 0x71,
+    0x89, 0x8a, 0x31, 0x4b, 0x8a, 0x31, 0x45, 0xc0, 0x4c, 0x51, 0x8a, 0x5c, 0x51, 0x8a, 0x2e, 0x02,
+    0x62, 0x8c, 0x52, 0xe2, 0x8c, 0x51, 0x70, 0x22, 0x9a, 0x58, 0xed, 0xe0, 0x92, 0x69, 0x5b, 0x6c,
+    0x71, 0xa9, 0x76, 0x6c, 0x67, 0x00, 0x0c, 0x9a, 0xf2, 0xed, 0x5f, 0x52, 0xb8, 0xd6, 0x6f, 0xde,
+    0x79, 0x19, 0xd6, 0x14, 0x24, 0x43, 0x19, 0xe0, 0x22, 0x7b, 0xfb, 0xf7, 0x3d, 0x7f, 0x20, 0x2b,
+    0x73, 0xc5, 0x9a, 0xcf, 0xda, 0xa7, 0x3a, 0x74, 0x0e, 0xe9, 0x14, 0x4c, 0x44, 0xbd, 0xbc, 0xc6,
+    0x07, 0xa7, 0xd0, 0x7e, 0xa7, 0xb7, 0x00, 0xd7, 0x32, 0x4a, 0x80, 0x08, 0xc0, 0xe9, 0x8f, 0xf3,
+    0xf9, 0xd7, 0x15, 0x7a, 0xd7, 0x7c, 0xb1, 0x32, 0x9c, 0xfa, 0x21, 0xa1, 0x4c, 0x7c, 0x72, 0x38,
+    0xea, 0x7b, 0xfd, 0x7f, 0x0a, 0x6b, 0xc8, 0x15, 0x71, 0x9e, 0x00, 0xe7, 0x14, 0xd6, 0x9d, 0x41,
+    0x3b, 0x58, 0x12, 0x7a, 0xf3, 0xd6, 0xaa, 0x49, 0x21, 0x77, 0xc0, 0x1c, 0x8e, 0x3d, 0xab, 0x18,
+    0xc1, 0xbd, 0xc5, 0x1a, 0x6d, 0xea, 0xc5, 0x48, 0xf7, 0xb6, 0x7a, 0xfb, 0x1f, 0xe9, 0x56, 0xa1,
+    0x4f, 0xba, 0x76, 0x91, 0xc6, 0x29, 0xe9, 0x12, 0x85, 0x04, 0x83, 0x9f, 0x5e, 0x7a, 0xff, 0x00,
+    0x9f, 0xe7, 0x4a, 0xce, 0x02, 0x30, 0x72, 0x40, 0xcd, 0x12, 0x9b, 0x7b, 0x04, 0xa6, 0xde, 0xc2,
+    0xf0, 0xa0, 0xe4, 0x67, 0x03, 0x38, 0x6e, 0xfe, 0xf5, 0x0c, 0x8e, 0x14, 0x71, 0x8c, 0xe4, 0x64,
+    0x7f, 0xfa, 0xaa, 0x29, 0x26, 0xdb, 0x90, 0x32, 0xae, 0x3a, 0xe0, 0xe7, 0x35, 0x01, 0x67, 0x77,
+    0x07, 0xa0, 0xcf, 0x04, 0x73, 0x9a, 0x71, 0x87, 0x71, 0xc2, 0x9f, 0x56, 0x3a, 0x49, 0xb3, 0x9c,
+    0x1c, 0x9e, 0x38, 0xec, 0x69, 0x80, 0x16, 0x6d, 0xd8, 0x23, 0xd8, 0x53, 0xd6, 0x32, 0xe4, 0x13,
+    0x92, 0xdd, 0x71, 0xea, 0x3d, 0xaa, 0xc4, 0x50, 0xf0, 0x39, 0xc9, 0xeb, 0x9c, 0xe3, 0x3f, 0x5a,
+    0xb7, 0x25, 0x13, 0x47, 0x25, 0x11, 0x91, 0x5b, 0x92, 0xb8, 0x60, 0x39, 0xe3, 0xa7, 0xf9, 0xf6,
+    0xab, 0x28, 0xa3, 0x66, 0x39, 0x5e, 0xa4, 0x81, 0xda, 0x95, 0x48, 0xdd, 0xfc, 0x59, 0x23, 0xd7,
+    0x15, 0x1b, 0x38, 0xc3, 0x64, 0x91, 0xc7, 0x18, 0x6e, 0xdf, 0xe7, 0xf9, 0xd6, 0x4d, 0xb9, 0x18,
+    0xb6, 0xe4, 0xc7, 0xf9, 0x88, 0x09, 0xf9, 0xf2, 0xb8, 0xc7, 0x5a, 0xae, 0xf3, 0x1d, 0xcd, 0x8c,
+    0x64, 0x8c, 0xf4, 0xc7, 0xb7, 0x5a, 0x89, 0xa5, 0x2c, 0x40, 0x2c, 0x33, 0xd3, 0x3d, 0x2a, 0x20,
+    0x0c, 0x84, 0x67, 0x2c, 0x73, 0xd3, 0x1f, 0x97, 0x35, 0xa4, 0x61, 0x6d, 0xcd, 0x23, 0x4e, 0xda,
+    0xb1, 0x4b, 0xb3, 0x26, 0x08, 0xeb, 0xea, 0x38, 0x1f, 0xe7, 0x14, 0xab, 0x19, 0x62, 0x08, 0x62,
+    0x31, 0xd0, 0x16, 0xed, 0x53, 0x47, 0x18, 0x00, 0x30, 0xe5, 0xd7, 0xa0, 0x35, 0x6f, 0xca, 0x09,
+    0xb4, 0x11, 0x80, 0x3a, 0xfa, 0x51, 0x29, 0xdb, 0x61, 0xca, 0xa2, 0x5a, 0x22, 0x25, 0x8b, 0x68,
+    0xda, 0x79, 0x20, 0x7e, 0x26, 0xa6, 0xe1, 0x02, 0x9d, 0xaa, 0x41, 0xc7, 0x6e, 0x95, 0x30, 0x82,
+    0xe1, 0xdf, 0xe4, 0x8c, 0xe0, 0x8e, 0x0f, 0x41, 0xf5, 0x15, 0x24, 0x7a, 0x63, 0x99, 0x33, 0x24,
+    0xa1, 0x63, 0xe3, 0x84, 0x19, 0x26, 0xb2, 0xdf, 0x70, 0x86, 0x1e, 0xb5, 0x5d, 0x91, 0x44, 0xdc,
+    0xb2, 0x95, 0x92, 0x26, 0x2b, 0x22, 0x90, 0xca, 0xca, 0x71, 0xb4, 0xf5, 0xea, 0x3f, 0x0f, 0xd2,
+    0xa0, 0x9d, 0xe4, 0xb9, 0xb8, 0x96, 0x79, 0x5b, 0x32, 0x4a, 0xe5, 0xdc, 0xe3, 0x19, 0x24, 0xe4,
+    0xd6, 0xd2, 0x69, 0x36, 0xdf, 0x36, 0xe0, 0xef, 0xe8, 0x19, 0xba, 0x7e, 0x58, 0xac, 0x8b, 0x85,
+    0x09, 0x73, 0x2a, 0x81, 0x80, 0x1c, 0x8c, 0x7e, 0x35, 0x57, 0x49, 0x59, 0x1e, 0xce, 0x07, 0x0a,
+    0xe9, 0x36, 0xe4, 0x31, 0x53, 0xe5, 0x1c, 0xd0, 0xcd, 0xe5, 0xf6, 0xce, 0x69, 0xeb, 0xf7, 0x45,
+    0x45, 0x3f, 0xf0, 0xd4, 0xad, 0x59, 0xeb, 0x49, 0x72, 0xc2, 0xe8, 0x0c, 0x9b, 0xc6, 0xdc, 0x63,
+    0x34, 0xdf, 0x2f, 0xde, 0x9a, 0x9f, 0x78, 0x54, 0xb5, 0x5b, 0x6c, 0x62, 0xbd, 0xfd, 0x64, 0x3b,
+    0x67, 0xbd, 0x34, 0xc9, 0xb0, 0xed, 0xc6, 0x71, 0xef, 0x52, 0xd5, 0x79, 0x7f, 0xd6, 0x1a, 0x95,
+    0xae, 0xe6, 0xd5, 0x7d, 0xc5, 0x78, 0x8a, 0xcd, 0xe6, 0xfb, 0x62, 0x85, 0x4f, 0x98, 0x73, 0x49,
+    0x1f, 0x7a, 0x91, 0x7e, 0xf0, 0xa6, 0xf4, 0x33, 0x8a, 0xe6, 0x69, 0xb1, 0x76, 0x7b, 0xd3, 0x3c,
+    0xff, 0x00, 0xf6, 0x7f, 0x5a, 0x9a, 0xaa, 0x52, 0x8e, 0xbb, 0x97, 0x55, 0xb8, 0x5b, 0x94, 0x90,
+    0x8d, 0xe7, 0x77, 0x4c, 0xd4, 0x6f, 0x10, 0x24, 0x64, 0xf1, 0x83, 0x9e, 0x3a, 0x54, 0x89, 0xf7,
+    0x45, 0x5c, 0xb3, 0xb6, 0x79, 0xd9, 0x99, 0x71, 0x84, 0xeb, 0x9a, 0xa4, 0xec, 0xce, 0x2c, 0x5c,
+    0x5b, 0xa1, 0x26, 0x96, 0xbf, 0xf0, 0x4a, 0xeb, 0x17, 0xcb, 0xdb, 0xe5, 0x38, 0x04, 0xff, 0x00,
+    0x9f, 0x6a, 0xb4, 0xa9, 0x82, 0x39, 0xcf, 0x38, 0x27, 0x38, 0xf4, 0xa9, 0x65, 0x8d, 0xe3, 0x76,
+    0x0c, 0xa4, 0x76, 0x19, 0xe4, 0x1a, 0xac, 0xf3, 0x05, 0xe7, 0x24, 0x11, 0xd0, 0x93, 0xfe, 0x34,
+    0x9b, 0x72, 0x3e, 0x6a, 0x5c, 0xcd, 0xd9, 0x92, 0x33, 0x32, 0xae, 0x38, 0xc8, 0xef, 0x8e, 0xbc,
+    0x55, 0x59, 0xa5, 0xc1, 0x23, 0x24, 0x77, 0xe0, 0x54, 0x52, 0x5c, 0x12, 0xd8, 0x41, 0xcf, 0x3c,
+    0x93, 0xd6, 0xa3, 0x0a, 0x18, 0xfc, 0xb9, 0xc1, 0x3f, 0x5a, 0xd2, 0x30, 0xb6, 0xe5, 0xc6, 0x9d,
+    0xb5, 0x62, 0xbb, 0x99, 0x08, 0x18, 0x38, 0xf7, 0x1c, 0xd3, 0xd2, 0x10, 0xc7, 0x69, 0x1c, 0x8e,
+    0xdf, 0xfd, 0x7a, 0x92, 0x38, 0xb6, 0x91, 0x80, 0x48, 0x1c, 0xf3, 0xe9, 0xfe, 0x73, 0x56, 0x95,
+    0x4a, 0xc5, 0x80, 0x3e, 0x9f, 0xe7, 0xf2, 0xa2, 0x53, 0xb6, 0xc3, 0x95, 0x44, 0xb4, 0x43, 0x23,
+    0x85, 0x73, 0xd3, 0x80, 0x79, 0x07, 0xe9, 0x52, 0x10, 0x30, 0x14, 0x67, 0x07, 0x18, 0xcf, 0x6e,
+    0x28, 0x2e, 0x15, 0x4b, 0x16, 0xce, 0x3a, 0x1f, 0x7a, 0xab, 0x24, 0xdc, 0x15, 0xe0, 0x01, 0xea,
+    0x6b, 0x3b, 0x39, 0x19, 0x24, 0xe4, 0xc9, 0x59, 0xc0, 0x0d, 0xce, 0x41, 0xe7, 0xa7, 0x4f, 0xf3,
+    0xfe, 0x35, 0x55, 0xe5, 0xdc, 0xbb, 0x8f, 0x27, 0x39, 0x3f, 0xe4, 0x54, 0x65, 0x99, 0x89, 0x53,
+    0x9c, 0x9e, 0x84, 0x8a, 0x7a, 0x42, 0x40, 0xe9, 0x90, 0x7d, 0x30, 0x7e, 0x86, 0xb5, 0x51, 0x51,
+    0x36, 0x8c, 0x54, 0x77, 0x1a, 0x37, 0x38, 0x66, 0x61, 0xc1, 0x3c, 0x71, 0x53, 0xa5, 0xba, 0xaf,
+    0x38, 0xe8, 0xdc, 0x73, 0x52, 0xa4, 0x28, 0x83, 0xa9, 0x18, 0xe0, 0x13, 0x53, 0xe3, 0x6a, 0xa8,
+    0x3c, 0xf1, 0x8e, 0xf8, 0xff, 0x00, 0x3d, 0x6a, 0x25, 0x3e, 0x88, 0x89, 0xd4, 0xe8, 0x86, 0xc7,
+    0x1a, 0xc6, 0xa7, 0x68, 0x27, 0x6f, 0xe1, 0x49, 0x23, 0xaa, 0x12, 0x0e, 0x08, 0x61, 0xc1, 0xc9,
+    0x24, 0x71, 0xfa, 0xd3, 0x5e, 0x4c, 0x1c, 0x1e, 0x47, 0xa6, 0x38, 0x15, 0x4d, 0xa4, 0xc1, 0xce,
+    0x32, 0x01, 0xfb, 0xb4, 0xa3, 0x16, 0xc9, 0x8c, 0x1c, 0xb7, 0x24, 0x96, 0x66, 0x31, 0x9c, 0x8c,
+    0x90, 0x4e, 0x71, 0xc7, 0x15, 0x16, 0x72, 0xc3, 0xe6, 0xce, 0x79, 0xe3, 0xbd, 0x20, 0x05, 0x9d,
+    0x89, 0x39, 0x3e, 0x98, 0x35, 0x2c, 0x70, 0x03, 0x1f, 0xdd, 0xc1, 0x27, 0x1f, 0x51, 0x9f, 0xca,
+    0xb5, 0xd2, 0x26, 0xda, 0x45, 0x0d, 0x89, 0x0b, 0x30, 0x0b, 0xf4, 0x1f, 0xfe, 0xba, 0xb6, 0x91,
+    0x8d, 0xc4, 0xee, 0xc0, 0xf7, 0x27, 0xf0, 0xa5, 0x48, 0x86, 0xc0, 0x09, 0xce, 0x0f, 0x4c, 0xf5,
+    0xa5, 0x25, 0x50, 0x12, 0xcd, 0xf3, 0x60, 0xe7, 0x9e, 0x95, 0x94, 0xa6, 0xde, 0xc6, 0x32, 0x9b,
+    0x96, 0xc3, 0xcf, 0xc9, 0xd1, 0x87, 0x27, 0x83, 0xda, 0xa1, 0x92, 0x5c, 0x12, 0x17, 0x82, 0x7e,
+    0xee, 0x78, 0xa8, 0xde, 0x5d, 0xbc, 0x1e, 0xe7, 0x00, 0x9e, 0xf5, 0x58, 0xfc, 0xfc, 0x82, 0xd9,
+    0xec, 0x71, 0x8e, 0x69, 0xc6, 0x1d, 0xc7, 0x0a, 0x7d, 0x58, 0xf9, 0x25, 0x2c, 0x70, 0x36, 0xe4,
+    0x71, 0xd6, 0x9a, 0xb9, 0x6c, 0x03, 0xf3, 0x7b, 0x1f, 0x5f, 0xa5, 0x2c, 0x71, 0x3b, 0x3e, 0x0e,
+    0x7e, 0x5e, 0xd8, 0xeb, 0x56, 0x63, 0x88, 0x2f, 0x4c, 0xe0, 0x8c, 0x7c, 0xb5, 0x6e, 0x4a, 0x26,
+    0x8e, 0x4a, 0x24, 0x51, 0x46, 0x19, 0xb7, 0x6d, 0x1e, 0x81, 0x7d, 0x2a, 0xc8, 0x01, 0x14, 0x65,
+    0xf7, 0x71, 0xf2, 0xe3, 0xeb, 0xff, 0x00, 0xd6, 0xa9, 0x38, 0x50, 0x37, 0x71, 0x8e, 0xe4, 0x8a,
+    0x89, 0xe6, 0xda, 0x33, 0xc0, 0xce, 0x0f, 0xa0, 0xac, 0x9b, 0x72, 0x31, 0x6d, 0xc9, 0x8f, 0x79,
+    0x36, 0x83, 0xfd, 0xec, 0xe4, 0xf1, 0x93, 0xfe, 0x7f, 0xc6, 0xaa, 0xc9, 0x36, 0xee, 0x40, 0xc7,
+    0xd4, 0xf1, 0xfe, 0x7a, 0xfe, 0x54, 0xc9, 0x27, 0x2c, 0x33, 0xce, 0x31, 0xc9, 0xcd, 0x47, 0xb0,
+    0xbe, 0x07, 0xcd, 0x83, 0xed, 0x5a, 0x46, 0x16, 0xdc, 0xd6, 0x34, 0xed, 0xab, 0x11, 0xdf, 0x76,
+    0xec, 0x80, 0x7e, 0x9d, 0x7e, 0x9f, 0xe7, 0xd6, 0xa4, 0x8a, 0x26, 0x72, 0x4e, 0x30, 0x4f, 0x3f,
+    0xe3, 0x52, 0x24, 0x1b, 0x5b, 0x18, 0xeb, 0x91, 0x56, 0x92, 0x30, 0x98, 0xc0, 0x00, 0xe3, 0xda,
+    0x89, 0x4e, 0xdb, 0x04, 0xaa, 0x25, 0xa2, 0x22, 0x8a, 0x2c, 0x60, 0x30, 0x04, 0x67, 0x3c, 0xf6,
+    0xf5, 0xab, 0x0c, 0x42, 0x70, 0xc0, 0x0c, 0x71, 0xd7, 0xb5, 0x30, 0x95, 0x54, 0x54, 0xcf, 0x1c,
+    0xf7, 0x22, 0xab, 0xc9, 0x37, 0x2c, 0xcb, 0xd4, 0xe3, 0x15, 0x9a, 0x4e, 0x46, 0x49, 0x39, 0x32,
+    0x57, 0x98, 0x28, 0x3b, 0x42, 0xe4, 0x80, 0x3a, 0xd5, 0x43, 0x2e, 0xec, 0xf2, 0x38, 0xec, 0x46,
+    0x69, 0x8c, 0xce, 0xfb, 0x40, 0x3f, 0x31, 0xce, 0x71, 0xd6, 0xa7, 0x82, 0xce, 0x7b, 0x85, 0xdc,
+    0x15, 0x88, 0xe4, 0x03, 0x8c, 0x0c, 0x7e, 0x3c, 0x56, 0xaa, 0x2a, 0x26, 0xf0, 0xa7, 0x6d, 0x8a,
+    0xe0, 0x6f, 0x39, 0xf9, 0x95, 0xbd, 0x71, 0xed, 0x53, 0xc3, 0x19, 0x20, 0x8e, 0x06, 0x0e, 0x3d,
+    0x85, 0x68, 0xc1, 0xa6, 0x48, 0xa0, 0x17, 0x65, 0x55, 0xc6, 0x71, 0xf7, 0x8a, 0x9f, 0x7a, 0xbb,
+    0x1d, 0x84, 0x2a, 0xf8, 0xe7, 0xfd, 0xdc, 0xf4, 0x1f, 0x85, 0x4c, 0xa7, 0xd8, 0xd9, 0x61, 0xab,
+    0x4f, 0x65, 0x6f, 0x53, 0x37, 0xca, 0x0a, 0xb9, 0xc6, 0x3d, 0xf9, 0xe3, 0xf0, 0xff, 0x00, 0x3d,
+    0x69, 0x42, 0x49, 0x20, 0x2c, 0x91, 0xc8, 0xe3, 0xb9, 0x40, 0x7e, 0xb8, 0xad, 0xa5, 0x48, 0xa3,
+    0x8f, 0xe5, 0x8d, 0x03, 0x2f, 0x0b, 0xc7, 0x3e, 0x95, 0x27, 0x98, 0x33, 0xd3, 0x20, 0x56, 0x46,
+    0xf0, 0xca, 0xef, 0xac, 0xe4, 0x60, 0xb5, 0x85, 0xf4, 0xaa, 0x02, 0xc4, 0xc4, 0x9e, 0x72, 0x58,
+    0x64, 0x7e, 0x67, 0x22, 0x91, 0xb4, 0x6b, 0xb9, 0x09, 0x25, 0xa1, 0xc9, 0x1c, 0x86, 0x27, 0x8f,
+    0xd3, 0xad, 0x74, 0x3e, 0x60, 0xc8, 0xce, 0x01, 0x1c, 0xff, 0x00, 0x9f, 0x7a, 0x8c, 0x91, 0xb7,
+    0x3d, 0x3d, 0xf3, 0xd7, 0xd3, 0xfa, 0x55, 0x29, 0x34, 0x75, 0x2c, 0x0d, 0x18, 0xf7, 0x30, 0x46,
+    0x8f, 0x72, 0x00, 0x25, 0xa2, 0xe7, 0xbe, 0xe3, 0xcd, 0x4a, 0x34, 0xe7, 0x47, 0xf9, 0x99, 0x09,
+    0xc7, 0x41, 0x5a, 0xec, 0x17, 0xee, 0x9c, 0x02, 0x78, 0x27, 0xb7, 0x5e, 0xd4, 0xc3, 0xf3, 0x63,
+    0x71, 0xed, 0xea, 0x47, 0x7a, 0xae, 0x66, 0xf7, 0x32, 0x9e, 0x12, 0x9b, 0x33, 0xbe, 0xcb, 0x22,
+    0xe3, 0x24, 0x10, 0x0f, 0x73, 0xd3, 0xf4, 0xa6, 0xc9, 0x6b, 0x3f, 0x25, 0x0a, 0x92, 0x3a, 0x0d,
+    0xde, 0xd5, 0xa2, 0x51, 0xb9, 0xe3, 0xaf, 0x1f, 0xe7, 0xfc, 0xf1, 0x4a, 0xca, 0xb8, 0xe8, 0x70,
+    0xc3, 0x9e, 0x3d, 0xa9, 0x59, 0x18, 0xfd, 0x4a, 0x06, 0x24, 0xd6, 0x77, 0x47, 0x27, 0xc9, 0x27,
+    0xd4, 0x82, 0x09, 0xfe, 0x79, 0x3d, 0x45, 0x56, 0x36, 0x93, 0x22, 0x06, 0x68, 0x5d, 0x54, 0x90,
+    0x0e, 0xe5, 0x3c, 0x0c, 0xf7, 0x35, 0xd3, 0x04, 0x63, 0xb7, 0x91, 0xb8, 0x9c, 0xfb, 0x62, 0x9c,
+    0x15, 0x37, 0x0c, 0x67, 0xae, 0x00, 0xc7, 0x4a, 0xae, 0x7b, 0x1a, 0x2c, 0x1c, 0x6d, 0xa3, 0x39,
+    0x84, 0x87, 0x18, 0xce, 0x79, 0x5e, 0xbe, 0xff, 0x00, 0xe7, 0xf9, 0xd5, 0xb8, 0x81, 0x89, 0xd6,
+    0x55, 0x62, 0x1d, 0x30, 0xc0, 0x86, 0xc1, 0x5c, 0x73, 0x91, 0xef, 0x9a, 0xdc, 0xda, 0xae, 0xd9,
+    0x70, 0xa7, 0x1c, 0x1f, 0x97, 0x3f, 0xd2, 0xa2, 0x7b, 0x0b, 0x59, 0x14, 0x00, 0x0a, 0xf1, 0xce,
+    0xd3, 0xcf, 0xeb, 0x50, 0xe4, 0xd9, 0x8d, 0x4c, 0xbe, 0xa3, 0xf8, 0x64, 0x98, 0xb0, 0xf8, 0xaf,
+    0x55, 0xb2, 0x28, 0x0d, 0xc7, 0x9c, 0x89, 0x9f, 0x96, 0x41, 0xbf, 0x77, 0xae, 0x4f, 0xde, 0xe3,
+    0xeb, 0x4c, 0xba, 0xf1, 0xb6, 0xb3, 0x23, 0x06, 0x8e, 0x58, 0xe0, 0xc0, 0x03, 0x64, 0x71, 0x82,
+    0x09, 0xf5, 0xf9, 0xb2, 0x7b, 0xe3, 0xf0, 0xaa, 0x32, 0xe8, 0xf3, 0x03, 0xfb, 0xa9, 0xd0, 0xf3,
+    0xf3, 0x6f, 0xe3, 0xa7, 0xa6, 0x33, 0x59, 0xd2, 0xd9, 0x5c, 0x46, 0xd9, 0x9a, 0x26, 0x55, 0x1c,
+    0xee, 0xc0, 0x20, 0x7e, 0x3c, 0xf7, 0xad, 0x61, 0x27, 0x6d, 0xcc, 0x1e, 0x1e, 0xa5, 0x35, 0xef,
+    0xa2, 0x3b, 0x8b, 0xab, 0x9b, 0xe9, 0x16, 0x4b, 0x99, 0xe6, 0x9d, 0x95, 0x70, 0x1a, 0x46, 0x2c,
+    0x71, 0xd7, 0xa9, 0xe9, 0x42, 0x47, 0xb9, 0x8e, 0x57, 0x8c, 0xfc, 0xc7, 0xff, 0x00, 0xaf, 0x4f,
+    0x48, 0x76, 0x01, 0x8c, 0x1e, 0x09, 0x23, 0xff, 0x00, 0xaf, 0x56, 0xc4, 0x78, 0x4c, 0x1c, 0x74,
+    0xe4, 0xe3, 0xbe, 0x69, 0x4a, 0x76, 0x32, 0x95, 0x44, 0xb6, 0x21, 0x8e, 0x20, 0x17, 0x2e, 0x49,
+    0xe0, 0x9e, 0x47, 0xf9, 0xcd, 0x58, 0xdc, 0xaa, 0x0e, 0x08, 0xc0, 0xe7, 0x20, 0xf5, 0xa6, 0x79,
+    0x9c, 0x7a, 0x9d, 0xb8, 0xf4, 0xa8, 0x1e, 0x73, 0xb8, 0x9c, 0x93, 0x9f, 0x4e, 0xbe, 0x95, 0x9a,
+    0x4e, 0x46, 0x49, 0x39, 0x31, 0xf2, 0xcc, 0x3e, 0x63, 0x80, 0x1b, 0x19, 0xaa, 0xaf, 0x3e, 0xe3,
+    0x9c, 0x0f, 0x63, 0xd3, 0x14, 0xd6, 0x91, 0x88, 0x39, 0xc1, 0xc7, 0x3c, 0x71, 0x4e, 0x45, 0x6d,
+    0xa3, 0x19, 0xe3, 0xa7, 0xf9, 0xfc, 0x6b, 0x55, 0x15, 0x13, 0x65, 0x15, 0x1d, 0xc6, 0xaa, 0x36,
+    0xe3, 0xce, 0x32, 0x79, 0xef, 0xf9, 0xfe, 0xb5, 0x66, 0x3b, 0x72, 0xab, 0x96, 0xe0, 0xe7, 0x3c,
+    0xf6, 0xa5, 0x8a, 0x0f, 0x94, 0x29, 0x04, 0x74, 0x39, 0x1d, 0xb8, 0xff, 0x00, 0xeb, 0x55, 0x81,
+    0x88, 0x8e, 0x70, 0x39, 0xf5, 0x1d, 0x2a, 0x25, 0x3e, 0xc4, 0x4e, 0xa7, 0x44, 0x22, 0xc5, 0x87,
+    0xc8, 0x20, 0x37, 0x7c, 0xf6, 0x1d, 0x29, 0x1d, 0xf6, 0x26, 0x40, 0xc9, 0xc6, 0x3a, 0xf1, 0xfe,
+    0x7f, 0xc6, 0x9b, 0x24, 0x81, 0x0e, 0x78, 0xe3, 0x23, 0x19, 0xf6, 0xf5, 0xaa, 0xb2, 0xca, 0x5c,
+    0xe3, 0x69, 0x3c, 0x52, 0x8c, 0x5b, 0x26, 0x30, 0x72, 0xdc, 0x7c, 0x93, 0xe4, 0x1e, 0xa3, 0xaf,
+    0x07, 0x9c, 0x57, 0x6f, 0xe0, 0xdf, 0x13, 0xc6, 0xf1, 0x43, 0xa4, 0xde, 0x3e, 0x24, 0x19, 0x10,
+    0x4a, 0xc7, 0x3b, 0x86, 0x78, 0x53, 0xe8, 0x47, 0x41, 0xd8, 0xf4, 0xf4, 0xcf, 0x00, 0x37, 0x06,
+    0xe4, 0x7e, 0x19, 0xcf, 0xa0, 0xa9, 0xe1, 0x84, 0x86, 0x07, 0x77, 0x43, 0xc7, 0xd7, 0xff, 0x00,
+    0xd5, 0x5b, 0x46, 0x4a, 0x1a, 0x9b, 0x69, 0x14, 0x7b, 0x7e, 0x28, 0xc5, 0x72, 0x9e, 0x18, 0xf1,
+    0x29, 0xb8, 0x54, 0xb1, 0xd4, 0x1f, 0xf7, 0xdc, 0x2c, 0x53, 0x37, 0xf1, 0xfa, 0x2b, 0x1f, 0xef,
+    0x7b, 0xf7, 0xfa, 0xf5, 0xeb, 0x31, 0x5d, 0x31, 0x9a, 0x92, 0xba, 0x04, 0xd3, 0xd8, 0x4c, 0x51,
+    0x8a, 0x5c, 0x51, 0x8a, 0xab, 0x8c, 0x4c, 0x51, 0x8a, 0x5c, 0x51, 0x8a, 0x2e, 0x02, 0x62, 0xb9,
+    0xdf, 0x14, 0xeb, 0x5f, 0xd9, 0xf6, 0xc6, 0xd2, 0x06, 0x71, 0x75, 0x2a, 0xe7, 0x72, 0x9c, 0x6c,
+    0x5c, 0xf5, 0xcf, 0xa9, 0xc1, 0x03, 0x1f, 0x5e, 0x38, 0xad, 0x0d, 0x77, 0x57, 0x5d, 0x1e, 0xc7,
+    0xcd, 0xda, 0xaf, 0x33, 0x9d, 0xb1, 0xa1, 0x3d, 0xfd, 0x4f, 0x7c, 0x0f, 0xf0, 0xf5, 0xaf, 0x2d,
+    0xbe, 0xbd, 0x96, 0xe6, 0xe2, 0x49, 0xa5, 0x94, 0xbc, 0xae, 0x72, 0xcc, 0x73, 0xc9, 0xff, 0x00,
+    0x3f, 0xcb, 0x8a, 0xc2, 0xad, 0x4b, 0x7b, 0xab, 0x72, 0x26, 0xfa, 0x21, 0xb2, 0x39, 0x45, 0xce,
+    0x57, 0x39, 0xe0, 0xff, 0x00, 0x9f, 0x6a, 0xad, 0x24, 0xbb, 0xd8, 0xa6, 0x70, 0x7d, 0x47, 0xeb,
+    0x4c, 0x79, 0x4b, 0x80, 0x30, 0x41, 0x19, 0xc7, 0xa0, 0xa6, 0xed, 0x2d, 0x82, 0x4e, 0x07, 0xaf,
+    0x4e, 0xf5, 0x84, 0x61, 0x6d, 0xc2, 0x34, 0xd2, 0xd5, 0x89, 0x92, 0xce, 0xc0, 0x9e, 0x83, 0x1b,
+    0x8d, 0x48, 0xb1, 0x86, 0x00, 0x33, 0x1e, 0x7d, 0x7d, 0x3d, 0x7f, 0x95, 0x3e, 0x28, 0x89, 0x39,
+    0x27, 0x8e, 0x83, 0xeb, 0x8a, 0xb4, 0x91, 0x84, 0x00, 0x96, 0x00, 0x0f, 0x6c, 0x8f, 0x4a, 0x25,
+    0x3b, 0x6c, 0x12, 0xa8, 0x96, 0x88, 0x6c, 0x8e, 0x57, 0x2a, 0xa3, 0x8c, 0x63, 0x03, 0xb5, 0x55,
+    0x69, 0x4a, 0x95, 0x0b, 0xcf, 0xd7, 0xda, 0xa2, 0x69, 0x01, 0x93, 0x00, 0x9e, 0xbf, 0x8f, 0xbd,
+    0x35, 0x06, 0xec, 0x0c, 0x13, 0x9e, 0x71, 0x8a, 0x71, 0x82, 0x5b, 0x84, 0x60, 0xa3, 0xb8, 0xe5,
+    0x39, 0x90, 0xf1, 0xce, 0x3e, 0x6f, 0x4a, 0x96, 0x2b, 0x75, 0x6f, 0x94, 0x9e, 0xdd, 0x31, 0x52,
+    0xc7, 0x11, 0x03, 0x96, 0xc6, 0x0f, 0x5e, 0xff, 0x00, 0x85, 0x4e, 0x50, 0x26, 0x38, 0x18, 0xc7,
+    0x6e, 0x86, 0xa6, 0x53, 0xec, 0x29, 0xd4, 0xe8, 0x86, 0x2c, 0x43, 0x04, 0x0c, 0x83, 0xdf, 0xd0,
+    0x9e, 0xb5, 0x23, 0xb6, 0xd5, 0x65, 0x1c, 0xb0, 0xec, 0x4f, 0xf9, 0xcd, 0x31, 0xe4, 0x55, 0x2d,
+    0xb9, 0x86, 0x4f, 0x7e, 0x95, 0x56, 0x59, 0xc6, 0x06, 0x1b, 0x6e, 0x72, 0x3a, 0x9f, 0xc3, 0xb5,
+    0x42, 0x8b, 0x91, 0x9a, 0x8b, 0x96, 0xe4, 0x92, 0x4b, 0xb5, 0xb7, 0xee, 0x25, 0x87, 0x71, 0xd3,
+    0xad, 0x57, 0xde, 0xcc, 0x4f, 0x1e, 0x9d, 0x3b, 0x1a, 0xb5, 0x06, 0x97, 0x79, 0x74, 0xca, 0x11,
+    0x02, 0x06, 0xce, 0x7c, 0xcf, 0x97, 0x1f, 0x85, 0x69, 0xdb, 0xe8, 0x31, 0x00, 0x0c, 0x92, 0x33,
+    0x31, 0x00, 0x90, 0xab, 0x80, 0x7d, 0x7e, 0xbf, 0xa5, 0x69, 0x78, 0xc4, 0xef, 0xa3, 0x83, 0xa9,
+    0x2d, 0x91, 0x84, 0x23, 0xdc, 0x49, 0x2a, 0xcd, 0xeb, 0xcd, 0x68, 0xc3, 0xa6, 0xdc, 0xb9, 0x0b,
+    0xb0, 0x28, 0xcf, 0x25, 0x97, 0x1e, 0xfd, 0x2b, 0x72, 0x0b, 0x4b, 0x68, 0x14, 0x08, 0xa3, 0x8d,
+    0x30, 0x31, 0xc7, 0x53, 0xf8, 0xff, 0x00, 0x9e, 0x94, 0xac, 0x32, 0x0b, 0x60, 0x96, 0xee, 0x47,
+    0x43, 0x50, 0xe7, 0x73, 0xad, 0x65, 0xdf, 0xce, 0xfe, 0xe3, 0x3d, 0x34, 0xf8, 0xd3, 0xef, 0x3e,
+    0x40, 0x20, 0xe1, 0x4e, 0x2a, 0xc8, 0x54, 0x8c, 0x90, 0xa8, 0x01, 0x1c, 0xe4, 0x54, 0x84, 0x93,
+    0x82, 0x1b, 0x1b, 0x46, 0x33, 0x8c, 0x66, 0x99, 0x23, 0x6d, 0x1b, 0xb3, 0xc8, 0xfd, 0x0d, 0x09,
+    0x16, 0xa9, 0x53, 0xa5, 0xf0, 0xa1, 0xfb, 0xb8, 0xeb, 0xed, 0xd4, 0x74, 0xa0, 0x30, 0xc6, 0xd0,
+    0x71, 0xe9, 0xcf, 0xf9, 0xfa, 0xd4, 0x0c, 0x46, 0xee, 0x73, 0x8e, 0x81, 0xb3, 0xc8, 0xa5, 0xdc,
+    0x43, 0x74, 0xf9, 0x4f, 0xaf, 0xd2, 0x9f, 0x29, 0x5e, 0xd1, 0x93, 0x6f, 0xc3, 0x1c, 0x0c, 0x11,
+    0x8d, 0xd8, 0xff, 0x00, 0x3c, 0x56, 0x0d, 0xc0, 0x06, 0xe6, 0x53, 0x8e, 0xae, 0x7f, 0x9d, 0x6d,
+    0xaf, 0x24, 0x67, 0x24, 0x83, 0xd0, 0xf5, 0xac, 0x59, 0xc6, 0x2e, 0x24, 0x00, 0xe4, 0x07, 0x3c,
+    0xfe, 0x35, 0x12, 0xd0, 0xed, 0xc2, 0x3e, 0x66, 0xee, 0x54, 0x77, 0x65, 0x72, 0x01, 0xc0, 0xa0,
+    0x12, 0xff, 0x00, 0x7b, 0x9c, 0x52, 0x4b, 0xfe, 0xb0, 0xd1, 0x1f, 0x7a, 0xae, 0x85, 0x36, 0xdc,
+    0xda, 0xe8, 0x3d, 0x55, 0x77, 0x0e, 0x2a, 0x4d, 0xa3, 0xd2, 0x98, 0xbf, 0x78, 0x54, 0x95, 0x0c,
+    0xe8, 0xa7, 0x15, 0x62, 0xbf, 0x9a, 0xfe, 0xbf, 0xa5, 0x28, 0x1b, 0x86, 0x4f, 0x24, 0xd4, 0x75,
+    0x22, 0x7d, 0xd1, 0x56, 0xce, 0x68, 0xb7, 0x27, 0x66, 0x3d, 0x14, 0x73, 0xc5, 0x2b, 0xfc, 0xa8,
+    0x48, 0xe0, 0xd0, 0x9d, 0xe8, 0x97, 0xfd, 0x59, 0xa9, 0xea, 0x74, 0x59, 0x28, 0x5d, 0x11, 0x79,
+    0xaf, 0xeb, 0xfa, 0x52, 0xec, 0x5f, 0x4a, 0x8e, 0xa6, 0xaa, 0x7a, 0x18, 0x41, 0xb9, 0x6e, 0x39,
+    0x54, 0x6d, 0x1c, 0x56, 0xae, 0x8e, 0x00, 0x33, 0x72, 0x07, 0xdd, 0xeb, 0xf8, 0xd6, 0x62, 0xfd,
+    0xd1, 0x5a, 0xda, 0x28, 0xc9, 0x9c, 0x74, 0x18, 0x19, 0x3f, 0x9d, 0x43, 0x66, 0xf3, 0x8a, 0x70,
+    0xb1, 0x7c, 0x29, 0xc7, 0x1d, 0x7b, 0xe4, 0x7f, 0x9f, 0x7a, 0xaf, 0x35, 0x85, 0xb5, 0xc0, 0x25,
+    0xd0, 0xf3, 0x9c, 0x91, 0xf2, 0x92, 0x4f, 0xd3, 0xad, 0x5e, 0x3c, 0x01, 0xc0, 0x24, 0xe7, 0x14,
+    0xc6, 0xe1, 0x4a, 0xe0, 0x9c, 0xfe, 0x94, 0x29, 0x1c, 0x93, 0xa3, 0x16, 0xb5, 0x46, 0x24, 0xba,
+    0x19, 0x59, 0x37, 0x45, 0x20, 0x39, 0x1f, 0x75, 0x87, 0x23, 0xf2, 0xcd, 0x57, 0xfb, 0x0c, 0xb1,
+    0x0d, 0xce, 0xb8, 0x1e, 0xa4, 0xf0, 0x39, 0xf5, 0xe9, 0xf8, 0x56, 0xf9, 0x24, 0x31, 0x20, 0x74,
+    0xce, 0x07, 0x02, 0xa2, 0x27, 0xa1, 0xc9, 0xcf, 0x62, 0x73, 0xc9, 0xad, 0x39, 0x9b, 0x3c, 0xea,
+    0xd8, 0x48, 0x3d, 0xb4, 0x32, 0x8a, 0x6d, 0xe0, 0xa8, 0x27, 0xa0, 0xcf, 0x7a, 0x8c, 0xca, 0x14,
+    0x3e, 0xd1, 0xc7, 0x7f, 0xa5, 0x69, 0xbc, 0x71, 0x3e, 0x09, 0x8f, 0xe6, 0x3f, 0x37, 0x1c, 0x55,
+    0x09, 0xb4, 0xbc, 0x8f, 0xdd, 0x4b, 0xb4, 0x8c, 0x70, 0x7b, 0xf6, 0xeb, 0xda, 0x92, 0x8f, 0x73,
+    0xcf, 0x78, 0x49, 0x27, 0xdc, 0xcf, 0x92, 0x52, 0x54, 0xaa, 0xbf, 0x51, 0xdf, 0x9c, 0x54, 0x47,
+    0x71, 0x23, 0x19, 0xc9, 0xe3, 0x9e, 0x95, 0x60, 0xd8, 0xcf, 0x1b, 0x7c, 0xc8, 0x70, 0x3a, 0x3e,
+    0x32, 0x3e, 0xbf, 0xfe, 0xba, 0x7c, 0x50, 0x64, 0xab, 0x10, 0x4e, 0x4f, 0x26, 0xb4, 0xba, 0x8a,
+    0x26, 0x5e, 0xe6, 0x8c, 0x8e, 0x18, 0x41, 0x61, 0xcf, 0x19, 0xef, 0x56, 0x52, 0x2c, 0x02, 0x72,
+    0x38, 0xee, 0xbc, 0x66, 0xa4, 0x54, 0x2a, 0x72, 0x71, 0x82, 0x3b, 0x8e, 0x3f, 0x3a, 0x64, 0x92,
+    0xa0, 0x53, 0xf2, 0xf5, 0x07, 0xaf, 0x7f, 0xa5, 0x64, 0xe4, 0xe4, 0x60, 0xe4, 0xe4, 0x2b, 0x3a,
+    0xab, 0x01, 0xd8, 0xf4, 0x20, 0xe3, 0xeb, 0x50, 0x49, 0x31, 0x6c, 0x63, 0xb1, 0xc6, 0xee, 0x99,
+    0xa8, 0xe5, 0x9b, 0x39, 0xce, 0xee, 0x06, 0x07, 0x3e, 0xb5, 0x5f, 0x25, 0xa4, 0x1c, 0xe7, 0x9e,
+    0x4e, 0x79, 0xc5, 0x5c, 0x61, 0xdc, 0xd2, 0x14, 0xfa, 0xb1, 0x59, 0xcb, 0x1c, 0x7a, 0x9f, 0x5e,
+    0x3f, 0xfa, 0xfd, 0x29, 0xca, 0x99, 0x07, 0x2a, 0x49, 0xf5, 0x39, 0x26, 0x9f, 0x1c, 0x65, 0xf1,
+    0x95, 0xf9, 0xbb, 0xd5, 0xb1, 0x00, 0x03, 0x2c, 0x38, 0xcf, 0x73, 0xeb, 0x55, 0x29, 0xa5, 0xb0,
+    0xe5, 0x35, 0x1d, 0x88, 0xe2, 0x85, 0x91, 0x01, 0x24, 0x13, 0x9c, 0x64, 0x54, 0xc1, 0x44, 0x6a,
+    0x09, 0xee, 0x30, 0x30, 0x7f, 0x95, 0x29, 0x60, 0x01, 0x07, 0xe6, 0xe3, 0xa7, 0x5f, 0xd6, 0xab,
+    0xbc, 0xb8, 0xe4, 0xf4, 0x3c, 0x0e, 0x7f, 0x95, 0x65, 0xac, 0x8c, 0xb5, 0x93, 0x1f, 0x2c, 0xa0,
+    0x73, 0xd0, 0x31, 0xf5, 0xaa, 0xd2, 0x49, 0xc1, 0xc0, 0x03, 0xeb, 0xcd, 0x35, 0xe4, 0xe7, 0x24,
+    0x90, 0x7b, 0x9f, 0x6a, 0x6a, 0x46, 0xd2, 0xe3, 0x20, 0x1c, 0x7a, 0xfa, 0xe2, 0xb5, 0x8c, 0x52,
+    0xdc, 0xda, 0x30, 0x51, 0xdc, 0x69, 0x00, 0x90, 0xcb, 0x9e, 0x3a, 0x76, 0xcf, 0x15, 0x3a, 0xc5,
+    0xbb, 0x24, 0xf0, 0xa3, 0x8e, 0x95, 0x2a, 0x40, 0x42, 0x60, 0xe4, 0x11, 0xeb, 0xd0, 0x8a, 0x98,
+    0x61, 0x46, 0x01, 0x39, 0xeb, 0x81, 0xfc, 0xaa, 0x65, 0x3e, 0xc4, 0xce, 0xa7, 0x44, 0x36, 0x18,
+    0x7b, 0x8f, 0xbc, 0x3b, 0xf6, 0xa9, 0x19, 0x8a, 0x1d, 0xa0, 0x7e, 0x07, 0xb7, 0xf8, 0x54, 0x6f,
+    0x20, 0x1c, 0x2e, 0x3d, 0x7a, 0x8a, 0xaf, 0x24, 0xcc, 0xeb, 0x80, 0x40, 0xed, 0x83, 0xda, 0xa1,
+    0x45, 0xc8, 0xcd, 0x45, 0xc9, 0xea, 0x3a, 0x69, 0xc2, 0x93, 0x8d, 0xa1, 0x7d, 0x87, 0xe8, 0x2a,
+    0xb9, 0x66, 0x2c, 0x84, 0x75, 0x3e, 0x87, 0x83, 0xfe, 0x78, 0xa0, 0x16, 0x63, 0x95, 0xea, 0x79,
+    0xc6, 0x7b, 0xd4, 0x89, 0x19, 0x75, 0x19, 0x38, 0xe7, 0xf0, 0xff, 0x00, 0x3c, 0xd6, 0xc9, 0x28,
+    0x9b, 0xa4, 0xa2, 0x86, 0x08, 0xf7, 0x02, 0x48, 0x51, 0xd3, 0x9c, 0x74, 0xf7, 0xab, 0x51, 0xc2,
+    0xb8, 0x0c, 0x47, 0x39, 0xfa, 0x7b, 0xd3, 0xe3, 0x42, 0xb8, 0xdd, 0x90, 0x07, 0x5d, 0xdc, 0x83,
+    0xfe, 0x7f, 0xc2, 0xac, 0x2c, 0x52, 0x33, 0x61, 0x63, 0x03, 0x1d, 0x18, 0xf3, 0x81, 0xf8, 0xd6,
+    0x72, 0x9b, 0x7b, 0x19, 0xb9, 0x4a, 0x4e, 0xd1, 0x1a, 0xaa, 0xab, 0xef, 0x93, 0xc1, 0xce, 0x45,
+    0x42, 0xd2, 0x64, 0x75, 0xc0, 0xe9, 0xd2, 0xae, 0x2d, 0x81, 0x27, 0x2e, 0xfc, 0x0e, 0xc0, 0x7e,
+    0x47, 0x3d, 0xea, 0xdc, 0x50, 0x43, 0x14, 0xa3, 0xcb, 0x8c, 0x2b, 0x2f, 0x43, 0x8c, 0x91, 0xf8,
+    0xf5, 0xa9, 0x51, 0xee, 0x6f, 0x4b, 0x07, 0x39, 0x3b, 0xcb, 0x43, 0x1e, 0x3b, 0x5b, 0xbb, 0x94,
+    0xfd, 0xda, 0x1d, 0xb8, 0x18, 0x76, 0xf9, 0x47, 0xd7, 0xdf, 0xbd, 0x5a, 0x87, 0x43, 0xf9, 0x87,
+    0xda, 0x6e, 0x33, 0xc6, 0x48, 0x8f, 0xa0, 0x3d, 0x7a, 0x91, 0xfd, 0x2b, 0x61, 0x3e, 0x50, 0x46,
+    0xee, 0x9c, 0x7d, 0x69, 0xfc, 0x10, 0x3a, 0xed, 0xe8, 0x71, 0xd6, 0x9b, 0x9b, 0x5b, 0x1e, 0xa5,
+    0x1c, 0x15, 0x35, 0xbe, 0xa5, 0x58, 0x74, 0xfb, 0x78, 0x54, 0x94, 0x8d, 0x38, 0xfe, 0x23, 0xf3,
+    0x1f, 0xcc, 0xd4, 0xec, 0x01, 0x1d, 0x88, 0xfa, 0x60, 0xd4, 0x9b, 0x78, 0xda, 0x72, 0x00, 0xe8,
+    0xbe, 0xf4, 0xe6, 0x50, 0x4e, 0xe3, 0x82, 0x49, 0xc7, 0x4c, 0xf4, 0xa8, 0xe6, 0x3b, 0x55, 0x18,
+    0xa5, 0xa2, 0x20, 0x39, 0x07, 0x73, 0x70, 0x7d, 0x3a, 0x52, 0x10, 0xd8, 0x00, 0xf0, 0x78, 0xc0,
+    0xed, 0x52, 0x67, 0x04, 0xf0, 0x3e, 0x87, 0x8c, 0x54, 0x24, 0xe0, 0x67, 0xb9, 0xe9, 0x93, 0x8c,
+    0x53, 0x46, 0x72, 0x56, 0x01, 0x80, 0x71, 0xc8, 0x1f, 0xe7, 0xff, 0x00, 0xaf, 0x4b, 0xbc, 0x93,
+    0x8c, 0xf1, 0x81, 0x9f, 0x4c, 0xd3, 0x32, 0x46, 0x15, 0x7e, 0xf1, 0xe4, 0xe4, 0xd3, 0x4b, 0x6d,
+    0xdc, 0x38, 0xcf, 0x72, 0x4e, 0x2a, 0xec, 0x60, 0xea, 0x58, 0x94, 0x3a, 0x95, 0xce, 0x38, 0xfe,
+    0xef, 0x3c, 0x0a, 0x50, 0xe4, 0xe3, 0xb0, 0xcf, 0x07, 0x19, 0xa8, 0x43, 0x1c, 0x1e, 0x98, 0xc7,
+    0x18, 0x1c, 0x8f, 0x41, 0x4a, 0x98, 0x20, 0x2e, 0xd3, 0xf4, 0xc7, 0x6a, 0x56, 0x08, 0xce, 0xe4,
+    0xa8, 0x08, 0x1d, 0x0e, 0x38, 0xe7, 0xa6, 0x29, 0xcd, 0x1a, 0xf3, 0xd7, 0xaf, 0x1c, 0xe6, 0x98,
+    0xbc, 0xe3, 0x69, 0x04, 0x9e, 0x80, 0x71, 0x52, 0x00, 0xc4, 0x60, 0x8e, 0xbd, 0xf1, 0x52, 0xcd,
+    0xe2, 0xae, 0x30, 0xaf, 0x1d, 0x39, 0xe8, 0x7a, 0xfd, 0x29, 0xe6, 0x21, 0xce, 0x72, 0x46, 0x7d,
+    0x4f, 0xf9, 0xeb, 0x52, 0x6c, 0x1c, 0x71, 0xcf, 0x5d, 0xbf, 0xd2, 0x86, 0x5d, 0xbc, 0xe3, 0x9e,
+    0xff, 0x00, 0xe1, 0x4b, 0x98, 0xd7, 0xd9, 0xa2, 0x11, 0x94, 0xc9, 0xda, 0x3d, 0x7b, 0xd3, 0x41,
+    0x60, 0x7d, 0x3d, 0xaa, 0x62, 0x36, 0x21, 0x1c, 0xe3, 0x3c, 0x82, 0x2a, 0x1c, 0x0c, 0xe0, 0x8c,
+    0xa8, 0x3f, 0x41, 0xd6, 0x9a, 0xd4, 0xca, 0x4a, 0xc0, 0xcd, 0xb1, 0x41, 0x07, 0x9c, 0x75, 0xfe,
+    0x94, 0xa5, 0xfa, 0xaa, 0xe0, 0x0c, 0x76, 0x3c, 0xd4, 0x7c, 0xe0, 0x2e, 0x30, 0x0e, 0x78, 0xcf,
+    0x5f, 0x7a, 0x60, 0xc2, 0xe3, 0x00, 0xf1, 0x9e, 0x40, 0xcd, 0x55, 0x8c, 0x1d, 0x4b, 0x12, 0xf9,
+    0x83, 0x39, 0x24, 0x13, 0x8e, 0x73, 0x4e, 0x53, 0xbf, 0xd7, 0x69, 0x03, 0x00, 0xd5, 0x7e, 0x32,
+    0x78, 0xc0, 0x04, 0xe3, 0xeb, 0x4f, 0x5d, 0xbb, 0x8e, 0x41, 0x27, 0xb8, 0xa6, 0xd0, 0x2a, 0x97,
+    0x06, 0x86, 0x17, 0x76, 0x66, 0x88, 0x6e, 0xe3, 0xeb, 0x50, 0x4d, 0xa6, 0x93, 0x91, 0x1c, 0x80,
+    0x7f, 0xbc, 0xbd, 0x72, 0x7d, 0x45, 0x5b, 0x56, 0x24, 0x81, 0x82, 0x0f, 0x41, 0xee, 0x3d, 0xea,
+    0x55, 0xc9, 0x24, 0x1d, 0xc7, 0x03, 0xa7, 0xa5, 0x43, 0x07, 0x86, 0xa5, 0x57, 0xe2, 0x47, 0x37,
+    0x79, 0x6b, 0x75, 0x08, 0x21, 0xa1, 0x72, 0x98, 0x3f, 0x38, 0xf9, 0xba, 0x7f, 0xfa, 0xbb, 0xe2,
+    0xa8, 0xb2, 0x17, 0x6e, 0x08, 0x38, 0xea, 0xa3, 0xad, 0x76, 0xbb, 0x14, 0xe0, 0x2a, 0xfd, 0x3f,
+    0xcf, 0xe5, 0x50, 0x4d, 0x63, 0x6f, 0x3b, 0x6e, 0x96, 0x10, 0x5c, 0x60, 0xb1, 0x03, 0x07, 0x8f,
+    0xe7, 0x55, 0x1a, 0x96, 0x33, 0x96, 0x5b, 0x65, 0xfb, 0xb7, 0xf7, 0x9c, 0xbc, 0x71, 0x67, 0x04,
+    0x1e, 0x87, 0x23, 0x27, 0x35, 0x6e, 0x38, 0xd5, 0x42, 0x8c, 0xf4, 0x1c, 0x0a, 0xd2, 0x93, 0x4c,
+    0x50, 0x3f, 0x75, 0x21, 0xe0, 0x60, 0x64, 0x67, 0xd3, 0xfc, 0xe7, 0xde, 0xaa, 0xcb, 0x6f, 0x34,
+    0x59, 0x3b, 0x77, 0x67, 0x00, 0x91, 0xcf, 0x34, 0x9c, 0x9c, 0x8f, 0x32, 0xb6, 0x1a, 0xbc, 0x1e,
+    0xa8, 0x89, 0xdc, 0xc7, 0xce, 0x38, 0x07, 0x8c, 0x9f, 0xf3, 0xe9, 0x55, 0xa4, 0x98, 0xe7, 0x2b,
+    0xc1, 0xe7, 0x3c, 0xd4, 0x12, 0x4e, 0x48, 0x20, 0xed, 0xe7, 0xd3, 0xb5, 0x44, 0x4b, 0x39, 0x04,
+    0x81, 0x92, 0x72, 0x4f, 0x5f, 0xad, 0x5c, 0x61, 0xdc, 0xca, 0x14, 0xfa, 0xb1, 0xe5, 0x89, 0x97,
+    0x07, 0x23, 0xd0, 0x13, 0xdf, 0xf3, 0xa5, 0x48, 0xcb, 0xe7, 0x01, 0x86, 0x70, 0x32, 0x05, 0x3e,
+    0x38, 0x33, 0x82, 0xdd, 0xfe, 0xf0, 0xf5, 0xab, 0x4a, 0x81, 0x50, 0x13, 0xc1, 0x04, 0xf5, 0xaa,
+    0x94, 0xd2, 0xd8, 0x72, 0x9a, 0x8e, 0xc3, 0x23, 0x84, 0x0f, 0xbd, 0x90, 0x49, 0xe4, 0x73, 0xfe,
+    0x7b, 0xd4, 0xc1, 0x71, 0xb7, 0x23, 0x82, 0x7a, 0xfa, 0x7d, 0x3d, 0xa8, 0x24, 0x46, 0x30, 0x30,
+    0x3d, 0x41, 0x1c, 0x67, 0xd6, 0xab, 0xcb, 0x2b, 0x1e, 0x07, 0x4f, 0x40, 0x7f, 0xad, 0x65, 0xac,
+    0x8c, 0x75, 0x93, 0x24, 0x69, 0x94, 0x6e, 0x5c, 0xe4, 0xe0, 0xf0, 0x6b, 0xb1, 0xf0, 0xe7, 0x8d,
+    0xa3, 0x2a, 0x96, 0x5a, 0xb4, 0x84, 0x49, 0xb8, 0x2a, 0x5c, 0x9f, 0xba, 0x47, 0x6d, 0xe7, 0xf2,
+    0x19, 0xf7, 0xe7, 0xb9, 0x3c, 0x03, 0xc8, 0xa7, 0x04, 0x0c, 0x29, 0x3d, 0xba, 0x83, 0x4a, 0xb1,
+    0x96, 0x77, 0x2e, 0x0f, 0xd0, 0xf7, 0xfd, 0x2b, 0x68, 0x2e, 0x4d, 0x4d, 0xe3, 0x15, 0x13, 0xdd,
+    0x51, 0xd2, 0x58, 0xd6, 0x48, 0xdd, 0x5d, 0x18, 0x06, 0x56, 0x53, 0x90, 0x41, 0xe8, 0x41, 0xa7,
+    0x62, 0xbc, 0x93, 0x48, 0xd7, 0x35, 0x2d, 0x2e, 0x35, 0x8e, 0xde, 0xe9, 0xbc, 0x90, 0xc0, 0xf9,
+    0x4c, 0xbb, 0x97, 0x19, 0xc9, 0x1c, 0xf4, 0xc9, 0x27, 0x38, 0xc7, 0x5a, 0xe9, 0x21, 0xf1, 0xdc,
+    0xf1, 0xc4, 0x7e, 0xd5, 0x63, 0x1b, 0xbe, 0x72, 0x0c, 0x6e, 0x50, 0x63, 0xd3, 0x07, 0x3f, 0xcf,
+    0xbd, 0x69, 0xed, 0xa3, 0xd4, 0x3d, 0xa4, 0x4e, 0xdf, 0x15, 0x89, 0xaf, 0xf8, 0x8e, 0xdb, 0x46,
+    0xb7, 0x65, 0x56, 0x49, 0x6f, 0x0f, 0x09, 0x10, 0x39, 0xda, 0x71, 0x9c, 0xb6, 0x3a, 0x0e, 0xfe,
+    0xff, 0x00, 0xa8, 0xe3, 0xef, 0x3c, 0x69, 0xab, 0x5c, 0x46, 0x11, 0x5e, 0x2b, 0x60, 0x41, 0x04,
+    0xc4, 0xbc, 0x90, 0x47, 0xa9, 0xce, 0x31, 0xed, 0x8a, 0xe6, 0x66, 0xb8, 0x79, 0x64, 0x77, 0x93,
+    0x73, 0xc8, 0xe7, 0x73, 0x33, 0x75, 0x27, 0xdf, 0x34, 0x9d, 0x5b, 0xfc, 0x21, 0xcd, 0x7d, 0x8b,
+    0x5a, 0xa6, 0xa7, 0x3e, 0xa9, 0x76, 0xd7, 0x37, 0x0f, 0xba, 0x47, 0xc0, 0x1c, 0x7c, 0xaa, 0x3b,
+    0x28, 0x1d, 0x87, 0x3f, 0xe4, 0xd6, 0x73, 0x31, 0x76, 0x18, 0x3f, 0x28, 0xed, 0x8c, 0x93, 0xfe,
+    0x7f, 0xcf, 0x4a, 0x40, 0x1a, 0x47, 0x20, 0x9c, 0x0e, 0x86, 0xa5, 0x58, 0xf7, 0x0e, 0x57, 0x93,
+    0xc6, 0x3b, 0x8a, 0x8d, 0x16, 0xac, 0x76, 0x51, 0xdc, 0x68, 0x8f, 0x3b, 0x43, 0x60, 0xf1, 0x8e,
+    0x07, 0x61, 0xfe, 0x7f, 0x4a, 0xb4, 0x90, 0x10, 0xb9, 0x6e, 0x33, 0xd0, 0x1a, 0x72, 0xc6, 0x00,
+    0xdc, 0x70, 0x07, 0xd0, 0x73, 0xfe, 0x79, 0xa9, 0x4b, 0x05, 0x1b, 0xb7, 0x64, 0x76, 0x00, 0x9f,
+    0x5a, 0xca, 0x53, 0xbe, 0xc6, 0x32, 0xa8, 0xde, 0x88, 0x6e, 0x00, 0x18, 0x20, 0x64, 0x7a, 0x9e,
+    0x69, 0xac, 0xe0, 0x67, 0x1c, 0x71, 0xd4, 0x71, 0x51, 0x4b, 0x39, 0xc6, 0x71, 0x86, 0x19, 0xcf,
+    0x1e, 0xf5, 0x59, 0xa5, 0x0e, 0x70, 0xbc, 0xe4, 0x63, 0x07, 0xbf, 0xa5, 0x38, 0xc2, 0xfb, 0x8e,
+    0x34, 0xef, 0xab, 0x1c, 0xb0, 0xe4, 0x80, 0xcb, 0x91, 0xdb, 0x26, 0xad, 0x2d, 0xb8, 0x53, 0x9e,
+    0xc3, 0xb8, 0x1c, 0xd6, 0xba, 0xd9, 0x40, 0x17, 0x68, 0x52, 0xd8, 0x3c, 0x9d, 0xc7, 0x27, 0xf2,
+    0xa9, 0x7c, 0xa8, 0xd7, 0xee, 0xa6, 0xd1, 0xd0, 0xe0, 0x00, 0x71, 0xe9, 0x43, 0x93, 0x67, 0x77,
+    0xd4, 0xaa, 0x4b, 0x77, 0x63, 0x31, 0x63, 0x76, 0x5e, 0x17, 0x8c, 0x9e, 0xdd, 0x7e, 0x94, 0xe1,
+    0x63, 0x33, 0xe3, 0x7e, 0x10, 0x1e, 0xa3, 0x19, 0xc7, 0xe1, 0x5a, 0x7b, 0x32, 0x0e, 0xd0, 0x3e,
+    0xa4, 0xf1, 0x8f, 0xf2, 0x69, 0x36, 0xe0, 0x0e, 0x48, 0xce, 0x31, 0x9a, 0x94, 0x91, 0xa4, 0x32,
+    0xf8, 0xaf, 0x8b, 0x52, 0x8a, 0x69, 0x31, 0x2e, 0xd6, 0x77, 0x67, 0x6e, 0xfd, 0x81, 0xeb, 0xf8,
+    0xd5, 0xf8, 0x21, 0x8e, 0xde, 0x33, 0xe5, 0x28, 0x40, 0x7a, 0x95, 0x18, 0xe8, 0x3d, 0x7b, 0xd3,
+    0xd5, 0x40, 0x8c, 0x64, 0x63, 0x07, 0x1c, 0xe2, 0x8c, 0x85, 0x20, 0x9c, 0x67, 0xd3, 0x3c, 0x50,
+    0xdd, 0xce, 0xda, 0x54, 0xa1, 0x4f, 0x64, 0x4c, 0xb8, 0x3c, 0x2e, 0x48, 0xfd, 0x28, 0x6f, 0x9b,
+    0xd7, 0x00, 0x75, 0xc5, 0x43, 0x9f, 0x98, 0x9e, 0x07, 0xa6, 0x7f, 0x5e, 0xb4, 0x34, 0x83, 0x9c,
+    0xf3, 0x9c, 0xf5, 0xa9, 0xb1, 0xd4, 0xaa, 0x24, 0x4c, 0xc7, 0x39, 0x23, 0xaf, 0x20, 0xf0, 0x29,
+    0x84, 0xfc, 0xa7, 0x20, 0xe7, 0x1e, 0xbd, 0x3a, 0x53, 0x0b, 0x05, 0x6f, 0x4f, 0xa1, 0xc1, 0xa7,
+    0x31, 0xdd, 0x8c, 0x9c, 0xf3, 0xd8, 0xf4, 0xa1, 0x21, 0x4a, 0x77, 0x18, 0xef, 0x83, 0xc6, 0x33,
+    0xed, 0x50, 0xb8, 0x27, 0x03, 0x83, 0x8c, 0x02, 0x71, 0xf9, 0xd4, 0xc7, 0x1c, 0xa9, 0xc9, 0x63,
+    0xc6, 0x3d, 0x29, 0xac, 0xa7, 0x7e, 0xec, 0xf2, 0x07, 0xa7, 0x5a, 0xb4, 0xce, 0x79, 0x46, 0xe4,
+    0x2c, 0x30, 0x76, 0x9c, 0xe3, 0xb1, 0xf4, 0xff, 0x00, 0x3f, 0xd2, 0x94, 0x71, 0x83, 0x93, 0xea,
+    0x71, 0xda, 0xa6, 0xf2, 0xc8, 0x52, 0x48, 0x18, 0xe0, 0x1c, 0xf7, 0xa5, 0xda, 0x06, 0xe0, 0x3f,
+    0x2e, 0x99, 0xe9, 0x4f, 0x98, 0x8f, 0x66, 0xc8, 0xc6, 0x06, 0x46, 0x33, 0xf4, 0xed, 0x5c, 0xdd,
+    0xd7, 0xfc, 0x7d, 0xcd, 0xff, 0x00, 0x5d, 0x1b, 0xf9, 0xd7, 0x4e, 0x06, 0x01, 0x2d, 0xcf, 0x4e,
+    0x7d, 0x2b, 0x9a, 0xbb, 0x53, 0xf6, 0xc9, 0xf1, 0xc8, 0xf3, 0x1b, 0xbf, 0xbd, 0x2b, 0x9b, 0x53,
+    0x8b, 0x18, 0x9f, 0x74, 0x54, 0x89, 0xde, 0x9a, 0xaa, 0x76, 0x8e, 0x29, 0xc0, 0x84, 0xfb, 0xdc,
+    0x66, 0xa5, 0x9d, 0xd0, 0xd2, 0xcd, 0x84, 0xbf, 0xea, 0xcd, 0x57, 0xa9, 0xdd, 0xd5, 0x94, 0x80,
+    0x72, 0x4d, 0x43, 0xb1, 0xbd, 0x29, 0xc7, 0x63, 0x3a, 0xde, 0xf4, 0xae, 0x89, 0x6a, 0x45, 0xfb,
+    0xa2, 0x99, 0xb4, 0xfa, 0x52, 0xef, 0x55, 0xe0, 0x9c, 0x1a, 0x4c, 0xda, 0x3e, 0xeb, 0xbb, 0x19,
+    0x3f, 0xf0, 0xd4, 0x69, 0xf7, 0x85, 0x49, 0x21, 0x0f, 0x8d, 0xbc, 0xe2, 0x9a, 0xaa, 0xdb, 0x87,
+    0x15, 0x4b, 0x63, 0x09, 0xeb, 0x52, 0xe8, 0x7d, 0x4b, 0x51, 0xed, 0x3e, 0x94, 0xbe, 0x6a, 0x7a,
+    0xfe, 0x95, 0x2f, 0x53, 0x78, 0x35, 0x1d, 0xc8, 0xa5, 0xff, 0x00, 0x58, 0x6b, 0x5f, 0x40, 0x00,
+    0x8b, 0x92, 0x7b, 0x6d, 0xfe, 0xb5, 0x90, 0xe3, 0x73, 0x92, 0x39, 0x06, 0xb5, 0xb4, 0x30, 0xca,
+    0x67, 0xe3, 0x3f, 0x77, 0x8c, 0xfd, 0x69, 0xbd, 0x8e, 0x69, 0x3b, 0x49, 0xc8, 0xdb, 0x0e, 0x44,
+    0x9c, 0x60, 0x03, 0xcf, 0x4c, 0x60, 0x62, 0x9a, 0x4e, 0xd2, 0xb9, 0xc8, 0x51, 0xd2, 0x99, 0xbb,
+    0x6f, 0x4e, 0x07, 0x6f, 0x6a, 0x46, 0xcf, 0xf0, 0x93, 0xd3, 0x3e, 0xf5, 0x36, 0x13, 0xa9, 0x71,
+    0xcd, 0xf3, 0x47, 0xc3, 0x64, 0x7b, 0x0a, 0x82, 0x50, 0xc5, 0x97, 0x07, 0x18, 0x1f, 0xe7, 0xfa,
+    0x54, 0x8d, 0xc1, 0xe4, 0xf2, 0x46, 0x49, 0xa4, 0xc1, 0xce, 0x09, 0x6d, 0xd8, 0x1d, 0x7a, 0x55,
+    0x2d, 0x0c, 0x24, 0xae, 0x44, 0x23, 0x3c, 0x96, 0x53, 0xd7, 0x9a, 0x4c, 0x60, 0x85, 0x1c, 0x90,
+    0xdc, 0x76, 0xa9, 0x4a, 0x1c, 0x9e, 0xa3, 0x1c, 0x01, 0xff, 0x00, 0xea, 0xa0, 0x29, 0x27, 0x92,
+    0x41, 0x1e, 0xa3, 0x26, 0xaa, 0xe6, 0x3e, 0xcd, 0x8c, 0x01, 0x76, 0xe4, 0x81, 0x96, 0xc0, 0xa3,
+    0xc8, 0x47, 0x3c, 0xc6, 0x09, 0xeb, 0x9e, 0xff, 0x00, 0x9f, 0xf9, 0xed, 0x4e, 0xe5, 0x40, 0x07,
+    0xf2, 0x14, 0xf2, 0x36, 0xaf, 0x53, 0x81, 0xdb, 0xb7, 0xd6, 0x93, 0x65, 0xaa, 0x69, 0xab, 0x49,
+    0x5c, 0xaa, 0xfa, 0x6a, 0x37, 0xdd, 0x9b, 0x60, 0x3c, 0x72, 0x32, 0x2b, 0x36, 0x7d, 0x2e, 0xec,
+    0x9e, 0x82, 0x41, 0x8e, 0x76, 0xb8, 0x1f, 0xa1, 0xc5, 0x6e, 0x82, 0x32, 0x08, 0xc7, 0xa1, 0x03,
+    0x1c, 0xff, 0x00, 0x9e, 0x69, 0xc8, 0xc7, 0x19, 0xc7, 0xcc, 0x33, 0xd3, 0xad, 0x24, 0xda, 0x21,
+    0xe1, 0x28, 0x3e, 0x96, 0xf4, 0x39, 0x26, 0x82, 0x64, 0x24, 0xc9, 0x14, 0xa8, 0x32, 0x40, 0x2c,
+    0xa4, 0x1a, 0x96, 0x18, 0x0b, 0x1c, 0xed, 0x03, 0xd3, 0xbf, 0xff, 0x00, 0x5a, 0xba, 0x64, 0x6c,
+    0xf6, 0xc9, 0x3d, 0x7d, 0xa9, 0xa6, 0xde, 0x27, 0x04, 0x34, 0x69, 0x93, 0xf7, 0xb0, 0x31, 0x9f,
+    0xd2, 0xa9, 0xcd, 0xb3, 0x9e, 0xa6, 0x05, 0xbf, 0x82, 0x46, 0x2c, 0x6b, 0xb0, 0xe1, 0x41, 0x04,
+    0xf6, 0xeb, 0xfe, 0x7d, 0x69, 0x8f, 0x29, 0x42, 0x0e, 0x47, 0xb8, 0x23, 0x19, 0x38, 0xad, 0x79,
+    0x2c, 0xa1, 0x6c, 0xa8, 0x2c, 0xac, 0x3a, 0x95, 0x3d, 0x7f, 0x3a, 0xab, 0x2e, 0x92, 0x8c, 0x07,
+    0x95, 0x33, 0xee, 0xe8, 0x73, 0x82, 0x3f, 0x2a, 0x94, 0xb5, 0xd4, 0xe4, 0x78, 0x0a, 0xa9, 0xeb,
+    0xa9, 0x93, 0x34, 0xe4, 0x00, 0x0e, 0xde, 0xc7, 0x24, 0xd4, 0x24, 0xb9, 0xf9, 0xb2, 0x7d, 0x87,
+    0xf9, 0xf5, 0xad, 0x51, 0xa1, 0xe5, 0x8e, 0x2e, 0x79, 0x27, 0xef, 0x14, 0xeb, 0xcf, 0xd6, 0xa4,
+    0x5d, 0x1f, 0x19, 0xdf, 0x36, 0x78, 0xfe, 0xe7, 0x51, 0xf9, 0xd6, 0xaa, 0x51, 0x5b, 0x1a, 0x2c,
+    0x2d, 0x45, 0xb2, 0x32, 0x52, 0x32, 0x71, 0x9f, 0xd7, 0xbf, 0xf5, 0xef, 0x56, 0x56, 0x2c, 0xe3,
+    0x77, 0x40, 0x71, 0xfe, 0x45, 0x69, 0x0d, 0x2d, 0x47, 0x57, 0x04, 0x81, 0xc9, 0xdb, 0x92, 0x7f,
+    0x5a, 0x7b, 0x69, 0xc7, 0xa0, 0x98, 0xfa, 0x0e, 0x31, 0x8f, 0xd6, 0xb3, 0x94, 0x9b, 0x32, 0x96,
+    0x17, 0x10, 0xfe, 0xcf, 0xe2, 0x8a, 0x24, 0x2e, 0x73, 0xc1, 0x1e, 0x83, 0xfc, 0xfe, 0x15, 0x0c,
+    0xb7, 0x01, 0x46, 0x3e, 0x5c, 0x0e, 0x7f, 0x1f, 0xc6, 0xb4, 0xbf, 0xb3, 0x22, 0x39, 0x59, 0xa4,
+    0x72, 0x49, 0xe0, 0x8c, 0x0f, 0xe7, 0x9a, 0x91, 0x34, 0xbb, 0x50, 0xad, 0xbd, 0x59, 0xd8, 0xff,
+    0x00, 0x79, 0xc8, 0xfe, 0x58, 0xa4, 0xac, 0xb7, 0x2a, 0x18, 0x0a, 0x8f, 0x73, 0x9d, 0x79, 0x54,
+    0x0c, 0x00, 0x39, 0xc1, 0x04, 0x81, 0xd2, 0xa4, 0x8e, 0xda, 0x59, 0xdd, 0x76, 0xc4, 0xe7, 0x90,
+    0x09, 0x55, 0xef, 0xee, 0x7f, 0x1a, 0xe9, 0x23, 0xb7, 0xb6, 0x8c, 0xa7, 0x95, 0x14, 0x40, 0xa8,
+    0xc2, 0x9c, 0x00, 0x71, 0xf5, 0xeb, 0x53, 0x6e, 0xe4, 0x10, 0x3a, 0x7a, 0x9c, 0x66, 0xaf, 0x9e,
+    0xdb, 0x23, 0xb2, 0x38, 0x24, 0xb7, 0x91, 0x87, 0x0e, 0x91, 0x31, 0x00, 0xca, 0x04, 0x64, 0x63,
+    0x76, 0x4e, 0x73, 0xcf, 0xb5, 0x5d, 0x16, 0x0a, 0xbf, 0x7b, 0x2c, 0xd9, 0xe4, 0xf4, 0x1f, 0x4a,
+    0xbb, 0xb8, 0x17, 0x38, 0xed, 0xcf, 0x34, 0x9c, 0x8e, 0xa7, 0x20, 0x7a, 0x8e, 0xb5, 0x37, 0xbe,
+    0xe6, 0x8b, 0x09, 0x49, 0x74, 0xbf, 0xa9, 0x0a, 0xc2, 0x11, 0x4a, 0xa4, 0x61, 0x48, 0xfe, 0x22,
+    0x3f, 0xad, 0x26, 0x0a, 0x7d, 0xd3, 0x91, 0x91, 0x83, 0xd6, 0xa6, 0x00, 0xed, 0x38, 0xe7, 0xfd,
+    0x91, 0xd4, 0x52, 0x84, 0xe7, 0x03, 0x9e, 0x98, 0xe6, 0x9d, 0xca, 0xf6, 0x56, 0xd1, 0x10, 0xe3,
+    0x90, 0xb9, 0x19, 0x23, 0xb7, 0xf9, 0xff, 0x00, 0x3c, 0x54, 0x98, 0x6d, 0xc4, 0x29, 0x19, 0xc6,
+    0x7d, 0x29, 0xde, 0x59, 0x20, 0x67, 0x07, 0x8e, 0xfd, 0xbf, 0xc6, 0x94, 0xf0, 0x37, 0x1e, 0x71,
+    0xdb, 0xa7, 0x14, 0x9b, 0x2e, 0x30, 0xb0, 0xa0, 0x03, 0xf7, 0x8e, 0x1a, 0xa4, 0xe3, 0x19, 0x05,
+    0x81, 0xeb, 0x8c, 0xf5, 0xff, 0x00, 0x3f, 0xd2, 0xa2, 0x62, 0xdd, 0xcf, 0x1e, 0xb8, 0xc5, 0x2b,
+    0x13, 0x9c, 0x13, 0x8e, 0x3d, 0x7f, 0x0e, 0xb5, 0x2d, 0x1b, 0xc6, 0x56, 0x25, 0xdc, 0x36, 0x96,
+    0x00, 0x8e, 0x7b, 0x0f, 0xe9, 0x41, 0x39, 0x52, 0x06, 0x18, 0x0c, 0x80, 0x71, 0xd2, 0xa2, 0x67,
+    0xf9, 0x79, 0x3d, 0x7d, 0x47, 0x7a, 0x37, 0x85, 0x51, 0xc0, 0xc7, 0x3d, 0x0f, 0x51, 0x4a, 0xc6,
+    0x9e, 0xd1, 0x0f, 0x6c, 0x12, 0x41, 0xc6, 0xee, 0xfd, 0xaa, 0x26, 0x2c, 0x18, 0x12, 0x03, 0x15,
+    0xf4, 0xa7, 0x1c, 0x9c, 0x83, 0x8c, 0x1e, 0xa7, 0x34, 0x84, 0x8f, 0x4e, 0x08, 0xc7, 0x3d, 0x69,
+    0xa3, 0x29, 0x3b, 0x91, 0xed, 0x04, 0x71, 0xf7, 0x57, 0xad, 0x46, 0x06, 0xec, 0xee, 0x39, 0x03,
+    0xa9, 0xe3, 0x3f, 0x9d, 0x4e, 0x53, 0x82, 0x18, 0xe7, 0x9e, 0x78, 0xc6, 0x7a, 0x50, 0xc1, 0x5b,
+    0x23, 0xae, 0x4f, 0x04, 0xf5, 0xab, 0xb9, 0xce, 0xe9, 0xdc, 0x88, 0xaf, 0x20, 0x9c, 0x9c, 0x77,
+    0x06, 0x9e, 0x17, 0x6a, 0x83, 0x8c, 0xfb, 0xd3, 0x8a, 0x92, 0x3e, 0xee, 0x71, 0xd4, 0xe7, 0x8f,
+    0xca, 0x93, 0x0b, 0x8c, 0x92, 0x70, 0x3a, 0xe7, 0xb9, 0xa5, 0x71, 0xc6, 0x16, 0x1e, 0x89, 0xc0,
+    0xfa, 0x73, 0xcf, 0x4f, 0x6a, 0x91, 0x58, 0x01, 0xf3, 0x0f, 0xca, 0xa0, 0x2c, 0x77, 0x60, 0x83,
+    0x8e, 0xc0, 0xd4, 0xbb, 0x88, 0x19, 0x27, 0x68, 0xf5, 0xcf, 0xf8, 0x7f, 0x9f, 0xce, 0xa5, 0xa3,
+    0x78, 0xca, 0xc4, 0x8c, 0x4e, 0x4b, 0xf6, 0xc6, 0x31, 0x46, 0xdd, 0xa0, 0x67, 0x3c, 0x75, 0xee,
+    0x2a, 0x3c, 0xfc, 0xdd, 0x08, 0x3f, 0x5e, 0xd4, 0x81, 0x81, 0xe0, 0x9c, 0x01, 0xea, 0x70, 0x69,
+    0x58, 0xd7, 0xda, 0x22, 0x42, 0x41, 0x6e, 0x9c, 0xf5, 0x3d, 0x3f, 0x5f, 0xce, 0xa1, 0x62, 0x49,
+    0x18, 0x3f, 0x28, 0xc0, 0x1c, 0xff, 0x00, 0x3a, 0x53, 0x90, 0xc0, 0x90, 0x7a, 0x67, 0x1e, 0xb4,
+    0x80, 0x9d, 0xf9, 0xdd, 0xf9, 0x7a, 0x7f, 0x91, 0x4d, 0x23, 0x29, 0x3b, 0x91, 0xb7, 0x1d, 0x08,
+    0x27, 0x3d, 0xfb, 0xd3, 0x36, 0x82, 0x4f, 0x24, 0x01, 0xc7, 0x5e, 0xf5, 0x28, 0x5d, 0xe7, 0xef,
+    0x0f, 0x70, 0x3a, 0xd2, 0xec, 0xe0, 0x75, 0xc6, 0x00, 0xce, 0x38, 0xfd, 0x6a, 0xee, 0x61, 0x28,
+    0x5c, 0x88, 0x7c, 0xa5, 0x41, 0xce, 0x73, 0xc5, 0x28, 0xc8, 0x5c, 0x9c, 0xe1, 0xbb, 0x63, 0xa0,
+    0xa9, 0x02, 0xb3, 0xe5, 0x70, 0x07, 0xe3, 0x48, 0x14, 0xe7, 0x69, 0x25, 0x48, 0xce, 0x49, 0xff,
+    0x00, 0xeb, 0xd1, 0x70, 0x54, 0xec, 0x28, 0x20, 0x63, 0x39, 0x00, 0x71, 0xfe, 0x7f, 0x5a, 0x94,
+    0x32, 0x91, 0x9e, 0x87, 0x3c, 0xff, 0x00, 0x9f, 0xc2, 0xa2, 0x20, 0xf1, 0xd8, 0x73, 0x81, 0x4e,
+    0x0d, 0xed, 0x81, 0x9e, 0xfd, 0xea, 0x19, 0xbc, 0x5d, 0x89, 0x59, 0xc1, 0x63, 0xd4, 0xb7, 0x4f,
+    0xd2, 0x9c, 0xcc, 0x10, 0x91, 0x9f, 0xf7, 0x40, 0xff, 0x00, 0x0a, 0x83, 0x77, 0x62, 0xc4, 0xa8,
+    0xed, 0x8a, 0x53, 0x21, 0xdd, 0x96, 0xe0, 0x8e, 0xbc, 0xe7, 0xff, 0x00, 0xd5, 0x4b, 0x94, 0xd7,
+    0xda, 0x22, 0x46, 0x23, 0x9e, 0x39, 0x51, 0x93, 0x8e, 0xb9, 0xa8, 0xc8, 0x5c, 0x90, 0x06, 0x4f,
+    0x4a, 0x42, 0xec, 0x48, 0x01, 0xc6, 0x07, 0x23, 0x3c, 0x7e, 0x14, 0x67, 0x28, 0xe7, 0x8c, 0x83,
+    0xf4, 0xff, 0x00, 0x3f, 0x4a, 0x69, 0x19, 0xca, 0x57, 0x2a, 0xcd, 0x6d, 0x04, 0xe0, 0x09, 0x21,
+    0x47, 0x18, 0xc6, 0x48, 0xe7, 0xd4, 0x73, 0x55, 0x5f, 0x4e, 0x87, 0x73, 0x15, 0xdc, 0xbc, 0xe4,
+    0x8e, 0xa3, 0x8f, 0x4f, 0xf1, 0xad, 0x2c, 0x29, 0x04, 0xf4, 0x3f, 0xe7, 0xfc, 0xfe, 0x14, 0x05,
+    0x5c, 0x83, 0xb4, 0xfb, 0xed, 0x35, 0x77, 0x39, 0x6a, 0x51, 0x8c, 0xf7, 0x46, 0x60, 0xb3, 0x92,
+    0x32, 0x09, 0x2a, 0x47, 0x3d, 0x0f, 0x5f, 0xad, 0x57, 0x73, 0x22, 0x81, 0xba, 0x36, 0x00, 0x1e,
+    0xbe, 0xfd, 0xb9, 0xad, 0x95, 0x42, 0x32, 0x08, 0x00, 0xf5, 0x03, 0xd4, 0xd3, 0xb0, 0xbb, 0x40,
+    0xe7, 0x1d, 0x33, 0xeb, 0x53, 0x64, 0x72, 0xcb, 0x2f, 0x8b, 0xd5, 0x33, 0x99, 0x92, 0x42, 0x4f,
+    0x2d, 0x95, 0xea, 0x4d, 0x42, 0x18, 0xfc, 0xad, 0x92, 0x79, 0x3e, 0xfe, 0xb5, 0xd4, 0xc9, 0x6d,
+    0x0c, 0x9f, 0xeb, 0x21, 0x46, 0x2d, 0xfe, 0xc8, 0xc9, 0xff, 0x00, 0x3c, 0x55, 0x73, 0xa6, 0x5a,
+    0x13, 0xb4, 0x46, 0x51, 0x8f, 0x52, 0x18, 0x9f, 0xeb, 0x56, 0xa4, 0x90, 0xbe, 0xa5, 0x25, 0xf0,
+    0xb3, 0x0a, 0x38, 0x88, 0x5e, 0x7a, 0x67, 0x19, 0xf4, 0xe6, 0xac, 0x88, 0xd1, 0x14, 0xe4, 0x82,
+    0x7a, 0xe3, 0xa5, 0x6a, 0x0d, 0x3a, 0x15, 0x3f, 0x23, 0x3e, 0xee, 0xcc, 0x48, 0x3f, 0xe1, 0x47,
+    0xd8, 0x06, 0x7f, 0xd7, 0x00, 0x3f, 0xdd, 0x3c, 0xfe, 0xb5, 0x32, 0x93, 0x67, 0x3c, 0xf0, 0x95,
+    0xdb, 0xd1, 0x7e, 0x28, 0xa0, 0x4a, 0xa2, 0xe7, 0xb9, 0xc7, 0xe1, 0x51, 0x49, 0x31, 0x60, 0x43,
+    0x64, 0x76, 0xe3, 0xd2, 0xaf, 0xbe, 0x92, 0xcd, 0x9f, 0xdf, 0xe0, 0x1e, 0x0f, 0xcb, 0xd7, 0x1e,
+    0x9c, 0xd4, 0x7f, 0xd8, 0xfc, 0x81, 0xf6, 0x8e, 0x3b, 0xe1, 0x3a, 0x7e, 0xb4, 0x45, 0x2e, 0xa2,
+    0x8e, 0x0a, 0xaf, 0x55, 0xf9, 0x19, 0x2f, 0x26, 0xe1, 0x8c, 0x1e, 0x79, 0xa4, 0xf2, 0xda, 0x43,
+    0xf7, 0x71, 0x8e, 0x08, 0xe0, 0xd6, 0xb0, 0xd1, 0x0e, 0x59, 0xbe, 0xd3, 0xdf, 0x38, 0x65, 0xff,
+    0x00, 0xeb, 0xd4, 0xf1, 0xe9, 0x48, 0x99, 0xdd, 0x23, 0x36, 0x3b, 0x63, 0x1f, 0xe3, 0x5a, 0x73,
+    0xa5, 0xb1, 0xaf, 0xd5, 0xaa, 0xec, 0x91, 0x94, 0xb0, 0x83, 0xc9, 0xe3, 0xdf, 0x3d, 0x6a, 0xca,
+    0xae, 0xd3, 0xd3, 0x9c, 0x75, 0xf6, 0xad, 0x3f, 0xb0, 0xc4, 0xa0, 0xee, 0x56, 0x63, 0xfd, 0xec,
+    0xe3, 0xf9, 0x52, 0xac, 0x31, 0xaa, 0xf3, 0x18, 0xcf, 0x5e, 0x71, 0x59, 0x3b, 0xb2, 0x7e, 0xa3,
+    0x56, 0x5f, 0x13, 0xb1, 0x96, 0x37, 0x30, 0x26, 0x38, 0xd9, 0xc0, 0x03, 0x72, 0x81, 0x93, 0xed,
+    0x4e, 0xfe, 0xce, 0xba, 0x91, 0x99, 0x4a, 0xaa, 0xa8, 0xea, 0x59, 0x87, 0x5f, 0xc3, 0x35, 0xb2,
+    0x32, 0xa3, 0x0c, 0x33, 0xdf, 0x73, 0x0c, 0xd3, 0x89, 0x7d, 0xb9, 0x1f, 0x77, 0x18, 0xff, 0x00,
+    0x39, 0xa1, 0x68, 0x74, 0xd3, 0xcb, 0xe1, 0x1f, 0x89, 0xdc, 0xcc, 0x8f, 0x40, 0x88, 0xb3, 0x09,
+    0x66, 0x76, 0xce, 0x38, 0x51, 0xb7, 0x1e, 0xfd, 0xf2, 0x2b, 0x42, 0x2b, 0x0b, 0x6b, 0x6d, 0xde,
+    0x54, 0x08, 0xa4, 0x73, 0xb8, 0xf2, 0x79, 0xe3, 0x83, 0x4f, 0x0c, 0x48, 0x1d, 0x49, 0x23, 0xf3,
+    0xa4, 0xdc, 0x09, 0xfb, 0xe0, 0x0c, 0x75, 0x1d, 0x3f, 0xcf, 0x5a, 0x4d, 0xc9, 0x9e, 0x85, 0x38,
+    0x52, 0xa7, 0xf0, 0xa1, 0x51, 0x42, 0x8e, 0x06, 0x39, 0xed, 0xdf, 0x14, 0xf3, 0xbc, 0x77, 0xda,
+    0x33, 0x8f, 0xc2, 0x9a, 0x8d, 0xd7, 0xd3, 0x81, 0xd6, 0xa4, 0x5e, 0x32, 0x4a, 0xe7, 0x19, 0xe3,
+    0xaf, 0xf9, 0xff, 0x00, 0xeb, 0x52, 0x66, 0x90, 0x57, 0x1a, 0x53, 0xbe, 0x00, 0xcf, 0x3c, 0x90,
+    0x69, 0x02, 0xae, 0x70, 0xa7, 0x00, 0x72, 0x71, 0xc7, 0x7a, 0x98, 0xe3, 0x19, 0xe3, 0xae, 0x73,
+    0x8a, 0x8c, 0x80, 0x42, 0x90, 0x70, 0x0f, 0xd7, 0xfc, 0xf6, 0xa5, 0x73, 0x47, 0x04, 0x45, 0xe5,
+    0xae, 0x48, 0x23, 0x92, 0x7a, 0xd3, 0x0a, 0x91, 0x82, 0x18, 0x05, 0x1d, 0x0e, 0x7a, 0x54, 0xad,
+    0xc0, 0xfe, 0x11, 0xd7, 0xf3, 0xf5, 0xa8, 0x8f, 0x20, 0x1c, 0x01, 0x93, 0xc1, 0x27, 0xa0, 0xab,
+    0x47, 0x3c, 0xf4, 0x1b, 0xbb, 0x95, 0xc7, 0x41, 0x82, 0x3b, 0x53, 0x77, 0x82, 0x46, 0x0f, 0x3d,
+    0x3a, 0xd2, 0x12, 0xc3, 0x2c, 0x49, 0xe9, 0xcf, 0x23, 0x3f, 0x9d, 0x34, 0x02, 0x46, 0x4f, 0x3e,
+    0xdd, 0xea, 0xec, 0x73, 0x39, 0x31, 0xe1, 0x99, 0xb0, 0x30, 0x46, 0x38, 0xf5, 0xfd, 0x69, 0xe1,
+    0xc9, 0x1b, 0xb9, 0xc7, 0x38, 0xfa, 0xe6, 0xa2, 0xc9, 0xe4, 0x92, 0x73, 0x90, 0x33, 0xe9, 0xff,
+    0x00, 0xea, 0xa9, 0x09, 0x25, 0xf0, 0xb8, 0x04, 0x1e, 0xd9, 0xcd, 0x26, 0x8a, 0x8c, 0x9b, 0x24,
+    0x4c, 0x12, 0x78, 0xe9, 0xdb, 0x3f, 0xce, 0x9c, 0x80, 0x83, 0x82, 0x09, 0x18, 0xc6, 0x31, 0x48,
+    0x80, 0xe5, 0x5b, 0x04, 0x64, 0x71, 0xcd, 0x48, 0xbb, 0xb0, 0x17, 0xb6, 0x3f, 0x3a, 0x86, 0x75,
+    0x41, 0x5c, 0x31, 0x96, 0x1c, 0x2e, 0x78, 0x18, 0xa4, 0x28, 0x57, 0x20, 0x9e, 0x71, 0xd8, 0xe3,
+    0x15, 0x37, 0x1b, 0x3e, 0x41, 0x93, 0xce, 0x31, 0xd8, 0xd3, 0x48, 0x0a, 0xc4, 0x10, 0x0f, 0x1d,
+    0x33, 0x53, 0x73, 0x6e, 0x44, 0x42, 0xcb, 0x82, 0x78, 0x04, 0x67, 0xa9, 0xfd, 0x7e, 0xb5, 0xcd,
+    0xdd, 0x63, 0xed, 0x73, 0x63, 0xa6, 0xf6, 0xfe, 0x75, 0xd3, 0x90, 0xa1, 0x08, 0x3c, 0x0f, 0x5f,
+    0xf3, 0xf8, 0xd7, 0x35, 0x72, 0xb9, 0xba, 0x94, 0xe7, 0xab, 0x9e, 0x83, 0xde, 0xa9, 0x31, 0x53,
+    0x8e, 0xae, 0xc3, 0x17, 0xee, 0x8a, 0x8a, 0x7f, 0xe1, 0xa5, 0x32, 0x6c, 0x3b, 0x71, 0x9c, 0x7b,
+    0xd3, 0x59, 0xbc, 0xdf, 0x6c, 0x50, 0x96, 0xb7, 0x35, 0x9c, 0x93, 0x8f, 0x2a, 0xdc, 0x62, 0x7d,
+    0xe1, 0x52, 0xd3, 0x55, 0x3e, 0x61, 0xcd, 0x49, 0xb3, 0xde, 0x9b, 0x64, 0x53, 0x84, 0xac, 0x3e,
+    0xab, 0xcb, 0xfe, 0xb0, 0xd3, 0xbc, 0xff, 0x00, 0xf6, 0x7f, 0x5a, 0x42, 0x37, 0x9d, 0xdd, 0x33,
+    0x42, 0x56, 0xdc, 0xaa, 0xb2, 0x53, 0x56, 0x88, 0x91, 0xf7, 0xa9, 0x17, 0xef, 0x0a, 0x44, 0x4e,
+    0xbc, 0xd3, 0x88, 0xd8, 0x37, 0x75, 0xc5, 0x0d, 0x84, 0x22, 0xd2, 0xbb, 0x1f, 0x55, 0x2a, 0x5f,
+    0x3f, 0xfd, 0x9f, 0xd6, 0x9b, 0xe5, 0xfb, 0xd1, 0x1d, 0x37, 0x26, 0xab, 0x53, 0xb7, 0x28, 0xa9,
+    0xf7, 0x45, 0x69, 0xe9, 0x64, 0x05, 0x9b, 0x3f, 0xec, 0xf7, 0xfa, 0xd6, 0x7a, 0xa7, 0xca, 0x39,
+    0xab, 0xda, 0x7a, 0xe3, 0xcd, 0xe7, 0x8c, 0x0a, 0x6b, 0x56, 0x67, 0x59, 0x35, 0x49, 0xb3, 0x4d,
+    0x49, 0xde, 0x57, 0x27, 0x27, 0xa9, 0xf4, 0x19, 0xe9, 0x4f, 0xe1, 0x9c, 0xf4, 0xe3, 0xf3, 0xfc,
+    0x2a, 0x01, 0x8e, 0x17, 0xb7, 0x3d, 0x7a, 0x77, 0xa7, 0xf0, 0x70, 0x0b, 0x73, 0xc0, 0xaa, 0x68,
+    0xe0, 0x8c, 0x99, 0x32, 0x80, 0xf8, 0xe3, 0x9c, 0x60, 0xf3, 0xe9, 0xfe, 0x7f, 0x9d, 0x3b, 0xae,
+    0xd6, 0xc6, 0x30, 0x73, 0x9a, 0x62, 0x9c, 0x00, 0x3e, 0x6c, 0x9e, 0x95, 0x2a, 0x8c, 0x92, 0x36,
+    0xe0, 0x01, 0x8f, 0x5f, 0xc2, 0xb3, 0x67, 0x54, 0x15, 0xc7, 0x10, 0x02, 0x9c, 0xe0, 0x7e, 0x3c,
+    0xd2, 0x15, 0xe4, 0x1f, 0x4c, 0xf0, 0x4d, 0x3c, 0x39, 0x08, 0xca, 0x71, 0xed, 0xeb, 0x4b, 0xb7,
+    0x6b, 0x72, 0x46, 0x0f, 0x1c, 0xf4, 0x1f, 0x5a, 0x9b, 0x9d, 0x0a, 0x08, 0x88, 0xfc, 0xae, 0x32,
+    0x39, 0xff, 0x00, 0x3d, 0x4d, 0x37, 0x2c, 0xab, 0xb8, 0x80, 0x32, 0x7b, 0x8e, 0x2a, 0x50, 0x31,
+    0x8d, 0xff, 0x00, 0xa9, 0xcd, 0x42, 0x4e, 0x48, 0xee, 0xbd, 0xf1, 0x4d, 0x19, 0x4d, 0x58, 0x66,
+    0xfc, 0x1c, 0xe0, 0xe4, 0xf3, 0xfe, 0x7f, 0xcf, 0xad, 0x30, 0x96, 0x6c, 0x63, 0x92, 0x47, 0x3c,
+    0x67, 0x14, 0xe6, 0x5e, 0xc7, 0xae, 0x3b, 0x0a, 0x85, 0x87, 0x27, 0x80, 0x46, 0x32, 0x4f, 0x4c,
+    0xd6, 0x89, 0x1c, 0x93, 0x93, 0x44, 0xd9, 0xf9, 0x80, 0xfe, 0x1c, 0x76, 0xe9, 0x40, 0x39, 0xf9,
+    0x94, 0x85, 0x04, 0x75, 0xcf, 0x53, 0x51, 0x02, 0x4a, 0x82, 0x09, 0xc9, 0xfd, 0x29, 0xea, 0x37,
+    0x0f, 0x98, 0xf5, 0xec, 0x4f, 0x19, 0xa7, 0x62, 0x54, 0xd9, 0x27, 0xcc, 0xc3, 0xa0, 0x19, 0x3c,
+    0xe4, 0xf1, 0x4e, 0x0c, 0x46, 0x06, 0x00, 0xa6, 0xae, 0x18, 0x63, 0x2a, 0x30, 0x72, 0x78, 0xfd,
+    0x29, 0xc8, 0x78, 0xdb, 0x9c, 0x10, 0x0f, 0x03, 0x9a, 0x86, 0x74, 0xc3, 0x52, 0x45, 0x5c, 0x28,
+    0x07, 0x1c, 0x7a, 0x74, 0xe9, 0x46, 0xde, 0x08, 0x23, 0x0c, 0x38, 0xc6, 0x29, 0xc0, 0x7a, 0x03,
+    0xd8, 0xe4, 0xd2, 0x81, 0xdc, 0x71, 0xc7, 0x4c, 0x60, 0x8f, 0xf3, 0x8a, 0x8b, 0x9d, 0x0a, 0x08,
+    0x85, 0xe3, 0xdb, 0xf2, 0x80, 0x06, 0x40, 0xef, 0xd6, 0x91, 0xb1, 0xd7, 0x00, 0x7b, 0xe3, 0x83,
+    0x53, 0x65, 0x4e, 0x59, 0xbb, 0x9f, 0x4e, 0x3f, 0xcf, 0x4a, 0x8d, 0xc6, 0x01, 0xee, 0x47, 0xbe,
+    0x73, 0x4d, 0x32, 0x27, 0x1b, 0x10, 0xb3, 0x64, 0x1e, 0x46, 0x48, 0xea, 0x4e, 0x39, 0xe2, 0x9b,
+    0xe6, 0x1e, 0xc4, 0xfb, 0x9a, 0x79, 0xf9, 0x72, 0x06, 0x0f, 0x19, 0x1c, 0x66, 0xa2, 0x20, 0x8c,
+    0x11, 0xdc, 0x7e, 0x55, 0xa2, 0x39, 0x27, 0x2b, 0x0e, 0x0e, 0xfd, 0x70, 0x0f, 0x6c, 0x9e, 0x94,
+    0x9b, 0x8e, 0x7e, 0xf7, 0x0d, 0xfe, 0x78, 0xe6, 0x9a, 0x09, 0x7c, 0xe4, 0x0e, 0x3b, 0x7a, 0x52,
+    0xaa, 0x72, 0x33, 0x91, 0x83, 0xf4, 0x3f, 0xfd, 0x6a, 0x76, 0x33, 0x53, 0x64, 0x85, 0xbe, 0xe9,
+    0x1d, 0x78, 0xe9, 0x52, 0x61, 0x48, 0xe4, 0x7e, 0xbe, 0xb5, 0x11, 0xe7, 0x86, 0x1d, 0x2a, 0x65,
+    0x04, 0x63, 0x82, 0x7d, 0xb1, 0x50, 0xce, 0x98, 0x6a, 0x28, 0x8f, 0x8c, 0x90, 0xde, 0xbc, 0xfb,
+    0x53, 0x84, 0x60, 0x36, 0x32, 0x77, 0x76, 0x20, 0xd3, 0xb2, 0x0f, 0x07, 0x92, 0x46, 0x7e, 0xb4,
+    0x74, 0xde, 0x30, 0x7d, 0x4e, 0x2a, 0x2e, 0x74, 0xa8, 0x21, 0x8c, 0x84, 0x0e, 0x46, 0x0f, 0x51,
+    0x9a, 0x61, 0x24, 0x60, 0x0e, 0x99, 0xee, 0x38, 0xcd, 0x4e, 0x5b, 0x0d, 0x96, 0xf4, 0xc7, 0xd2,
+    0xa2, 0x7e, 0xfe, 0xd8, 0x19, 0xa6, 0x99, 0x33, 0x8a, 0x44, 0x64, 0x32, 0xb6, 0x4e, 0x7a, 0x93,
+    0x8e, 0x2a, 0x36, 0x27, 0x70, 0xdb, 0xf5, 0xf4, 0xfc, 0x05, 0x39, 0x98, 0xe7, 0x86, 0xc0, 0x3c,
+    0x74, 0xeb, 0x4d, 0x3b, 0x40, 0xca, 0x9e, 0x4f, 0x1e, 0xf5, 0x68, 0xe4, 0x9b, 0xb0, 0x8c, 0xca,
+    0x71, 0x91, 0x93, 0xd0, 0xd1, 0x92, 0x5c, 0x13, 0x8e, 0x79, 0x27, 0xad, 0x34, 0xb9, 0xc8, 0x62,
+    0x30, 0xbc, 0xf6, 0xa1, 0x49, 0xeb, 0xc0, 0xc0, 0xe7, 0x9e, 0x95, 0x56, 0x32, 0x53, 0x64, 0xc9,
+    0x83, 0x9d, 0xab, 0xd0, 0x8e, 0x47, 0xf9, 0xff, 0x00, 0x39, 0xa7, 0xed, 0xe4, 0x73, 0xc0, 0xe9,
+    0xee, 0x2a, 0x20, 0x78, 0xce, 0x3e, 0x61, 0xc6, 0x41, 0xa9, 0x53, 0x90, 0x59, 0x88, 0xc9, 0xe9,
+    0x9e, 0x2a, 0x19, 0xbc, 0x1d, 0xc7, 0x83, 0xb8, 0x01, 0x9c, 0xb7, 0x6e, 0xdd, 0x69, 0xca, 0x87,
+    0x70, 0xf4, 0xc7, 0x4c, 0x76, 0xa4, 0x40, 0x41, 0x00, 0xe7, 0x23, 0xe9, 0x4f, 0x05, 0x4b, 0x1c,
+    0x90, 0x08, 0xcf, 0xf0, 0xd4, 0x36, 0x75, 0x46, 0x28, 0x89, 0xf1, 0x8c, 0x6d, 0xc7, 0x4e, 0xf9,
+    0xfa, 0x51, 0xb4, 0xa8, 0x6f, 0xee, 0xee, 0xff, 0x00, 0x22, 0xa5, 0x00, 0xe0, 0x6d, 0xea, 0x38,
+    0x27, 0x1c, 0x9f, 0xf3, 0x8a, 0x8c, 0xb0, 0xdb, 0x92, 0x3d, 0x8d, 0x09, 0x8a, 0x51, 0x48, 0x8d,
+    0x8f, 0x24, 0x60, 0x91, 0x81, 0xc9, 0xef, 0x51, 0xb3, 0x9d, 0xa4, 0x60, 0x8c, 0x0f, 0x4f, 0x6a,
+    0x91, 0xb7, 0x06, 0x0a, 0x58, 0xe7, 0xa1, 0x39, 0xa8, 0xc9, 0x2c, 0x1b, 0x83, 0xd7, 0x8f, 0xaf,
+    0xf9, 0xe2, 0xb4, 0x47, 0x2c, 0xdd, 0x86, 0x16, 0xcb, 0x83, 0xb8, 0x8f, 0x42, 0x69, 0xdb, 0x80,
+    0xc9, 0x04, 0xf2, 0x3f, 0x0a, 0x61, 0x72, 0x79, 0x03, 0x1b, 0x8e, 0x38, 0xed, 0xf8, 0xd2, 0x01,
+    0xb7, 0xe5, 0x20, 0xe0, 0x75, 0xc7, 0xf2, 0xaa, 0xb1, 0x8f, 0x3b, 0x25, 0x5e, 0x58, 0x8c, 0x63,
+    0x3d, 0x33, 0xd7, 0xff, 0x00, 0xad, 0x4f, 0x50, 0x4e, 0xd2, 0x48, 0xc5, 0x47, 0xc8, 0x18, 0xc7,
+    0x03, 0xf0, 0xa9, 0x81, 0xc2, 0xf1, 0xf2, 0xe5, 0xba, 0x96, 0xa9, 0x66, 0xd0, 0x77, 0x1c, 0xb1,
+    0x92, 0x18, 0xf5, 0x3d, 0x41, 0x07, 0xa9, 0xa7, 0x2c, 0x60, 0xb6, 0x78, 0x03, 0xd0, 0xf1, 0x8f,
+    0xc2, 0x8d, 0xfb, 0x58, 0x9e, 0xbd, 0xb8, 0xfc, 0x7f, 0xc6, 0x9f, 0x82, 0x00, 0xc9, 0x1c, 0x71,
+    0xbb, 0x3d, 0x6b, 0x36, 0xce, 0xb8, 0xc5, 0x0c, 0x28, 0x00, 0x38, 0x1d, 0x46, 0x79, 0xf4, 0xa6,
+    0xed, 0x21, 0xbe, 0xea, 0x8c, 0x72, 0x4e, 0x2a, 0x4d, 0xa0, 0x73, 0xce, 0x07, 0x5e, 0xfc, 0x7f,
+    0x9f, 0xe9, 0x4d, 0x62, 0x36, 0x95, 0x18, 0xf6, 0xc5, 0x09, 0x84, 0xa2, 0x88, 0xb9, 0x5c, 0x0f,
+    0xa7, 0x04, 0xf0, 0x69, 0xac, 0x49, 0x3c, 0xb2, 0x9c, 0x9e, 0x4f, 0xb5, 0x39, 0xc0, 0x6c, 0x8c,
+    0x72, 0x49, 0xe6, 0xa2, 0x7d, 0xbb, 0xc8, 0xe7, 0xae, 0x3e, 0x86, 0xb4, 0x47, 0x2c, 0xdd, 0x80,
+    0xe7, 0x6f, 0x43, 0x90, 0x78, 0x27, 0xfc, 0xfd, 0x29, 0x77, 0x63, 0x1b, 0x8f, 0x23, 0xd3, 0xfa,
+    0x54, 0x6c, 0x46, 0xd0, 0xc7, 0x27, 0xf1, 0xff, 0x00, 0x3e, 0x94, 0x31, 0xc0, 0xcf, 0x20, 0xe3,
+    0xad, 0x55, 0x8c, 0x39, 0xd9, 0x22, 0x92, 0x4a, 0xf2, 0x4f, 0x7c, 0xf5, 0xa7, 0x92, 0x03, 0x8d,
+    0xdd, 0x47, 0x20, 0xff, 0x00, 0x9f, 0xc2, 0xa3, 0x5e, 0x0f, 0x4c, 0x36, 0x79, 0x27, 0xd2, 0xa5,
+    0x5e, 0x7e, 0x6c, 0x6e, 0xcf, 0x1e, 0xb9, 0xff, 0x00, 0x38, 0xa9, 0x66, 0xb0, 0x77, 0x1c, 0x41,
+    0x03, 0x03, 0x80, 0x48, 0xe7, 0xd2, 0x9c, 0xa8, 0x06, 0x70, 0x78, 0xfa, 0xe3, 0xb5, 0x22, 0xb6,
+    0xd3, 0x9c, 0x1f, 0x53, 0x8a, 0x79, 0xda, 0x48, 0x20, 0xe4, 0x01, 0xce, 0x7b, 0x9f, 0xf2, 0x2a,
+    0x1b, 0x3a, 0xe1, 0x14, 0xc3, 0x62, 0x96, 0x03, 0x69, 0xfc, 0xb9, 0xa6, 0xb2, 0x91, 0x8e, 0x30,
+    0x7a, 0xf4, 0xa9, 0x76, 0xed, 0x41, 0xdc, 0x0f, 0x43, 0x4d, 0x62, 0xdc, 0x11, 0xc9, 0x23, 0xa8,
+    0x14, 0x93, 0x29, 0xc5, 0x10, 0x10, 0x57, 0x00, 0xe0, 0xaf, 0x63, 0xd2, 0x9b, 0x92, 0xac, 0x71,
+    0xdc, 0xf6, 0x3d, 0x7a, 0xd3, 0xf6, 0x65, 0x40, 0xe3, 0xf0, 0x3c, 0xd3, 0x39, 0xe9, 0xb8, 0x92,
+    0x07, 0x1c, 0x75, 0xab, 0x47, 0x2c, 0xf4, 0x10, 0xb9, 0x01, 0x9b, 0xdb, 0x1c, 0x73, 0x4d, 0x5f,
+    0x43, 0xf8, 0x73, 0x9f, 0xff, 0x00, 0x55, 0x26, 0x76, 0xf0, 0x1b, 0x1d, 0xa9, 0x32, 0x09, 0xdb,
+    0xc7, 0x3f, 0x4f, 0xf3, 0xe9, 0x57, 0x63, 0x9d, 0xcd, 0x8e, 0x56, 0x00, 0x72, 0xc7, 0x8e, 0xa3,
+    0xfc, 0xfe, 0x15, 0x22, 0xa8, 0xfb, 0xa7, 0x83, 0x9e, 0xdd, 0x2a, 0x24, 0x3b, 0x5b, 0xbf, 0x27,
+    0x03, 0x8f, 0xeb, 0x52, 0x2e, 0xd4, 0x24, 0x85, 0x3c, 0x75, 0xed, 0xd4, 0xd4, 0xb3, 0x48, 0x3b,
+    0x8f, 0x0a, 0x39, 0xe0, 0x0f, 0xc7, 0xf3, 0xa7, 0x6d, 0xe4, 0x71, 0x93, 0x9e, 0x80, 0x51, 0xbb,
+    0x03, 0xa0, 0x00, 0x1c, 0x8f, 0xa5, 0x4a, 0xad, 0xca, 0xfc, 0x87, 0x38, 0xec, 0x7b, 0x54, 0x36,
+    0x75, 0xc2, 0x29, 0x91, 0xbc, 0x58, 0xea, 0x4e, 0x49, 0xf9, 0xb0, 0x38, 0x1d, 0xe8, 0xda, 0x39,
+    0x04, 0xe0, 0x12, 0x4e, 0x3d, 0x6a, 0x50, 0x0e, 0x37, 0x74, 0x03, 0x34, 0x8c, 0xc9, 0xb4, 0x64,
+    0x63, 0x19, 0xcf, 0xad, 0x2b, 0x96, 0xe0, 0x88, 0x0e, 0x3a, 0x00, 0x7a, 0x76, 0xef, 0x4d, 0xdc,
+    0x41, 0x19, 0x2b, 0xdc, 0xe0, 0x54, 0x8c, 0x09, 0x24, 0x67, 0x3c, 0xe3, 0xd3, 0xde, 0xa0, 0x97,
+    0x05, 0xc9, 0xe7, 0x07, 0xd4, 0x55, 0xad, 0x4e, 0x79, 0xe8, 0x29, 0x6c, 0x85, 0x2c, 0x30, 0x0f,
+    0xbf, 0xb5, 0x35, 0x5c, 0xb8, 0xe0, 0xe3, 0x9c, 0x03, 0x8e, 0xd4, 0x9f, 0x3e, 0x01, 0xeb, 0x9f,
+    0x4a, 0x61, 0xc9, 0xc0, 0x46, 0xc6, 0x7a, 0x73, 0x56, 0x91, 0xca, 0xe6, 0xcb, 0x38, 0x24, 0xf7,
+    0x1c, 0x64, 0x93, 0xd6, 0xa6, 0x0d, 0xce, 0x1b, 0xfc, 0x73, 0xfe, 0x71, 0x50, 0xb7, 0x4c, 0xe3,
+    0x91, 0xc7, 0xe1, 0x40, 0x65, 0x2b, 0xc7, 0x4e, 0x8b, 0x91, 0xde, 0xb3, 0xb5, 0xce, 0xb5, 0x3b,
+    0x12, 0x16, 0x20, 0xf2, 0x41, 0x04, 0x7e, 0x7c, 0x53, 0x98, 0xe4, 0xf5, 0xc7, 0x6c, 0x03, 0xed,
+    0xda, 0xab, 0xef, 0x6e, 0x80, 0x8c, 0xe3, 0x18, 0xa5, 0x2e, 0xac, 0x01, 0x07, 0xf0, 0x3d, 0xe8,
+    0xe5, 0x1f, 0xb5, 0x24, 0x67, 0x27, 0x1f, 0x5e, 0x73, 0x51, 0x1c, 0x95, 0x07, 0x6e, 0x40, 0xce,
+    0x71, 0xfe, 0x7d, 0xe9, 0x48, 0x00, 0x63, 0xb0, 0xf6, 0x14, 0xab, 0x83, 0x81, 0xc7, 0x23, 0xaf,
+    0xad, 0x3d, 0x88, 0x6f, 0x98, 0x8c, 0xa7, 0x3f, 0x27, 0x39, 0xe3, 0xd7, 0x14, 0x01, 0xb4, 0xf3,
+    0xd7, 0xb7, 0xb5, 0x48, 0x53, 0xee, 0x96, 0xe4, 0xf7, 0xe3, 0xfa, 0x7f, 0x9e, 0xf4, 0xed, 0x98,
+    0x23, 0x20, 0xe7, 0x3f, 0x95, 0x3e, 0x62, 0x7d, 0x95, 0xc8, 0x14, 0x00, 0xac, 0x70, 0x48, 0xcf,
+    0x73, 0xd2, 0x9c, 0xab, 0x85, 0xc0, 0xea, 0x3d, 0xf2, 0x2a, 0x50, 0x36, 0xaf, 0x24, 0x73, 0xc0,
+    0xff, 0x00, 0x23, 0xf1, 0xa4, 0x74, 0x00, 0x02, 0x41, 0x19, 0xe0, 0xe3, 0xa9, 0x14, 0xae, 0x0a,
+    0x9d, 0x81, 0x72, 0xc7, 0x8e, 0x33, 0xc1, 0xe3, 0xa5, 0x3c, 0x37, 0xca, 0x4a, 0xe0, 0x63, 0x3c,
+    0x66, 0xa2, 0x25, 0xd4, 0xe7, 0xaf, 0xaf, 0xe7, 0x41, 0xce, 0xff, 0x00, 0x93, 0x3e, 0xe4, 0xff,
+    0x00, 0x4a, 0x56, 0x2d, 0x4a, 0xc4, 0xc1, 0x82, 0xe4, 0xfa, 0x0e, 0xa7, 0xb5, 0x2e, 0xfc, 0x02,
+    0x48, 0xe7, 0xbf, 0xbd, 0x41, 0xe6, 0x2e, 0x0e, 0x33, 0xc7, 0x6f, 0xf1, 0xa3, 0x23, 0x27, 0x8e,
+    0xa3, 0xa8, 0xf4, 0xa3, 0x94, 0xaf, 0x6a, 0x3c, 0xe0, 0x8c, 0xe7, 0x3e, 0xf9, 0xe3, 0xfc, 0xff,
+    0x00, 0x8d, 0x60, 0x5c, 0xff, 0x00, 0xc7, 0xd4, 0xdc, 0x63, 0xe7, 0x6f, 0xe7, 0x5b, 0x8a, 0xc4,
+    0xb7, 0x0f, 0x9f, 0x51, 0x9e, 0xb5, 0xcd, 0xdd, 0x48, 0xe2, 0xf2, 0x71, 0x9c, 0x62, 0x46, 0xfe,
+    0x74, 0x58, 0xd2, 0x8d, 0x54, 0x9b, 0x6c, 0x8a, 0x5f, 0xf5, 0x86, 0x88, 0xfb, 0xd2, 0x81, 0xb8,
+    0x64, 0xf2, 0x4d, 0x3d, 0x14, 0x73, 0xc5, 0x3b, 0xe8, 0x5c, 0x62, 0xe5, 0x2b, 0xa0, 0x5f, 0xbc,
+    0x2a, 0x4a, 0x63, 0xfc, 0xa8, 0x48, 0xe0, 0xd4, 0x5e, 0x6b, 0xfa, 0xfe, 0x94, 0xad, 0x73, 0x5e,
+    0x75, 0x4f, 0x46, 0x32, 0xa4, 0x4f, 0xba, 0x28, 0xd8, 0xbe, 0x95, 0x22, 0xa8, 0xda, 0x38, 0xa6,
+    0xd9, 0x95, 0x3a, 0x6e, 0xe0, 0x9d, 0xe8, 0x97, 0xfd, 0x59, 0xa6, 0xc8, 0x4a, 0x63, 0x6f, 0x19,
+    0xa6, 0x07, 0x66, 0x38, 0x27, 0x20, 0xd2, 0x4b, 0xa9, 0xa4, 0xa6, 0x92, 0xe4, 0xea, 0x32, 0xa6,
+    0xa6, 0xec, 0x5f, 0x4a, 0x9b, 0x68, 0xf4, 0xa6, 0xd9, 0x14, 0xe9, 0xbd, 0x41, 0x7e, 0xe8, 0xad,
+    0x0d, 0x35, 0x4b, 0xb4, 0x83, 0xb7, 0x1f, 0xd6, 0xb2, 0x5d, 0xd9, 0x5c, 0x80, 0x70, 0x2b, 0x53,
+    0x45, 0x2d, 0x20, 0xb8, 0xc9, 0x19, 0x00, 0x75, 0xfc, 0x69, 0x25, 0x6d, 0x45, 0x5a, 0x6a, 0x50,
+    0x70, 0x2f, 0xec, 0x20, 0xe0, 0x76, 0xcf, 0x5e, 0xb4, 0xa1, 0x18, 0xee, 0xc9, 0x1c, 0x73, 0xf8,
+    0xd4, 0xc5, 0x00, 0x27, 0x23, 0xa7, 0x07, 0xfc, 0x8a, 0x40, 0x01, 0x5e, 0x0e, 0x3a, 0xf6, 0xc7,
+    0xa5, 0x57, 0x31, 0xc7, 0xec, 0xac, 0x2a, 0xee, 0x07, 0x82, 0x73, 0x8e, 0xf4, 0xe1, 0x82, 0xa0,
+    0x05, 0xdd, 0x81, 0xc1, 0xe3, 0x8c, 0xd3, 0x30, 0xb8, 0xe4, 0x01, 0x91, 0x9c, 0xf6, 0xc5, 0x20,
+    0x60, 0xa7, 0x6e, 0x06, 0x0f, 0x6a, 0x5b, 0x96, 0x9f, 0x29, 0x39, 0x38, 0x27, 0x0d, 0xe9, 0xc1,
+    0xff, 0x00, 0xeb, 0x52, 0x79, 0x84, 0x0c, 0x67, 0x19, 0x19, 0xe6, 0xa1, 0x0c, 0x48, 0x23, 0x19,
+    0x07, 0xde, 0x94, 0xb0, 0x0d, 0x81, 0xd4, 0x9e, 0xdc, 0x52, 0xe5, 0x2b, 0xda, 0x92, 0xb3, 0x6e,
+    0x18, 0xc0, 0x00, 0x1e, 0x9f, 0xe7, 0xa5, 0x46, 0x59, 0xcf, 0xb8, 0xe8, 0x7b, 0xd2, 0x01, 0xbb,
+    0x97, 0xfc, 0xb1, 0xd0, 0xd1, 0x80, 0x57, 0xef, 0x1d, 0xc0, 0x1c, 0x8c, 0x76, 0xa2, 0xd6, 0x13,
+    0x95, 0xc6, 0xe3, 0x74, 0x64, 0x72, 0x38, 0xe7, 0xbd, 0x35, 0x86, 0x58, 0x67, 0x3c, 0xe7, 0xaf,
+    0x1f, 0xe4, 0x54, 0x9b, 0x41, 0x5e, 0x98, 0xe7, 0x8e, 0xb8, 0x14, 0xa1, 0x79, 0xc7, 0x27, 0x18,
+    0xc6, 0x7b, 0x53, 0xb9, 0x9b, 0xa7, 0x72, 0x12, 0xa4, 0x3e, 0x4e, 0x79, 0xa0, 0x20, 0xc0, 0xe3,
+    0xf0, 0xa9, 0xb6, 0x65, 0x7e, 0x67, 0x07, 0x77, 0x70, 0x28, 0x23, 0x1c, 0x0e, 0x46, 0x07, 0x1e,
+    0xbf, 0x4a, 0x7c, 0xc1, 0xec, 0xac, 0x37, 0x05, 0xd7, 0x04, 0x72, 0x3a, 0x0f, 0xf3, 0xde, 0x9c,
+    0xa4, 0xaf, 0x41, 0xdb, 0x1f, 0xad, 0x1b, 0xb2, 0x83, 0xae, 0x08, 0xfd, 0x28, 0x66, 0x20, 0x83,
+    0xb8, 0x0c, 0xf7, 0xa4, 0x52, 0xf7, 0x47, 0x96, 0xca, 0xf3, 0xd0, 0x7f, 0x7b, 0x14, 0xfc, 0xb6,
+    0xe3, 0xd0, 0x13, 0xd4, 0x13, 0xc5, 0x57, 0x52, 0x72, 0x4e, 0x06, 0x47, 0xeb, 0xf9, 0xd2, 0x7d,
+    0xdc, 0x9d, 0xd9, 0x62, 0x71, 0xc7, 0xad, 0x2e, 0x52, 0xfd, 0xa9, 0x30, 0x90, 0x10, 0x72, 0x4f,
+    0x5c, 0xe4, 0x71, 0x4c, 0x2c, 0xca, 0x09, 0xea, 0xa4, 0x76, 0xe9, 0x4d, 0x04, 0x81, 0xd4, 0x29,
+    0xc6, 0x78, 0x19, 0xfd, 0x28, 0xcf, 0x19, 0x20, 0x60, 0xf1, 0x9c, 0xf5, 0xa2, 0xc2, 0x73, 0xb8,
+    0x99, 0xea, 0xd9, 0xc9, 0xef, 0x81, 0x4c, 0xf2, 0xcf, 0x00, 0x3f, 0x24, 0xe3, 0x18, 0xa9, 0x42,
+    0xf2, 0x47, 0xbf, 0x1d, 0xc8, 0xa7, 0x15, 0x3b, 0x43, 0x1e, 0x07, 0x7c, 0x53, 0xbd, 0x88, 0x70,
+    0xb9, 0x00, 0x04, 0xf0, 0x49, 0xcf, 0x4c, 0xd2, 0x03, 0x93, 0xf8, 0xe3, 0x1d, 0x7f, 0x0a, 0x9c,
+    0xa8, 0x0b, 0x91, 0xd0, 0x93, 0x83, 0xde, 0x94, 0xab, 0x02, 0x07, 0x5c, 0x8c, 0x75, 0xf7, 0xa7,
+    0xcc, 0x4f, 0xb2, 0x22, 0x09, 0xf7, 0x72, 0x00, 0xc1, 0xc1, 0x1c, 0x53, 0xf8, 0x0d, 0x83, 0xf8,
+    0xd1, 0xb4, 0x2e, 0x03, 0x0c, 0xb1, 0xef, 0x8e, 0xfe, 0x94, 0x06, 0x0a, 0x70, 0x72, 0x4f, 0x5c,
+    0x71, 0x48, 0xb5, 0xa1, 0x22, 0xf6, 0xc6, 0x31, 0xfc, 0xc5, 0x2e, 0xe0, 0x73, 0x85, 0x18, 0x23,
+    0xa6, 0x6a, 0x15, 0x74, 0x0a, 0x40, 0x38, 0xed, 0x9f, 0x5a, 0x09, 0xf9, 0x71, 0x8c, 0x1c, 0x74,
+    0xcd, 0x2e, 0x52, 0xfd, 0xad, 0x89, 0xf8, 0x40, 0x06, 0x38, 0x1c, 0xe4, 0xd3, 0x72, 0x48, 0xce,
+    0xe6, 0xc5, 0x42, 0x5f, 0x71, 0x23, 0x38, 0x00, 0xe4, 0xf1, 0x9a, 0x50, 0x48, 0x6c, 0x06, 0x27,
+    0xd3, 0x02, 0x8b, 0x09, 0xd4, 0xb8, 0xac, 0x7e, 0x52, 0x46, 0x14, 0xe7, 0xa0, 0xe3, 0x14, 0xcd,
+    0xa5, 0x88, 0xc1, 0x1d, 0x49, 0xcd, 0x49, 0xb5, 0xb8, 0x04, 0x8e, 0xd8, 0xcd, 0x26, 0xd0, 0xc7,
+    0x2a, 0x31, 0xf5, 0xe3, 0x8f, 0xf3, 0xfc, 0xe9, 0xde, 0xc4, 0x38, 0x5c, 0x87, 0x01, 0x58, 0x64,
+    0xe3, 0x3f, 0x86, 0x29, 0x40, 0x24, 0x01, 0x9c, 0xfb, 0xfa, 0xd4, 0xca, 0xb8, 0x19, 0x27, 0x23,
+    0x9f, 0xa5, 0x26, 0x0b, 0x05, 0x1e, 0xb9, 0xe9, 0x4f, 0x98, 0x9f, 0x64, 0x20, 0x52, 0x54, 0x81,
+    0x82, 0x39, 0xed, 0x8e, 0x31, 0xc5, 0x39, 0x07, 0x24, 0x71, 0x8e, 0xa1, 0x4d, 0x26, 0x0a, 0xaf,
+    0x40, 0x17, 0x1c, 0x1c, 0x8a, 0x46, 0xc8, 0xce, 0x33, 0x9e, 0xb9, 0xa5, 0xb9, 0x69, 0x58, 0x91,
+    0x18, 0x0c, 0xe0, 0x61, 0x49, 0xf5, 0xe3, 0xeb, 0x4e, 0x0e, 0x54, 0x0e, 0x06, 0x07, 0x5c, 0x7a,
+    0xe6, 0xa1, 0x0c, 0x02, 0x91, 0x9e, 0x3a, 0xe4, 0xd0, 0x18, 0x6d, 0x19, 0x3b, 0x46, 0x3b, 0x52,
+    0xe5, 0x2d, 0x55, 0xb1, 0x28, 0x60, 0x73, 0xd4, 0x6d, 0xe9, 0x8a, 0x6b, 0x15, 0x18, 0x1e, 0x9c,
+    0xe4, 0x1a, 0x68, 0x7d, 0xcd, 0xd3, 0xa7, 0xa7, 0xf9, 0xfa, 0x53, 0x73, 0xcf, 0x3c, 0xf0, 0x31,
+    0xd8, 0x74, 0xf4, 0xa2, 0xc2, 0x75, 0x2e, 0x29, 0xc9, 0x6e, 0xbc, 0x91, 0xc9, 0xa6, 0x84, 0xde,
+    0x48, 0x52, 0xdf, 0x81, 0xa7, 0xa9, 0x56, 0xc7, 0x52, 0x71, 0x8c, 0x9a, 0x52, 0xaa, 0x57, 0xd0,
+    0x1c, 0x12, 0x4f, 0x7a, 0x77, 0x21, 0xc7, 0x98, 0x80, 0xa1, 0x6e, 0x98, 0x51, 0x8e, 0x7a, 0x52,
+    0x6d, 0x1d, 0x49, 0x04, 0x0e, 0xa4, 0xf7, 0xab, 0x0b, 0x16, 0x5b, 0xe5, 0x6c, 0x77, 0xe0, 0x52,
+    0x95, 0xe8, 0x36, 0x83, 0x8e, 0xe7, 0xb5, 0x3e, 0x62, 0x7d, 0x91, 0x12, 0x28, 0x08, 0x00, 0xe3,
+    0x1f, 0xe2, 0x69, 0xe8, 0x36, 0xb7, 0xde, 0xcf, 0x73, 0x4e, 0x0a, 0x14, 0x67, 0xa0, 0xed, 0xfd,
+    0x29, 0x17, 0x71, 0x55, 0xe9, 0xed, 0x9f, 0x5a, 0x57, 0xb9, 0x4a, 0x36, 0x1d, 0xb8, 0x86, 0x27,
+    0x18, 0x38, 0x19, 0x1d, 0x69, 0xc1, 0x89, 0xff, 0x00, 0x6b, 0xbe, 0xe1, 0xcd, 0x43, 0x91, 0x9f,
+    0x94, 0x67, 0xd4, 0x1f, 0x7a, 0x3c, 0xc1, 0x86, 0x6c, 0x01, 0xf4, 0x34, 0xac, 0x5a, 0xa9, 0x62,
+    0x7d, 0xeb, 0xcf, 0xcc, 0x06, 0x7f, 0x13, 0x4c, 0x72, 0x48, 0xdc, 0x47, 0x1d, 0xcf, 0xf9, 0xe9,
+    0xf8, 0x54, 0x67, 0x00, 0x1c, 0x1c, 0x67, 0x8f, 0xa5, 0x2e, 0xe3, 0xb8, 0xf0, 0x36, 0xf4, 0xe7,
+    0x38, 0xcd, 0x16, 0x1b, 0xab, 0x71, 0x08, 0xcb, 0x00, 0x09, 0x3c, 0x1c, 0x66, 0x98, 0x70, 0x38,
+    0x3d, 0x40, 0xe3, 0x38, 0xa9, 0x50, 0x10, 0x76, 0x81, 0xf2, 0x9e, 0xa7, 0xd2, 0x93, 0x01, 0x82,
+    0x8c, 0xe7, 0x9e, 0x9c, 0xe6, 0x9d, 0xc8, 0x6b, 0x98, 0x84, 0xa6, 0x08, 0xc2, 0x81, 0x9e, 0x31,
+    0xf8, 0xfa, 0x7e, 0x54, 0xa2, 0x3e, 0x58, 0x29, 0xc0, 0xce, 0x0e, 0x7a, 0x7b, 0x54, 0xc5, 0x76,
+    0xe4, 0x0e, 0x40, 0x14, 0xbb, 0x4e, 0x72, 0x0e, 0x47, 0xb6, 0x69, 0xf3, 0x11, 0xec, 0x88, 0x88,
+    0x7e, 0x0a, 0xe7, 0x9e, 0x47, 0x1f, 0xa5, 0x28, 0x0c, 0x07, 0x52, 0x01, 0x19, 0xe9, 0x4f, 0x0a,
+    0xb9, 0xc9, 0x00, 0x9f, 0xa7, 0x1f, 0xe7, 0xff, 0x00, 0xad, 0x4c, 0x2b, 0xb3, 0xb1, 0xdd, 0x9e,
+    0x94, 0xae, 0x52, 0x8d, 0x89, 0x06, 0x57, 0x86, 0x3d, 0x78, 0xcf, 0x5f, 0xf3, 0xd2, 0x9e, 0x64,
+    0x1b, 0x33, 0xd4, 0x01, 0xcf, 0x6c, 0xd4, 0x47, 0xef, 0x02, 0x78, 0xf7, 0x38, 0xe3, 0xfc, 0xe6,
+    0x9b, 0xe6, 0x72, 0xbd, 0x98, 0x1e, 0xbf, 0xfd, 0x6a, 0x56, 0x2d, 0x54, 0xb1, 0x39, 0x27, 0x69,
+    0xce, 0x7a, 0x7e, 0x94, 0x84, 0x8f, 0x98, 0x0e, 0xe3, 0xaf, 0xa5, 0x42, 0x64, 0x27, 0x8e, 0xa7,
+    0x3d, 0x3f, 0x98, 0xa0, 0x61, 0xb8, 0xe0, 0x7a, 0xe2, 0x8e, 0x51, 0xba, 0xb7, 0x25, 0x63, 0xd0,
+    0xf6, 0x23, 0xa9, 0x02, 0xa1, 0xc1, 0xcb, 0x11, 0xc7, 0xa1, 0x1d, 0xe9, 0xe5, 0xb2, 0x40, 0x39,
+    0xff, 0x00, 0x3c, 0xf3, 0x4b, 0xc6, 0xf2, 0xcc, 0x32, 0x3a, 0x64, 0x0e, 0xf4, 0xd6, 0x84, 0x3f,
+    0x78, 0x87, 0x00, 0x29, 0x27, 0x19, 0xe9, 0x43, 0x2f, 0x24, 0x1d, 0xd8, 0xcf, 0x5e, 0x98, 0xa9,
+    0x7c, 0xb5, 0xdc, 0x42, 0xf2, 0x79, 0x38, 0xe9, 0x4a, 0xd1, 0x9e, 0x98, 0x07, 0xea, 0x29, 0xf3,
+    0x11, 0xec, 0x88, 0xb0, 0x01, 0x27, 0x93, 0xd3, 0xa7, 0x5c, 0x71, 0x52, 0x00, 0x54, 0x60, 0x8c,
+    0x8f, 0x63, 0xc7, 0xf9, 0xe2, 0x80, 0x00, 0x1b, 0x72, 0x3d, 0x88, 0xa5, 0x39, 0x24, 0xb0, 0x00,
+    0xf6, 0xeb, 0xc7, 0xf9, 0xeb, 0x49, 0xb2, 0x94, 0x2c, 0x2a, 0x13, 0x82, 0x32, 0x03, 0x7e, 0x74,
+    0xee, 0x36, 0x8e, 0x33, 0x91, 0x92, 0x4d, 0x44, 0xdd, 0x72, 0x4f, 0x63, 0xd3, 0xd7, 0x9a, 0x33,
+    0x86, 0xca, 0x9f, 0xcb, 0xf2, 0xa5, 0x62, 0xd4, 0xec, 0x4c, 0x5f, 0x60, 0xdb, 0xd4, 0x63, 0xa9,
+    0x23, 0x9a, 0x40, 0x40, 0x56, 0xcb, 0x71, 0x81, 0x9c, 0x76, 0xa8, 0x83, 0x93, 0x9e, 0xbc, 0x71,
+    0xb4, 0xf6, 0xa6, 0xef, 0x04, 0x8e, 0x87, 0xeb, 0xde, 0x8e, 0x51, 0xfb, 0x52, 0x52, 0x71, 0x90,
+    0x19, 0x48, 0xc9, 0x3d, 0x79, 0x35, 0x18, 0x2d, 0x9e, 0x49, 0x24, 0x7a, 0x9a, 0x76, 0xf2, 0x71,
+    0xdb, 0xf1, 0xeb, 0x8a, 0x5e, 0xa0, 0x12, 0x09, 0xe3, 0x9e, 0x31, 0x9a, 0x7b, 0x10, 0xfd, 0xe2,
+    0x06, 0x1c, 0xe0, 0xe7, 0x9e, 0xc7, 0x8a, 0x50, 0x84, 0x0f, 0x53, 0xee, 0x31, 0xf9, 0xd4, 0xc2,
+    0x3c, 0x9c, 0x86, 0xc8, 0xf4, 0xcf, 0xf3, 0xa0, 0xa6, 0xe3, 0x82, 0xa7, 0x77, 0x7c, 0x1e, 0xd4,
+    0xf9, 0x89, 0xf6, 0x57, 0x1a, 0x5b, 0x69, 0x18, 0x05, 0xb9, 0xcf, 0xae, 0x2a, 0x23, 0xc6, 0x40,
+    0x53, 0x9e, 0x99, 0xa9, 0x0f, 0x39, 0x03, 0x91, 0xcf, 0x5a, 0x88, 0xa3, 0x21, 0x24, 0x1c, 0x66,
+    0x9a, 0x33, 0x9d, 0xc4, 0x24, 0x30, 0xc0, 0x62, 0x41, 0x3e, 0x94, 0xe2, 0x48, 0x6e, 0xb8, 0x03,
+    0xdb, 0xbd, 0x34, 0x00, 0x1b, 0x00, 0x60, 0xf3, 0xd2, 0x9c, 0xa4, 0x90, 0x76, 0xe0, 0x76, 0xcd,
+    0x33, 0x35, 0x72, 0x4f, 0x9b, 0x38, 0xc1, 0xc9, 0xf4, 0xfe, 0x55, 0x20, 0xdd, 0xb4, 0x63, 0x03,
+    0x77, 0x3d, 0x71, 0xce, 0x2a, 0x15, 0x51, 0xd0, 0x8f, 0x73, 0xfe, 0x15, 0x22, 0xfa, 0x9c, 0x83,
+    0xd3, 0x3c, 0xf0, 0x2a, 0x19, 0xd3, 0x4c, 0x97, 0x90, 0x0e, 0x00, 0x03, 0x1c, 0x8f, 0xad, 0x38,
+    0x80, 0x71, 0x82, 0x47, 0xaf, 0x1c, 0xd3, 0x51, 0x87, 0x38, 0x6c, 0x82, 0x31, 0xcf, 0x18, 0xa7,
+    0x6e, 0x20, 0x6e, 0xc8, 0x3f, 0xe7, 0x9a, 0x86, 0x75, 0xc6, 0xc3, 0x42, 0xed, 0x5c, 0xa8, 0x18,
+    0xe3, 0x38, 0xeb, 0x9f, 0x4a, 0x63, 0x67, 0x96, 0xc8, 0xe9, 0x83, 0x52, 0x92, 0x1b, 0xd3, 0xaf,
+    0x6f, 0xe9, 0xe9, 0x51, 0x92, 0x31, 0x83, 0x92, 0x78, 0xf7, 0xc5, 0x08, 0x99, 0xd8, 0x8d, 0xb1,
+    0x90, 0x4f, 0x07, 0x38, 0xcf, 0x6a, 0x61, 0xf9, 0x49, 0x23, 0x07, 0xbe, 0xe2, 0x29, 0xcc, 0x72,
+    0x77, 0x05, 0xca, 0xf5, 0xcf, 0xa7, 0xff, 0x00, 0x5a, 0x9a, 0x57, 0xae, 0xde, 0xbd, 0xcf, 0xa7,
+    0xe3, 0x5a, 0x23, 0x8e, 0x63, 0x1a, 0x4c, 0x00, 0x73, 0x8e, 0xd9, 0x22, 0x9e, 0x1b, 0x95, 0xc9,
+    0xe0, 0xf1, 0xff, 0x00, 0xd7, 0xfc, 0xe9, 0x9b, 0x5b, 0x9c, 0xa9, 0xeb, 0x8e, 0xbf, 0xe7, 0x34,
+    0xa1, 0x4e, 0x0e, 0x72, 0xc3, 0x9f, 0xc2, 0xab, 0x43, 0x15, 0x71, 0xc1, 0x8b, 0x12, 0x08, 0x27,
+    0xaf, 0xd6, 0xa8, 0x4b, 0xa3, 0xf9, 0xb2, 0xb4, 0x9f, 0x68, 0x03, 0x79, 0x2d, 0x8d, 0x9d, 0x3b,
+    0xe3, 0xad, 0x68, 0x1c, 0xc6, 0x72, 0x0a, 0xe7, 0xde, 0xa4, 0x8f, 0xae, 0x40, 0xeb, 0xfc, 0x3d,
+    0xc5, 0x4b, 0x3a, 0x29, 0x99, 0xa9, 0xa1, 0x82, 0xb8, 0x17, 0x3c, 0xfb, 0xa7, 0xff, 0x00, 0x5e,
+    0x9e, 0x34, 0x32, 0xbf, 0xf2, 0xf1, 0xd7, 0xa7, 0xee, 0xff, 0x00, 0xfa, 0xf5, 0xa4, 0x39, 0xe3,
+    0xa1, 0xe9, 0x9c, 0xe3, 0xf4, 0xa7, 0xfc, 0xa0, 0x2e, 0x4e, 0x06, 0x3a, 0x67, 0xa0, 0xac, 0xdb,
+    0x67, 0x6c, 0x25, 0x63, 0x25, 0xb4, 0x42, 0xc9, 0x8f, 0x3c, 0xf3, 0xfe, 0xc7, 0x7f, 0xce, 0xa2,
+    0x3a, 0x03, 0x64, 0x81, 0x71, 0x93, 0x9c, 0x7d, 0xcf, 0xfe, 0xbd, 0x6c, 0xef, 0x5e, 0x40, 0x03,
+    0x03, 0xbd, 0x04, 0x06, 0x19, 0x3c, 0xe0, 0x72, 0x00, 0xa6, 0x9b, 0x44, 0xd4, 0x77, 0xd5, 0x98,
+    0xc7, 0x48, 0x00, 0x13, 0xf6, 0x91, 0xd3, 0x3f, 0x73, 0xff, 0x00, 0xaf, 0x48, 0x74, 0xe0, 0xa3,
+    0xe5, 0x9b, 0x76, 0x0e, 0x3e, 0xee, 0x3f, 0xad, 0x6b, 0x15, 0xdc, 0x41, 0x61, 0x82, 0x46, 0x3d,
+    0x8d, 0x45, 0xb3, 0x23, 0x00, 0x64, 0xf2, 0x30, 0x6a, 0x95, 0x99, 0xcf, 0x2a, 0xd5, 0x23, 0xb3,
+    0x32, 0xdf, 0x4d, 0xde, 0xd8, 0x32, 0x91, 0x8f, 0xf6, 0x7f, 0xfa, 0xf4, 0xd5, 0xd2, 0x7e, 0x6e,
+    0x26, 0x27, 0x8c, 0xfd, 0xcf, 0xfe, 0xbd, 0x69, 0x94, 0x0c, 0xf9, 0xc7, 0xe4, 0x4d, 0x0a, 0x19,
+    0xb2, 0x76, 0xf0, 0xdc, 0x1e, 0x6a, 0xec, 0x8c, 0x1d, 0x6a, 0x8d, 0xdd, 0xb2, 0x80, 0xd2, 0x89,
+    0x23, 0x33, 0x63, 0xfe, 0x01, 0xff, 0x00, 0xd7, 0xa9, 0x06, 0x99, 0x9e, 0x93, 0x71, 0xfe, 0xef,
+    0xff, 0x00, 0x5e, 0xae, 0x8f, 0x97, 0x81, 0xdf, 0x9c, 0xf5, 0xe2, 0xa4, 0x5f, 0x97, 0xae, 0x33,
+    0x8e, 0xa7, 0xd3, 0x15, 0x2d, 0x23, 0x7a, 0x75, 0xea, 0x77, 0x33, 0x1f, 0x44, 0xdc, 0x4b, 0x7d,
+    0xa3, 0xeb, 0x84, 0xcf, 0x6f, 0xad, 0x5e, 0xb0, 0xd3, 0x7e, 0xc4, 0x64, 0x06, 0x41, 0x21, 0x62,
+    0x0e, 0x31, 0x8e, 0x99, 0xff, 0x00, 0x1a, 0xb2, 0x30, 0x0f, 0xcc, 0x78, 0x23, 0x9c, 0x1e, 0x9f,
+    0xe7, 0xfa, 0xd4, 0x9b, 0xbe, 0xf1, 0xf9, 0x86, 0x3b, 0x13, 0xd4, 0xd4, 0x36, 0xf6, 0x37, 0x8d,
+    0x9b, 0xbb, 0x0d, 0x80, 0x83, 0xc2, 0x9e, 0x79, 0xc7, 0xa5, 0x31, 0x8e, 0xc2, 0x09, 0x07, 0x18,
+    0xfa, 0x71, 0x4e, 0x6c, 0x38, 0xc0, 0xcf, 0x3d, 0x32, 0xdf, 0xd2, 0x9a, 0x71, 0xdb, 0xaf, 0x4c,
+    0x71, 0xc7, 0x14, 0x90, 0xe5, 0x61, 0x9c, 0x10, 0xc1, 0x8e, 0x72, 0x79, 0x3e, 0x83, 0xfa, 0x53,
+    0x18, 0x67, 0x23, 0x27, 0x8e, 0x86, 0x9e, 0xf9, 0x3f, 0x78, 0xfb, 0xe3, 0xa7, 0xf9, 0xfa, 0xd4,
+    0x65, 0x0b, 0x16, 0xc9, 0xc8, 0x1c, 0x7a, 0xd5, 0xa3, 0x92, 0xa0, 0xc2, 0xdc, 0x2f, 0xae, 0x78,
+    0x1e, 0x82, 0x90, 0xb0, 0x04, 0x1c, 0xed, 0xc7, 0x7c, 0xd1, 0xb7, 0x18, 0xc8, 0x3c, 0xf4, 0xe0,
+    0xd2, 0x15, 0x21, 0x71, 0xb7, 0x8e, 0x9f, 0xfd, 0x6a, 0xb3, 0x9d, 0xdc, 0x72, 0x10, 0x01, 0xcf,
+    0x38, 0xe3, 0xd8, 0x54, 0xa5, 0x77, 0x36, 0x4f, 0xcb, 0x9e, 0x33, 0x9e, 0xfe, 0x94, 0xc0, 0xa7,
+    0x93, 0x92, 0x0f, 0xe9, 0xc7, 0xf9, 0x34, 0xf4, 0x00, 0x63, 0x71, 0xc8, 0x03, 0xe8, 0x3f, 0xcf,
+    0x4a, 0x96, 0x6b, 0x01, 0xe1, 0x76, 0x9e, 0x33, 0xff, 0x00, 0xd6, 0xa9, 0x30, 0x77, 0x00, 0x49,
+    0xcf, 0xa0, 0xc1, 0x15, 0x1e, 0xd6, 0x1d, 0xc1, 0x3d, 0x38, 0xee, 0x2a, 0x5c, 0x9c, 0xe3, 0xaf,
+    0x18, 0xc7, 0xd3, 0xad, 0x43, 0x3b, 0x21, 0x61, 0x46, 0x49, 0xe9, 0xdb, 0xa8, 0x1c, 0x62, 0x9a,
+    0x48, 0x60, 0x0f, 0x00, 0x63, 0xd3, 0x82, 0x69, 0xe3, 0x9c, 0x73, 0xc1, 0xfd, 0x69, 0x8c, 0xed,
+    0x91, 0x8c, 0xe4, 0x8f, 0xff, 0x00, 0x55, 0x4a, 0x2e, 0x56, 0x23, 0x6d, 0xab, 0x92, 0x47, 0x3d,
+    0x30, 0x7f, 0xcf, 0x15, 0x1b, 0x31, 0xce, 0x72, 0x76, 0x7a, 0x77, 0x34, 0xf2, 0x40, 0xc9, 0xce,
+    0x4e, 0x7e, 0xb8, 0xa8, 0xd8, 0xf1, 0x9e, 0xc3, 0xa1, 0xcf, 0x7a, 0xd1, 0x1c, 0xb5, 0x08, 0xd9,
+    0x8e, 0x72, 0x40, 0x39, 0xe0, 0xf5, 0xa3, 0x3c, 0x72, 0xc4, 0x13, 0xed, 0x41, 0x07, 0x00, 0x74,
+    0xc9, 0xe4, 0x62, 0x8c, 0x74, 0xc8, 0x07, 0xb0, 0xab, 0x39, 0x5d, 0xc7, 0x29, 0x05, 0x7a, 0x73,
+    0xea, 0x4e, 0x38, 0xa7, 0x21, 0x2b, 0xc6, 0x70, 0x30, 0x0f, 0x3f, 0x95, 0x46, 0x39, 0x52, 0x79,
+    0xf4, 0x15, 0x2a, 0x6d, 0x23, 0x83, 0x90, 0x4f, 0xa7, 0x4f, 0xa5, 0x26, 0x69, 0x0b, 0x8f, 0x5c,
+    0x32, 0xfc, 0xa0, 0x0e, 0xfc, 0xfa, 0x62, 0xa5, 0x55, 0x05, 0x40, 0x61, 0xce, 0x0d, 0x30, 0x72,
+    0x14, 0x67, 0xbf, 0x42, 0x38, 0xcd, 0x3b, 0x77, 0xc8, 0x02, 0xe0, 0x56, 0x6c, 0xec, 0x85, 0x87,
+    0x6d, 0xdc, 0x46, 0x54, 0x64, 0xf4, 0xc7, 0xa5, 0x35, 0xb0, 0x01, 0x24, 0x60, 0x9f, 0x5e, 0xe3,
+    0xfa, 0x53, 0xdb, 0x27, 0x03, 0x23, 0x8e, 0x0e, 0x7a, 0xd3, 0x5a, 0x4c, 0x2e, 0x50, 0xf3, 0xd2,
+    0x92, 0x35, 0x76, 0x18, 0x7a, 0xfc, 0xa3, 0x80, 0x7a, 0xf4, 0x15, 0x11, 0x19, 0x0d, 0x92, 0x78,
+    0xc7, 0x3d, 0x7e, 0x9c, 0x54, 0x87, 0xaa, 0xe0, 0xfe, 0x24, 0xd4, 0x64, 0x8c, 0xf1, 0xf2, 0xaf,
+    0x38, 0x35, 0x68, 0xe5, 0xa8, 0x47, 0x9d, 0xb9, 0xeb, 0xc9, 0x1d, 0xba, 0xd2, 0x03, 0x8e, 0x06,
+    0x43, 0x0e, 0x9c, 0xf1, 0x4a, 0xcb, 0xce, 0x47, 0xa7, 0x3d, 0xf1, 0xef, 0x4c, 0x61, 0x8d, 0xa3,
+    0x8e, 0x47, 0x23, 0x35, 0x68, 0xe4, 0x95, 0xc7, 0x1e, 0x80, 0x9e, 0x3a, 0xe3, 0x07, 0xd7, 0x9a,
+    0x91, 0x1c, 0x93, 0x95, 0x3c, 0x03, 0xf5, 0x14, 0xc0, 0x09, 0xe1, 0x93, 0xa1, 0xfd, 0x07, 0xb5,
+    0x3c, 0x1c, 0x95, 0xee, 0x0f, 0x4c, 0x73, 0xc6, 0x29, 0x32, 0xe1, 0x72, 0x40, 0x38, 0xf9, 0xb0,
+    0x39, 0xed, 0x8e, 0x94, 0xf1, 0x80, 0x31, 0x9c, 0x1f, 0x42, 0x29, 0x83, 0x81, 0xc1, 0xe0, 0x63,
+    0x3e, 0xf8, 0xa9, 0x55, 0x88, 0xc7, 0xde, 0x1d, 0x7a, 0x73, 0xda, 0xb3, 0x67, 0x64, 0x03, 0x20,
+    0x2e, 0x01, 0xe8, 0x7a, 0x11, 0x4a, 0xc3, 0x91, 0x95, 0x5c, 0x9e, 0xd8, 0xeb, 0xfe, 0x78, 0xa5,
+    0x2c, 0x1b, 0xa9, 0xe0, 0xf1, 0xcf, 0x6a, 0x47, 0x38, 0x56, 0xe0, 0x91, 0xfe, 0x7a, 0xd4, 0x9b,
+    0x3b, 0x58, 0x8c, 0x8c, 0x7d, 0x4f, 0x5e, 0x78, 0xff, 0x00, 0x3c, 0xd3, 0x18, 0xf0, 0x0e, 0xe3,
+    0xfa, 0x13, 0x4f, 0xce, 0xee, 0x33, 0xb4, 0xfa, 0xe3, 0xfa, 0xd4, 0x6e, 0x0f, 0x24, 0x92, 0x49,
+    0x07, 0x38, 0x1d, 0xaa, 0xd1, 0xcd, 0x50, 0x88, 0xb8, 0x20, 0xf6, 0xf4, 0xcf, 0x06, 0x9a, 0x58,
+    0x8e, 0x8d, 0x82, 0x3d, 0xb3, 0xf5, 0xff, 0x00, 0x3e, 0xf5, 0x23, 0x90, 0x3d, 0xfb, 0xf3, 0xda,
+    0x98, 0xc0, 0xe1, 0x88, 0x03, 0x9f, 0x6f, 0xf3, 0xe9, 0x5a, 0x23, 0x92, 0x57, 0x01, 0xbb, 0x7e,
+    0x38, 0xc1, 0x3d, 0x08, 0xa7, 0x81, 0xc1, 0x27, 0x19, 0xc8, 0xcf, 0xa1, 0xef, 0x4c, 0xe7, 0x69,
+    0xc0, 0x18, 0x39, 0xe2, 0x9d, 0xec, 0x73, 0x8f, 0x53, 0x43, 0x1c, 0x2e, 0x4a, 0xbc, 0x80, 0x99,
+    0x24, 0xe3, 0xbf, 0xbd, 0x4a, 0x14, 0xe1, 0x81, 0x50, 0x3a, 0x72, 0x7b, 0x54, 0x49, 0x90, 0x41,
+    0x24, 0x0c, 0x8e, 0x32, 0x2a, 0x44, 0xc6, 0xdc, 0xaf, 0x27, 0x18, 0xed, 0xdf, 0xff, 0x00, 0xd7,
+    0x59, 0xb3, 0xb2, 0x99, 0x20, 0x24, 0xe4, 0x80, 0x03, 0x7a, 0x53, 0x58, 0x72, 0xa4, 0xf5, 0xe8,
+    0x71, 0xc1, 0x34, 0xe3, 0x80, 0xec, 0x31, 0xd4, 0x64, 0xe6, 0x9a, 0xcc, 0x32, 0x76, 0xf3, 0xc7,
+    0x1e, 0xab, 0x50, 0x6f, 0xa0, 0xd6, 0xdc, 0xca, 0x09, 0x18, 0xff, 0x00, 0x3d, 0x2a, 0x32, 0x43,
+    0x33, 0x0e, 0x08, 0x27, 0xa1, 0xf4, 0x14, 0xf6, 0xc6, 0x7a, 0x02, 0x3a, 0xf0, 0x71, 0x4d, 0x24,
+    0x37, 0x09, 0xd4, 0xfb, 0xf6, 0xab, 0x46, 0x13, 0x22, 0x6c, 0x15, 0x23, 0x6e, 0x3a, 0x75, 0xa8,
+    0x77, 0x10, 0x70, 0x0f, 0xb7, 0xb5, 0x4d, 0x8d, 0xc7, 0x24, 0x67, 0xb1, 0xa6, 0x63, 0x23, 0x0c,
+    0x3a, 0x8a, 0xd1, 0x1c, 0x72, 0xb8, 0x06, 0x6e, 0xe7, 0x8f, 0xf6, 0x7b, 0xd3, 0x94, 0xee, 0x61,
+    0xc9, 0xc1, 0x18, 0xe7, 0x91, 0x4c, 0xda, 0x02, 0xe0, 0x8e, 0x0f, 0x5e, 0xd9, 0xf4, 0xa7, 0xa0,
+    0x04, 0x71, 0xce, 0x7b, 0x74, 0xef, 0xde, 0x86, 0x28, 0xdc, 0x95, 0x70, 0xad, 0x82, 0x7e, 0x51,
+    0xf3, 0x67, 0xf1, 0xa9, 0x10, 0x2f, 0x23, 0xa1, 0xfa, 0x75, 0xa8, 0x81, 0x21, 0x72, 0xd8, 0x3c,
+    0xe7, 0x19, 0xeb, 0x4f, 0x50, 0x08, 0xc6, 0x79, 0xc7, 0x1c, 0x75, 0xf7, 0xac, 0xd9, 0xd9, 0x4c,
+    0x95, 0x50, 0x6d, 0x19, 0x50, 0x39, 0xe7, 0xbf, 0x4a, 0x41, 0xf7, 0x46, 0xd0, 0x31, 0x8f, 0x5e,
+    0xff, 0x00, 0xe3, 0x4b, 0xc0, 0x51, 0xc0, 0x1c, 0x77, 0x14, 0xb9, 0xc6, 0x46, 0x79, 0xf6, 0xcf,
+    0xf3, 0xa8, 0x3a, 0x34, 0x18, 0x54, 0x63, 0x91, 0xc7, 0x6e, 0x78, 0x1f, 0x85, 0x44, 0xc7, 0xb7,
+    0x53, 0xd0, 0x7f, 0x9f, 0xca, 0xa4, 0x27, 0x6e, 0x46, 0xec, 0x0e, 0xfe, 0xd4, 0xd2, 0x06, 0xef,
+    0xbb, 0x8e, 0xdd, 0x71, 0x8a, 0xa4, 0x63, 0x32, 0x2d, 0xc1, 0x4e, 0xde, 0x31, 0xc7, 0x02, 0xa2,
+    0x62, 0x38, 0x23, 0x83, 0x9c, 0x7a, 0x54, 0xae, 0xa5, 0x4e, 0x5b, 0x9c, 0xd4, 0x44, 0x7c, 0xbc,
+    0x92, 0x00, 0xeb, 0xde, 0xb4, 0x47, 0x1c, 0xee, 0x19, 0x25, 0x70, 0x70, 0x4e, 0x39, 0xa7, 0x82,
+    0x54, 0x13, 0x9c, 0xe3, 0x81, 0x9a, 0x6e, 0x19, 0x71, 0x9e, 0xb9, 0xef, 0xcd, 0x03, 0x80, 0x07,
+    0x50, 0x3b, 0x9e, 0xd4, 0xc8, 0x8d, 0xc9, 0xb8, 0x2b, 0x90, 0x31, 0xec, 0x0f, 0x26, 0x9d, 0x8c,
+    0x31, 0xe7, 0xa7, 0xbd, 0x35, 0x39, 0x7c, 0x13, 0x83, 0xd3, 0x26, 0x9e, 0xb2, 0x77, 0x20, 0x80,
+    0x4f, 0xaf, 0x26, 0xa1, 0x9d, 0x74, 0xc9, 0x41, 0xc9, 0xc0, 0x20, 0x62, 0x95, 0x57, 0x81, 0xbb,
+    0xbf, 0x61, 0x49, 0x19, 0xe0, 0x85, 0x23, 0x27, 0xd0, 0x63, 0xf5, 0xa3, 0x9d, 0xc4, 0x1c, 0x9e,
+    0xdc, 0x1a, 0xcc, 0xea, 0x56, 0x18, 0xe3, 0x04, 0x8e, 0x07, 0x7e, 0x38, 0xe2, 0x92, 0x43, 0xf3,
+    0x02, 0x49, 0x1d, 0x86, 0x0f, 0x5f, 0xf3, 0xfd, 0x6a, 0x43, 0x8e, 0x5b, 0x82, 0x3b, 0x60, 0xf4,
+    0xa8, 0x99, 0x8e, 0x4f, 0x01, 0x81, 0xe3, 0x1d, 0x6a, 0x91, 0x94, 0xec, 0x44, 0x48, 0x09, 0xb8,
+    0x70, 0x07, 0xb5, 0x31, 0x89, 0x27, 0x1d, 0x3b, 0x7e, 0x35, 0x33, 0x0c, 0xb6, 0x79, 0xf7, 0xfa,
+    0x54, 0x2c, 0x09, 0xe3, 0x20, 0xe0, 0xe7, 0x3d, 0xbd, 0xab, 0x44, 0x71, 0xce, 0xe3, 0x43, 0x11,
+    0xc9, 0xdc, 0x49, 0xea, 0x69, 0xea, 0x57, 0x23, 0x38, 0x39, 0x3c, 0x77, 0xc7, 0xf9, 0xfe, 0x95,
+    0x1e, 0x32, 0x54, 0x03, 0xec, 0x7e, 0x5a, 0x7a, 0x8c, 0x82, 0xbd, 0x4e, 0x7a, 0x75, 0xc0, 0xa6,
+    0xcc, 0xd5, 0xc7, 0x8c, 0xe4, 0x71, 0xc6, 0x33, 0xb7, 0xf0, 0xf4, 0xa9, 0x57, 0x07, 0x19, 0x39,
+    0xef, 0x90, 0x2a, 0x20, 0xb9, 0x60, 0x4f, 0x7e, 0x49, 0x1d, 0xaa, 0x5e, 0x87, 0x18, 0xf9, 0x7a,
+    0xf2, 0x39, 0x35, 0x0c, 0xea, 0xa6, 0x3d, 0x00, 0xe3, 0x00, 0x64, 0x76, 0x1c, 0xd2, 0x8c, 0x6d,
+    0xdb, 0x83, 0xf8, 0x9a, 0x50, 0xe5, 0x46, 0x54, 0x8c, 0x7b, 0xf1, 0x43, 0x0e, 0x0e, 0x0f, 0x00,
+    0xe7, 0x3f, 0x4f, 0x6a, 0x83, 0xa9, 0x58, 0x83, 0xfb, 0xac, 0x47, 0x18, 0xfc, 0xfd, 0xe9, 0xaa,
+    0x00, 0x1c, 0xb1, 0xe3, 0x9e, 0x2a, 0x40, 0xa4, 0x91, 0xd4, 0x8e, 0x3f, 0xc9, 0xa5, 0x55, 0xc8,
+    0xc8, 0xce, 0x7d, 0xc5, 0x55, 0xce, 0x65, 0x0b, 0x90, 0x94, 0x18, 0xc1, 0x04, 0xf1, 0xc6, 0x29,
+    0x4a, 0x80, 0x39, 0xea, 0x7a, 0x7f, 0x91, 0x52, 0x85, 0xc8, 0xc6, 0x4e, 0x33, 0xc9, 0xf4, 0xa3,
+    0xcb, 0xfb, 0xc3, 0x20, 0xe3, 0xdf, 0x9a, 0x7c, 0xc3, 0xf6, 0x44, 0x6a, 0x00, 0x50, 0x70, 0xa4,
+    0xfb, 0x75, 0xfc, 0x29, 0xca, 0xfb, 0x5b, 0x00, 0x63, 0x3d, 0xb3, 0xed, 0x4e, 0xe8, 0x31, 0x81,
+    0x91, 0xf3, 0x60, 0xf1, 0xeb, 0x51, 0x33, 0x00, 0x46, 0x18, 0xf3, 0xd7, 0x9a, 0x37, 0x26, 0xdc,
+    0xa4, 0x85, 0x82, 0x81, 0xc7, 0x7c, 0x73, 0xf4, 0xe9, 0x8a, 0x4d, 0xc0, 0xa8, 0xe0, 0x60, 0x70,
+    0x78, 0xa8, 0xc3, 0x12, 0xc4, 0xfa, 0xf6, 0x14, 0xd2, 0xe5, 0x95, 0x4e, 0xee, 0x83, 0x92, 0x7f,
+    0xc2, 0x8e, 0x51, 0x7b, 0x5b, 0x16, 0x37, 0x00, 0x72, 0x49, 0x1e, 0xbc, 0x53, 0x43, 0x67, 0x3d,
+    0x71, 0x81, 0x9c, 0x77, 0xfc, 0x6a, 0x34, 0x72, 0x73, 0x8c, 0x10, 0xdd, 0xba, 0x53, 0x95, 0xc8,
+    0x42, 0x46, 0x06, 0x78, 0x20, 0xd1, 0x60, 0xf6, 0x97, 0x1c, 0x40, 0x19, 0xe7, 0x0a, 0x46, 0x07,
+    0x1e, 0xa6, 0x98, 0x32, 0x48, 0x53, 0xd4, 0x73, 0x4f, 0x52, 0x3a, 0x1e, 0x73, 0xd7, 0x9c, 0xfb,
+    0x53, 0xc7, 0xcc, 0x84, 0x92, 0x32, 0xbd, 0x46, 0x69, 0x5e, 0xc5, 0x28, 0xdc, 0x88, 0x26, 0x49,
+    0x04, 0x63, 0xd0, 0x52, 0x05, 0x2a, 0x40, 0x00, 0x7d, 0x2a, 0x40, 0xb9, 0x5e, 0x5b, 0x18, 0x1d,
+    0x31, 0xfe, 0x79, 0xa7, 0xed, 0x52, 0x40, 0x03, 0x1e, 0xe6, 0x8e, 0x61, 0xfb, 0x12, 0x0e, 0x40,
+    0xe9, 0xce, 0x06, 0x38, 0xf5, 0xa5, 0x19, 0xea, 0x71, 0x8f, 0x42, 0x71, 0xfa, 0x53, 0xb0, 0xdb,
+    0x40, 0xce, 0x08, 0x3e, 0xb4, 0xd6, 0xce, 0x48, 0xe3, 0x39, 0xe8, 0x3a, 0x9a, 0x7b, 0x93, 0x6e,
+    0x51, 0xca, 0x41, 0x56, 0xe4, 0x63, 0xea, 0x69, 0xdb, 0xf6, 0x95, 0xe4, 0x80, 0x72, 0x79, 0x3d,
+    0x2a, 0x02, 0x7e, 0x62, 0xdc, 0x67, 0xfa, 0x7f, 0x93, 0x48, 0xcc, 0x77, 0x67, 0x77, 0x27, 0xd7,
+    0x91, 0x47, 0x28, 0xbd, 0xad, 0x8b, 0x02, 0x45, 0xc6, 0x4b, 0x70, 0x4f, 0x4f, 0x6e, 0xb4, 0x16,
+    0x3c, 0xfa, 0x0e, 0x71, 0x8f, 0x7f, 0xfe, 0xb5, 0x41, 0x90, 0xe1, 0x4f, 0x60, 0x7b, 0x9e, 0x31,
+    0xfd, 0x29, 0xc8, 0xc5, 0x81, 0x39, 0xeb, 0xd3, 0xb6, 0x4d, 0x1c, 0xa1, 0xed, 0x2e, 0x3b, 0x0d,
+    0x9d, 0xb9, 0xf9, 0x4f, 0xf7, 0xbb, 0x1a, 0x4d, 0xbf, 0x31, 0xdb, 0xd4, 0x0c, 0xf6, 0x3c, 0xfb,
+    0x52, 0xae, 0x0e, 0x1b, 0x68, 0x2b, 0x8e, 0x7e, 0x95, 0x20, 0x21, 0x8f, 0x51, 0x93, 0x9e, 0xa6,
+    0x8b, 0x94, 0xa3, 0xcc, 0x41, 0xb5, 0x87, 0xca, 0x79, 0xc0, 0xe3, 0x23, 0xa5, 0x0c, 0x8b, 0xb3,
+    0x38, 0xc9, 0x3d, 0x0d, 0x58, 0x54, 0x04, 0x74, 0x38, 0xfa, 0xe3, 0x3d, 0x28, 0x11, 0xe3, 0x04,
+    0x10, 0x0f, 0xaf, 0xa8, 0xf5, 0xa5, 0xcc, 0x3f, 0x62, 0x43, 0xb7, 0x73, 0x8e, 0x06, 0x37, 0x7a,
+    0x75, 0xa0, 0xa9, 0x5f, 0x94, 0x7a, 0xfa, 0xd4, 0x85, 0x70, 0x43, 0x67, 0x19, 0xef, 0xfd, 0x69,
+    0xac, 0x7e, 0x7c, 0xfd, 0xd1, 0xea, 0x47, 0x26, 0x9d, 0xc4, 0xe3, 0x60, 0xde, 0xca, 0x40, 0xee,
+    0x3b, 0x53, 0x8c, 0x87, 0x68, 0x00, 0xfc, 0xa0, 0x63, 0x20, 0xf4, 0xa8, 0x5b, 0x24, 0x92, 0xb8,
+    0x27, 0x1d, 0xbb, 0xd3, 0x72, 0x08, 0x3c, 0x37, 0xbf, 0x34, 0x58, 0x9f, 0x69, 0x62, 0xc1, 0x63,
+    0xbb, 0x76, 0x73, 0x8a, 0x68, 0x73, 0x9d, 0xc7, 0xa1, 0xe9, 0x9e, 0x3a, 0xd4, 0x0c, 0xde, 0xa3,
+    0x8f, 0xaf, 0xe7, 0xfe, 0x78, 0xa7, 0x86, 0x19, 0x24, 0xe0, 0xfa, 0x67, 0xd6, 0x8e, 0x50, 0xf6,
+    0xb7, 0x1e, 0x03, 0x3e, 0x76, 0x83, 0xcf, 0x5e, 0x69, 0x0a, 0x85, 0x53, 0xc7, 0x3d, 0x06, 0x79,
+    0x06, 0x90, 0x2e, 0x3b, 0x10, 0x09, 0xc1, 0x3e, 0xbc, 0xd4, 0x84, 0x36, 0x40, 0x20, 0xfd, 0x47,
+    0xa7, 0x3f, 0xe3, 0x41, 0x49, 0x73, 0x11, 0x11, 0xd3, 0x07, 0x69, 0xe8, 0x09, 0xef, 0x40, 0x50,
+    0x17, 0x1e, 0xdd, 0x33, 0x53, 0x04, 0x1c, 0x1c, 0x0e, 0x3b, 0x63, 0xa5, 0x38, 0x28, 0x38, 0x03,
+    0x19, 0x23, 0xf2, 0xa5, 0xcc, 0x3f, 0x62, 0x40, 0x07, 0xcc, 0x09, 0x1c, 0x9e, 0x09, 0x23, 0xb7,
+    0x7a, 0x77, 0xcd, 0xc8, 0xc1, 0x3e, 0xde, 0x94, 0xed, 0xb8, 0x24, 0x00, 0x78, 0xe7, 0xaf, 0x34,
+    0xd2, 0x01, 0x01, 0xbb, 0x0e, 0xe0, 0x7f, 0x9f, 0xa5, 0x3b, 0x8b, 0x92, 0xc2, 0x8c, 0x9f, 0x50,
+    0x58, 0xf1, 0xcf, 0x34, 0x07, 0xe7, 0x82, 0x4f, 0x3c, 0x77, 0xcf, 0xbf, 0xf3, 0xa6, 0x33, 0x28,
+    0x2b, 0x8c, 0x74, 0xcf, 0x3d, 0xa9, 0xbb, 0xb0, 0x00, 0x1c, 0xe0, 0x0c, 0xf5, 0x14, 0x58, 0x9f,
+    0x69, 0x62, 0x63, 0x26, 0x17, 0x00, 0x90, 0x0f, 0x3d, 0x3a, 0xff, 0x00, 0x9e, 0x28, 0xc9, 0xe0,
+    0x60, 0x8c, 0x7b, 0xd4, 0x00, 0xe4, 0xed, 0x20, 0x83, 0xd8, 0x91, 0x4b, 0xb8, 0x82, 0x10, 0xf3,
+    0x91, 0xc0, 0xf4, 0xa3, 0x94, 0x3d, 0xad, 0xc9, 0x32, 0x77, 0x6d, 0x24, 0x63, 0xd0, 0xff, 0x00,
+    0x4a, 0x02, 0xee, 0xf9, 0x7a, 0xf7, 0x3e, 0xf8, 0xa0, 0x01, 0xce, 0x0f, 0xcc, 0x3a, 0x60, 0x76,
+    0xe2, 0x94, 0x82, 0x71, 0xc8, 0xe7, 0xa1, 0xcf, 0x38, 0xeb, 0x40, 0xd7, 0xbc, 0x35, 0x97, 0x92,
+    0x71, 0xf9, 0x0a, 0x69, 0x51, 0xd3, 0x19, 0x3e, 0x9d, 0xf3, 0xed, 0x53, 0xe3, 0x25, 0x71, 0x83,
+    0xe8, 0x7d, 0xff, 0x00, 0xcf, 0xf2, 0xa4, 0x28, 0x01, 0x5c, 0xe7, 0xe6, 0x1f, 0x77, 0xd2, 0x97,
+    0x31, 0x5e, 0xca, 0xe4, 0x5c, 0x73, 0x9c, 0x93, 0xd8, 0xed, 0xa0, 0x31, 0xcf, 0x53, 0x81, 0xf7,
+    0x73, 0x53, 0xed, 0x1b, 0x72, 0xa0, 0x7c, 0xde, 0x9c, 0x62, 0xa2, 0xe0, 0x2f, 0x3d, 0x86, 0x46,
+    0x4f, 0xe9, 0x4e, 0xf7, 0x17, 0x25, 0x85, 0x24, 0x03, 0xc7, 0xe9, 0xe9, 0x4a, 0x87, 0x6f, 0xdf,
+    0x23, 0x20, 0xe0, 0x64, 0x7f, 0x85, 0x46, 0xa7, 0xe5, 0xf9, 0x4b, 0x2e, 0x7d, 0xbf, 0xcf, 0x7a,
+    0x37, 0x80, 0xad, 0xc6, 0x4a, 0x8a, 0x2c, 0x4f, 0x3d, 0x89, 0x37, 0x03, 0x82, 0x54, 0x8c, 0x75,
+    0xa5, 0xdf, 0xbf, 0x20, 0x1e, 0x5b, 0xa5, 0x57, 0x56, 0x20, 0x86, 0xc3, 0x0c, 0x63, 0xb6, 0x7f,
+    0xa5, 0x05, 0xc1, 0x50, 0xbc, 0xb7, 0xbf, 0x5a, 0x39, 0x43, 0xda, 0x93, 0x3b, 0x7c, 0xd9, 0x04,
+    0x03, 0xd7, 0x18, 0xe6, 0x91, 0x86, 0x70, 0x72, 0x7a, 0xf6, 0xff, 0x00, 0x3f, 0xe7, 0x14, 0x81,
+    0xc9, 0x25, 0x58, 0xe0, 0x0e, 0x94, 0xaa, 0x71, 0xf3, 0x28, 0x27, 0x9c, 0x63, 0x3d, 0x28, 0xd8,
+    0x7f, 0x10, 0xd0, 0x9b, 0xb7, 0x67, 0xa6, 0x7b, 0x71, 0x49, 0xb4, 0x96, 0x62, 0x38, 0xc7, 0x4e,
+    0x3f, 0xa5, 0x4e, 0xa0, 0xed, 0x5e, 0x79, 0x03, 0xa6, 0x29, 0x76, 0x03, 0x92, 0x06, 0x4f, 0x23,
+    0x3f, 0xfd, 0x7a, 0x5c, 0xc5, 0x7b, 0x2b, 0x90, 0x6c, 0xc6, 0x0f, 0x18, 0xfe, 0xb4, 0x83, 0x23,
+    0x20, 0x60, 0x1f, 0xf3, 0xfe, 0x15, 0x30, 0x43, 0x85, 0x38, 0xf6, 0x18, 0xa1, 0x86, 0x72, 0x5b,
+    0x00, 0x03, 0xc8, 0xa7, 0x71, 0x7b, 0x3b, 0x0d, 0x09, 0xb0, 0x37, 0xcd, 0xf2, 0xf7, 0xe0, 0x52,
+    0xf9, 0x83, 0x39, 0xe0, 0x1e, 0x9c, 0x53, 0x1b, 0x96, 0xc6, 0x30, 0x7b, 0xe4, 0x74, 0xa4, 0x2c,
+    0x47, 0xcc, 0x31, 0xc9, 0xc8, 0xc5, 0x16, 0xb8, 0xb9, 0xec, 0x48, 0x64, 0xc3, 0x60, 0x1e, 0x9d,
+    0x7e, 0xb4, 0xa4, 0x80, 0x07, 0x1c, 0x63, 0xa1, 0xe7, 0xde, 0xab, 0xee, 0xc0, 0xf7, 0xc0, 0xeb,
+    0xc8, 0xa5, 0xcb, 0x1e, 0x47, 0x1c, 0x72, 0x09, 0xa3, 0x94, 0x5e, 0xd8, 0x90, 0x16, 0x23, 0x6f,
+    0x41, 0xcf, 0x34, 0x85, 0x4e, 0xd3, 0x83, 0x91, 0xdf, 0x1d, 0x28, 0xdc, 0x4b, 0x64, 0x9c, 0x81,
+    0xfc, 0xa8, 0x51, 0x92, 0x03, 0x02, 0x49, 0x19, 0xe4, 0x63, 0xff, 0x00, 0xd5, 0x40, 0xef, 0xcc,
+    0x26, 0xde, 0x9d, 0x30, 0x79, 0xe0, 0x7f, 0x9f, 0x7f, 0xce, 0x81, 0x18, 0xc8, 0x03, 0x83, 0xc1,
+    0xfe, 0x75, 0x22, 0x00, 0x43, 0x7c, 0xa3, 0x9e, 0x08, 0x1d, 0xb8, 0xa7, 0xe0, 0x8d, 0xb9, 0xdc,
+    0x00, 0xea, 0x31, 0x4b, 0x98, 0xaf, 0x65, 0x72, 0x11, 0x1f, 0x24, 0x9c, 0x63, 0x91, 0xcf, 0x34,
+    0x80, 0x02, 0x72, 0xb8, 0xe7, 0xdf, 0x8f, 0xd7, 0xeb, 0x53, 0x81, 0x81, 0xf2, 0x8c, 0x8f, 0x7f,
+    0x4f, 0xf2, 0x69, 0x85, 0x72, 0xb9, 0xe3, 0x1f, 0xcb, 0xfc, 0xf1, 0x45, 0xc5, 0xec, 0xec, 0x33,
+    0x01, 0x39, 0x2b, 0x9f, 0x43, 0x9c, 0x52, 0x86, 0xce, 0x38, 0x60, 0x5b, 0x95, 0xc7, 0x34, 0x8d,
+    0x96, 0x5c, 0xb7, 0x07, 0xd3, 0x14, 0xcf, 0x98, 0x0c, 0x12, 0x79, 0xe8, 0x33, 0xd2, 0x9d, 0xae,
+    0x2e, 0x6e, 0x52, 0x7d, 0xe0, 0x9c, 0x6e, 0xe7, 0xd3, 0x8a, 0x42, 0xe4, 0xb6, 0x0f, 0x3c, 0xe0,
+    0x1c, 0x73, 0x51, 0x67, 0x03, 0x73, 0x63, 0x9e, 0xa3, 0xff, 0x00, 0xaf, 0x48, 0x64, 0xdd, 0x90,
+    0x47, 0x3f, 0x4a, 0x39, 0x45, 0xed, 0x89, 0x83, 0x6e, 0x1f, 0x2f, 0x1e, 0xd4, 0x83, 0x25, 0x4f,
+    0xcd, 0x90, 0x48, 0xe9, 0x51, 0x29, 0xc9, 0xc6, 0x30, 0x01, 0xed, 0x52, 0x60, 0x8e, 0x30, 0x7d,
+    0x40, 0xf5, 0x34, 0x58, 0x6a, 0x5c, 0xc3, 0x76, 0xe5, 0x32, 0x41, 0x24, 0xf5, 0xc1, 0xa0, 0xa0,
+    0x04, 0x06, 0x03, 0xa7, 0x3c, 0x73, 0x52, 0x04, 0x52, 0x7e, 0x61, 0xf3, 0x75, 0x03, 0xa5, 0x2b,
+    0x28, 0x6c, 0x93, 0xc6, 0x47, 0x6e, 0xf8, 0xa2, 0xe3, 0xf6, 0x77, 0x20, 0x09, 0x81, 0xb7, 0x3d,
+    0xfe, 0x5e, 0x78, 0x3c, 0xd3, 0x90, 0x1d, 0xc7, 0xaa, 0x8f, 0x41, 0x56, 0x36, 0xa9, 0x1b, 0x81,
+    0xc8, 0xe3, 0x1c, 0xf4, 0xa6, 0xb0, 0x21, 0x70, 0x46, 0x38, 0xc7, 0x23, 0xa7, 0xf3, 0xa5, 0xcc,
+    0x3f, 0x65, 0x62, 0x2e, 0xc5, 0x89, 0x27, 0xd4, 0x7a, 0x71, 0x4f, 0x18, 0x1b, 0x70, 0x0e, 0x7d,
+    0x68, 0xc1, 0x05, 0x81, 0x6c, 0x0c, 0x64, 0x8e, 0xf5, 0x13, 0x13, 0xe6, 0x2b, 0x01, 0xf2, 0x9f,
+    0x41, 0x4f, 0x72, 0x5b, 0xe5, 0x26, 0x2f, 0x96, 0xc6, 0x06, 0x33, 0x8c, 0x9e, 0x73, 0x4d, 0x2e,
+    0xd8, 0x04, 0x67, 0xa6, 0x47, 0x6a, 0x84, 0x1c, 0x10, 0x37, 0xf3, 0xdf, 0x8e, 0x94, 0xb9, 0xc0,
+    0xeb, 0x8f, 0x71, 0xdc, 0x7e, 0x34, 0x72, 0x8b, 0xdb, 0x12, 0xee, 0xca, 0xf2, 0x41, 0x38, 0xc0,
+    0xcd, 0x23, 0xb1, 0x65, 0x3b, 0xb2, 0x40, 0xfc, 0xe9, 0x8a, 0xfd, 0x0e, 0x06, 0x0e, 0x07, 0x1d,
+    0xe9, 0xf1, 0xe7, 0x71, 0x04, 0x02, 0x3a, 0x7a, 0xf1, 0x45, 0xac, 0x35, 0x2e, 0x61, 0x30, 0x30,
+    0x5f, 0x80, 0x0f, 0x1d, 0x69, 0x1c, 0x7d, 0xe2, 0x47, 0x4e, 0x39, 0xcd, 0x4c, 0x17, 0xd4, 0x8e,
+    0x79, 0x02, 0x83, 0x0e, 0x49, 0x39, 0xe4, 0x71, 0xff, 0x00, 0xeb, 0xa5, 0x71, 0xfb, 0x3b, 0x90,
+    0xec, 0x1b, 0x48, 0x1c, 0xfb, 0x7d, 0x3f, 0xcf, 0xe9, 0x4b, 0x8c, 0xe0, 0x2f, 0xaf, 0xd3, 0x3d,
+    0x3a, 0x54, 0xbb, 0x02, 0xf5, 0xcf, 0x3d, 0xf1, 0xfe, 0x7b, 0x1a, 0x4d, 0x80, 0x1e, 0x85, 0x8f,
+    0xa5, 0x1c, 0xc1, 0xec, 0xac, 0x46, 0x80, 0x70, 0xa3, 0x9e, 0xe3, 0x8a, 0x70, 0x24, 0xb6, 0xe3,
+    0x81, 0xcf, 0x00, 0x9c, 0x63, 0xf4, 0xa5, 0xe3, 0x07, 0xbf, 0x18, 0x19, 0xe7, 0x35, 0x1e, 0xee,
+    0x37, 0x31, 0xc1, 0xf4, 0x26, 0x9e, 0xe2, 0xf8, 0x47, 0xef, 0x50, 0x71, 0xfc, 0x3d, 0x78, 0xfe,
+    0x74, 0xe3, 0x20, 0x00, 0x05, 0x70, 0x7e, 0xb5, 0x5d, 0x98, 0x63, 0x00, 0x1d, 0xbd, 0xc0, 0xa1,
+    0x5c, 0x01, 0xb7, 0x23, 0x27, 0x9c, 0x1a, 0x39, 0x45, 0xed, 0x49, 0x89, 0x2c, 0x32, 0x07, 0x00,
+    0x03, 0x83, 0xd2, 0x93, 0x07, 0x6f, 0x5c, 0x63, 0xd0, 0xd3, 0x43, 0x15, 0x19, 0x20, 0x95, 0xfe,
+    0xee, 0x30, 0x29, 0x41, 0xc1, 0xc8, 0x20, 0xf1, 0xc8, 0x23, 0xbd, 0x16, 0x0e, 0x7b, 0x80, 0xc2,
+    0x82, 0x0f, 0x51, 0xfc, 0xa9, 0x8d, 0x19, 0x6c, 0x60, 0x12, 0x3d, 0x01, 0xcf, 0xf9, 0xed, 0x52,
+    0x0d, 0xa5, 0x54, 0x60, 0xe3, 0x1d, 0xc7, 0xff, 0x00, 0x5a, 0xa4, 0x4c, 0x9e, 0x32, 0x68, 0xbd,
+    0x8a, 0xe4, 0xb9, 0x06, 0xcc, 0x80, 0x01, 0x39, 0xc7, 0x5c, 0x7e, 0xb4, 0xe2, 0xa0, 0xe4, 0x95,
+    0xe9, 0xd7, 0x38, 0xe6, 0xa4, 0xda, 0x5b, 0x81, 0x9c, 0xfa, 0x51, 0x82, 0xe0, 0x11, 0xc3, 0x7a,
+    0x9e, 0x69, 0x73, 0x0f, 0xd9, 0x58, 0x88, 0x6d, 0xdc, 0x72, 0x72, 0x0e, 0x7e, 0x50, 0x79, 0xff,
+    0x00, 0xeb, 0xd3, 0xb7, 0x61, 0x89, 0x3b, 0xb9, 0x3c, 0x67, 0x8a, 0x73, 0x2f, 0xca, 0x39, 0x19,
+    0x39, 0xfc, 0xe9, 0x85, 0x82, 0xb0, 0xcb, 0x1c, 0xfa, 0x13, 0xc7, 0xd7, 0xf9, 0xd3, 0xdc, 0x97,
+    0xee, 0x8e, 0x53, 0xd0, 0x30, 0xf9, 0x47, 0x56, 0xf5, 0x1f, 0xe4, 0x50, 0x5d, 0x72, 0x06, 0x73,
+    0xd8, 0xfa, 0xe6, 0xa1, 0x52, 0x41, 0x43, 0x9e, 0x87, 0xbd, 0x06, 0x4e, 0x58, 0xf1, 0xcf, 0x5d,
+    0xdf, 0x4a, 0x39, 0x45, 0xed, 0x6c, 0x4c, 0x84, 0x64, 0x64, 0xe4, 0x03, 0xe9, 0xd2, 0x9e, 0x39,
+    0x03, 0xf9, 0x03, 0x51, 0xe3, 0x69, 0x0c, 0x3b, 0x9e, 0x3e, 0x95, 0x2b, 0x11, 0xbc, 0x8c, 0x8c,
+    0x9e, 0x39, 0xa9, 0x66, 0xf0, 0x68, 0x91, 0x4b, 0x00, 0xb9, 0x20, 0x67, 0xbd, 0x37, 0xe5, 0xfc,
+    0x41, 0xc0, 0x3d, 0xe9, 0xa4, 0x8c, 0xe3, 0x19, 0x1f, 0xc8, 0xf3, 0x48, 0xcc, 0x48, 0x38, 0x1c,
+    0xfa, 0x74, 0xcd, 0x2b, 0x1a, 0x39, 0x21, 0xbd, 0xc0, 0xdd, 0xc0, 0xe7, 0xeb, 0xdf, 0xad, 0x35,
+    0x97, 0xf7, 0x80, 0xfa, 0x1c, 0x9c, 0x9f, 0xe5, 0xfe, 0x7b, 0x53, 0xdc, 0x82, 0x0a, 0x91, 0x92,
+    0x3b, 0xff, 0x00, 0xf5, 0xaa, 0x12, 0xb9, 0x39, 0xc9, 0x39, 0xe7, 0xdf, 0xeb, 0x54, 0x8e, 0x69,
+    0xea, 0x33, 0x03, 0x6e, 0xc5, 0x3c, 0x93, 0x9e, 0xb9, 0xa4, 0x0d, 0x8c, 0xe4, 0x10, 0x3a, 0x0c,
+    0x73, 0x4b, 0xb5, 0x8b, 0x63, 0x9c, 0x2f, 0x73, 0x46, 0x01, 0xed, 0x90, 0x3b, 0x01, 0xfe, 0x7d,
+    0x2b, 0x43, 0x96, 0x51, 0x62, 0x0e, 0x09, 0x60, 0x4f, 0x5e, 0xe7, 0xaf, 0xe5, 0x4e, 0x50, 0x32,
+    0x32, 0x79, 0x62, 0x73, 0xc6, 0x33, 0x46, 0x3f, 0x79, 0x9c, 0x63, 0xae, 0x0f, 0xe9, 0xfe, 0x7e,
+    0x94, 0xaa, 0xbf, 0xdd, 0x1c, 0x81, 0xcf, 0xbd, 0x26, 0x54, 0x13, 0x25, 0x41, 0xb5, 0x72, 0x33,
+    0x8a, 0x95, 0x43, 0x01, 0xee, 0x7e, 0xbc, 0x1f, 0xca, 0xa2, 0x5c, 0xf6, 0xf9, 0x09, 0xfd, 0x45,
+    0x3d, 0x58, 0x21, 0xfb, 0xcb, 0xc7, 0x5e, 0x9c, 0x8c, 0xd6, 0x6c, 0xeb, 0x83, 0xb0, 0xf0, 0x09,
+    0xce, 0x02, 0xe3, 0x93, 0x82, 0x78, 0xc7, 0xaf, 0xf3, 0xa3, 0xa1, 0x2d, 0xb7, 0x19, 0x1d, 0x01,
+    0xc5, 0x26, 0xf3, 0x8e, 0xa7, 0x81, 0xfd, 0xdf, 0xad, 0x21, 0x60, 0x18, 0xe4, 0x12, 0x7d, 0x0f,
+    0xe5, 0x4a, 0xc6, 0xdc, 0xc8, 0x43, 0xf3, 0x2e, 0x0e, 0x00, 0x1d, 0x85, 0x44, 0x4b, 0x60, 0xed,
+    0x19, 0x18, 0x1c, 0xf4, 0xa9, 0x06, 0xd1, 0xdf, 0x27, 0x1c, 0xe0, 0x75, 0xf6, 0xa8, 0x8f, 0x25,
+    0x86, 0xde, 0x49, 0xce, 0x01, 0xce, 0x6a, 0x91, 0xcf, 0x3d, 0x48, 0xc0, 0x21, 0xba, 0x60, 0x03,
+    0xc7, 0x6a, 0x6b, 0x1e, 0x55, 0x81, 0xc1, 0xc6, 0x47, 0xb5, 0x49, 0xb7, 0x71, 0xc9, 0x3d, 0xf0,
+    0x33, 0x4d, 0x55, 0x6c, 0x9c, 0x70, 0x78, 0xfc, 0x6b, 0x44, 0xce, 0x59, 0x45, 0x8d, 0x07, 0x8f,
+    0x99, 0x7a, 0xe0, 0x70, 0x3f, 0xcf, 0xad, 0x48, 0x32, 0x48, 0x1c, 0x8e, 0x31, 0x91, 0x4d, 0x0b,
+    0xdc, 0x8e, 0x3e, 0xb8, 0xa7, 0x04, 0xf9, 0xba, 0x76, 0xfd, 0x7d, 0x28, 0x61, 0x18, 0xb2, 0x45,
+    0x00, 0xbe, 0x49, 0xe7, 0xe9, 0xfd, 0x2a, 0x50, 0xac, 0xca, 0xa4, 0x00, 0x0f, 0xb7, 0x6e, 0x2a,
+    0x25, 0xf9, 0x47, 0xb9, 0xeb, 0xf9, 0x53, 0xc2, 0x8d, 0xe7, 0x20, 0x63, 0xeb, 0x59, 0xb3, 0xae,
+    0x0e, 0xc4, 0xa4, 0x29, 0xfb, 0xa0, 0x92, 0x07, 0x07, 0xeb, 0x40, 0x1f, 0x29, 0x27, 0x07, 0xb7,
+    0xd4, 0x53, 0x43, 0x73, 0xc8, 0xcb, 0x63, 0x9a, 0x0b, 0x74, 0xe5, 0x47, 0x7c, 0xf4, 0xe6, 0xa2,
+    0xc6, 0xfc, 0xc8, 0x3e, 0x61, 0x8c, 0x28, 0x27, 0xa1, 0xfe, 0x5c, 0xd4, 0x2d, 0x90, 0x19, 0x70,
+    0xa0, 0xf7, 0xf5, 0x38, 0xa7, 0x9c, 0x6e, 0xce, 0x07, 0x5f, 0x5c, 0x9f, 0xc6, 0x98, 0xe4, 0x71,
+    0x80, 0x7e, 0x98, 0xab, 0x46, 0x33, 0x77, 0x22, 0x93, 0x04, 0x8e, 0xeb, 0x8c, 0x11, 0x9a, 0x63,
+    0xe7, 0x70, 0x19, 0xed, 0xd0, 0x0f, 0xfe, 0xb7, 0x35, 0x2b, 0x29, 0x05, 0x89, 0xed, 0x9e, 0xa2,
+    0x90, 0xa9, 0x53, 0x90, 0x72, 0x49, 0x03, 0x3e, 0x98, 0xab, 0x4c, 0xe4, 0x94, 0x59, 0x1e, 0xe2,
+    0x08, 0x07, 0x9c, 0x7b, 0x74, 0xa7, 0x0c, 0x87, 0x39, 0x27, 0x3d, 0x78, 0x1d, 0x29, 0x0a, 0x90,
+    0xc0, 0x63, 0xa1, 0xc9, 0xf6, 0xfc, 0x6a, 0x50, 0x08, 0x60, 0x41, 0xdc, 0xa3, 0xb6, 0x7f, 0xcf,
+    0xb5, 0x36, 0xc5, 0x18, 0xb0, 0x46, 0x2c, 0xa3, 0xee, 0xe7, 0x92, 0x41, 0xe2, 0xa5, 0x00, 0xed,
+    0x18, 0x0b, 0x9f, 0x6a, 0x67, 0x1b, 0x40, 0x62, 0x00, 0xcf, 0x5c, 0x75, 0xa9, 0x11, 0x99, 0x9f,
+    0x90, 0x41, 0x1e, 0xa7, 0xa1, 0xc1, 0xac, 0xd9, 0xd5, 0x4f, 0x41, 0xeb, 0xc0, 0xda, 0x30, 0x49,
+    0x3c, 0x01, 0xc5, 0x3b, 0x05, 0x00, 0xda, 0x9d, 0x38, 0xfa, 0xfb, 0xd4, 0x45, 0x97, 0xb1, 0x1f,
+    0x31, 0xc7, 0xcb, 0x4f, 0x66, 0x50, 0x08, 0x3c, 0xe3, 0x18, 0x1d, 0x07, 0xd2, 0xa2, 0xc7, 0x42,
+    0x92, 0x18, 0xe1, 0x8e, 0x33, 0x8f, 0x5e, 0xb9, 0xa6, 0xb3, 0x7c, 0xc5, 0x88, 0x00, 0x0e, 0x4e,
+    0x69, 0x77, 0x02, 0x48, 0xe3, 0xd4, 0x67, 0xf2, 0xa6, 0xbe, 0x30, 0x36, 0xf7, 0xe3, 0xb7, 0xe7,
+    0x54, 0x8c, 0xa6, 0xee, 0x44, 0xcc, 0x78, 0x61, 0x81, 0xd8, 0x73, 0xd6, 0xa3, 0x3d, 0x7a, 0xfc,
+    0xc0, 0x7e, 0x3f, 0xe7, 0xa5, 0x4d, 0x82, 0xfd, 0x0e, 0x7d, 0x7a, 0xe2, 0xa3, 0x64, 0xd9, 0x9e,
+    0x81, 0xbd, 0x73, 0x8c, 0x56, 0x89, 0x9c, 0x73, 0x4c, 0x67, 0xde, 0x3d, 0x72, 0x47, 0x38, 0xa5,
+    0x5e, 0x4e, 0x73, 0xce, 0xee, 0x7b, 0x54, 0x9b, 0x08, 0x24, 0xe0, 0x67, 0x39, 0xe6, 0x85, 0x53,
+    0xca, 0xf3, 0x9c, 0xf7, 0x03, 0xf9, 0x53, 0xb9, 0x2a, 0x2c, 0x70, 0x18, 0x24, 0x01, 0xc7, 0x38,
+    0xfe, 0x75, 0x2e, 0x0a, 0x91, 0xc8, 0xea, 0x71, 0xd4, 0x54, 0x25, 0x76, 0x36, 0x72, 0x00, 0x3d,
+    0xbb, 0x54, 0xab, 0x80, 0x43, 0x06, 0xe7, 0xd2, 0xa1, 0x9d, 0x50, 0xd0, 0x94, 0x60, 0x6e, 0xcb,
+    0x73, 0xd4, 0x1f, 0xf3, 0xf4, 0xa5, 0x61, 0xbb, 0x1c, 0x0d, 0xdf, 0x5a, 0x8d, 0x58, 0x7c, 0xad,
+    0x90, 0x01, 0xc9, 0xa7, 0x6e, 0x39, 0xce, 0x3b, 0x70, 0x3b, 0x54, 0x58, 0xe9, 0x52, 0x42, 0xba,
+    0x8c, 0x10, 0x47, 0xcd, 0x9c, 0x60, 0x0a, 0x89, 0xc0, 0xdd, 0x9e, 0x4f, 0x5e, 0x7f, 0xc6, 0x9d,
+    0xbc, 0x30, 0x24, 0xf4, 0xfa, 0x9c, 0x52, 0x37, 0x2b, 0x96, 0xce, 0x07, 0x3f, 0xfd, 0x6a, 0x68,
+    0xce, 0x6d, 0x11, 0x3b, 0x74, 0x39, 0x38, 0x1d, 0x4f, 0x4a, 0x8c, 0x31, 0x50, 0x4e, 0x3a, 0x77,
+    0xf5, 0xf4, 0xa9, 0x4f, 0x52, 0x7e, 0xbc, 0x81, 0x51, 0x9c, 0xb0, 0x19, 0xc6, 0x01, 0xc7, 0xd2,
+    0xb4, 0x47, 0x24, 0xd3, 0x19, 0x91, 0xe6, 0x64, 0x72, 0x3a, 0xe4, 0xd3, 0xb3, 0xf3, 0x33, 0x05,
+    0xc2, 0xf5, 0xcf, 0xbd, 0x2e, 0xc5, 0x0b, 0x82, 0x47, 0x1e, 0xb4, 0x98, 0x63, 0xce, 0x38, 0xdb,
+    0xd7, 0x38, 0xa7, 0x73, 0x35, 0x16, 0x3d, 0x01, 0xc8, 0xf9, 0x49, 0xe4, 0x1c, 0xd4, 0x98, 0x04,
+    0x15, 0xc9, 0xda, 0x3b, 0x13, 0xde, 0xa3, 0x41, 0x86, 0x0d, 0xfc, 0x3e, 0xa4, 0x53, 0xc1, 0x00,
+    0x63, 0x04, 0x8c, 0x76, 0xeb, 0x50, 0xce, 0x8a, 0x7a, 0x13, 0x82, 0x31, 0x81, 0x91, 0x93, 0xd4,
+    0x0e, 0xf4, 0xbf, 0x29, 0x07, 0x20, 0xf5, 0x23, 0x19, 0xe4, 0x53, 0x32, 0x09, 0x2c, 0xa7, 0xd8,
+    0x8e, 0x3a, 0xfa, 0xd0, 0x48, 0x08, 0x7a, 0x9c, 0xf3, 0x82, 0x6a, 0x2c, 0x75, 0x46, 0x48, 0x77,
+    0xdd, 0xc6, 0x71, 0x8e, 0x9c, 0x9e, 0x29, 0xac, 0x41, 0x20, 0x8c, 0xe0, 0x74, 0x22, 0x8c, 0xe5,
+    0x71, 0x81, 0x93, 0xc1, 0x38, 0xa6, 0xbb, 0x0e, 0xbd, 0x79, 0xa1, 0x22, 0x66, 0xd1, 0x11, 0xf9,
+    0x43, 0x71, 0x82, 0x3f, 0xcf, 0xf9, 0xcd, 0x46, 0xec, 0xcc, 0x33, 0xb7, 0x80, 0x79, 0xa9, 0x59,
+    0x59, 0x89, 0xc0, 0xe3, 0xe9, 0xda, 0xa3, 0x7f, 0xe3, 0xe0, 0xf7, 0xfc, 0xbf, 0xce, 0x6b, 0x54,
+    0x72, 0x4d, 0x0c, 0x24, 0x7d, 0xdc, 0x63, 0x3d, 0x33, 0x40, 0x38, 0xcb, 0x7a, 0x60, 0x90, 0x78,
+    0xa7, 0x63, 0x72, 0xf0, 0x7f, 0x0f, 0xe5, 0x4b, 0x82, 0xa0, 0x81, 0x9c, 0x03, 0xce, 0x29, 0xdc,
+    0xc7, 0x95, 0x8b, 0x1f, 0xde, 0x51, 0x8c, 0x29, 0x27, 0xa0, 0xa9, 0x17, 0x85, 0x1d, 0xcf, 0x5e,
+    0x38, 0xa6, 0x2a, 0x82, 0x32, 0x49, 0x07, 0xfb, 0xd9, 0x3c, 0xd3, 0x81, 0x5e, 0x00, 0xce, 0x71,
+    0xcf, 0xf9, 0xef, 0x52, 0xce, 0x8a, 0x7a, 0x13, 0xa0, 0xc7, 0x23, 0x92, 0x48, 0x23, 0x77, 0x14,
+    0xab, 0x86, 0x38, 0x38, 0x20, 0x75, 0xe2, 0x98, 0xaf, 0x81, 0x92, 0xdf, 0x51, 0xe9, 0xfe, 0x71,
+    0x40, 0x65, 0x5c, 0x10, 0x47, 0x00, 0x56, 0x6d, 0x1d, 0x71, 0x92, 0x24, 0x00, 0x8e, 0x48, 0x21,
+    0x47, 0xe5, 0xf9, 0x53, 0x18, 0x76, 0xdb, 0xf2, 0xfa, 0xfb, 0x7f, 0x4a, 0x08, 0x19, 0xce, 0x31,
+    0xdf, 0x9e, 0xbe, 0xf4, 0xd6, 0x24, 0x75, 0x53, 0xc1, 0xe3, 0xf0, 0xa1, 0x0a, 0x52, 0x44, 0x4e,
+    0x09, 0x53, 0xd3, 0xa5, 0x30, 0xf1, 0x83, 0x8e, 0xa3, 0x00, 0xff, 0x00, 0x5a, 0x9e, 0x41, 0xb8,
+    0x83, 0x90, 0x48, 0xff, 0x00, 0x3c, 0x7e, 0x55, 0x5d, 0xc6, 0x70, 0xdc, 0xb7, 0xae, 0x6b, 0x44,
+    0x72, 0x4d, 0x5c, 0x69, 0x24, 0x64, 0x10, 0x4e, 0x3d, 0x4f, 0x1f, 0x5a, 0x51, 0xc7, 0x4c, 0x86,
+    0xea, 0x7d, 0xa9, 0xc4, 0x60, 0xe3, 0x3c, 0x1f, 0x4f, 0xf1, 0xa0, 0xf1, 0xf3, 0x06, 0xe4, 0x9e,
+    0x3f, 0xfd, 0x55, 0x57, 0x30, 0xe5, 0x62, 0x29, 0xde, 0x42, 0x83, 0xd7, 0xd0, 0xd4, 0xea, 0x32,
+    0x4e, 0x06, 0x40, 0xed, 0x9e, 0x95, 0x10, 0x19, 0x40, 0x17, 0x07, 0x9f, 0xc2, 0xa4, 0x65, 0x1b,
+    0x72, 0x33, 0xc9, 0xc7, 0x4c, 0xe6, 0xa5, 0x9b, 0xc1, 0x58, 0x95, 0x39, 0x00, 0x92, 0x49, 0x3d,
+    0x88, 0xa7, 0xfc, 0xa5, 0x83, 0xe4, 0xe3, 0xf9, 0xf6, 0xa8, 0x97, 0x19, 0xe4, 0x0d, 0xbf, 0xc5,
+    0xda, 0x9d, 0xb8, 0x85, 0xc1, 0xea, 0x47, 0x41, 0x8a, 0xcd, 0xa3, 0xae, 0x32, 0x44, 0x8d, 0x80,
+    0xa0, 0x6d, 0x24, 0x9e, 0x31, 0xd2, 0x98, 0x54, 0x67, 0x82, 0xc7, 0xd5, 0x71, 0xd6, 0x80, 0xc7,
+    0x69, 0x1e, 0x9c, 0xf0, 0x69, 0x8c, 0xdf, 0xbb, 0x62, 0x80, 0xf1, 0xe9, 0x42, 0x43, 0x94, 0x90,
+    0xc6, 0x07, 0x23, 0x24, 0x67, 0xd3, 0xbf, 0xf9, 0xeb, 0x51, 0xb0, 0xdc, 0x79, 0x00, 0x1c, 0xf4,
+    0x26, 0xa4, 0xcf, 0xcb, 0x8e, 0x4f, 0x71, 0x8e, 0xf4, 0xc2, 0xbf, 0x26, 0x79, 0xe0, 0xf4, 0xad,
+    0x11, 0xc9, 0x35, 0x72, 0x22, 0x39, 0xc7, 0x6f, 0xa7, 0xf3, 0xa4, 0xc7, 0x4c, 0xf1, 0xc7, 0xf9,
+    0xe9, 0x52, 0xb4, 0x5c, 0x93, 0xc8, 0xa6, 0x90, 0x3a, 0x77, 0xcf, 0x24, 0xf5, 0xeb, 0x55, 0x73,
+    0x9f, 0x95, 0x8e, 0x8d, 0x4e, 0xe0, 0x4b, 0x1e, 0x3f, 0x0e, 0x2a, 0x4c, 0x9e, 0xdd, 0x08, 0xc1,
+    0x38, 0xcf, 0xf5, 0xa8, 0xc0, 0x29, 0x9c, 0xb9, 0xed, 0x9e, 0x69, 0xe8, 0xc5, 0x9b, 0xa0, 0xfe,
+    0x5f, 0x8d, 0x4b, 0x36, 0x82, 0x25, 0x04, 0x8c, 0x1c, 0xe4, 0xe3, 0xa9, 0x34, 0xed, 0xa0, 0x0f,
+    0x94, 0x0e, 0x47, 0x4a, 0x8d, 0x5b, 0x1c, 0x1e, 0xde, 0xfc, 0x54, 0xa0, 0x85, 0x23, 0x83, 0xf5,
+    0xc5, 0x66, 0xce, 0xb8, 0x34, 0x28, 0xc1, 0x52, 0xb8, 0x51, 0xb4, 0xf3, 0x8a, 0x61, 0x38, 0xe7,
+    0x8c, 0xf6, 0xdb, 0xce, 0x7e, 0xbf, 0x95, 0x1b, 0x98, 0xb6, 0x40, 0x27, 0xbf, 0x27, 0xad, 0x1d,
+    0x1b, 0x9f, 0x94, 0x63, 0xa0, 0x1f, 0xe4, 0xd1, 0x62, 0xa5, 0x24, 0x34, 0xf4, 0xc6, 0x71, 0x83,
+    0xeb, 0xc1, 0xcd, 0x41, 0x26, 0x02, 0x63, 0x66, 0x06, 0x3b, 0x76, 0xa9, 0x72, 0x38, 0x24, 0xae,
+    0x7b, 0xfa, 0x7d, 0x6a, 0x3c, 0x9e, 0x36, 0x80, 0x30, 0x32, 0x06, 0x73, 0xed, 0x56, 0x8e, 0x59,
+    0xea, 0x30, 0x8c, 0x36, 0xdc, 0xf3, 0xdb, 0xdf, 0x9a, 0x4d, 0xd8, 0x20, 0xe3, 0xbf, 0xd2, 0x9e,
+    0xcb, 0x80, 0x7e, 0x53, 0xd7, 0x81, 0x8a, 0x68, 0x4f, 0x94, 0x76, 0xe3, 0x18, 0xe4, 0x8a, 0xbb,
+    0x9c, 0xee, 0x2c, 0x41, 0xb9, 0xb1, 0xd4, 0x8c, 0x9e, 0xdd, 0x3b, 0x54, 0xaa, 0x4f, 0xb0, 0xeb,
+    0xc0, 0xff, 0x00, 0x1a, 0x8d, 0x46, 0xe0, 0xa4, 0xf7, 0x35, 0x22, 0xe7, 0x8e, 0xc3, 0xb1, 0xe9,
+    0x49, 0x9a, 0x41, 0x32, 0x45, 0x27, 0xe5, 0xcb, 0x0e, 0x01, 0xeb, 0xcf, 0x35, 0x37, 0x46, 0x6e,
+    0x79, 0x3f, 0x9f, 0xe1, 0x51, 0x01, 0xc1, 0x00, 0x85, 0xce, 0x47, 0xb1, 0xf7, 0xa7, 0x6e, 0xc6,
+    0xd2, 0xa4, 0x9c, 0x8e, 0x31, 0x59, 0xb3, 0xae, 0x0d, 0x21, 0xfb, 0x40, 0xe0, 0x82, 0x00, 0xf4,
+    0xe7, 0xfc, 0xf7, 0xa6, 0xe5, 0x77, 0x60, 0x95, 0x1c, 0xf7, 0xa4, 0x0c, 0xae, 0x71, 0xb8, 0x1c,
+    0x0e, 0xb8, 0xff, 0x00, 0x3e, 0xb4, 0xd0, 0x7f, 0x8b, 0xa8, 0xc7, 0x20, 0xff, 0x00, 0x8d, 0x2b,
+    0x1a, 0x39, 0x20, 0x71, 0xcf, 0xcd, 0x83, 0xd7, 0x9f, 0x5a, 0x85, 0xf9, 0x6e, 0x72, 0x70, 0x0f,
+    0x18, 0xcf, 0xe3, 0x53, 0x38, 0x1f, 0x77, 0x6e, 0x0e, 0x79, 0xf4, 0x02, 0xa3, 0x20, 0x9e, 0x4e,
+    0x0f, 0x18, 0xfc, 0x6a, 0xd1, 0xcd, 0x53, 0x52, 0x13, 0xc9, 0x3c, 0x0e, 0x4f, 0x7a, 0x6e, 0x7e,
+    0x6e, 0x19, 0xbd, 0x71, 0x9e, 0xb5, 0x20, 0x42, 0x02, 0x9e, 0x30, 0x3b, 0xe3, 0x8f, 0xce, 0x9a,
+    0x53, 0x82, 0x7b, 0x63, 0x83, 0xea, 0x2a, 0xd3, 0x39, 0x5c, 0x59, 0x38, 0xf9, 0x49, 0xe7, 0x90,
+    0x7a, 0x67, 0xeb, 0xfe, 0x7f, 0x1a, 0x4e, 0x39, 0xe0, 0x7a, 0x9e, 0x79, 0xcd, 0x1b, 0x82, 0x9c,
+    0x8e, 0xdd, 0x6a, 0x26, 0x7c, 0x30, 0xc9, 0xcf, 0xd3, 0xd6, 0xa5, 0x23, 0x69, 0x4e, 0xc4, 0xc6,
+    0x40, 0xc3, 0x96, 0x19, 0xa4, 0xdc, 0x4e, 0x46, 0x33, 0x9e, 0xb5, 0x11, 0x24, 0x10, 0x33, 0x81,
+    0x8c, 0x67, 0x34, 0x06, 0x18, 0xc9, 0xc7, 0x1e, 0xbd, 0x3a, 0xd3, 0xe5, 0x25, 0x55, 0x26, 0x19,
+    0x2c, 0xdd, 0x4f, 0x1d, 0x8e, 0x29, 0x5b, 0x1d, 0x00, 0x07, 0xb7, 0x35, 0x10, 0x62, 0xe0, 0x1c,
+    0xf5, 0x3e, 0x9c, 0x67, 0xfc, 0x2a, 0x61, 0xc9, 0x3b, 0x80, 0x27, 0x38, 0x1c, 0xd4, 0xbd, 0x0d,
+    0x63, 0xa8, 0x6c, 0xc0, 0xdd, 0xd3, 0x3d, 0x48, 0x34, 0x85, 0x79, 0xdf, 0x9c, 0x29, 0xec, 0x07,
+    0x5c, 0x53, 0xd5, 0x00, 0x07, 0x6f, 0x24, 0x77, 0xec, 0x39, 0xa7, 0x95, 0x01, 0x89, 0xcf, 0x3d,
+    0xce, 0x6a, 0x6e, 0x6a, 0xa9, 0xdc, 0x83, 0x6f, 0x20, 0x01, 0xc0, 0xc0, 0xc9, 0xe7, 0x34, 0x36,
+    0xe0, 0x32, 0x72, 0x06, 0x46, 0x6a, 0x6d, 0x8a, 0x3b, 0x75, 0xe9, 0x91, 0x4c, 0x73, 0x85, 0xe0,
+    0x1c, 0x1e, 0x4e, 0x4e, 0x29, 0xdc, 0x4e, 0x16, 0x18, 0x7b, 0x10, 0xa4, 0x75, 0x19, 0x07, 0xfa,
+    0x75, 0xf5, 0xa0, 0xb9, 0x09, 0xd0, 0x13, 0xea, 0x45, 0x27, 0x52, 0xdf, 0xc4, 0x07, 0x1c, 0x62,
+    0xa2, 0x27, 0x69, 0x20, 0x81, 0xdb, 0x8e, 0xc7, 0xfc, 0x9a, 0xa4, 0x8c, 0x65, 0x2b, 0x12, 0xef,
+    0xd8, 0xbc, 0xf2, 0x4f, 0x6e, 0x98, 0x14, 0xac, 0xe0, 0x67, 0x83, 0xb4, 0x75, 0x3f, 0xe0, 0x2a,
+    0x0c, 0xed, 0x24, 0x15, 0xe7, 0x1c, 0x77, 0xc5, 0x38, 0xf2, 0x49, 0x23, 0xa7, 0x5a, 0x76, 0x23,
+    0xda, 0x92, 0x86, 0x18, 0xc6, 0x79, 0x3f, 0xe7, 0xf3, 0xa3, 0x2c, 0x06, 0xe0, 0x49, 0x23, 0xb9,
+    0xe9, 0xcd, 0x44, 0x33, 0xd5, 0x89, 0x23, 0x8e, 0x00, 0xa9, 0x46, 0xd6, 0x61, 0xd8, 0x11, 0x93,
+    0x91, 0xfa, 0x7e, 0xb5, 0x2d, 0x1a, 0x45, 0xdc, 0x5d, 0xab, 0x91, 0x81, 0x80, 0x48, 0xe7, 0xf9,
+    0x51, 0xb1, 0x97, 0x83, 0x92, 0xb9, 0xa9, 0x15, 0x4b, 0x23, 0x64, 0x8c, 0x91, 0x8e, 0x9e, 0xf4,
+    0xe0, 0x87, 0x27, 0xdc, 0x0c, 0x9a, 0x9b, 0x9b, 0x2a, 0x77, 0x20, 0x55, 0x27, 0x6f, 0x27, 0x83,
+    0xfe, 0x7f, 0x9d, 0x02, 0x3e, 0x01, 0x07, 0xf2, 0xe7, 0x9a, 0x9c, 0x26, 0x79, 0xe7, 0x27, 0xbf,
+    0xbf, 0xf9, 0xcd, 0x44, 0xe3, 0x69, 0x6e, 0x33, 0xdf, 0x38, 0x23, 0x34, 0x5c, 0x1d, 0x3b, 0x0d,
+    0x2d, 0x91, 0x92, 0xa3, 0x38, 0xcf, 0xf9, 0xf6, 0xa3, 0x76, 0x06, 0x70, 0x76, 0x67, 0x07, 0x34,
+    0xa4, 0xe7, 0x9e, 0x40, 0xf7, 0xff, 0x00, 0x3f, 0x4a, 0x89, 0xba, 0x96, 0xcf, 0x3d, 0x72, 0x6a,
+    0x92, 0x30, 0x94, 0xac, 0x3c, 0x48, 0x4b, 0x0d, 0xa3, 0x1f, 0xa5, 0x06, 0x4c, 0xe3, 0x07, 0x8e,
+    0x99, 0x23, 0xb5, 0x44, 0x49, 0x1e, 0x80, 0x63, 0x1c, 0x52, 0x29, 0x2e, 0x4b, 0x7a, 0xf5, 0xaa,
+    0xe5, 0x23, 0xda, 0x92, 0xef, 0x18, 0xf7, 0xeb, 0xc7, 0xbf, 0xa5, 0x28, 0x00, 0x15, 0xe0, 0xed,
+    0x1d, 0xb1, 0xf9, 0x7f, 0x3a, 0x88, 0x64, 0x8c, 0xe7, 0xbe, 0x31, 0x53, 0x2e, 0x4b, 0x6d, 0x25,
+    0x86, 0x47, 0x20, 0xfe, 0xb4, 0x9a, 0x2e, 0x32, 0xb8, 0x9b, 0x79, 0x23, 0x69, 0x19, 0xe2, 0x9c,
+    0xd1, 0xb1, 0x5c, 0x63, 0x24, 0x75, 0x34, 0xf0, 0xbd, 0x73, 0x93, 0x9f, 0x41, 0xc5, 0x3c, 0x28,
+    0x18, 0x00, 0x1f, 0x71, 0xde, 0xa2, 0xe6, 0xca, 0x9d, 0xc8, 0x42, 0x8c, 0x85, 0x61, 0xf2, 0xf6,
+    0xe6, 0x80, 0xa3, 0x3c, 0xe0, 0x83, 0x8e, 0x40, 0xc6, 0x2a, 0x62, 0x0e, 0xf3, 0x9f, 0xc7, 0x8f,
+    0x5a, 0x60, 0x38, 0x1d, 0x06, 0x01, 0xe9, 0x45, 0xc6, 0xe9, 0xd8, 0x8f, 0x6a, 0xae, 0x30, 0x31,
+    0x9e, 0xa4, 0x1c, 0xd0, 0xe4, 0x67, 0x1d, 0xb3, 0xd3, 0xfa, 0x62, 0x9c, 0x78, 0x39, 0x4e, 0x3d,
+    0x7b, 0x9f, 0xf3, 0xf5, 0xa8, 0x8e, 0x01, 0xf9, 0x46, 0x09, 0xce, 0x33, 0x8c, 0xff, 0x00, 0x9e,
+    0x6a, 0x91, 0x8c, 0x9d, 0x87, 0x97, 0xdc, 0x01, 0xdc, 0x0b, 0x7a, 0x9e, 0x38, 0xa6, 0xef, 0xee,
+    0x30, 0x48, 0xeb, 0x9e, 0xd5, 0x1e, 0x4e, 0x19, 0x32, 0x38, 0xce, 0x29, 0x0b, 0xf3, 0xc6, 0x00,
+    0x3d, 0x01, 0xc7, 0x35, 0x5c, 0xa6, 0x7e, 0xd4, 0x9b, 0x23, 0x93, 0x81, 0x9e, 0xb8, 0x6e, 0x83,
+    0xfc, 0xe2, 0x9c, 0x48, 0xdf, 0x8c, 0x80, 0x5b, 0x93, 0xd6, 0xa2, 0x57, 0x20, 0xab, 0x37, 0xde,
+    0x34, 0xe5, 0x61, 0x90, 0x33, 0xcf, 0x7c, 0x9c, 0xd2, 0x68, 0xb8, 0xca, 0xe3, 0xc0, 0xc3, 0x0f,
+    0x4f, 0x6f, 0x5a, 0x43, 0x18, 0xdb, 0x92, 0x33, 0x9e, 0xbc, 0xd4, 0xa9, 0x83, 0xc8, 0x3d, 0x47,
+    0x4e, 0xb4, 0xaa, 0xbb, 0xc8, 0xcf, 0x63, 0xf8, 0x7d, 0x2a, 0x2e, 0x6d, 0x18, 0x5c, 0x8b, 0xcb,
+    0xdb, 0xd7, 0x3c, 0xf7, 0x23, 0xf3, 0xa0, 0x63, 0x2b, 0x85, 0x38, 0x3c, 0xe4, 0x8a, 0x97, 0x04,
+    0xa9, 0x1d, 0x70, 0x3b, 0x74, 0xcd, 0x0c, 0xa3, 0x8e, 0x30, 0x71, 0xfa, 0x51, 0xcc, 0x37, 0x4e,
+    0xc4, 0x2d, 0xd4, 0xe5, 0x49, 0xf7, 0xef, 0xd7, 0xfc, 0xfb, 0x52, 0x8c, 0x29, 0xc6, 0x48, 0x23,
+    0x9a, 0x1b, 0x8c, 0x83, 0xc0, 0x27, 0x9c, 0x1f, 0xfe, 0xbd, 0x30, 0xb1, 0x53, 0xc1, 0xe7, 0x39,
+    0xf7, 0x35, 0x4b, 0x53, 0x29, 0x68, 0x05, 0xc7, 0x7c, 0x13, 0xdc, 0x0e, 0xd4, 0xe0, 0xf8, 0x1c,
+    0x0c, 0x01, 0xef, 0x50, 0x86, 0xc9, 0x2a, 0x4e, 0xe1, 0xe8, 0x47, 0x5a, 0x42, 0xc7, 0x70, 0xe8,
+    0x09, 0xe9, 0xf8, 0xf3, 0xc5, 0x57, 0x29, 0x93, 0xaa, 0x4e, 0x8f, 0x82, 0x70, 0x79, 0xe9, 0x40,
+    0x3e, 0x62, 0x8e, 0x79, 0xc6, 0x3a, 0x1e, 0xb5, 0x02, 0x31, 0x2c, 0x72, 0x08, 0x24, 0x63, 0x8a,
+    0x91, 0x79, 0x25, 0xd4, 0xf4, 0xe4, 0x9f, 0x5a, 0x4d, 0x15, 0x19, 0xdc, 0x7e, 0xdd, 0xc7, 0x04,
+    0x9e, 0xdd, 0xba, 0xd2, 0x80, 0x03, 0x92, 0x08, 0xe7, 0x8c, 0x74, 0xa1, 0x46, 0x57, 0x81, 0x81,
+    0xf9, 0xd4, 0x91, 0xae, 0xe0, 0x39, 0xe9, 0xd3, 0xde, 0xa5, 0xb3, 0x68, 0xc2, 0xe4, 0x5b, 0x02,
+    0xe0, 0x75, 0xe3, 0x8f, 0x7f, 0x7a, 0x0f, 0x18, 0x55, 0xcf, 0x1c, 0x70, 0x05, 0x4c, 0x57, 0x0a,
+    0x76, 0x85, 0xe3, 0xb1, 0xea, 0x3f, 0xcf, 0xf4, 0xa4, 0x3c, 0x0c, 0x37, 0x20, 0x70, 0x14, 0x73,
+    0x9a, 0x5c, 0xc5, 0xba, 0x44, 0x44, 0x30, 0x19, 0x0a, 0x08, 0xe0, 0x71, 0x48, 0xcd, 0x90, 0x49,
+    0x27, 0x07, 0x80, 0x7b, 0x53, 0xca, 0xe3, 0x1d, 0x40, 0xcf, 0x7e, 0xf4, 0xc6, 0x1f, 0xbb, 0xcf,
+    0x5e, 0xb8, 0x18, 0xed, 0xfe, 0x45, 0x52, 0x31, 0x96, 0x83, 0x89, 0x03, 0x3c, 0x8c, 0xff, 0x00,
+    0x23, 0x4d, 0x32, 0x1e, 0x99, 0xe7, 0xae, 0x33, 0xc1, 0x15, 0x11, 0x38, 0x07, 0x1c, 0x8f, 0x5f,
+    0xa7, 0xbd, 0x23, 0x67, 0x80, 0x4f, 0x5f, 0x7a, 0xae, 0x53, 0x27, 0x52, 0xc5, 0x84, 0x7c, 0x8c,
+    0x0c, 0x73, 0x9d, 0xd4, 0xdd, 0xe1, 0x81, 0x24, 0x01, 0xd8, 0xe0, 0x0f, 0xf3, 0xda, 0xa1, 0xcf,
+    0x3c, 0x10, 0x0e, 0x7f, 0x5a, 0x91, 0x70, 0x09, 0x1b, 0xf3, 0x93, 0xb8, 0x7b, 0xd2, 0x68, 0x6a,
+    0x77, 0x1d, 0x86, 0xc1, 0xc0, 0xe0, 0xfb, 0x74, 0xa7, 0x6c, 0xce, 0x30, 0x30, 0x76, 0xf0, 0x31,
+    0x9a, 0x4e, 0x40, 0x53, 0xc8, 0x0b, 0xeb, 0xde, 0xa4, 0xc0, 0x0a, 0x00, 0x27, 0x91, 0xd3, 0xa8,
+    0x15, 0x2d, 0x9b, 0xc6, 0x37, 0x18, 0x53, 0x71, 0x24, 0x28, 0xe0, 0x12, 0x78, 0xeb, 0xcd, 0x37,
+    0x68, 0xe9, 0x9e, 0x33, 0xfc, 0x3d, 0xea, 0xc2, 0xa9, 0x2b, 0x80, 0x32, 0x0f, 0x71, 0xdb, 0xf2,
+    0xa5, 0x64, 0xf9, 0x40, 0x03, 0x23, 0xe9, 0x4b, 0x98, 0xbf, 0x64, 0x57, 0xd9, 0xd4, 0xf0, 0x09,
+    0xe9, 0x8a, 0x0e, 0xd3, 0xf5, 0x07, 0x04, 0x9c, 0xd4, 0x92, 0x29, 0xda, 0x40, 0xc9, 0x27, 0xb1,
+    0xa8, 0x89, 0x1b, 0x88, 0xc9, 0xc7, 0xd7, 0xa5, 0x35, 0xa9, 0x94, 0x95, 0x83, 0x77, 0xcd, 0xc7,
+    0x5f, 0xfe, 0xbf, 0x53, 0x40, 0x20, 0x1d, 0xc0, 0xe3, 0xdb, 0xd4, 0x75, 0xa8, 0x99, 0xc0, 0x20,
+    0x8c, 0xed, 0x07, 0xd2, 0x8e, 0x8d, 0x83, 0xd7, 0xa6, 0x7f, 0xcf, 0xe5, 0x55, 0x63, 0x17, 0x52,
+    0xc4, 0xbb, 0xb3, 0xcf, 0x6c, 0xf4, 0xf7, 0xff, 0x00, 0x26, 0x93, 0x76, 0x3a, 0xf0, 0x54, 0xf1,
+    0xc6, 0x7f, 0xcf, 0x6a, 0x89, 0x5b, 0x04, 0x13, 0x8d, 0xa4, 0xfa, 0x62, 0x9f, 0xbd, 0x5b, 0x2b,
+    0xc0, 0xef, 0x45, 0x86, 0xaa, 0x5c, 0x90, 0x65, 0x79, 0x03, 0x8c, 0xf7, 0xe2, 0x94, 0x29, 0x1f,
+    0x29, 0x0b, 0x92, 0x28, 0x09, 0xb8, 0x8e, 0xc2, 0xa4, 0x09, 0x80, 0x03, 0x9e, 0x87, 0xb7, 0x39,
+    0xfc, 0x2a, 0x5b, 0x36, 0x8c, 0x6e, 0x44, 0x7a, 0xb0, 0x6c, 0x64, 0x72, 0x38, 0xa0, 0x29, 0x3d,
+    0x06, 0x07, 0x00, 0x0a, 0x98, 0x0c, 0x7b, 0x7e, 0x3d, 0xa9, 0x76, 0xf3, 0x96, 0x1f, 0xfd, 0x6a,
+    0x5c, 0xc6, 0x9e, 0xc8, 0x87, 0x03, 0x38, 0x03, 0x20, 0x70, 0x78, 0xa4, 0x20, 0x0d, 0xe4, 0x01,
+    0xdf, 0x81, 0x4e, 0xe1, 0x0e, 0x70, 0xbf, 0x50, 0x69, 0x8c, 0x01, 0x52, 0x38, 0xcf, 0x5f, 0x4a,
+    0x68, 0xce, 0x51, 0xb0, 0x36, 0x55, 0x48, 0x24, 0xf1, 0x92, 0x08, 0x34, 0x17, 0xe8, 0x40, 0xc8,
+    0x1d, 0x2a, 0x3c, 0xed, 0xcf, 0x5e, 0x7b, 0x9a, 0x46, 0x3b, 0x89, 0xc7, 0x40, 0x3b, 0x76, 0xaa,
+    0xb1, 0x8b, 0xa9, 0x62, 0x55, 0x93, 0x71, 0x20, 0x91, 0xcf, 0x53, 0x8e, 0x7f, 0x4a, 0x0b, 0x06,
+    0x53, 0x91, 0xf2, 0xfa, 0x54, 0x01, 0xce, 0xde, 0x48, 0x00, 0x9e, 0xd4, 0xf5, 0xe8, 0x3a, 0x00,
+    0x0e, 0x3a, 0x73, 0xff, 0x00, 0xeb, 0xa7, 0x61, 0x2a, 0x97, 0x25, 0x27, 0x23, 0x18, 0xfc, 0x41,
+    0xa5, 0xdb, 0xbb, 0x98, 0xc7, 0x5f, 0xd2, 0x9b, 0xdc, 0x29, 0x07, 0x3f, 0x5e, 0xb5, 0x28, 0xcb,
+    0x0c, 0xe7, 0x07, 0x3f, 0xd2, 0xa1, 0x9b, 0x45, 0x5c, 0x8b, 0x1f, 0x28, 0x07, 0x81, 0xde, 0x9e,
+    0x91, 0x92, 0x72, 0x07, 0xd3, 0x23, 0xa5, 0x49, 0xb0, 0x60, 0x10, 0x3f, 0xdd, 0xc1, 0xa3, 0x6e,
+    0x40, 0x7c, 0xe4, 0x8f, 0x5a, 0x5c, 0xc6, 0xbe, 0xc8, 0x8c, 0x06, 0x04, 0x73, 0xd7, 0x04, 0xe3,
+    0xd2, 0x9a, 0x0e, 0xd3, 0x8c, 0x8c, 0x93, 0xc7, 0x3d, 0x2a, 0x52, 0x0f, 0xde, 0xe3, 0x6e, 0x3a,
+    0xff, 0x00, 0x5a, 0x63, 0x6d, 0x1c, 0x0e, 0xbd, 0x3a, 0xfe, 0x94, 0xd3, 0x22, 0x51, 0xb0, 0x8d,
+    0x95, 0x38, 0xe7, 0x9a, 0x43, 0x29, 0x0c, 0x37, 0x1f, 0x9b, 0xa1, 0x00, 0xd3, 0x1f, 0x9c, 0xe7,
+    0x69, 0x23, 0xa6, 0x4f, 0xbd, 0x30, 0xb8, 0x52, 0x09, 0x5c, 0x81, 0xd4, 0xfa, 0x55, 0x24, 0x60,
+    0xe7, 0x62, 0x6d, 0xf9, 0xdc, 0x0f, 0x27, 0x92, 0x38, 0xed, 0x49, 0x90, 0x46, 0x38, 0xe9, 0xfc,
+    0x22, 0xa1, 0xf5, 0x53, 0x93, 0xc6, 0x73, 0xfe, 0x34, 0xed, 0xfc, 0x0c, 0x7d, 0xea, 0x76, 0x12,
+    0xa9, 0x72, 0x5c, 0x80, 0x41, 0x23, 0x90, 0x71, 0x81, 0x9a, 0x39, 0x0c, 0xc3, 0x69, 0xf6, 0xa6,
+    0xae, 0x18, 0xfc, 0xbc, 0x01, 0xd3, 0x8f, 0x7a, 0x96, 0x3d, 0xb9, 0x00, 0x8c, 0xf7, 0xe3, 0xbd,
+    0x4b, 0xd0, 0xda, 0x2a, 0xe2, 0x61, 0x4b, 0x64, 0x8e, 0x47, 0xf9, 0xcd, 0x02, 0x33, 0x82, 0x06,
+    0x73, 0xed, 0xd0, 0x54, 0xa7, 0xa0, 0x1b, 0x73, 0xe9, 0xef, 0x46, 0x40, 0x18, 0xe4, 0xf1, 0xce,
+    0x46, 0x2a, 0x6e, 0x6a, 0xa9, 0x10, 0x84, 0x23, 0xe6, 0x3c, 0x95, 0xf4, 0xa4, 0x00, 0x15, 0x0c,
+    0x1b, 0xb6, 0x4e, 0x3f, 0xcf, 0xad, 0x48, 0x40, 0x24, 0x8c, 0xe0, 0x63, 0x06, 0xa3, 0xdb, 0xb0,
+    0x9e, 0xbc, 0x7e, 0x62, 0x9a, 0x77, 0x22, 0x50, 0xb0, 0xbb, 0xf1, 0x26, 0x5b, 0xf0, 0xa6, 0xee,
+    0xf9, 0x46, 0x07, 0xeb, 0x8f, 0xf2, 0x29, 0xad, 0x9d, 0xdc, 0x9c, 0xff, 0x00, 0xc0, 0x69, 0x8a,
+    0x31, 0xd3, 0x24, 0x10, 0x32, 0x2a, 0x92, 0x31, 0x94, 0xec, 0x4a, 0xaf, 0x9e, 0xd9, 0x27, 0xbd,
+    0x1b, 0xf0, 0x0e, 0x7b, 0x0c, 0xe3, 0xa8, 0x15, 0x10, 0x61, 0xc8, 0x01, 0x87, 0x04, 0x0a, 0x03,
+    0xf0, 0x33, 0xf9, 0x1e, 0x7f, 0x0f, 0xe5, 0x4e, 0xc4, 0xaa, 0xa4, 0xdb, 0xb2, 0x46, 0x01, 0x27,
+    0x3b, 0xba, 0x63, 0x9a, 0x08, 0x38, 0xce, 0x40, 0xf5, 0xcf, 0xad, 0x22, 0xe4, 0x32, 0xe3, 0x91,
+    0x8c, 0x7a, 0x0e, 0xb4, 0xf5, 0xeb, 0x8c, 0xe3, 0x1d, 0x4f, 0xf9, 0xef, 0x52, 0xcd, 0x63, 0xa8,
+    0x04, 0xe3, 0x04, 0x75, 0xe3, 0x8a, 0x4d, 0x99, 0x39, 0x1c, 0xe0, 0xe0, 0x64, 0x54, 0xaa, 0x32,
+    0xbc, 0xf1, 0x83, 0x4b, 0x87, 0x6c, 0x93, 0xf7, 0x7d, 0x3d, 0x33, 0x53, 0xcc, 0x6a, 0xa9, 0x5c,
+    0xff, 0xd9,
+};
+
+#endif // BENCHIMAGE_H
@@ -0,0 +1,199 @@
+#include "bmp.h"
+#include "budget.h"
+
+// ==================== BMP Format ====================
+#define BMP_STRIP_ROWS 16     // File rows read per strip
+
+#define BMP_RGB 0
+#define BMP_BITFIELDS 3
+
+struct BmpHeader {
+    uint32_t dataOffset;
+    uint32_t headerSize;
+    int32_t width;
+    int32_t height;         // Negative for top-down files
+    uint16_t bitCount;
+    uint32_t compression;
+    uint32_t colorsUsed;
+};
+
+// Field of a 16/32-bit pixel, widened to 8 bits
+struct BmpChannel {
+    uint32_t mask;
+    uint8_t shift;
+    uint8_t bits;
+};
+
+static uint16_t readLE16(const uint8_t* p) {
+    return p[0] | (p[1] << 8);
+}
+
+static uint32_t readLE32(const uint8_t* p) {
+    return p[0] | (p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static int readHeader(File& file, BmpHeader& header) {
+    uint8_t buf[54];
+    if (decodeRead(file, buf, sizeof(buf)) != sizeof(buf)) return DECODE_READ_ERROR;
+    if (buf[0] != 'B' || buf[1] != 'M') return DECODE_BAD_STRUCTURE;
+    
+    header.dataOffset = readLE32(buf + 10);
+    header.headerSize = readLE32(buf + 14);
+    // OS/2 BITMAPCOREHEADER has 16-bit sizes and is long obsolete
+    if (header.headerSize < 40) return DECODE_UNSUPPORTED;
+    
+    header.width = (int32_t)readLE32(buf + 18);
+    header.height = (int32_t)readLE32(buf + 22);
+    header.bitCount = readLE16(buf + 28);
+    header.compression = readLE32(buf + 30);
+    header.colorsUsed = readLE32(buf + 46);
+    
+    int32_t height = header.height < 0 ? -header.height : header.height;
+    if (header.width <= 0 || height == 0) return DECODE_BAD_STRUCTURE;
+    if (header.width > 0xFFFF || height > 0xFFFF) return DECODE_UNSUPPORTED;
+    return DECODE_OK;
+}
+
+static BmpChannel makeChannel(uint32_t mask) {
+    BmpChannel channel = {mask, 0, 0};
+    if (mask == 0) return channel;
+    while (!(mask & 1)) {
+        mask >>= 1;
+        channel.shift++;
+    }
+    while (mask & 1) {
+        mask >>= 1;
+        channel.bits++;
+    }
+    return channel;
+}
+
+static inline uint8_t channelValue(uint32_t pixel, const BmpChannel& channel) {
+    if (channel.bits == 0) return 0;
+    uint32_t v = (pixel & channel.mask) >> channel.shift;
+    if (channel.bits >= 8) return v >> (channel.bits - 8);
+    return v * 255 / ((1 << channel.bits) - 1);
+}
+
+// ==================== Decoder Interface ====================
+static bool bmpProbe(const uint8_t* magic) {
+    // The DIB header is checked when the file is read
+    return magic[0] == 'B' && magic[1] == 'M';
+}
+
+static int bmpGetSize(File& file, uint16_t* w, uint16_t* h) {
+    BmpHeader header;
+    int res = readHeader(file, header);
+    if (res == DECODE_OK) {
+        *w = header.width;
+        *h = header.height < 0 ? -header.height : header.height;
+    }
+    return res;
+}
+
+static int bmpDecode(File& file, uint8_t scale, ImageBlockSink sink, void* ctx) {
+    BmpHeader header;
+    int res = readHeader(file, header);
+    if (res != DECODE_OK) return res;
+    
+    uint16_t bits = header.bitCount;
+    bool paletted = bits == 1 || bits == 4 || bits == 8;
+    if (!paletted && bits != 16 && bits != 24 && bits != 32) return DECODE_UNSUPPORTED;
+    if (header.compression != BMP_RGB && !(header.compression == BMP_BITFIELDS && (bits == 16 || bits == 32))) {
+        return DECODE_UNSUPPORTED;
+    }
+    
+    // Palette entries are B, G, R, reserved
+    uint8_t palette[256 * 3];
+    if (paletted) {
+        uint32_t colors = header.colorsUsed ? min<uint32_t>(header.colorsUsed, 256) : (1 << bits);
+        uint8_t entry[4];
+        memset(palette, 0, sizeof(palette));
+        if (!file.seek(14 + header.headerSize)) return DECODE_READ_ERROR;
+        for (uint32_t i = 0; i < colors; i++) {
+            if (decodeRead(file, entry, 4) != 4) return DECODE_READ_ERROR;
+            palette[i * 3] = entry[2];
+            palette[i * 3 + 1] = entry[1];
+            palette[i * 3 + 2] = entry[0];
+        }
+    }
+    
+    // 16/32-bit layouts: masks follow the 40-byte header (or sit inside V4/V5)
+    BmpChannel red, green, blue;
+    if (header.compression == BMP_BITFIELDS) {
+        uint8_t masks[12];
+        if (!file.seek(14 + 40) || decodeRead(file, masks, 12) != 12) return DECODE_READ_ERROR;
+        red = makeChannel(readLE32(masks));
+        green = makeChannel(readLE32(masks + 4));
+        blue = makeChannel(readLE32(masks + 8));
+    } else if (bits == 16) {
+        red = makeChannel(0x7C00);
+        green = makeChannel(0x03E0);
+        blue = makeChannel(0x001F);
+    } else {
+        red = makeChannel(0xFF0000);
+        green = makeChannel(0x00FF00);
+        blue = makeChannel(0x0000FF);
+    }
+    
+    uint32_t width = header.width;
+    uint32_t height = header.height < 0 ? -header.height : header.height;
+    bool bottomUp = header.height > 0;
+    uint32_t stride = ((width * bits + 31) / 32) * 4;
+    
+    ArenaScope arena(ARENA_DECODE);
+    uint8_t* strip = (uint8_t*)arena.alloc(stride * BMP_STRIP_ROWS);
+    uint8_t* rgb = (uint8_t*)arena.alloc(width * 3);
+    RowReducer reducer;
+    res = (strip && rgb) ? rowReducerBegin(reducer, width, height, scale, sink, ctx) : DECODE_NO_MEMORY;
+    
+    for (uint32_t top = 0; res == DECODE_OK && top < height; top += BMP_STRIP_ROWS) {
+        uint32_t rows = min<uint32_t>(BMP_STRIP_ROWS, height - top);
+        
+        // Bottom-up files keep this strip in reverse order, ending at row `top`
+        uint32_t first = bottomUp ? height - top - rows : top;
+        if (!file.seek(header.dataOffset + first * stride) ||
+            decodeRead(file, strip, rows * stride) != rows * stride) {
+            res = DECODE_READ_ERROR;
+            break;
+        }
+        
+        for (uint32_t j = 0; j < rows && res == DECODE_OK; j++) {
+            const uint8_t* x = strip + (bottomUp ? rows - 1 - j : j) * stride;
+            uint8_t* out = rgb;
+            
+            for (uint32_t i = 0; i < width; i++) {
+                if (paletted) {
+                    uint32_t bit = i * bits;
+                    uint8_t index = (x[bit >> 3] >> (8 - bits - (bit & 7))) & ((1 << bits) - 1);
+                    memcpy(out, palette + index * 3, 3);
+                } else if (bits == 24) {
+                    out[0] = x[i * 3 + 2];
+                    out[1] = x[i * 3 + 1];
+                    out[2] = x[i * 3];
+                } else {
+                    uint32_t pixel = bits == 16 ? readLE16(x + i * 2) : readLE32(x + i * 4);
+                    out[0] = channelValue(pixel, red);
+                    out[1] = channelValue(pixel, green);
+                    out[2] = channelValue(pixel, blue);
+                }
+                out += 3;
+            }
+            
+            if (!rowReducerPush(reducer, rgb)) res = DECODE_INTERRUPTED;
+        }
+    }
+    
+    if (res == DECODE_OK && !rowReducerFinish(reducer)) res = DECODE_INTERRUPTED;
+    
+    if (strip && rgb) rowReducerEnd(reducer);
+    return res;
+}
+
+const ImageDecoder bmpDecoder = {
+    "BMP",
+    ".bmp",
+    bmpProbe,
+    bmpGetSize,
+    bmpDecode,
+};
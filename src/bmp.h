@@ -0,0 +1,11 @@
+#ifndef BMP_H
+#define BMP_H
+
+#include "decoder.h"
+
+// ==================== BMP Decoder ====================
+// Uncompressed 1/4/8-bit palette, 16-bit and 24/32-bit BMPs. Rows are read
+// in strips top to bottom whichever way the file stores them.
+extern const ImageDecoder bmpDecoder;
+
+#endif // BMP_H
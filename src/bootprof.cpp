@@ -0,0 +1,42 @@
+#include "bootprof.h"
+
+struct BootPhase {
+    const char* name;
+    uint32_t micros;
+};
+
+static BootPhase phases[BOOT_PHASES_MAX];
+static int phaseCount = 0;
+static uint32_t firstPhotoMicros = 0;
+
+void bootMark(const char* phase) {
+    if (phaseCount >= BOOT_PHASES_MAX) return;
+    phases[phaseCount].name = phase;
+    phases[phaseCount].micros = micros();
+    phaseCount++;
+}
+
+void bootFirstPhoto() {
+    if (firstPhotoMicros) return;
+    firstPhotoMicros = micros();
+    bootMark("first photo");
+}
+
+uint32_t bootFirstPhotoMs() {
+    return firstPhotoMicros / 1000;
+}
+
+void printBootProfile() {
+    Serial.println("Boot profile (ms since app start):");
+    uint32_t last = 0;
+    for (int i = 0; i < phaseCount; i++) {
+        Serial.printf("  %-14s %8.1f  +%7.1f\n", phases[i].name, phases[i].micros / 1000.0f,
+                      (phases[i].micros - last) / 1000.0f);
+        last = phases[i].micros;
+    }
+    if (firstPhotoMicros) {
+        Serial.printf("Time to first photo: %.1f ms\n", firstPhotoMicros / 1000.0f);
+    } else {
+        Serial.println("Time to first photo: no photo shown");
+    }
+}
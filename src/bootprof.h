@@ -0,0 +1,17 @@
+#ifndef BOOTPROF_H
+#define BOOTPROF_H
+
+#include <Arduino.h>
+
+// ==================== Boot Profile ====================
+// When each setup() phase ended, counted from the start of the app (ROM
+// and bootloader time before it is not included). Time to first photo is
+// the number to watch; 'p' on Serial prints the table again.
+#define BOOT_PHASES_MAX 12
+
+void bootMark(const char* phase);   // Phase that just finished
+void bootFirstPhoto();              // A photo is on screen; later calls are ignored
+uint32_t bootFirstPhotoMs();        // 0 until then
+void printBootProfile();
+
+#endif // BOOTPROF_H
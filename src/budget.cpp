@@ -0,0 +1,167 @@
+#include "budget.h"
+#include "config.h"
+#include "display.h"
+#include "log.h"
+#include <esp_heap_caps.h>
+
+#define SLOT_BYTES (FRAME_PIXELS * sizeof(uint16_t))
+#define ARENA_ALIGN 16
+
+// ==================== Frame Pool ====================
+// One block for all slots, so adjacent slots make a contiguous run. A
+// run's first slot records its length.
+static uint8_t* poolBase = NULL;
+static FrameOwner slotOwner[FRAME_POOL_SLOTS];
+static uint8_t runLength[FRAME_POOL_SLOTS];
+static FramePoolStats poolStats;
+
+void* framePoolTakeRun(FrameOwner owner, int count) {
+    int n = poolStats.slots;
+    for (int first = 0; count > 0 && first + count <= n; first++) {
+        int length = 0;
+        while (length < count && slotOwner[first + length] == FRAME_OWNER_NONE) length++;
+        if (length < count) {
+            first += length;
+            continue;
+        }
+        
+        for (int i = 0; i < count; i++) slotOwner[first + i] = owner;
+        runLength[first] = count;
+        poolStats.owned[FRAME_OWNER_NONE] -= count;
+        poolStats.owned[owner] += count;
+        uint8_t used = poolStats.slots - poolStats.owned[FRAME_OWNER_NONE];
+        if (used > poolStats.peak) poolStats.peak = used;
+        return poolBase + (size_t)first * SLOT_BYTES;
+    }
+    poolStats.misses++;
+    return NULL;
+}
+
+uint16_t* framePoolTake(FrameOwner owner) {
+    return (uint16_t*)framePoolTakeRun(owner, 1);
+}
+
+void framePoolRelease(const void* memory) {
+    if (!memory || !poolBase) return;
+    int first = ((const uint8_t*)memory - poolBase) / SLOT_BYTES;
+    if (first < 0 || first >= poolStats.slots || runLength[first] == 0) return;
+    
+    FrameOwner owner = slotOwner[first];
+    int count = runLength[first];
+    for (int i = 0; i < count; i++) slotOwner[first + i] = FRAME_OWNER_NONE;
+    runLength[first] = 0;
+    poolStats.owned[owner] -= count;
+    poolStats.owned[FRAME_OWNER_NONE] += count;
+}
+
+const FramePoolStats& framePoolStats() {
+    return poolStats;
+}
+
+// ==================== Arenas ====================
+struct Arena {
+    uint8_t* base;
+    ArenaStats stats;
+    uint32_t watch;     // Peak use in the current watched span
+};
+
+static Arena arenas[ARENA_COUNT];
+static const uint32_t arenaSizes[ARENA_COUNT] = {DECODE_ARENA_SIZE, LIBRARY_ARENA_SIZE, UPLOAD_ARENA_SIZE};
+static const char* arenaNames[ARENA_COUNT] = {"decode", "library", "upload"};
+
+void* arenaAlloc(MemArena id, size_t bytes) {
+    Arena& arena = arenas[id];
+    size_t rounded = (bytes + ARENA_ALIGN - 1) & ~(size_t)(ARENA_ALIGN - 1);
+    if (!arena.base || rounded > arena.stats.size - arena.stats.used) {
+        arena.stats.misses++;
+        return NULL;
+    }
+    
+    void* memory = arena.base + arena.stats.used;
+    arena.stats.used += rounded;
+    if (arena.stats.used > arena.stats.peak) arena.stats.peak = arena.stats.used;
+    if (arena.stats.used > arena.watch) arena.watch = arena.stats.used;
+    return memory;
+}
+
+uint32_t arenaMark(MemArena id) {
+    return arenas[id].stats.used;
+}
+
+void arenaRelease(MemArena id, uint32_t mark) {
+    if (mark < arenas[id].stats.used) arenas[id].stats.used = mark;
+}
+
+const ArenaStats& arenaStats(MemArena id) {
+    return arenas[id].stats;
+}
+
+const char* arenaName(MemArena id) {
+    return arenaNames[id];
+}
+
+uint32_t arenaWatchStart(MemArena id) {
+    uint32_t outer = arenas[id].watch;
+    arenas[id].watch = arenas[id].stats.used;
+    return outer;
+}
+
+uint32_t arenaWatchStop(MemArena id, uint32_t outer) {
+    uint32_t peak = arenas[id].watch;
+    arenas[id].watch = max(outer, peak);
+    return peak;
+}
+
+ArenaScope::ArenaScope(MemArena a) : arena(a) {
+    mark = arenaMark(a);
+}
+
+ArenaScope::~ArenaScope() {
+    arenaRelease(arena, mark);
+}
+
+// ==================== Reservation ====================
+bool budgetBegin() {
+    if (poolBase) return true;
+    
+    // The pool goes first, while the largest block is still there; with
+    // less PSRAM than planned it shrinks rather than failing outright
+    int slots = FRAME_POOL_SLOTS;
+    while (slots > 0 && !poolBase) {
+        poolBase = (uint8_t*)heap_caps_aligned_alloc(ARENA_ALIGN, slots * SLOT_BYTES, MALLOC_CAP_SPIRAM);
+        if (!poolBase) slots--;
+    }
+    poolStats.slots = slots;
+    poolStats.owned[FRAME_OWNER_NONE] = slots;
+    
+    bool ok = slots == FRAME_POOL_SLOTS;
+    uint32_t reserved = slots * SLOT_BYTES;
+    for (int i = 0; i < ARENA_COUNT; i++) {
+        arenas[i].base = (uint8_t*)heap_caps_aligned_alloc(ARENA_ALIGN, arenaSizes[i], MALLOC_CAP_SPIRAM);
+        arenas[i].stats.size = arenas[i].base ? arenaSizes[i] : 0;
+        reserved += arenas[i].stats.size;
+        ok = ok && arenas[i].base;
+    }
+    
+    if (ok) {
+        LOG_I("Memory budget: %lu KB of PSRAM reserved\n", (unsigned long)(reserved / 1024));
+    } else {
+        LOG_E("Memory budget: only %lu KB of PSRAM reserved, %d of %d frame slots\n",
+              (unsigned long)(reserved / 1024), slots, FRAME_POOL_SLOTS);
+    }
+    return ok;
+}
+
+// ==================== Serial Report ====================
+void printBudget() {
+    Serial.printf("MEM frames %u/%u in use (cache %u, clip %u, motion %u), peak %u, misses %lu\n",
+                  poolStats.slots - poolStats.owned[FRAME_OWNER_NONE], poolStats.slots,
+                  poolStats.owned[FRAME_OWNER_CACHE], poolStats.owned[FRAME_OWNER_CLIP],
+                  poolStats.owned[FRAME_OWNER_MOTION], poolStats.peak, (unsigned long)poolStats.misses);
+    for (int i = 0; i < ARENA_COUNT; i++) {
+        const ArenaStats& stats = arenas[i].stats;
+        Serial.printf("MEM arena %-7s %lu/%lu KB, peak %lu KB, misses %lu\n", arenaNames[i],
+                      (unsigned long)stats.used / 1024, (unsigned long)stats.size / 1024,
+                      (unsigned long)stats.peak / 1024, (unsigned long)stats.misses);
+    }
+}
@@ -0,0 +1,81 @@
+#ifndef BUDGET_H
+#define BUDGET_H
+
+#include <Arduino.h>
+
+// ==================== Memory Budget ====================
+// PSRAM is carved up once at boot, before anything else can fragment it:
+//
+//   frame pool   FRAME_POOL_SLOTS whole screens (750 KB each), taken and
+//                returned by an owner. A run of adjacent slots backs a
+//                buffer larger than a screen.
+//   arenas       one per subsystem for working buffers. An arena is a
+//                stack: allocations since a mark are released together.
+//
+// After boot nothing calls the heap for PSRAM, so months of slides cannot
+// fragment it. A request that does not fit fails as an allocation would,
+// and is counted as a miss.
+
+enum FrameOwner {
+    FRAME_OWNER_NONE,
+    FRAME_OWNER_CACHE,
+    FRAME_OWNER_CLIP,
+    FRAME_OWNER_MOTION,
+    FRAME_OWNER_COUNT
+};
+
+// Each arena is used by one task at a time
+enum MemArena {
+    ARENA_DECODE,       // Decoder work areas on the loop task
+    ARENA_LIBRARY,      // Album index reads
+    ARENA_UPLOAD,       // Receive buffers during an upload session
+    ARENA_COUNT
+};
+
+struct FramePoolStats {
+    uint8_t slots;                      // Reserved at boot
+    uint8_t owned[FRAME_OWNER_COUNT];   // In use now, by owner; [0] is free
+    uint8_t peak;                       // Most in use at once
+    uint32_t misses;
+};
+
+struct ArenaStats {
+    uint32_t size;
+    uint32_t used;
+    uint32_t peak;
+    uint32_t misses;
+};
+
+// Reserves everything; false if some of it could not be
+bool budgetBegin();
+
+// Frame pool calls come from the loop task
+uint16_t* framePoolTake(FrameOwner owner);              // NULL when every slot is in use
+void* framePoolTakeRun(FrameOwner owner, int count);    // count adjacent slots
+void framePoolRelease(const void* memory);              // A slot or a whole run
+const FramePoolStats& framePoolStats();
+
+// 16-byte aligned; NULL when the arena is full
+void* arenaAlloc(MemArena arena, size_t bytes);
+uint32_t arenaMark(MemArena arena);
+void arenaRelease(MemArena arena, uint32_t mark);   // Frees everything allocated since the mark
+const ArenaStats& arenaStats(MemArena arena);
+const char* arenaName(MemArena arena);
+
+// Most an arena held during a span of work. arenaWatchStart returns the
+// enclosing span's mark, to hand back to arenaWatchStop so spans nest.
+uint32_t arenaWatchStart(MemArena arena);
+uint32_t arenaWatchStop(MemArena arena, uint32_t outer);   // Bytes in use at the span's peak
+
+// Releases what was allocated in the arena during its lifetime
+struct ArenaScope {
+    ArenaScope(MemArena arena);
+    ~ArenaScope();
+    void* alloc(size_t bytes) { return arenaAlloc(arena, bytes); }
+    MemArena arena;
+    uint32_t mark;
+};
+
+void printBudget();
+
+#endif // BUDGET_H
@@ -0,0 +1,121 @@
+#include "color.h"
+
+// ==================== Ordered Dither Tables ====================
+// 4x4 Bayer matrix scaled to the quantization step of each channel:
+// 0..7 for the 5-bit red/blue channels, 0..3 for the 6-bit green channel.
+// Red and blue thresholds are pre-packed into two 16-bit lanes so both
+// channels are dithered with a single 32-bit add.
+static const uint8_t bayer4[4][4] = {
+    { 0,  8,  2, 10},
+    {12,  4, 14,  6},
+    { 3, 11,  1,  9},
+    {15,  7, 13,  5}
+};
+
+static uint32_t ditherRB[4][4];
+static uint32_t ditherG[4][4];
+static bool ditherTablesReady = false;
+
+static void initDitherTables() {
+    for (int y = 0; y < 4; y++) {
+        for (int x = 0; x < 4; x++) {
+            uint32_t t5 = bayer4[y][x] >> 1;
+            uint32_t t6 = bayer4[y][x] >> 2;
+            ditherRB[y][x] = (t5 << 16) | t5;
+            ditherG[y][x] = (t6 << 16) | t6;
+        }
+    }
+    ditherTablesReady = true;
+}
+
+// Clamp both 16-bit lanes to 255 after the threshold add
+static inline uint32_t saturateLanes(uint32_t v) {
+    uint32_t overflow = (v & 0x01000100) >> 8;
+    return (v | (overflow * 0xFF)) & 0x00FF00FF;
+}
+
+// ==================== Luminance Histogram ====================
+static inline uint32_t lumaBin(const uint8_t* rgb) {
+    return (rgb[0] * 77 + rgb[1] * 150 + rgb[2] * 29) >> (8 + LUMA_BIN_SHIFT);
+}
+
+void lumaReset(LumaHistogram& luma) {
+    memset(&luma, 0, sizeof(luma));
+}
+
+uint8_t lumaMean(const LumaHistogram& luma) {
+    if (luma.pixels == 0) return 0;
+    uint64_t sum = 0;
+    for (int i = 0; i < LUMA_BINS; i++) {
+        sum += (uint64_t)luma.bins[i] * ((i << LUMA_BIN_SHIFT) + (1 << LUMA_BIN_SHIFT) / 2);
+    }
+    return sum / luma.pixels;
+}
+
+uint8_t lumaPercentile(const LumaHistogram& luma, uint8_t percent) {
+    uint32_t limit = (uint64_t)luma.pixels * percent / 100;
+    uint32_t seen = 0;
+    for (int i = 0; i < LUMA_BINS; i++) {
+        seen += luma.bins[i];
+        if (seen >= limit) return ((i + 1) << LUMA_BIN_SHIFT) - 1;
+    }
+    return 255;
+}
+
+// ==================== Conversion Kernels ====================
+void rgb888ToRgb565(const uint8_t* src, uint16_t* dst, uint16_t w, uint16_t h,
+                    LumaHistogram* luma) {
+    uint32_t count = (uint32_t)w * h;
+    if (luma) luma->pixels += count;
+    while (count--) {
+        if (luma) luma->bins[lumaBin(src)]++;
+        *dst++ = ((src[0] & 0xF8) << 8) | ((src[1] & 0xFC) << 3) | (src[2] >> 3);
+        src += 3;
+    }
+}
+
+void rgb888ToRgb565Dither(const uint8_t* src, uint16_t* dst, uint16_t w, uint16_t h,
+                          int16_t x0, int16_t y0, LumaHistogram* luma) {
+    if (!ditherTablesReady) initDitherTables();
+    if (luma) luma->pixels += (uint32_t)w * h;
+    
+    for (uint16_t row = 0; row < h; row++) {
+        const uint32_t* rbRow = ditherRB[(y0 + row) & 3];
+        const uint32_t* gRow = ditherG[(y0 + row) & 3];
+        int phase = x0 & 3;
+        uint16_t col = 0;
+        
+        // Two pixels per iteration: R/B of each pixel share one word,
+        // the greens of both pixels share another
+        for (; col + 1 < w; col += 2) {
+            if (luma) {
+                luma->bins[lumaBin(src)]++;
+                luma->bins[lumaBin(src + 3)]++;
+            }
+            uint32_t rb0 = ((uint32_t)src[0] << 16) | src[2];
+            uint32_t rb1 = ((uint32_t)src[3] << 16) | src[5];
+            uint32_t gg = ((uint32_t)src[4] << 16) | src[1];
+            
+            rb0 = saturateLanes(rb0 + rbRow[phase]);
+            rb1 = saturateLanes(rb1 + rbRow[(phase + 1) & 3]);
+            gg = saturateLanes(gg + ((gRow[(phase + 1) & 3] & 0xFFFF0000) | (gRow[phase] & 0xFFFF)));
+            
+            dst[0] = ((rb0 >> 8) & 0xF800) | ((gg & 0xFC) << 3) | ((rb0 & 0xF8) >> 3);
+            dst[1] = ((rb1 >> 8) & 0xF800) | ((gg >> 13) & 0x07E0) | ((rb1 & 0xF8) >> 3);
+            
+            src += 6;
+            dst += 2;
+            phase = (phase + 2) & 3;
+        }
+        
+        if (col < w) {
+            if (luma) luma->bins[lumaBin(src)]++;
+            uint32_t rb = saturateLanes((((uint32_t)src[0] << 16) | src[2]) + rbRow[phase]);
+            uint32_t g = src[1] + (gRow[phase] & 0xFF);
+            if (g > 255) g = 255;
+            
+            *dst++ = ((rb >> 8) & 0xF800) | ((g & 0xFC) << 3) | ((rb & 0xF8) >> 3);
+            src += 3;
+        }
+    }
+}
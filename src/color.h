@@ -0,0 +1,30 @@
+#ifndef COLOR_H
+#define COLOR_H
+
+#include <Arduino.h>
+
+// ==================== Luminance Histogram ====================
+// Rec. 601 luma of every converted pixel, binned while the pixels are
+// already in registers for the conversion
+#define LUMA_BINS 64
+#define LUMA_BIN_SHIFT 2    // 256 luma levels / LUMA_BINS
+
+struct LumaHistogram {
+    uint32_t bins[LUMA_BINS];
+    uint32_t pixels;
+};
+
+void lumaReset(LumaHistogram& luma);
+uint8_t lumaMean(const LumaHistogram& luma);
+uint8_t lumaPercentile(const LumaHistogram& luma, uint8_t percent);  // Upper edge of the bin
+
+// ==================== Color Conversion ====================
+// RGB888 -> RGB565 reduction for decoders that emit 24-bit pixels.
+// x0/y0 are screen coordinates of the first pixel so the dither pattern
+// lines up across MCU blocks. Pixels are added to luma unless it is NULL.
+void rgb888ToRgb565(const uint8_t* src, uint16_t* dst, uint16_t w, uint16_t h,
+                    LumaHistogram* luma = NULL);
+void rgb888ToRgb565Dither(const uint8_t* src, uint16_t* dst, uint16_t w, uint16_t h,
+                          int16_t x0, int16_t y0, LumaHistogram* luma = NULL);
+
+#endif // COLOR_H
@@ -5,6 +5,60 @@
 #define INTERVAL_DEFAULT_INDEX 2  // Default to 1 minute (60000 ms)
 #define INTERVAL_FILENAME "/interval.txt"
 #define BRIGHTNESS_FILENAME "/brightness.txt"
+#define LAST_FRAME_FILENAME "/lastframe.txt"  // Photo on screen, painted first at the next boot
+#define LAST_FRAME_SAVE_INTERVAL 600000       // Most often it is rewritten (ms); also on entering the menu
+
+// ==================== Library Refresh ====================
+#define LIBRARY_RESCAN_INTERVAL 60000   // Background rescan period (ms)
+#define LIBRARY_SLICE_BUDGET_US 2000    // Max time per scan slice (us)
+#define LIBRARY_SLICE_PAUSE_MS 20       // Pause between scan slices (ms)
+#define LIBRARY_TASK_STACK 6144
+#define LIBRARY_TASK_PRIORITY 1
+#define LIBRARY_TASK_CORE 0             // Loop task runs on core 1
+
+// ==================== Albums ====================
+#define ALBUM_FILENAME "/album.txt"     // Directory of the album playing, "*" for all
+#define ALBUM_INDEX_DIR "/.albums"      // Per-album image indexes and shuffle state
+#define ALBUM_ROOT_NAME "Unsorted"      // Images directly in the root directory
+#define ALBUM_MENU_ROWS 10
+
+// ==================== Shuffle Diversity ====================
+#define SHUFFLE_NEAR_BITS 10            // Hash bits two photos may differ by and still count as near-duplicates
+#define SHUFFLE_SPREAD_WINDOW 8         // Slides kept between near-duplicates where the order allows
+#define SHUFFLE_SPREAD_SEARCH 64        // Later positions tried for a photo that must move
+#define SHUFFLE_SKIP_DUPLICATES true    // Copies of a photo (same hash and size) play once a cycle
+#define HASH_SAVE_BATCH 16              // New hashes held before the indexes are rewritten
+
+// ==================== Date Order ====================
+#define ORDER_FILENAME "/order.txt"     // 1 plays in capture order, 0 shuffled
+#define DATE_ORDER_DEFAULT false
+#define PLAYLIST_RUN_BYTES (256UL << 10)    // Records sorted in memory at once, from the decode arena
+#define PLAYLIST_MERGE_WAYS 4               // Runs merged at once; with the output that is SD.begin's 5 open files
+#define PLAYLIST_BUFFER_BYTES (8UL << 10)   // Per run while merging, and for the output
+#define PLAYLIST_SKIP_MAX 64                // Vanished photos stepped over per slide before the shuffle takes over
+
+// ==================== Decode Limits ====================
+#define DECODE_TIME_BUDGET 5000            // Max decode time per image (ms)
+#define DECODE_MAX_FILE_SIZE (20UL << 20)  // Larger files are not decoded
+#define DECODE_MAX_PIXELS (24UL << 20)     // Larger images are not decoded
+#define DECODE_MAX_ATTEMPTS 3              // Images tried per slide change
+#define READ_ERROR_STRIKES 3               // Passes a photo may fail to read before it is quarantined
+#define QUARANTINE_FILENAME "/quarantine.txt"
+
+// ==================== Parallel JPEG Decode ====================
+#define JPEG_PARALLEL true                    // Split files with restart markers across both cores
+#define JPEG_PARALLEL_MAX_FILE (1408UL << 10) // Read whole into the decode arena, leaving 128 KB for rows; larger files stream on one core
+#define JPEG_TASK_STACK 4096
+#define JPEG_TASK_PRIORITY 2
+#define JPEG_TASK_CORE 0
+
+// ==================== Browse Configuration ====================
+#define THUMB_SIZE 112                    // Thumbnail edge in pixels
+#define THUMB_INDEX_FILENAME "/.thumbs.idx"
+#define THUMB_DATA_FILENAME "/.thumbs.bin"
+#define BROWSE_COLUMNS 4
+#define BROWSE_ROWS 6
+#define BROWSE_TIMEOUT 30000   // 30 секунд бездействия в режиме просмотра
 
 // ==================== Button Configuration ====================
 #define BOOT_BUTTON_PIN 0  // GPIO0 - кнопка BOOT на ESP32
@@ -15,11 +69,53 @@
 #define MENU_TIMEOUT 10000     // 10 секунд бездействия в главном меню
 #define SETTING_TIMEOUT 5000   // 5 секунд для выхода из настроек
 
+// ==================== Touch Configuration ====================
+#define TOUCH_ENABLED true
+#define TOUCH_SDA 19
+#define TOUCH_SCL 20
+#define TOUCH_INT_PIN 18             // -1 to poll instead
+#define TOUCH_RST_PIN 38             // -1 if not wired
+#define TOUCH_POLL_MS 20             // Poll period without INT
+#define TOUCH_RELEASE_TIMEOUT 100    // No report this long ends a touch (ms)
+#define TOUCH_TAP_SLOP 20            // Max travel of a tap or hold (pixels)
+#define TOUCH_LONG_PRESS_TIME 600
+#define SWIPE_MIN_DISTANCE 80        // Horizontal travel of a swipe (pixels)
+#define SWIPE_MAX_TIME 800           // Slower moves are not swipes (ms)
+
+// ==================== Frame Cache ====================
+#define FRAME_CACHE_SLOTS 4          // Whole screens kept, from the frame pool
+#define FRAME_HISTORY 16             // Photos a swipe back can return to
+#define PREFETCH_DELAY 200           // Slide shown this long before the next is rendered (ms)
+
+// ==================== Serial Upload ====================
+#define SERIAL_BAUD 921600            // Console and upload link; monitor_speed must match
+#define UPLOAD_CHUNK 2048             // Largest data frame payload (bytes)
+#define UPLOAD_WINDOW 3               // Data frames the host may send ahead of the acks
+#define UPLOAD_RX_BUFFER 8192         // UART receive buffer, holds a whole window
+#define UPLOAD_BUFFER_SIZE 32768      // Each of the two PSRAM buffers the SD writer drains
+#define UPLOAD_IDLE_TIMEOUT 3000      // Session ends this long after the last frame (ms)
+#define UPLOAD_PROGRESS_INTERVAL 500  // Progress screen refresh (ms)
+#define UPLOAD_PART_SUFFIX ".part"    // Unfinished upload, kept for a resume
+#define UPLOAD_TASK_STACK 3072
+#define UPLOAD_TASK_PRIORITY 2
+#define UPLOAD_TASK_CORE 0            // SD writes overlap the receive on core 1
+
 // ==================== SD Card SPI Configuration ====================
 #define SD_SCK   12
 #define SD_MISO  13
 #define SD_MOSI  11
 #define SD_CS    10
+#define SD_CLOCK_HZ          40000000
+#define SD_CLOCK_FALLBACK_HZ 20000000   // Cards or wiring that fail at the full clock
+
+// ==================== Benchmark ====================
+#define BENCH_RESULTS_FILENAME "/benchmark.csv"  // One line per run, to compare frames
+#define BENCH_TEST_FILENAME "/.benchmark.tmp"    // Scratch file, removed after the run
+#define BENCH_FILE_SIZE (1UL << 20)
+#define BENCH_CHUNK_SIZE (32UL << 10)            // Sequential transfer size
+#define BENCH_RANDOM_SIZE 4096                   // Random read size, one cluster
+#define BENCH_RANDOM_READS 128
+#define BENCH_REPEATS 3                          // Decode and screen timings keep the fastest
 
 
 // ==================== Display Settings ====================
@@ -27,8 +123,73 @@
 #define MIN_BRIGHTNESS 20
 #define BRIGHTNESS_STEP 10
 #define BRIGHTNESS_DEFAULT 128
+#define JPEG_DITHER true  // Ordered dither from RGB888 to RGB565; false truncates each pixel
+#define BLIT_BANDED true  // Gather a full MCU row before writing the framebuffer
+#define BLIT_BAND_THICKNESS 16  // Tallest MCU row (2x2 subsampling)
+#define DISPLAY_ROTATION 1  // 1 = portrait, 3 = portrait turned over; the UI is laid out for 480x800
+
+// ==================== Letterbox Fill ====================
+#define LETTERBOX_BLUR true             // Blurred copy of the photo around small photos instead of black
+#define LETTERBOX_CELL 16               // Screen pixels per blur grid cell; divides 480 and 800
+#define LETTERBOX_BLUR_RADIUS 2         // Box radius in cells
+#define LETTERBOX_BLUR_PASSES 3         // Three box passes come close to a Gaussian
+#define LETTERBOX_DIM_PERCENT 45        // Brightness of the fill
+#define LETTERBOX_MAX_FILE_SIZE (256UL << 10)  // The fill reads the file twice; larger ones get black bars
+
+// ==================== Adaptive Backlight ====================
+#define BACKLIGHT_ADAPTIVE true             // Backlight follows each photo, up to the brightness setting
+#define BACKLIGHT_FLOOR_PERCENT 55          // For a photo with no highlights at all
+#define BACKLIGHT_HIGHLIGHT_PERCENTILE 98   // Luma under which this share of pixels falls sets the level
+#define BACKLIGHT_BRIGHT_MEAN 170           // Mean luma above which a bright photo is toned down
+#define BACKLIGHT_BRIGHT_CUT_PERCENT 15     // ... by this much at an all-white photo
+#define BACKLIGHT_FADE_MS 800               // Hardware ramp between slides
+
+// ==================== Ken Burns Motion ====================
+#define MOTION_FILENAME "/motion.txt"
+#define MOTION_DEFAULT false
+#define KENBURNS_FPS 20
+#define KENBURNS_ZOOM 1.25f                     // Closest zoom, relative to filling the screen
+#define KENBURNS_SEGMENT_MS 12000               // Length of one pan/zoom move
+#define KENBURNS_MAX_STEP 1.0f                  // Max screen pixels any point moves per frame
+#define KENBURNS_PAUSE_FRAMES 4                 // Longer gaps pause the move
+#define KENBURNS_SOURCE_SLOTS 5                 // Frame pool slots holding the decoded source (1.9 Mpx)
+#define KENBURNS_STATS_WINDOW 5000              // fps/load averaging window (ms)
+#define KENBURNS_TASK_STACK 3072
+#define KENBURNS_TASK_PRIORITY 2
+#define KENBURNS_TASK_CORE 0                    // Renders the lower half of each frame
+
+// ==================== Clip Playback ====================
+#define MJPEG_DEFAULT_FPS 15                    // Raw .mjpg streams carry no frame rate
+#define MJPEG_MAX_FPS 30
+#define MJPEG_MAX_FRAME_BYTES (180UL << 10)     // Larger frames are skipped; all read buffers share one frame slot
+#define MJPEG_READ_BUFFERS 4                    // Compressed frames read ahead
+#define MJPEG_FRAME_BUFFERS 3                   // Decoded screens waiting to be shown, from the frame pool
+#define MJPEG_READ_CHUNK 16384                  // Raw streams are read in chunks and split at EOI
+#define MJPEG_PREROLL_MS 100                    // Extra time on the first frame while the pipeline fills
+#define MJPEG_WAIT_SLICE_MS 10                  // Waiting stages check for a stop this often
+#define MJPEG_TASK_STACK 4096
+#define MJPEG_TASK_PRIORITY 2
+#define MJPEG_READ_CORE 1                       // SD read-ahead, beside the loop
+#define MJPEG_DECODE_CORE 0
+#define MJPEG_PRESENT_CORE 1                    // Frame copies into the framebuffer
+
+// ==================== Memory Budget ====================
+#define FRAME_POOL_SLOTS 6                      // Whole screens reserved in PSRAM at boot, 750 KB each
+#define DECODE_ARENA_SIZE (1536UL << 10)        // Decoder work areas, a two-core JPEG file included
+#define LIBRARY_ARENA_SIZE (32UL << 10)         // Album index reads, in pieces of this size
+#define UPLOAD_ARENA_SIZE (2 * UPLOAD_BUFFER_SIZE)
+
+// ==================== Memory Telemetry ====================
+#define MEMSTAT_SAMPLE_INTERVAL 600000  // 10 минут между замерами
+#define MEMSTAT_RING_SIZE 144           // 24 hours of samples
 
-// ==================== Debug Settings ====================
-#define DEBUG_SERIAL true
+// ==================== Logging ====================
+#define LOG_LEVEL 3                 // 0 off, 1 errors, 2 warnings, 3 info, 4 debug (per-slide timings)
+#define LOG_RING_SLOTS 32           // Lines waiting for the drain task; a power of two
+#define LOG_LINE_MAX 128            // Longer lines are cut
+#define LOG_DRAIN_INTERVAL 20       // Drain task wakes this often (ms)
+#define LOG_TASK_STACK 2048
+#define LOG_TASK_PRIORITY 1
+#define LOG_TASK_CORE 0
 
 #endif // CONFIG_H
\ No newline at end of file
@@ -0,0 +1,261 @@
+#include "decoder.h"
+#include "config.h"
+#include "color.h"
+#include "display.h"
+#include "jpeg.h"
+#include "png.h"
+#include "bmp.h"
+#include "budget.h"
+
+// ==================== Registry ====================
+static const ImageDecoder* const decoders[] = {
+    &jpegDecoder,
+    &pngDecoder,
+    &bmpDecoder,
+};
+static const int decoderCount = sizeof(decoders) / sizeof(decoders[0]);
+
+// ==================== Decode Timing ====================
+static unsigned long budgetStart = 0;
+static unsigned long budgetMs = 0;
+static bool (*cancelCheck)() = NULL;
+static DecodeStats stats = {};
+
+void decodeSetBudget(unsigned long ms) {
+    budgetStart = millis();
+    budgetMs = ms;
+}
+
+bool decodeBudgetExpired() {
+    if (cancelCheck && cancelCheck()) return true;
+    return budgetMs != 0 && millis() - budgetStart > budgetMs;
+}
+
+void decodeSetCancel(bool (*cancel)()) {
+    cancelCheck = cancel;
+}
+
+const DecodeStats& lastDecodeStats() {
+    return stats;
+}
+
+LumaHistogram* decodeLuma() {
+    return &stats.luma;
+}
+
+size_t decodeRead(File& file, uint8_t* buf, size_t length) {
+    // Reads happen every few blocks, so this also bounds a decoder that
+    // churns on corrupt data
+    if (decodeBudgetExpired()) return 0;
+    
+    size_t n = file.read(buf, length);
+    stats.bytesRead += n;
+    return n;
+}
+
+// ==================== Dispatch ====================
+static const ImageDecoder* findDecoder(File& file) {
+    uint8_t magic[DECODER_MAGIC_BYTES];
+    memset(magic, 0, sizeof(magic));
+    file.read(magic, sizeof(magic));
+    file.seek(0);
+    
+    for (int i = 0; i < decoderCount; i++) {
+        if (decoders[i]->probe(magic)) return decoders[i];
+    }
+    return NULL;
+}
+
+bool isDecodableName(const String& filename) {
+    int dot = filename.lastIndexOf('.');
+    if (dot < 0) return false;
+    
+    String ext = filename.substring(dot);
+    ext.toLowerCase();
+    
+    for (int i = 0; i < decoderCount; i++) {
+        // Match whole entries only: ".jp" must not match ".jpg"
+        const char* list = decoders[i]->extensions;
+        const char* found = strstr(list, ext.c_str());
+        while (found) {
+            char next = found[ext.length()];
+            if (next == '\0' || next == '.') return true;
+            found = strstr(found + 1, ext.c_str());
+        }
+    }
+    return false;
+}
+
+int imageGetSdSize(uint16_t* w, uint16_t* h, const char* path) {
+    File file = SD.open(path, FILE_READ);
+    if (!file) return DECODE_READ_ERROR;
+    
+    const ImageDecoder* decoder = findDecoder(file);
+    int res = decoder ? decoder->getSize(file, w, h) : DECODE_UNSUPPORTED;
+    file.close();
+    return res;
+}
+
+// Counts pixels and enforces the budget on the output side for every decoder
+struct CountingTarget {
+    ImageBlockSink sink;
+    void* ctx;
+};
+
+static bool countingSink(void* ctx, int16_t x, int16_t y, uint16_t w, uint16_t h, const uint8_t* rgb) {
+    CountingTarget* target = (CountingTarget*)ctx;
+    if (decodeBudgetExpired()) return false;
+    
+    stats.pixels += (uint32_t)w * h;
+    return target->sink(target->ctx, x, y, w, h, rgb);
+}
+
+int imageDecodeSd(const char* path, uint8_t scale, ImageBlockSink sink, void* ctx) {
+    unsigned long start = micros();
+    stats.decoder = "none";
+    stats.bytesRead = 0;
+    stats.pixels = 0;
+    lumaReset(stats.luma);
+    
+    File file = SD.open(path, FILE_READ);
+    if (!file) return DECODE_READ_ERROR;
+    
+    int res = DECODE_UNSUPPORTED;
+    const ImageDecoder* decoder = findDecoder(file);
+    if (decoder) {
+        stats.decoder = decoder->name;
+        CountingTarget target = {sink, ctx};
+        res = decoder->decode(file, scale, countingSink, &target);
+    }
+    
+    file.close();
+    stats.micros = micros() - start;
+    return res;
+}
+
+// ==================== Screen Output ====================
+struct ScreenTarget {
+    int32_t x;
+    int32_t y;
+};
+
+static uint16_t screenBlock[16 * 16];
+
+static bool screenSink(void* ctx, int16_t x, int16_t y, uint16_t w, uint16_t h, const uint8_t* rgb) {
+    ScreenTarget* target = (ScreenTarget*)ctx;
+    int32_t bx = target->x + x;
+    int32_t by = target->y + y;
+
+#if JPEG_DITHER
+    // Dither in image space so the pattern stays seamless under rotation
+    rgb888ToRgb565Dither(rgb, screenBlock, w, h, bx, by, decodeLuma());
+#else
+    rgb888ToRgb565(rgb, screenBlock, w, h, decodeLuma());
+#endif
+
+    return oriented_output(bx, by, w, h, screenBlock);
+}
+
+int imageDrawSd(int32_t x, int32_t y, const char* path) {
+    ScreenTarget target = {x, y};
+    return imageDecodeSd(path, 0, screenSink, &target);
+}
+
+// ==================== Row Reducer ====================
+#define STRIP_ROWS 16
+#define BLOCK_SIZE 16
+
+static uint8_t reducerBlock[BLOCK_SIZE * BLOCK_SIZE * 3];
+
+int rowReducerBegin(RowReducer& reducer, uint16_t width, uint16_t height, uint8_t scale,
+                    ImageBlockSink sink, void* ctx) {
+    memset(&reducer, 0, sizeof(reducer));
+    if (width == 0 || height == 0 || scale > 3) return DECODE_BAD_PARAMETER;
+    
+    reducer.sink = sink;
+    reducer.ctx = ctx;
+    reducer.width = width;
+    reducer.height = height;
+    reducer.scale = scale;
+    reducer.outWidth = (width + (1 << scale) - 1) >> scale;
+    
+    reducer.arenaMark = arenaMark(ARENA_DECODE);
+    reducer.strip = (uint8_t*)arenaAlloc(ARENA_DECODE, (size_t)reducer.outWidth * 3 * STRIP_ROWS);
+    if (scale > 0) {
+        reducer.sums = (uint16_t*)arenaAlloc(ARENA_DECODE, (size_t)reducer.outWidth * 3 * sizeof(uint16_t));
+    }
+    if (!reducer.strip || (scale > 0 && !reducer.sums)) {
+        rowReducerEnd(reducer);
+        return DECODE_NO_MEMORY;
+    }
+    if (reducer.sums) {
+        memset(reducer.sums, 0, (size_t)reducer.outWidth * 3 * sizeof(uint16_t));
+    }
+    return DECODE_OK;
+}
+
+static bool flushStrip(RowReducer& reducer) {
+    if (reducer.stripRows == 0) return true;
+    
+    for (uint16_t bx = 0; bx < reducer.outWidth; bx += BLOCK_SIZE) {
+        uint16_t w = min<uint16_t>(BLOCK_SIZE, reducer.outWidth - bx);
+        for (uint8_t j = 0; j < reducer.stripRows; j++) {
+            memcpy(reducerBlock + j * w * 3, reducer.strip + ((size_t)j * reducer.outWidth + bx) * 3, w * 3);
+        }
+        if (!reducer.sink(reducer.ctx, bx, reducer.stripTop, w, reducer.stripRows, reducerBlock)) {
+            return false;
+        }
+    }
+    
+    reducer.stripTop += reducer.stripRows;
+    reducer.stripRows = 0;
+    return true;
+}
+
+bool rowReducerPush(RowReducer& reducer, const uint8_t* rgb) {
+    uint8_t* out = reducer.strip + (size_t)reducer.stripRows * reducer.outWidth * 3;
+    reducer.inRow++;
+    
+    if (reducer.scale == 0) {
+        memcpy(out, rgb, (size_t)reducer.width * 3);
+    } else {
+        // Sum into the box under each output pixel
+        uint8_t s = reducer.scale;
+        for (uint16_t x = 0; x < reducer.width; x++) {
+            uint16_t* sum = reducer.sums + (x >> s) * 3;
+            sum[0] += rgb[0];
+            sum[1] += rgb[1];
+            sum[2] += rgb[2];
+            rgb += 3;
+        }
+        
+        // Box complete, or the image ends part way through one
+        uint16_t rows = ((reducer.inRow - 1) & ((1 << s) - 1)) + 1;
+        if (rows < (1 << s) && reducer.inRow < reducer.height) return true;
+        
+        for (uint16_t u = 0; u < reducer.outWidth; u++) {
+            uint16_t cols = min<uint16_t>(1 << s, reducer.width - (u << s));
+            uint16_t count = cols * rows;
+            uint16_t* sum = reducer.sums + u * 3;
+            out[u * 3] = sum[0] / count;
+            out[u * 3 + 1] = sum[1] / count;
+            out[u * 3 + 2] = sum[2] / count;
+        }
+        memset(reducer.sums, 0, (size_t)reducer.outWidth * 3 * sizeof(uint16_t));
+    }
+    
+    if (++reducer.stripRows == STRIP_ROWS) {
+        return flushStrip(reducer);
+    }
+    return true;
+}
+
+bool rowReducerFinish(RowReducer& reducer) {
+    return flushStrip(reducer);
+}
+
+void rowReducerEnd(RowReducer& reducer) {
+    if (reducer.strip || reducer.sums) arenaRelease(ARENA_DECODE, reducer.arenaMark);
+    reducer.strip = NULL;
+    reducer.sums = NULL;
+}
@@ -0,0 +1,102 @@
+#ifndef DECODER_H
+#define DECODER_H
+
+#include <Arduino.h>
+#include <SD.h>
+#include "color.h"
+
+// ==================== Decoder Registry ====================
+// Every image format is a decoder that streams blocks of RGB888 pixels to a
+// sink. The decoder for a file is picked by its first bytes, so a PNG saved
+// as .jpg still decodes; extensions only pre-filter the library scan.
+
+// Results are numbered like TJpgDec's JRESULT
+enum DecodeResult {
+    DECODE_OK = 0,
+    DECODE_INTERRUPTED,    // The sink stopped the decode
+    DECODE_READ_ERROR,
+    DECODE_NO_MEMORY,
+    DECODE_NO_MEMORY_INPUT,
+    DECODE_BAD_PARAMETER,
+    DECODE_CORRUPT,
+    DECODE_BAD_STRUCTURE,
+    DECODE_UNSUPPORTED
+};
+
+// Receives one block of at most 16x16 RGB888 pixels in (scaled) image
+// coordinates. Returning false stops the decode.
+typedef bool (*ImageBlockSink)(void* ctx, int16_t x, int16_t y, uint16_t w, uint16_t h, const uint8_t* rgb);
+
+#define DECODER_MAGIC_BYTES 8
+
+struct ImageDecoder {
+    const char* name;
+    const char* extensions;   // Lowercase, each with its dot: ".jpg.jpeg"
+    bool (*probe)(const uint8_t* magic);   // First DECODER_MAGIC_BYTES of the file
+    int (*getSize)(File& file, uint16_t* w, uint16_t* h);
+    // scale: 0 = 1/1, 1 = 1/2, 2 = 1/4, 3 = 1/8
+    int (*decode)(File& file, uint8_t scale, ImageBlockSink sink, void* ctx);
+};
+
+// Files are opened and positioned at 0 before getSize/decode
+int imageGetSdSize(uint16_t* w, uint16_t* h, const char* path);
+int imageDecodeSd(const char* path, uint8_t scale, ImageBlockSink sink, void* ctx);
+
+// Full-size decode, each block reduced to RGB565 (dithered with
+// JPEG_DITHER) and handed to oriented_output()
+int imageDrawSd(int32_t x, int32_t y, const char* path);
+
+bool isDecodableName(const String& filename);
+
+// ==================== Decode Timing ====================
+// Per-image time budget; once it runs out reads return nothing and the
+// sink is not called again. 0 disables the budget.
+void decodeSetBudget(unsigned long ms);
+bool decodeBudgetExpired();
+
+// Ends the decode the same way as soon as cancel() returns true, for work
+// that input should preempt. NULL removes the check.
+void decodeSetCancel(bool (*cancel)());
+
+// Throughput of the last imageDecodeSd()/imageDrawSd()
+struct DecodeStats {
+    const char* decoder;
+    uint32_t bytesRead;
+    uint32_t pixels;        // Pixels handed to the sink
+    unsigned long micros;
+    LumaHistogram luma;     // Pixels the sink converted for display
+};
+const DecodeStats& lastDecodeStats();
+
+// Histogram of the decode in progress, for sinks that convert to RGB565
+LumaHistogram* decodeLuma();
+
+// ==================== Decoder Helpers ====================
+// Reads through the budget and byte counter; decoders use this for all input
+size_t decodeRead(File& file, uint8_t* buf, size_t length);
+
+// Turns full-width RGB888 rows into sink blocks: reduces them 2^scale times
+// with a box filter and groups 16 output rows into 16x16 blocks. Memory
+// is bounded by the image width, never its height.
+struct RowReducer {
+    ImageBlockSink sink;
+    void* ctx;
+    uint16_t width;       // Input row width
+    uint16_t height;      // Input rows expected
+    uint16_t outWidth;
+    uint8_t scale;
+    uint16_t* sums;       // Box sums per output pixel and channel
+    uint8_t* strip;       // 16 output rows
+    uint16_t inRow;       // Input rows pushed so far
+    uint16_t stripTop;    // Output row of the first strip row
+    uint8_t stripRows;
+    uint32_t arenaMark;   // Decode arena before the strip and sums
+};
+
+int rowReducerBegin(RowReducer& reducer, uint16_t width, uint16_t height, uint8_t scale,
+                    ImageBlockSink sink, void* ctx);
+bool rowReducerPush(RowReducer& reducer, const uint8_t* rgb);  // false once the sink stops
+bool rowReducerFinish(RowReducer& reducer);                    // Flushes the last strip
+void rowReducerEnd(RowReducer& reducer);
+
+#endif // DECODER_H
@@ -1,7 +1,10 @@
 #include "display.h"
 #include "config.h"
+#include "log.h"
 #include <Arduino.h>
-#include <TJpg_Decoder.h>
+#include <esp_heap_caps.h>
+#include <esp32s3/rom/cache.h>
+#include <driver/ledc.h>
 
 // ==================== Global Display Objects ====================
 Arduino_ESP32RGBPanel rgbpanel(
@@ -12,56 +15,438 @@ Arduino_ESP32RGBPanel rgbpanel(
     0 /* hsync_polarity */, 20 /* hsync_front_porch */, 30 /* hsync_pulse_width */, 16 /* hsync_back_porch */,
     0 /* vsync_polarity */, 22 /* vsync_front_porch */, 13 /* vsync_pulse_width */, 10 /* vsync_back_porch */,
     true /* pclk_active_neg */, 16000000 /* prefer_speed */, false /* useBigEndian */);
-    
+
 Arduino_RGB_Display gfx(800, 480, &rgbpanel, 0, true);
 
-// ==================== TJpg_Decoder Output ====================
-bool tft_output(int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t *bitmap) {
-    // Stop decoding if out of screen bounds
-    if (y >= (int16_t)gfx.height()) return 0;
+// ==================== Oriented Output ====================
+// Decoders emit blocks in image coordinates; this stage applies the EXIF
+// orientation per block and writes each transposed tile straight to its
+// destination, so no rotated copy of the image is ever held.
+static uint8_t blitOrientation = 1;
+static uint16_t blitSrcWidth = 0;
+static uint16_t blitSrcHeight = 0;
+static int16_t blitDstX = 0;
+static int16_t blitDstY = 0;
+static uint16_t blitTile[16 * 16];  // Largest MCU at scale 1
+
+static unsigned long blitTime = 0;
+static uint32_t blitCount = 0;
+
+// ==================== Band Accumulator ====================
+// draw16bitRGBBitmap() redoes the rotation math for every pixel and writes
+// the cache back on every call. Decoders emit one MCU row at a time, so
+// blocks are gathered into a band across the screen, already laid out in
+// framebuffer order, and copied out with one memcpy per framebuffer row and
+// one cache write-back per band.
+//
+// Upright images fill bands of screen rows; transposed (EXIF 5-8) images
+// fill bands of screen columns. Depending on the rotation a band is either
+// a few whole framebuffer rows or a short run in every framebuffer row.
+static uint16_t* bandBuffer = NULL;
+static bool bandVertical = false;    // Band spans screen columns
+static bool bandActive = false;
+static int16_t bandStart = 0;        // First screen row/column of the band
+static int16_t bandLength = 0;       // Band thickness filled so far
+static int16_t bandLo = 0;           // Span touched along the band
+static int16_t bandHi = 0;
+
+// Frame the band is flushed into: NULL for the panel, otherwise an
+// offscreen frame in the same native layout
+static uint16_t* blitTarget = NULL;
+
+// Native framebuffer: 480 rows of 800 pixels
+#define FB_STRIDE 800
+#define FB_ROWS 480
+
+// ==================== Native Kernels ====================
+// Screen (x, y) is framebuffer row rowX*x + rowY*y + rowBase and column
+// colX*x + colY*y + colBase, as Arduino_RGB_Display lays out each rotation.
+// The kernels are instantiated per rotation so every index step below is
+// a compile-time constant.
+template <uint8_t R> struct Native;
+template <> struct Native<0> {
+    enum { rowX = 0, rowY = 1, rowBase = 0, colX = 1, colY = 0, colBase = 0 };
+};
+template <> struct Native<1> {
+    enum { rowX = 1, rowY = 0, rowBase = 0, colX = 0, colY = -1, colBase = FB_STRIDE - 1 };
+};
+template <> struct Native<2> {
+    enum { rowX = 0, rowY = -1, rowBase = FB_ROWS - 1, colX = -1, colY = 0, colBase = FB_STRIDE - 1 };
+};
+template <> struct Native<3> {
+    enum { rowX = -1, rowY = 0, rowBase = FB_ROWS - 1, colX = 0, colY = 1, colBase = 0 };
+};
+
+template <uint8_t R> struct BandKernel {
+    typedef Native<R> N;
+    
+    static int32_t fbRow(int32_t x, int32_t y) { return N::rowX * x + N::rowY * y + N::rowBase; }
+    static int32_t fbCol(int32_t x, int32_t y) { return N::colX * x + N::colY * y + N::colBase; }
+    
+    // Screen (x, y) from the band's across/along coordinates
+    static int32_t fbRowAt(bool vertical, int32_t across, int32_t along) {
+        return vertical ? fbRow(across, along) : fbRow(along, across);
+    }
+    static int32_t fbColAt(bool vertical, int32_t across, int32_t along) {
+        return vertical ? fbCol(across, along) : fbCol(along, across);
+    }
+    
+    // A band across framebuffer rows holds whole rows; otherwise it holds
+    // BLIT_BAND_THICKNESS pixels of every framebuffer row
+    static bool rowBand(bool vertical) {
+        return vertical ? N::rowX != 0 : N::rowY != 0;
+    }
+    
+    // Lowest framebuffer row (row band) or column the band can cover
+    static int32_t bandOrigin(bool vertical) {
+        const int t = BLIT_BAND_THICKNESS;
+        if (rowBand(vertical)) {
+            return min(fbRowAt(vertical, bandStart, 0), fbRowAt(vertical, bandStart + t - 1, 0));
+        }
+        return min(fbColAt(vertical, bandStart, 0), fbColAt(vertical, bandStart + t - 1, 0));
+    }
+    
+    template <bool ROWS> static void putPixels(int16_t x, int16_t y, int16_t w, int16_t h,
+                                               const uint16_t* pixels, int16_t stride, int32_t origin) {
+        const int32_t S = ROWS ? FB_STRIDE : BLIT_BAND_THICKNESS;
+        const int32_t di = N::rowX * S + N::colX;
+        const int32_t dj = N::rowY * S + N::colY;
+        uint16_t* base = bandBuffer + (ROWS ? (fbRow(x, y) - origin) * S + fbCol(x, y)
+                                            : fbRow(x, y) * S + fbCol(x, y) - origin);
+        
+        for (int16_t j = 0; j < h; j++) {
+            const uint16_t* src = pixels + (int32_t)j * stride;
+            uint16_t* dst = base + j * dj;
+            if (di == 1) {
+                memcpy(dst, src, w * 2);
+            } else {
+                for (int16_t i = 0; i < w; i++) {
+                    *dst = src[i];
+                    dst += di;
+                }
+            }
+        }
+    }
+    
+    static void put(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t* pixels, int16_t stride) {
+        int32_t origin = bandOrigin(bandVertical);
+        if (rowBand(bandVertical)) {
+            putPixels<true>(x, y, w, h, pixels, stride, origin);
+        } else {
+            putPixels<false>(x, y, w, h, pixels, stride, origin);
+        }
+    }
+    
+    // Copies the touched part of the band out in ascending framebuffer
+    // order, the order the panel scans it out
+    static void flush(uint16_t* fb, uint32_t& first, uint32_t& last) {
+        bool vertical = bandVertical;
+        int32_t origin = bandOrigin(vertical);
+        int32_t acrossEnd = bandStart + bandLength - 1;
+        
+        if (rowBand(vertical)) {
+            int32_t row0 = min(fbRowAt(vertical, bandStart, 0), fbRowAt(vertical, acrossEnd, 0));
+            int32_t col0 = min(fbColAt(vertical, 0, bandLo), fbColAt(vertical, 0, bandHi - 1));
+            int32_t cols = bandHi - bandLo;
+            for (int32_t r = row0; r < row0 + bandLength; r++) {
+                memcpy(fb + r * FB_STRIDE + col0, bandBuffer + (r - origin) * FB_STRIDE + col0, cols * 2);
+            }
+            first = row0 * FB_STRIDE + col0;
+            last = (row0 + bandLength - 1) * FB_STRIDE + col0 + cols;
+        } else {
+            const int t = BLIT_BAND_THICKNESS;
+            int32_t row0 = min(fbRowAt(vertical, 0, bandLo), fbRowAt(vertical, 0, bandHi - 1));
+            int32_t rows = bandHi - bandLo;
+            int32_t col0 = min(fbColAt(vertical, bandStart, 0), fbColAt(vertical, acrossEnd, 0));
+            for (int32_t r = row0; r < row0 + rows; r++) {
+                memcpy(fb + r * FB_STRIDE + col0, bandBuffer + r * t + (col0 - origin), bandLength * 2);
+            }
+            first = row0 * FB_STRIDE + col0;
+            last = (row0 + rows - 1) * FB_STRIDE + col0 + bandLength;
+        }
+    }
+};
+
+typedef void (*BandPutFn)(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t* pixels, int16_t stride);
+typedef void (*BandFlushFn)(uint16_t* fb, uint32_t& first, uint32_t& last);
+
+static const BandPutFn bandPutKernels[4] = {
+    BandKernel<0>::put, BandKernel<1>::put, BandKernel<2>::put, BandKernel<3>::put,
+};
+static const BandFlushFn bandFlushKernels[4] = {
+    BandKernel<0>::flush, BandKernel<1>::flush, BandKernel<2>::flush, BandKernel<3>::flush,
+};
+
+static void flushBand() {
+    if (!bandActive) return;
+    bandActive = false;
+    if (bandHi <= bandLo) return;
+    
+    unsigned long start = micros();
+    uint16_t* fb = blitTarget ? blitTarget : gfx.getFramebuffer();
+    uint32_t first, last;
+    bandFlushKernels[gfx.getRotation() & 3](fb, first, last);
+    
+    // Offscreen frames reach the panel through showFrame()
+    if (!blitTarget) {
+        Cache_WriteBack_Addr((uint32_t)(uintptr_t)(fb + first), (last - first) * 2);
+    }
+    blitTime += micros() - start;
+    blitCount++;
+}
+
+// Takes a block already clipped to the screen. Returns false if it does
+// not fit the band model and must be drawn directly.
+static bool bandPut(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t* pixels, int16_t stride) {
+    const int t = BLIT_BAND_THICKNESS;
+    int16_t across = bandVertical ? x : y;
+    int16_t thick = bandVertical ? w : h;
+    if (thick > t) return false;
+    
+    if (bandActive && (across < bandStart || across + thick > bandStart + t)) {
+        flushBand();
+    }
+    if (!bandActive) {
+        bandActive = true;
+        bandStart = across;
+        bandLength = 0;
+        bandLo = INT16_MAX;
+        bandHi = 0;
+    }
+    
+    unsigned long start = micros();
+    int16_t along = bandVertical ? y : x;
+    int16_t span = bandVertical ? h : w;
+    if (across + thick - bandStart > bandLength) bandLength = across + thick - bandStart;
+    if (along < bandLo) bandLo = along;
+    if (along + span > bandHi) bandHi = along + span;
+    
+    bandPutKernels[gfx.getRotation() & 3](x, y, w, h, pixels, stride);
+    blitTime += micros() - start;
+    return true;
+}
+
+// Clips a screen-space block and sends it through the band, or straight to
+// the driver when banding is unavailable
+static void blitBlock(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t* pixels) {
+    int16_t stride = w;
+    if (x < 0) { pixels -= x; w += x; x = 0; }
+    if (y < 0) { pixels -= (int32_t)y * stride; h += y; y = 0; }
+    if (x + w > (int16_t)gfx.width()) w = gfx.width() - x;
+    if (y + h > (int16_t)gfx.height()) h = gfx.height() - y;
+    if (w <= 0 || h <= 0) return;
+    
+    if (bandBuffer && bandPut(x, y, w, h, pixels, stride)) {
+        return;
+    }
+    
+    flushBand();
+    unsigned long start = micros();
+    if (w == stride) {
+        gfx.draw16bitRGBBitmap(x, y, pixels, w, h);
+    } else {
+        for (int16_t j = 0; j < h; j++) {
+            gfx.draw16bitRGBBitmap(x, y + j, pixels + (int32_t)j * stride, w, 1);
+        }
+    }
+    blitTime += micros() - start;
+    blitCount++;
+}
+
+void flushBlit() {
+    flushBand();
+}
+
+unsigned long blitMicros() {
+    return blitTime;
+}
+
+uint32_t blitWrites() {
+    return blitCount;
+}
+
+void setBlitTransform(uint8_t orientation, uint16_t srcWidth, uint16_t srcHeight, int16_t dstX, int16_t dstY) {
+    flushBand();
+    blitOrientation = (orientation >= 1 && orientation <= 8) ? orientation : 1;
+    blitSrcWidth = srcWidth;
+    blitSrcHeight = srcHeight;
+    blitDstX = dstX;
+    blitDstY = dstY;
+    bandVertical = blitOrientation >= 5;
+    blitTime = 0;
+    blitCount = 0;
+}
+
+bool setBlitTarget(uint16_t* frame) {
+    flushBand();
+    // Blocks that miss the band are drawn by the driver, onto the panel
+    if (frame && !bandBuffer) return false;
+    blitTarget = frame;
+    return true;
+}
+
+void fillBlitTarget(uint16_t color) {
+    if (!blitTarget) {
+        gfx.fillScreen(color);
+        return;
+    }
+    for (uint32_t i = 0; i < FRAME_PIXELS; i++) {
+        blitTarget[i] = color;
+    }
+}
+
+// ==================== Frame Copies ====================
+void captureFrame(uint16_t* frame) {
+    memcpy(frame, gfx.getFramebuffer(), FRAME_PIXELS * 2);
+}
+
+void showFrame(const uint16_t* frame) {
+    uint16_t* fb = gfx.getFramebuffer();
+    memcpy(fb, frame, FRAME_PIXELS * 2);
+    Cache_WriteBack_Addr((uint32_t)(uintptr_t)fb, FRAME_PIXELS * 2);
+}
+
+bool oriented_output(int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t *bitmap) {
+    if (blitOrientation == 1) {
+        // Past the bottom edge nothing more can land on screen
+        if (blitDstY + y >= (int16_t)gfx.height()) return 0;
+        blitBlock(blitDstX + x, blitDstY + y, w, h, bitmap);
+        return 1;
+    }
+    
+    if ((uint32_t)w * h > sizeof(blitTile) / sizeof(blitTile[0])) return 0;
     
-    // Adjust width if image exceeds screen
-    if ((x + w) > (int16_t)gfx.width()) {
-        w = (uint16_t)((int16_t)gfx.width() - x);
+    const int W = blitSrcWidth;
+    const int H = blitSrcHeight;
+    bool transposed = blitOrientation >= 5;
+    int dw = transposed ? h : w;
+    int dh = transposed ? w : h;
+    
+    // Destination tile origin and index steps per source column/row
+    int tx, ty, start, di, dj;
+    switch (blitOrientation) {
+        case 2:  tx = W - x - w; ty = y;         start = w - 1;                 di = -1;    dj = dw;  break;
+        case 3:  tx = W - x - w; ty = H - y - h; start = (h - 1) * dw + w - 1;  di = -1;    dj = -dw; break;
+        case 4:  tx = x;         ty = H - y - h; start = (h - 1) * dw;          di = 1;     dj = -dw; break;
+        case 5:  tx = y;         ty = x;         start = 0;                     di = dw;    dj = 1;   break;
+        case 6:  tx = H - y - h; ty = x;         start = h - 1;                 di = dw;    dj = -1;  break;
+        case 7:  tx = H - y - h; ty = W - x - w; start = (w - 1) * dw + h - 1;  di = -dw;   dj = -1;  break;
+        default: tx = y;         ty = W - x - w; start = (w - 1) * dw;          di = -dw;   dj = 1;   break;
     }
     
-    // Validate parameter correctness
-    if (x < 0 || y < 0 || w == 0 || h == 0) {
-        return 0;
+    const uint16_t *src = bitmap;
+    for (int j = 0; j < h; j++) {
+        uint16_t *dst = blitTile + start + j * dj;
+        for (int i = 0; i < w; i++) {
+            *dst = *src++;
+            dst += di;
+        }
     }
     
-    gfx.draw16bitRGBBitmap(x, y, bitmap, w, h);
+    // Rotated blocks do not arrive top to bottom, so an off-screen tile is
+    // skipped rather than ending the decode
+    blitBlock(blitDstX + tx, blitDstY + ty, dw, dh, blitTile);
     return 1;
 }
 
+// ==================== Blit Benchmark ====================
+// One screen of 16x16 blocks in decoder order, upright or transposed
+// (EXIF 6), through the current blit path
+static unsigned long benchmarkFrame(uint8_t orientation, uint16_t color) {
+    static uint16_t block[16 * 16];
+    for (int i = 0; i < 16 * 16; i++) {
+        block[i] = color ^ (i << 1);
+    }
+    
+    bool transposed = orientation >= 5;
+    uint16_t srcWidth = transposed ? gfx.height() : gfx.width();
+    uint16_t srcHeight = transposed ? gfx.width() : gfx.height();
+    setBlitTransform(orientation, srcWidth, srcHeight, 0, 0);
+    
+    unsigned long start = micros();
+    for (uint16_t y = 0; y < srcHeight; y += 16) {
+        for (uint16_t x = 0; x < srcWidth; x += 16) {
+            oriented_output(x, y, min(16, srcWidth - x), min(16, srcHeight - y), block);
+        }
+    }
+    flushBlit();
+    return micros() - start;
+}
+
+void runBlitBenchmark() {
+    Serial.println("Blit benchmark (ms per frame):");
+    Serial.println("rot  upright  transposed  per-block");
+    
+    uint16_t* banded = bandBuffer;
+    uint16_t color = 0;
+    for (uint8_t r = 0; r < 4; r++) {
+        gfx.setRotation(r);
+        bandBuffer = banded;
+        unsigned long upright = banded ? benchmarkFrame(1, color += 0x0841) : 0;
+        unsigned long transposed = banded ? benchmarkFrame(6, color += 0x0841) : 0;
+        
+        // Baseline: every block through draw16bitRGBBitmap()
+        bandBuffer = NULL;
+        unsigned long perBlock = benchmarkFrame(1, color += 0x0841);
+        
+        Serial.printf("%3d  %7.1f  %10.1f  %9.1f\n", r, upright / 1000.0f, transposed / 1000.0f, perBlock / 1000.0f);
+    }
+    
+    bandBuffer = banded;
+    gfx.setRotation(DISPLAY_ROTATION);
+    setBlitTransform(1, 0, 0, 0, 0);
+}
+
+unsigned long blitFrameMicros(uint8_t orientation) {
+    unsigned long elapsed = benchmarkFrame(orientation, 0x39E7);
+    setBlitTransform(1, 0, 0, 0, 0);
+    return elapsed;
+}
+
 // ==================== Display Setup ====================
 void setup_display() {
     // Check if Serial is initialized
     if (!Serial) {
-        Serial.begin(115200);
+        Serial.begin(SERIAL_BAUD);
         delay(100);
     }
     
-    Serial.println("Initializing display...");
+    LOG_I("Initializing display...\n");
     
     // Initialize display
     gfx.begin();
-    // Set default portrait mode
-    gfx.setRotation(1);  // 90 degrees for portrait mode (480x800)
+    // Portrait mode (480x800), either way up
+    gfx.setRotation(DISPLAY_ROTATION);
     
     // Initialize backlight PWM
     ledcSetup(0, 5000, 8);  // 5kHz PWM, 8-bit resolution
     ledcAttachPin(TFT_BL, 0);
     ledcWrite(0, BRIGHTNESS_DEFAULT);  // Default brightness
-    
-    Serial.println("Display setup complete.");
-    Serial.printf("Display: %dx%d\n", gfx.width(), gfx.height());
+    ledc_fade_func_install(0);
+
+#if BLIT_BANDED
+    // Sized for a band of screen columns, the longer of the two shapes
+    bandBuffer = (uint16_t*)heap_caps_malloc(FB_STRIDE * BLIT_BAND_THICKNESS * sizeof(uint16_t),
+                                             MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    if (!bandBuffer) {
+        LOG_W("Band buffer allocation failed, blitting per block\n");
+    }
+#endif
+
+    LOG_I("Display setup complete.\n");
+    LOG_I("Display: %dx%d\n", gfx.width(), gfx.height());
 }
 
 // ==================== Set Brightness ====================
 void set_brightness(uint8_t level) {
     if (level < MIN_BRIGHTNESS) level = MIN_BRIGHTNESS;
     if (level > MAX_BRIGHTNESS) level = MAX_BRIGHTNESS;
-    ledcWrite(0, level);
-    Serial.printf("Brightness set to: %d\n", level);
-}
\ No newline at end of file
+    fade_brightness(level, 0);
+    LOG_D("Brightness set to: %d\n", level);
+}
+
+// Ramps the backlight in hardware and returns at once. A fade still
+// running is finished first; a time of 0 would divide by zero in the driver.
+void fade_brightness(uint8_t level, uint16_t ms) {
+    ledc_set_fade_time_and_start(LEDC_LOW_SPEED_MODE, LEDC_CHANNEL_0, level, ms ? ms : 1, LEDC_FADE_NO_WAIT);
+}
@@ -11,8 +11,26 @@
 extern Arduino_RGB_Display gfx;
 
 // ==================== Display Functions ====================
-bool tft_output(int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t *bitmap);
+bool oriented_output(int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t *bitmap);
+void setBlitTransform(uint8_t orientation, uint16_t srcWidth, uint16_t srcHeight, int16_t dstX, int16_t dstY);
+void flushBlit();
+
+// Redirects the blit path into an offscreen frame of FRAME_PIXELS laid
+// out like the panel's framebuffer; NULL returns it to the panel. Fails
+// when the band buffer is unavailable.
+bool setBlitTarget(uint16_t* frame);
+void fillBlitTarget(uint16_t color);
+
+// Whole-screen copies between the panel and an offscreen frame
+#define FRAME_PIXELS (800UL * 480)
+void captureFrame(uint16_t* frame);
+void showFrame(const uint16_t* frame);
+unsigned long blitMicros();
+uint32_t blitWrites();
+void runBlitBenchmark();   // Per-rotation frame write times on Serial; leaves the screen dirty
+unsigned long blitFrameMicros(uint8_t orientation);   // One screen of decoder blocks; leaves it dirty
 void setup_display();
 void set_brightness(uint8_t level);
+void fade_brightness(uint8_t level, uint16_t ms);   // Unclamped duty
 
 #endif // DISPLAY_H
\ No newline at end of file
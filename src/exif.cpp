@@ -0,0 +1,160 @@
+#include "exif.h"
+
+#define EXIF_MAX_SEGMENTS 16   // Markers checked before giving up on APP1
+#define EXIF_MAX_IFD_ENTRIES 64
+#define EXIF_TAG_ORIENTATION 0x0112
+#define EXIF_TAG_DATE_TIME 0x0132           // Last edited, in IFD0
+#define EXIF_TAG_EXIF_IFD 0x8769
+#define EXIF_TAG_DATE_ORIGINAL 0x9003       // Shutter pressed, in the Exif IFD
+#define EXIF_TAG_DATE_DIGITIZED 0x9004
+#define EXIF_DATE_LENGTH 19                 // "YYYY:MM:DD HH:MM:SS"
+
+// ==================== Byte Helpers ====================
+static uint16_t exifRead16(const uint8_t* p, bool bigEndian) {
+    return bigEndian ? (p[0] << 8) | p[1] : (p[1] << 8) | p[0];
+}
+
+static uint32_t exifRead32(const uint8_t* p, bool bigEndian) {
+    return bigEndian ? ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | (p[2] << 8) | p[3]
+                     : ((uint32_t)p[3] << 24) | ((uint32_t)p[2] << 16) | (p[1] << 8) | p[0];
+}
+
+// ==================== Dates ====================
+// Days from 1970-01-01 to a proleptic Gregorian date
+static int32_t daysFromCivil(int year, unsigned month, unsigned day) {
+    year -= month <= 2;
+    int era = (year >= 0 ? year : year - 399) / 400;
+    unsigned yearOfEra = year - era * 400;
+    unsigned dayOfYear = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+    unsigned dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+    return era * 146097 + (int32_t)dayOfEra - 719468;
+}
+
+// Seconds since 1970, or 0 for the blank dates some cameras write
+static uint32_t parseExifDate(const char* text) {
+    static const uint8_t start[6] = {0, 5, 8, 11, 14, 17};
+    static const uint8_t digits[6] = {4, 2, 2, 2, 2, 2};
+    int v[6];
+    for (int i = 0; i < 6; i++) {
+        v[i] = 0;
+        for (int k = 0; k < digits[i]; k++) {
+            char c = text[start[i] + k];
+            if (c < '0' || c > '9') return 0;
+            v[i] = v[i] * 10 + c - '0';
+        }
+    }
+    
+    // 2105 keeps the result in 32 bits
+    if (v[0] < 1970 || v[0] > 2105 || v[1] < 1 || v[1] > 12 || v[2] < 1 || v[2] > 31 ||
+        v[3] > 23 || v[4] > 59 || v[5] > 60) return 0;
+    return (uint32_t)daysFromCivil(v[0], v[1], v[2]) * 86400 + v[3] * 3600 + v[4] * 60 + v[5];
+}
+
+// ==================== IFD Parsing ====================
+// Where the tags of interest point, relative to the TIFF header; 0 if absent
+struct IfdOffsets {
+    uint32_t exifIfd;
+    uint32_t dateOriginal;
+    uint32_t dateDigitized;
+    uint32_t dateTime;
+};
+
+static bool scanIfd(File& file, uint32_t tiffStart, uint32_t offset, bool bigEndian,
+                    ExifInfo& info, IfdOffsets& offsets) {
+    if (!file.seek(tiffStart + offset)) return false;
+    
+    uint8_t buf[12];
+    if (file.read(buf, 2) != 2) return false;
+    uint16_t count = exifRead16(buf, bigEndian);
+    if (count > EXIF_MAX_IFD_ENTRIES) count = EXIF_MAX_IFD_ENTRIES;
+    
+    for (uint16_t i = 0; i < count; i++) {
+        if (file.read(buf, 12) != 12) return false;
+        
+        // Dates are 20 ASCII bytes, so the entry holds their offset
+        uint16_t tag = exifRead16(buf, bigEndian);
+        bool dateFits = exifRead32(buf + 4, bigEndian) >= EXIF_DATE_LENGTH;
+        uint32_t value = exifRead32(buf + 8, bigEndian);
+        switch (tag) {
+            case EXIF_TAG_ORIENTATION: {
+                uint16_t orientation = exifRead16(buf + 8, bigEndian);
+                if (orientation >= 1 && orientation <= 8) {
+                    info.orientation = orientation;
+                }
+                break;
+            }
+            case EXIF_TAG_EXIF_IFD:       offsets.exifIfd = value; break;
+            case EXIF_TAG_DATE_ORIGINAL:  if (dateFits) offsets.dateOriginal = value; break;
+            case EXIF_TAG_DATE_DIGITIZED: if (dateFits) offsets.dateDigitized = value; break;
+            case EXIF_TAG_DATE_TIME:      if (dateFits) offsets.dateTime = value; break;
+        }
+    }
+    
+    return true;
+}
+
+static uint32_t readExifDate(File& file, uint32_t tiffStart, uint32_t offset) {
+    char text[EXIF_DATE_LENGTH];
+    if (!offset || !file.seek(tiffStart + offset)) return 0;
+    if (file.read((uint8_t*)text, EXIF_DATE_LENGTH) != EXIF_DATE_LENGTH) return 0;
+    return parseExifDate(text);
+}
+
+static bool parseTiff(File& file, uint32_t tiffStart, ExifInfo& info) {
+    uint8_t header[8];
+    if (file.read(header, 8) != 8) return false;
+    
+    bool bigEndian;
+    if (header[0] == 'M' && header[1] == 'M') {
+        bigEndian = true;
+    } else if (header[0] == 'I' && header[1] == 'I') {
+        bigEndian = false;
+    } else {
+        return false;
+    }
+    
+    if (exifRead16(header + 2, bigEndian) != 0x002A) return false;
+    
+    IfdOffsets offsets = {};
+    if (!scanIfd(file, tiffStart, exifRead32(header + 4, bigEndian), bigEndian, info, offsets)) return false;
+    if (offsets.exifIfd) {
+        scanIfd(file, tiffStart, offsets.exifIfd, bigEndian, info, offsets);
+    }
+    
+    // DateTime in IFD0 changes when the photo is edited, so it comes last
+    info.taken = readExifDate(file, tiffStart, offsets.dateOriginal);
+    if (!info.taken) info.taken = readExifDate(file, tiffStart, offsets.dateDigitized);
+    if (!info.taken) info.taken = readExifDate(file, tiffStart, offsets.dateTime);
+    return true;
+}
+
+// ==================== Public API ====================
+bool readExifInfo(File& file, ExifInfo& info) {
+    info.orientation = EXIF_ORIENTATION_NORMAL;
+    info.taken = 0;
+    
+    uint8_t buf[6];
+    if (!file.seek(0) || file.read(buf, 2) != 2) return false;
+    if (buf[0] != 0xFF || buf[1] != 0xD8) return false;
+    
+    for (int i = 0; i < EXIF_MAX_SEGMENTS; i++) {
+        if (file.read(buf, 4) != 4 || buf[0] != 0xFF) return false;
+        
+        uint8_t marker = buf[1];
+        uint16_t length = (buf[2] << 8) | buf[3];
+        
+        // Image data starts; no EXIF block in this file
+        if (marker == 0xDA || marker == 0xD9 || length < 2) return false;
+        
+        uint32_t next = file.position() + length - 2;
+        if (marker == 0xE1 && length >= 16) {
+            if (file.read(buf, 6) == 6 && memcmp(buf, "Exif\0\0", 6) == 0) {
+                return parseTiff(file, file.position(), info);
+            }
+        }
+        
+        if (!file.seek(next)) return false;
+    }
+    
+    return false;
+}
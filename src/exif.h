@@ -0,0 +1,24 @@
+#ifndef EXIF_H
+#define EXIF_H
+
+#include <Arduino.h>
+#include <SD.h>
+
+// ==================== EXIF Metadata ====================
+// Orientation values follow the EXIF spec:
+// 1 normal, 2 mirror H, 3 rotate 180, 4 mirror V,
+// 5 transpose, 6 rotate 90 CW, 7 transverse, 8 rotate 270 CW
+#define EXIF_ORIENTATION_NORMAL 1
+
+struct ExifInfo {
+    uint8_t orientation;
+    uint32_t taken;     // DateTimeOriginal in seconds since 1970, 0 if absent
+};
+
+// Reads the APP1 block of an open JPEG. Leaves defaults in info when the
+// file has no EXIF data. The file position is undefined afterwards.
+// Capture times are camera local time, as FAT timestamps are, so the two
+// sort together.
+bool readExifInfo(File& file, ExifInfo& info);
+
+#endif // EXIF_H
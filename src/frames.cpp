@@ -0,0 +1,108 @@
+#include "frames.h"
+#include "config.h"
+#include "display.h"
+#include "budget.h"
+
+struct FrameSlot {
+    uint16_t* pixels;       // Allocated on first use
+    String path;            // Empty while unused or being rendered
+    uint32_t lastUse;
+    uint8_t backlight;
+};
+
+static FrameSlot slots[FRAME_CACHE_SLOTS];
+static uint32_t useClock = 0;
+static FrameSlot* rendering = NULL;
+static String renderingPath;
+
+static FrameSlot* findSlot(const String& path) {
+    for (int i = 0; i < FRAME_CACHE_SLOTS; i++) {
+        if (slots[i].pixels && slots[i].path.length() && slots[i].path == path) return &slots[i];
+    }
+    return NULL;
+}
+
+// Least recently used slot, taking a frame from the pool if it has none.
+// With the pool spent (a clip or motion holds it) the least recently used
+// slot that has a frame is reused instead.
+static FrameSlot* claimSlot() {
+    FrameSlot* oldest = NULL;
+    FrameSlot* oldestHeld = NULL;
+    for (int i = 0; i < FRAME_CACHE_SLOTS; i++) {
+        FrameSlot& slot = slots[i];
+        if (&slot == rendering) continue;
+        if (!oldest || slot.lastUse < oldest->lastUse) oldest = &slot;
+        if (slot.pixels && (!oldestHeld || slot.lastUse < oldestHeld->lastUse)) oldestHeld = &slot;
+    }
+    if (!oldest) return NULL;
+    
+    if (!oldest->pixels) {
+        oldest->pixels = framePoolTake(FRAME_OWNER_CACHE);
+        if (!oldest->pixels) oldest = oldestHeld;
+        if (!oldest) return NULL;
+    }
+    oldest->path = "";
+    return oldest;
+}
+
+bool frameCacheShow(const String& path, uint8_t* backlight) {
+    FrameSlot* slot = findSlot(path);
+    if (!slot) return false;
+    
+    showFrame(slot->pixels);
+    *backlight = slot->backlight;
+    slot->lastUse = ++useClock;
+    return true;
+}
+
+void frameCacheStore(const String& path, uint8_t backlight) {
+    FrameSlot* slot = findSlot(path);
+    if (!slot) slot = claimSlot();
+    if (!slot) return;
+    
+    captureFrame(slot->pixels);
+    slot->path = path;
+    slot->backlight = backlight;
+    slot->lastUse = ++useClock;
+}
+
+bool frameCacheHas(const String& path) {
+    return findSlot(path) != NULL;
+}
+
+uint16_t* frameCacheBeginRender(const String& path) {
+    // A stale copy of the same path must not be shown meanwhile
+    FrameSlot* slot = findSlot(path);
+    if (slot) slot->path = "";
+    
+    rendering = slot ? slot : claimSlot();
+    if (!rendering) return NULL;
+    renderingPath = path;
+    return rendering->pixels;
+}
+
+void frameCacheEndRender(bool keep, uint8_t backlight) {
+    if (!rendering) return;
+    if (keep) {
+        rendering->path = renderingPath;
+        rendering->backlight = backlight;
+        rendering->lastUse = ++useClock;
+    }
+    rendering = NULL;
+    renderingPath = "";
+}
+
+void frameCacheClear() {
+    for (int i = 0; i < FRAME_CACHE_SLOTS; i++) {
+        slots[i].path = "";
+        slots[i].lastUse = 0;
+    }
+}
+
+void frameCacheFree() {
+    frameCacheClear();
+    for (int i = 0; i < FRAME_CACHE_SLOTS; i++) {
+        framePoolRelease(slots[i].pixels);
+        slots[i].pixels = NULL;
+    }
+}
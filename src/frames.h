@@ -0,0 +1,26 @@
+#ifndef FRAMES_H
+#define FRAMES_H
+
+#include <Arduino.h>
+
+// ==================== Frame Cache ====================
+// Finished still slides kept whole in PSRAM, by image path. Going back to
+// one, or on to the next slide rendered ahead of time, is one copy into
+// the framebuffer instead of an SD read and a decode. The least recently
+// used frame makes room for a new one. Each frame keeps the backlight
+// percent measured when it was decoded (backlight.h).
+
+// false if the path is not cached
+bool frameCacheShow(const String& path, uint8_t* backlight);
+void frameCacheStore(const String& path, uint8_t backlight);   // Keeps the screen as it is now
+bool frameCacheHas(const String& path);
+
+// Frame to render the slide for path into offscreen, NULL without memory.
+// The path only counts as cached once the render is ended with keep set.
+uint16_t* frameCacheBeginRender(const String& path);
+void frameCacheEndRender(bool keep, uint8_t backlight);
+
+void frameCacheClear();     // Forgets every frame (files changed)
+void frameCacheFree();      // Also returns the memory (motion needs it)
+
+#endif // FRAMES_H
@@ -0,0 +1,483 @@
+#include "jpeg.h"
+#include "config.h"
+#include "budget.h"
+#include <esp32s3/rom/tjpgd.h>  // ROM decoder
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/semphr.h>
+
+// ==================== Decoder State ====================
+#define JPEG_WORK_SIZE 3100  // Work area required by the ROM decoder
+
+static uint8_t jpegWork[JPEG_WORK_SIZE];
+static uint8_t jpegWorkLower[JPEG_WORK_SIZE];   // Lower band on core 0
+
+struct JpegSource {
+    File* file;
+    ImageBlockSink sink;
+    void* ctx;
+};
+
+// ==================== Decoder Callbacks ====================
+static UINT jpegInput(JDEC* jd, BYTE* buff, UINT nbyte) {
+    JpegSource* source = (JpegSource*)jd->device;
+    
+    if (buff) {
+        return decodeRead(*source->file, buff, nbyte);
+    }
+    
+    // Skip request
+    if (decodeBudgetExpired()) return 0;
+    uint32_t pos = source->file->position();
+    return source->file->seek(pos + nbyte) ? nbyte : 0;
+}
+
+static UINT jpegOutput(JDEC* jd, void* bitmap, JRECT* rect) {
+    JpegSource* source = (JpegSource*)jd->device;
+    
+    uint16_t w = rect->right - rect->left + 1;
+    uint16_t h = rect->bottom - rect->top + 1;
+    return source->sink(source->ctx, rect->left, rect->top, w, h, (const uint8_t*)bitmap) ? 1 : 0;
+}
+
+// ==================== Header Walk ====================
+// What the split needs from the headers, read before committing to
+// loading the whole file
+struct JpegLayout {
+    uint32_t heightAt;          // File offset of the frame height
+    uint32_t entropyStart;      // First byte after SOS
+    uint16_t width;
+    uint16_t height;
+    uint8_t mcuWidth;
+    uint8_t mcuHeight;
+    uint16_t restartInterval;   // MCUs per interval, 0 without DRI
+};
+
+static bool readLayout(File& file, JpegLayout& layout) {
+    uint8_t buf[16];
+    memset(&layout, 0, sizeof(layout));
+    if (decodeRead(file, buf, 2) != 2 || buf[0] != 0xFF || buf[1] != 0xD8) return false;
+    
+    while (true) {
+        if (decodeRead(file, buf, 4) != 4 || buf[0] != 0xFF) return false;
+        uint8_t marker = buf[1];
+        uint16_t length = (buf[2] << 8) | buf[3];
+        if (length < 2) return false;
+        uint32_t next = file.position() + length - 2;
+        
+        if (marker == 0xC0) {
+            // Baseline frame: precision, height, width, components, then
+            // the sampling factors of the first component
+            if (length < 11 || decodeRead(file, buf, 8) != 8) return false;
+            layout.heightAt = file.position() - 7;
+            layout.height = (buf[1] << 8) | buf[2];
+            layout.width = (buf[3] << 8) | buf[4];
+            bool gray = buf[5] == 1;
+            layout.mcuWidth = gray ? 8 : 8 * (buf[7] >> 4);
+            layout.mcuHeight = gray ? 8 : 8 * (buf[7] & 15);
+        } else if (marker >= 0xC1 && marker <= 0xCF && marker != 0xC4 && marker != 0xC8 && marker != 0xCC) {
+            return false;  // Progressive and friends: the ROM decoder rejects them anyway
+        } else if (marker == 0xDD) {
+            if (length != 4 || decodeRead(file, buf, 2) != 2) return false;
+            layout.restartInterval = (buf[0] << 8) | buf[1];
+        } else if (marker == 0xDA) {
+            layout.entropyStart = next;
+            return layout.heightAt != 0 && layout.mcuWidth != 0 && layout.mcuHeight != 0;
+        }
+        
+        if (!file.seek(next)) return false;
+    }
+}
+
+// ==================== Restart Interval Split ====================
+// A baseline JPEG with restart markers can be cut at an RSTn that starts
+// an MCU row. Each half is then a JPEG of its own: the original headers
+// with a smaller frame height, its slice of the entropy data with the
+// restart markers renumbered from RST0, and EOI. The lower half keeps the
+// file's own EOI, so a truncated file still fails. The loop task decodes
+// the upper band while a worker on core 0 decodes the lower one; both read
+// the file from PSRAM.
+struct JpegBand {
+    const uint8_t* data;
+    uint32_t entropyStart;      // Headers are data[0, entropyStart)
+    uint32_t heightAt;
+    uint16_t height;            // Replaces the frame height
+    uint32_t sliceStart;        // Entropy data handed out after the headers
+    uint32_t sliceEnd;
+    uint8_t restartBase;        // Number of the first restart marker in the slice
+    uint8_t eoiLength;          // EOI bytes appended after the slice
+    uint32_t pos;               // Position in the stream headers + slice + EOI
+    int16_t top;                // Output row of the band at the decode scale
+    
+    ImageBlockSink sink;
+    void* ctx;
+    // The lower band gathers whole MCU rows before taking the sink, and a
+    // stop from its sink ends only this band
+    bool lower;
+    uint8_t* rowPixels;
+    JRECT* rowRects;
+    uint16_t rowBlocks;
+    uint32_t rowUsed;
+    uint16_t outWidth;
+};
+
+static const uint8_t jpegEoi[2] = {0xFF, 0xD9};
+
+static bool parallelEnabled = JPEG_PARALLEL;
+static TaskHandle_t workerHandle = NULL;
+static TaskHandle_t callerHandle = NULL;
+static SemaphoreHandle_t sinkMutex = NULL;
+static JpegBand* workerBand = NULL;
+static volatile int workerResult = JDR_OK;
+static volatile bool bandsStopped = false;   // Upper band stopped, or either band failed
+
+// Rewrites RSTn in out (stream bytes from..to-1 of the slice) so the slice
+// counts from RST0. A marker's FF may sit in the previous chunk.
+static void renumberRestarts(const JpegBand& band, uint32_t from, uint32_t to, BYTE* out) {
+    const uint8_t* d = band.data;
+    uint32_t p = from > band.sliceStart ? from - 1 : from;
+    while (p + 1 < to) {
+        const uint8_t* ff = (const uint8_t*)memchr(d + p, 0xFF, to - 1 - p);
+        if (!ff) break;
+        p = ff - d + 1;
+        if (d[p] >= 0xD0 && d[p] <= 0xD7 && p >= from) {
+            out[p - from] = 0xD0 | ((d[p] - band.restartBase) & 7);
+        }
+    }
+}
+
+static UINT bandInput(JDEC* jd, BYTE* buff, UINT nbyte) {
+    JpegBand* band = (JpegBand*)jd->device;
+    uint32_t sliceLength = band->sliceEnd - band->sliceStart;
+    UINT done = 0;
+    
+    while (done < nbyte) {
+        uint32_t pos = band->pos;
+        uint32_t n;
+        if (pos < band->entropyStart) {
+            n = min<uint32_t>(nbyte - done, band->entropyStart - pos);
+            if (buff) {
+                memcpy(buff + done, band->data + pos, n);
+                for (uint32_t i = 0; i < 2; i++) {
+                    uint32_t at = band->heightAt + i;
+                    if (at >= pos && at < pos + n) buff[done + at - pos] = i ? band->height & 0xFF : band->height >> 8;
+                }
+            }
+        } else if (pos < band->entropyStart + sliceLength) {
+            uint32_t from = band->sliceStart + pos - band->entropyStart;
+            n = min<uint32_t>(nbyte - done, band->sliceEnd - from);
+            if (buff) {
+                memcpy(buff + done, band->data + from, n);
+                if (band->restartBase) renumberRestarts(*band, from, from + n, buff + done);
+            }
+        } else {
+            uint32_t at = pos - band->entropyStart - sliceLength;
+            if (at >= band->eoiLength) break;
+            n = min<uint32_t>(nbyte - done, band->eoiLength - at);
+            if (buff) memcpy(buff + done, jpegEoi + at, n);
+        }
+        band->pos += n;
+        done += n;
+    }
+    return done;
+}
+
+static bool emitBlock(JpegBand* band, const JRECT& rect, const uint8_t* pixels) {
+    if (bandsStopped) return false;
+    uint16_t w = rect.right - rect.left + 1;
+    uint16_t h = rect.bottom - rect.top + 1;
+    if (!band->sink(band->ctx, rect.left, band->top + rect.top, w, h, pixels)) {
+        // Output past the screen bottom from the upper band means nothing
+        // below it can show either
+        if (!band->lower) bandsStopped = true;
+        return false;
+    }
+    return true;
+}
+
+static UINT bandOutput(JDEC* jd, void* bitmap, JRECT* rect) {
+    JpegBand* band = (JpegBand*)jd->device;
+    bool ok = true;
+    
+    if (!band->lower) {
+        xSemaphoreTake(sinkMutex, portMAX_DELAY);
+        ok = emitBlock(band, *rect, (const uint8_t*)bitmap);
+        xSemaphoreGive(sinkMutex);
+        return ok ? 1 : 0;
+    }
+    
+    // A whole MCU row per lock keeps the two bands from splitting each
+    // other's blit bands into single blocks
+    uint32_t size = (uint32_t)(rect->right - rect->left + 1) * (rect->bottom - rect->top + 1) * 3;
+    memcpy(band->rowPixels + band->rowUsed, bitmap, size);
+    band->rowRects[band->rowBlocks++] = *rect;
+    band->rowUsed += size;
+    if (rect->right + 1 < band->outWidth) return 1;
+    
+    xSemaphoreTake(sinkMutex, portMAX_DELAY);
+    const uint8_t* pixels = band->rowPixels;
+    for (uint16_t i = 0; i < band->rowBlocks && ok; i++) {
+        const JRECT& r = band->rowRects[i];
+        ok = emitBlock(band, r, pixels);
+        pixels += (uint32_t)(r.right - r.left + 1) * (r.bottom - r.top + 1) * 3;
+    }
+    xSemaphoreGive(sinkMutex);
+    band->rowBlocks = 0;
+    band->rowUsed = 0;
+    return ok ? 1 : 0;
+}
+
+static int decodeBand(JpegBand* band, uint8_t* work, uint8_t scale) {
+    band->pos = 0;
+    JDEC jd;
+    JRESULT res = jd_prepare(&jd, bandInput, work, JPEG_WORK_SIZE, band);
+    if (res == JDR_OK) {
+        res = jd_decomp(&jd, bandOutput, scale);
+    }
+    return res;
+}
+
+static uint8_t workerScale = 0;
+
+static void jpegWorkerTask(void* parameter) {
+    while (true) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        workerResult = decodeBand(workerBand, jpegWorkLower, workerScale);
+        if (workerResult != JDR_OK && workerResult != JDR_INTR) bandsStopped = true;
+        xTaskNotifyGive(callerHandle);
+    }
+}
+
+static bool startWorker() {
+    if (workerHandle) return true;
+    sinkMutex = xSemaphoreCreateMutex();
+    if (!sinkMutex) return false;
+    xTaskCreatePinnedToCore(jpegWorkerTask, "jpegLower", JPEG_TASK_STACK, NULL,
+                            JPEG_TASK_PRIORITY, &workerHandle, JPEG_TASK_CORE);
+    return workerHandle != NULL;
+}
+
+static uint32_t gcd(uint32_t a, uint32_t b) {
+    while (b) {
+        uint32_t t = a % b;
+        a = b;
+        b = t;
+    }
+    return a;
+}
+
+// Offset just past the count-th restart marker, 0 if the data runs out
+static uint32_t findRestart(const uint8_t* data, uint32_t from, uint32_t end, uint32_t count) {
+    uint32_t p = from;
+    while (count > 0 && p + 1 < end) {
+        const uint8_t* ff = (const uint8_t*)memchr(data + p, 0xFF, end - 1 - p);
+        if (!ff) return 0;
+        p = ff - data + 1;
+        if (data[p] >= 0xD0 && data[p] <= 0xD7) count--;
+    }
+    return count == 0 ? p + 1 : 0;
+}
+
+// MCU row to cut at: the restart boundary nearest the middle, 0 if none
+static uint32_t splitRow(const JpegLayout& layout) {
+    if (layout.restartInterval == 0) return 0;
+    uint32_t mcusPerRow = (layout.width + layout.mcuWidth - 1) / layout.mcuWidth;
+    uint32_t mcuRows = (layout.height + layout.mcuHeight - 1) / layout.mcuHeight;
+    
+    // Restarts line up with a row start every `step` rows
+    uint32_t step = layout.restartInterval / gcd(layout.restartInterval, mcusPerRow);
+    uint32_t row = (mcuRows / 2 + step / 2) / step * step;
+    return row < mcuRows ? row : 0;
+}
+
+// Returns -1 when the file does not qualify, so the caller streams it
+// from the start
+static int decodeParallel(File& file, uint8_t scale, ImageBlockSink sink, void* ctx) {
+    JpegLayout layout;
+    uint32_t size = file.size();
+    if (!parallelEnabled || size > JPEG_PARALLEL_MAX_FILE || !readLayout(file, layout)) return -1;
+    uint32_t row = splitRow(layout);
+    if (row == 0 || !startWorker()) return -1;
+    
+    ArenaScope arena(ARENA_DECODE);
+    uint8_t* data = (uint8_t*)arena.alloc(size);
+    if (!data) return -1;
+    
+    uint32_t mcusPerRow = (layout.width + layout.mcuWidth - 1) / layout.mcuWidth;
+    uint32_t restarts = row * mcusPerRow / layout.restartInterval;
+    uint16_t outWidth = (layout.width + (1 << scale) - 1) >> scale;
+    uint32_t blockBytes = (uint32_t)max(1, layout.mcuWidth >> scale) * max(1, layout.mcuHeight >> scale) * 3;
+    
+    JpegBand upper = {};
+    JpegBand lower = {};
+    lower.rowPixels = (uint8_t*)arena.alloc(mcusPerRow * blockBytes);
+    lower.rowRects = (JRECT*)arena.alloc(mcusPerRow * sizeof(JRECT));
+    
+    int res = JDR_OK;
+    uint32_t cut = 0;
+    if (!lower.rowPixels || !lower.rowRects) {
+        res = -1;
+    } else if (!file.seek(0) || decodeRead(file, data, size) != size) {
+        res = JDR_INP;
+    } else {
+        cut = findRestart(data, layout.entropyStart, size, restarts);
+        if (cut == 0) res = -1;
+    }
+    
+    if (res == JDR_OK) {
+        upper.data = lower.data = data;
+        upper.entropyStart = lower.entropyStart = layout.entropyStart;
+        upper.heightAt = lower.heightAt = layout.heightAt;
+        upper.sink = lower.sink = sink;
+        upper.ctx = lower.ctx = ctx;
+        
+        upper.height = row * layout.mcuHeight;
+        upper.sliceStart = layout.entropyStart;
+        upper.sliceEnd = cut - 2;
+        upper.eoiLength = sizeof(jpegEoi);
+        
+        lower.height = layout.height - upper.height;
+        lower.sliceStart = cut;
+        lower.sliceEnd = size;
+        lower.restartBase = restarts & 7;
+        lower.top = upper.height >> scale;
+        lower.lower = true;
+        lower.outWidth = outWidth;
+        
+        bandsStopped = false;
+        callerHandle = xTaskGetCurrentTaskHandle();
+        workerBand = &lower;
+        workerScale = scale;
+        xTaskNotifyGive(workerHandle);
+        
+        res = decodeBand(&upper, jpegWork, scale);
+        if (res != JDR_OK) bandsStopped = true;
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        
+        // Errors outrank an interrupt, which only means a sink stopped
+        if (res == JDR_OK || (res == JDR_INTR && workerResult != JDR_OK)) {
+            res = workerResult;
+        }
+    }
+    return res;
+}
+
+// ==================== Decoder Interface ====================
+static bool jpegProbe(const uint8_t* magic) {
+    return magic[0] == 0xFF && magic[1] == 0xD8 && magic[2] == 0xFF;
+}
+
+static int jpegGetSize(File& file, uint16_t* w, uint16_t* h) {
+    JpegSource source = {&file, NULL, NULL};
+    JDEC jd;
+    JRESULT res = jd_prepare(&jd, jpegInput, jpegWork, JPEG_WORK_SIZE, &source);
+    
+    if (res == JDR_OK) {
+        *w = jd.width;
+        *h = jd.height;
+    }
+    return res;
+}
+
+static int jpegDecode(File& file, uint8_t scale, ImageBlockSink sink, void* ctx) {
+    int res = decodeParallel(file, scale, sink, ctx);
+    if (res != -1) return res;
+    file.seek(0);
+    
+    JpegSource source = {&file, sink, ctx};
+    JDEC jd;
+    res = jd_prepare(&jd, jpegInput, jpegWork, JPEG_WORK_SIZE, &source);
+    if (res == JDR_OK) {
+        res = jd_decomp(&jd, jpegOutput, scale);
+    }
+    return res;
+}
+
+const ImageDecoder jpegDecoder = {
+    "JPEG",
+    ".jpg.jpeg",
+    jpegProbe,
+    jpegGetSize,
+    jpegDecode,
+};
+
+// ==================== Memory Buffers ====================
+// Clip frames arrive whole in PSRAM and decode on a task of their own
+static uint8_t jpegWorkBuffer[JPEG_WORK_SIZE];
+
+struct JpegMemory {
+    const uint8_t* data;
+    uint32_t length;
+    uint32_t pos;
+    ImageBlockSink sink;
+    void* ctx;
+};
+
+static UINT memoryInput(JDEC* jd, BYTE* buff, UINT nbyte) {
+    JpegMemory* memory = (JpegMemory*)jd->device;
+    UINT n = min<uint32_t>(nbyte, memory->length - memory->pos);
+    if (buff) memcpy(buff, memory->data + memory->pos, n);
+    memory->pos += n;
+    return n;
+}
+
+static UINT memoryOutput(JDEC* jd, void* bitmap, JRECT* rect) {
+    JpegMemory* memory = (JpegMemory*)jd->device;
+    
+    uint16_t w = rect->right - rect->left + 1;
+    uint16_t h = rect->bottom - rect->top + 1;
+    return memory->sink(memory->ctx, rect->left, rect->top, w, h, (const uint8_t*)bitmap) ? 1 : 0;
+}
+
+int jpegBufferSize(const uint8_t* data, uint32_t length, uint16_t* w, uint16_t* h) {
+    JpegMemory memory = {data, length, 0, NULL, NULL};
+    JDEC jd;
+    JRESULT res = jd_prepare(&jd, memoryInput, jpegWorkBuffer, JPEG_WORK_SIZE, &memory);
+    
+    if (res == JDR_OK) {
+        *w = jd.width;
+        *h = jd.height;
+    }
+    return res;
+}
+
+int jpegDecodeBuffer(const uint8_t* data, uint32_t length, uint8_t scale, ImageBlockSink sink, void* ctx) {
+    JpegMemory memory = {data, length, 0, sink, ctx};
+    JDEC jd;
+    JRESULT res = jd_prepare(&jd, memoryInput, jpegWorkBuffer, JPEG_WORK_SIZE, &memory);
+    if (res == JDR_OK) {
+        res = jd_decomp(&jd, memoryOutput, scale);
+    }
+    return res;
+}
+
+// ==================== Benchmark ====================
+static bool countOnly(void* ctx, int16_t x, int16_t y, uint16_t w, uint16_t h, const uint8_t* rgb) {
+    return true;
+}
+
+void jpegBenchmark(const char* path) {
+    File file = SD.open(path, FILE_READ);
+    if (!file) return;
+    JpegLayout layout;
+    bool ok = readLayout(file, layout);
+    uint32_t size = file.size();
+    file.close();
+    if (!ok) return;
+    
+    bool enabled = parallelEnabled;
+    parallelEnabled = false;
+    int single = imageDecodeSd(path, 0, countOnly, NULL);
+    unsigned long singleMicros = lastDecodeStats().micros;
+    
+    parallelEnabled = true;
+    int dual = imageDecodeSd(path, 0, countOnly, NULL);
+    unsigned long dualMicros = lastDecodeStats().micros;
+    parallelEnabled = enabled;
+    
+    Serial.printf("%s: %ux%u, %lu KB, restart %u MCUs: 1 core %.1f ms, 2 cores %.1f ms (%.2fx)%s\n",
+                  path, layout.width, layout.height, (unsigned long)(size >> 10), layout.restartInterval,
+                  singleMicros / 1000.0f, dualMicros / 1000.0f, (float)singleMicros / max(1UL, dualMicros),
+                  (single != JDR_OK || dual != JDR_OK) ? " FAILED" :
+                  (size <= JPEG_PARALLEL_MAX_FILE && splitRow(layout)) ? "" : " (not split)");
+}
@@ -0,0 +1,22 @@
+#ifndef JPEG_H
+#define JPEG_H
+
+#include "decoder.h"
+
+// ==================== ROM JPEG Decoder ====================
+// Decodes through the TJpgDec build in the ESP32-S3 ROM, which emits RGB888
+// MCUs and scales by 1/2, 1/4 and 1/8 natively. Its JRESULT codes are the
+// DecodeResult values.
+extern const ImageDecoder jpegDecoder;
+
+// A JPEG held whole in memory, such as one frame of a clip. These share a
+// work area of their own, so one task at a time may use them alongside
+// the file decoders on another.
+int jpegBufferSize(const uint8_t* data, uint32_t length, uint16_t* w, uint16_t* h);
+int jpegDecodeBuffer(const uint8_t* data, uint32_t length, uint8_t scale, ImageBlockSink sink, void* ctx);
+
+// Prints how long one file takes to decode on one core and, split at a
+// restart marker near the middle, on both cores. Other formats are skipped.
+void jpegBenchmark(const char* path);
+
+#endif // JPEG_H
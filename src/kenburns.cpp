@@ -0,0 +1,420 @@
+#include "kenburns.h"
+#include "config.h"
+#include "display.h"
+#include "color.h"
+#include "decoder.h"
+#include "log.h"
+#include "budget.h"
+#include <esp32s3/rom/cache.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+// ==================== Source Image ====================
+// The source is the image after EXIF rotation, laid out like the
+// framebuffer: source row u is screen column u and runs bottom to top
+// (turned over, the last column running top to bottom).
+// Scaling then walks source and framebuffer rows in the same direction.
+// It is a run of frame pool slots, held while motion is on.
+#define SOURCE_MAX_PIXELS ((uint32_t)KENBURNS_SOURCE_SLOTS * FRAME_PIXELS)
+
+static uint16_t* source = NULL;
+static int32_t sourceRows = 0;   // Image width as shown
+static int32_t sourceCols = 0;   // Image height as shown
+static bool active = false;
+
+// Screen in framebuffer order: 480 rows of 800 pixels
+static int32_t fbRows = 0;
+static int32_t fbCols = 0;
+static bool turnedOver = false;  // Rotation 3: the source is stored turned 180 degrees
+
+// Where the decoder's pixel (x, y) lands in the source
+struct SourceTarget {
+    int32_t base;
+    int32_t stepX;
+    int32_t stepY;
+    int32_t width;
+    int32_t height;
+};
+
+static uint16_t decodeBlock[16 * 16];
+
+// ==================== Motion Path ====================
+// A move goes from one window to another in KENBURNS_SEGMENT_MS, then the
+// next move starts from where it ended. cx/cy is the window centre in the
+// source, step the source pixels per screen pixel.
+struct MotionWindow {
+    float cx;
+    float cy;
+    float step;
+};
+
+static MotionWindow moveFrom;
+static MotionWindow moveTo;
+static float coverStep = 1.0f;   // Step at which the source just fills the screen
+static bool zoomedIn = false;
+static unsigned long moveStart = 0;
+static unsigned long lastFrameAt = 0;
+static unsigned long nextFrameDue = 0;
+
+// ==================== Frame Setup ====================
+// 16.16 fixed point source coordinates of the first framebuffer row and
+// column, and the step per screen pixel. Column positions are the same for
+// every row, so they are resolved once per frame: index << 6 | weight.
+static int32_t frameU0 = 0;
+static int32_t frameV0 = 0;
+static int32_t frameStep = 0;
+static uint32_t columnTable[800];
+
+// ==================== Workers ====================
+static TaskHandle_t loopTaskHandle = NULL;
+static TaskHandle_t workerHandle = NULL;
+static unsigned long workerMicros = 0;
+
+// ==================== Stats ====================
+static KenBurnsStats stats = {};
+static unsigned long windowStart = 0;
+static uint32_t windowFrames = 0;
+static unsigned long windowCore1 = 0;
+static unsigned long windowCore0 = 0;
+static unsigned long windowFrameTime = 0;
+
+// ==================== Decode ====================
+static bool sourceSink(void* ctx, int16_t x, int16_t y, uint16_t w, uint16_t h, const uint8_t* rgb) {
+    SourceTarget* target = (SourceTarget*)ctx;
+#if JPEG_DITHER
+    rgb888ToRgb565Dither(rgb, decodeBlock, w, h, x, y, decodeLuma());
+#else
+    rgb888ToRgb565(rgb, decodeBlock, w, h, decodeLuma());
+#endif
+
+    for (int32_t j = 0; j < h && y + j < target->height; j++) {
+        const uint16_t* src = decodeBlock + j * w;
+        uint16_t* dst = source + target->base + x * target->stepX + (y + j) * target->stepY;
+        for (int32_t i = 0; i < w && x + i < target->width; i++) {
+            *dst = src[i];
+            dst += target->stepX;
+        }
+    }
+    return true;
+}
+
+// Maps decoded pixel (x, y) of a width x height image to the source index
+// for the given EXIF orientation
+static SourceTarget sourceTarget(uint8_t orientation, int32_t width, int32_t height) {
+    // Shown position as sx = ax*x + ay*y + a0, sy = bx*x + by*y + b0
+    int32_t ax = 0, ay = 0, a0 = 0, bx = 0, by = 0, b0 = 0;
+    switch (orientation) {
+        case 2:  ax = -1; a0 = width - 1;  by = 1;                       break;
+        case 3:  ax = -1; a0 = width - 1;  by = -1; b0 = height - 1;     break;
+        case 4:  ax = 1;                   by = -1; b0 = height - 1;     break;
+        case 5:  ay = 1;                   bx = 1;                       break;
+        case 6:  ay = -1; a0 = height - 1; bx = 1;                       break;
+        case 7:  ay = -1; a0 = height - 1; bx = -1; b0 = width - 1;      break;
+        case 8:  ay = 1;                   bx = -1; b0 = width - 1;      break;
+        default: ax = 1;                   by = 1;                       break;
+    }
+    
+    // Source index is sx * cols + (cols - 1 - sy), or (rows - 1 - sx) * cols + sy
+    // when the panel is turned over
+    SourceTarget target;
+    if (turnedOver) {
+        target.stepX = -ax * sourceCols + bx;
+        target.stepY = -ay * sourceCols + by;
+        target.base = (sourceRows - 1 - a0) * sourceCols + b0;
+    } else {
+        target.stepX = ax * sourceCols - bx;
+        target.stepY = ay * sourceCols - by;
+        target.base = a0 * sourceCols + sourceCols - 1 - b0;
+    }
+    target.width = width;
+    target.height = height;
+    return target;
+}
+
+// ==================== Scaler ====================
+// RGB565 spread over 32 bits as 00000GGGGGG00000RRRRR000000BBBBB leaves
+// five spare bits above every channel, so one multiply by a 5-bit weight
+// blends all three channels at once.
+#define SPREAD_MASK 0x07E0F81FUL
+
+static inline uint32_t spread(uint16_t c) {
+    return ((uint32_t)c | ((uint32_t)c << 16)) & SPREAD_MASK;
+}
+
+static inline uint32_t blend(uint32_t a, uint32_t b, uint32_t weight) {
+    return ((a * (32 - weight) + b * weight) >> 5) & SPREAD_MASK;
+}
+
+// Integer part and 5-bit fraction of a 16.16 position, kept inside
+// 0..limit-1 so the right/lower neighbour always exists
+static inline void splitPosition(int32_t pos, int32_t limit, int32_t& index, uint32_t& weight) {
+    if (pos < 0) pos = 0;
+    index = pos >> 16;
+    weight = (pos >> 11) & 31;
+    if (index >= limit - 1) {
+        index = limit - 2;
+        weight = 32;
+    }
+}
+
+static void renderRows(int32_t first, int32_t last) {
+    uint16_t* fb = gfx.getFramebuffer();
+    
+    for (int32_t r = first; r < last; r++) {
+        int32_t row;
+        uint32_t fy;
+        splitPosition(frameU0 + r * frameStep, sourceRows, row, fy);
+        const uint16_t* a = source + row * sourceCols;
+        const uint16_t* b = a + sourceCols;
+        uint16_t* out = fb + r * fbCols;
+        
+        for (int32_t c = 0; c < fbCols; c++) {
+            uint32_t entry = columnTable[c];
+            uint32_t fx = entry & 63;
+            const uint16_t* pa = a + (entry >> 6);
+            const uint16_t* pb = b + (entry >> 6);
+            uint32_t top = blend(spread(pa[0]), spread(pa[1]), fx);
+            uint32_t bottom = blend(spread(pb[0]), spread(pb[1]), fx);
+            uint32_t pixel = blend(top, bottom, fy);
+            out[c] = (uint16_t)(pixel | (pixel >> 16));
+        }
+    }
+    
+    Cache_WriteBack_Addr((uint32_t)(uintptr_t)(fb + first * fbCols), (last - first) * fbCols * 2);
+}
+
+static void kenBurnsTask(void* parameter) {
+    while (true) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        unsigned long start = micros();
+        renderRows(fbRows / 2, fbRows);
+        workerMicros = micros() - start;
+        xTaskNotifyGive(loopTaskHandle);
+    }
+}
+
+// ==================== Motion ====================
+static float randomUnit() {
+    return random(0, 1001) / 1000.0f;
+}
+
+static MotionWindow pickWindow(bool closeUp) {
+    MotionWindow window;
+    window.step = closeUp ? coverStep / KENBURNS_ZOOM : coverStep;
+    float halfWidth = fbRows / 2 * window.step;
+    float halfHeight = fbCols / 2 * window.step;
+    window.cx = halfWidth + (sourceRows - 2 * halfWidth) * randomUnit();
+    window.cy = halfHeight + (sourceCols - 2 * halfHeight) * randomUnit();
+    return window;
+}
+
+static MotionWindow mixWindows(const MotionWindow& a, const MotionWindow& b, float t) {
+    MotionWindow window;
+    window.cx = a.cx + (b.cx - a.cx) * t;
+    window.cy = a.cy + (b.cy - a.cy) * t;
+    window.step = a.step + (b.step - a.step) * t;
+    return window;
+}
+
+// Starts the next move from `from`. A move is shortened until no point on
+// screen travels more than KENBURNS_MAX_STEP pixels a frame; at that speed
+// the scanout overtaking the renderer leaves no visible seam.
+static void startMove(const MotionWindow& from, unsigned long now) {
+    zoomedIn = !zoomedIn;
+    moveFrom = from;
+    moveTo = pickWindow(zoomedIn);
+    
+    float travel = max(fabsf(moveTo.cx - moveFrom.cx) + fabsf(moveTo.step - moveFrom.step) * fbRows / 2,
+                       fabsf(moveTo.cy - moveFrom.cy) + fabsf(moveTo.step - moveFrom.step) * fbCols / 2);
+    float screenTravel = travel / min(moveFrom.step, moveTo.step);
+    
+    // Smoothstep peaks at 1.5x the average speed
+    float frames = (float)KENBURNS_SEGMENT_MS * KENBURNS_FPS / 1000;
+    float perFrame = screenTravel * 1.5f / frames;
+    if (perFrame > KENBURNS_MAX_STEP) {
+        moveTo = mixWindows(moveFrom, moveTo, KENBURNS_MAX_STEP / perFrame);
+    }
+    moveStart = now;
+}
+
+static void setupFrame(const MotionWindow& window) {
+    // Screen pixel centres sampled in the source
+    float step = window.step;
+    float u0 = window.cx - fbRows / 2 * step + step / 2 - 0.5f;
+    float v0 = sourceCols - 0.5f - (window.cy - fbCols / 2 * step) - (fbCols - 0.5f) * step;
+    
+    frameStep = (int32_t)(step * 65536);
+    frameU0 = (int32_t)(u0 * 65536);
+    frameV0 = (int32_t)(v0 * 65536);
+    
+    for (int32_t c = 0; c < fbCols; c++) {
+        int32_t index;
+        uint32_t weight;
+        splitPosition(frameV0 + c * frameStep, sourceCols, index, weight);
+        columnTable[c] = (uint32_t)index << 6 | weight;
+    }
+}
+
+static void renderFrame(unsigned long now) {
+    float t = (float)(now - moveStart) / KENBURNS_SEGMENT_MS;
+    if (t >= 1.0f) {
+        startMove(moveTo, now);
+        t = 0;
+    }
+    float eased = t * t * (3 - 2 * t);
+    
+    unsigned long start = micros();
+    setupFrame(mixWindows(moveFrom, moveTo, eased));
+    
+    // Bottom half on core 0 while this task renders the top half
+    xTaskNotifyGive(workerHandle);
+    renderRows(0, fbRows / 2);
+    unsigned long core1 = micros() - start;
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    unsigned long frameTime = micros() - start;
+    
+    stats.frames++;
+    windowFrames++;
+    windowCore1 += core1;
+    windowCore0 += workerMicros;
+    windowFrameTime += frameTime;
+    
+    unsigned long elapsed = now - windowStart;
+    if (elapsed >= KENBURNS_STATS_WINDOW) {
+        stats.fps = windowFrames * 1000.0f / elapsed;
+        stats.frameMicros = windowFrameTime / windowFrames;
+        stats.loadCore1 = min(100UL, windowCore1 / 10 / elapsed);
+        stats.loadCore0 = min(100UL, windowCore0 / 10 / elapsed);
+        windowStart = now;
+        windowFrames = 0;
+        windowCore1 = 0;
+        windowCore0 = 0;
+        windowFrameTime = 0;
+    }
+}
+
+// ==================== Public API ====================
+bool kenBurnsBegin() {
+    // Framebuffer order below assumes portrait rotation, either way up
+    uint8_t rotation = gfx.getRotation();
+    if ((rotation != 1 && rotation != 3) || !gfx.getFramebuffer()) return false;
+    turnedOver = rotation == 3;
+    fbRows = gfx.width();
+    fbCols = gfx.height();
+    if (fbCols > (int32_t)(sizeof(columnTable) / sizeof(columnTable[0]))) return false;
+    
+    if (!workerHandle) {
+        loopTaskHandle = xTaskGetCurrentTaskHandle();
+        xTaskCreatePinnedToCore(kenBurnsTask, "kenBurns", KENBURNS_TASK_STACK, NULL,
+                                KENBURNS_TASK_PRIORITY, &workerHandle, KENBURNS_TASK_CORE);
+    }
+    return workerHandle != NULL;
+}
+
+void kenBurnsEnd() {
+    active = false;
+    framePoolRelease(source);
+    source = NULL;
+    stats.fps = 0;
+}
+
+int kenBurnsLoad(const char* path, uint8_t orientation, uint16_t width, uint16_t height) {
+    active = false;
+    if (!workerHandle) return DECODE_BAD_PARAMETER;
+    
+    if (!source) {
+        source = (uint16_t*)framePoolTakeRun(FRAME_OWNER_MOTION, KENBURNS_SOURCE_SLOTS);
+        if (!source) return DECODE_NO_MEMORY;
+    }
+    
+    // Largest reduction that still gives one source pixel per screen pixel
+    // at the closest zoom, then further down until it fits
+    bool transposed = orientation >= 5;
+    uint32_t shownWidth = transposed ? height : width;
+    uint32_t shownHeight = transposed ? width : height;
+    uint8_t scale = 0;
+    while (scale < 3 && (shownWidth >> (scale + 1)) >= fbRows * KENBURNS_ZOOM &&
+           (shownHeight >> (scale + 1)) >= fbCols * KENBURNS_ZOOM) {
+        scale++;
+    }
+    while (scale < 3 && (shownWidth >> scale) * (shownHeight >> scale) > SOURCE_MAX_PIXELS) {
+        scale++;
+    }
+    
+    sourceRows = shownWidth >> scale;
+    sourceCols = shownHeight >> scale;
+    if (sourceRows < 2 || sourceCols < 2 || (uint32_t)sourceRows * sourceCols > SOURCE_MAX_PIXELS) {
+        return DECODE_BAD_PARAMETER;
+    }
+    
+    SourceTarget target = sourceTarget(orientation, width >> scale, height >> scale);
+    unsigned long decodeStart = millis();
+    int res = imageDecodeSd(path, scale, sourceSink, &target);
+    if (res != DECODE_OK) return res;
+    
+    LOG_D("Motion source %ldx%ld (1/%d scale)\n", (long)sourceRows, (long)sourceCols, 1 << scale);
+    
+    // Open on the whole image, then move in
+    coverStep = min((float)sourceRows / fbRows, (float)sourceCols / fbCols);
+    MotionWindow whole = {sourceRows / 2.0f, sourceCols / 2.0f, coverStep};
+    unsigned long now = millis();
+    zoomedIn = false;
+    startMove(whole, now);
+    
+    // Decoding is not frame time
+    if (windowFrames == 0) {
+        windowStart = now;
+    } else {
+        windowStart += now - decodeStart;
+    }
+    
+    active = true;
+    lastFrameAt = now;
+    nextFrameDue = now + 1000 / KENBURNS_FPS;
+    renderFrame(now);
+    return DECODE_OK;
+}
+
+bool kenBurnsActive() {
+    return active;
+}
+
+void kenBurnsPoll() {
+    if (!active) return;
+    
+    const unsigned long period = 1000 / KENBURNS_FPS;
+    unsigned long now = millis();
+    if ((long)(now - nextFrameDue) < 0) return;
+    
+    if (now - lastFrameAt > KENBURNS_PAUSE_FRAMES * period) {
+        // Something else had the screen; carry on where the move left off
+        moveStart += now - lastFrameAt - period;
+        windowStart += now - lastFrameAt - period;
+        nextFrameDue = now;
+    } else if (now - nextFrameDue >= period) {
+        stats.lateFrames += (now - nextFrameDue) / period;
+        nextFrameDue = now;
+    }
+    nextFrameDue += period;
+    lastFrameAt = now;
+    
+    renderFrame(now);
+}
+
+const KenBurnsStats& kenBurnsStats() {
+    return stats;
+}
+
+void printKenBurnsStats() {
+    Serial.println("=== Motion ===");
+    if (!active) {
+        Serial.println("Inactive");
+        return;
+    }
+    Serial.printf("Source: %ldx%ld, step %.3f -> %.3f\n", (long)sourceRows, (long)sourceCols,
+                  moveFrom.step, moveTo.step);
+    Serial.printf("Rate: %.1f fps (target %d), %lu us/frame\n", stats.fps, KENBURNS_FPS,
+                  (unsigned long)stats.frameMicros);
+    Serial.printf("Load: core 1 %d%%, core 0 %d%%\n", stats.loadCore1, stats.loadCore0);
+    Serial.printf("Frames: %lu, late %lu\n", (unsigned long)stats.frames, (unsigned long)stats.lateFrames);
+}
@@ -0,0 +1,36 @@
+#ifndef KENBURNS_H
+#define KENBURNS_H
+
+#include <Arduino.h>
+
+// ==================== Ken Burns Motion ====================
+// Slow pan and zoom across the image on screen. The image is decoded once
+// into a PSRAM source larger than the screen, stored in framebuffer order,
+// and every frame is scaled from it straight into the framebuffer: the
+// loop task renders one half of the rows and a worker on core 0 the other.
+
+struct KenBurnsStats {
+    float fps;              // Frames per second over the last window
+    uint32_t frameMicros;   // Average time to render one frame
+    uint8_t loadCore1;      // Share of the window spent rendering, percent
+    uint8_t loadCore0;
+    uint32_t lateFrames;    // Frames that missed their slot, since boot
+    uint32_t frames;        // Frames rendered, since boot
+};
+
+bool kenBurnsBegin();   // Starts the core 0 worker; false if the display cannot run motion
+void kenBurnsEnd();     // Stops motion and frees the source
+
+// Decodes an image into the source and starts a new move from the whole
+// image. Returns a DecodeResult.
+int kenBurnsLoad(const char* path, uint8_t orientation, uint16_t width, uint16_t height);
+bool kenBurnsActive();
+
+// Renders the next frame when it is due. Gaps longer than a few frames
+// (menus, messages) pause the move rather than jump it.
+void kenBurnsPoll();
+
+const KenBurnsStats& kenBurnsStats();
+void printKenBurnsStats();
+
+#endif // KENBURNS_H
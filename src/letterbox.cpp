@@ -0,0 +1,238 @@
+#include "letterbox.h"
+#include "config.h"
+#include "color.h"
+#include "decoder.h"
+#include "display.h"
+#include "log.h"
+#include "budget.h"
+
+#define GRID_W LETTERBOX_GRID_WIDTH
+#define GRID_H LETTERBOX_GRID_HEIGHT
+#define GRID_CELLS (GRID_W * GRID_H)
+#define BLOCK 16
+#define WEIGHT_ONE (2 * LETTERBOX_CELL)   // Interpolation weights, per cell
+
+// ==================== Source Sampling ====================
+// Averages the decode into the grid, applying the EXIF orientation and a
+// crop to the screen's aspect ratio
+struct GridSource {
+    uint32_t* sums;         // Three per cell
+    uint16_t* counts;
+    int srcWidth;           // Decoded size at the scale used
+    int srcHeight;
+    uint8_t orientation;
+    int cropX;              // Crop in shown coordinates
+    int cropY;
+    int cropWidth;
+    int cropHeight;
+};
+
+static bool gridSink(void* ctx, int16_t x, int16_t y, uint16_t w, uint16_t h, const uint8_t* rgb) {
+    GridSource* s = (GridSource*)ctx;
+    const int W = s->srcWidth;
+    const int H = s->srcHeight;
+    
+    for (int j = 0; j < h; j++) {
+        for (int i = 0; i < w; i++, rgb += 3) {
+            int sx = x + i;
+            int sy = y + j;
+            if (sx >= W || sy >= H) continue;
+            
+            int px, py;
+            switch (s->orientation) {
+                case 2:  px = W - 1 - sx; py = sy;         break;
+                case 3:  px = W - 1 - sx; py = H - 1 - sy; break;
+                case 4:  px = sx;         py = H - 1 - sy; break;
+                case 5:  px = sy;         py = sx;         break;
+                case 6:  px = H - 1 - sy; py = sx;         break;
+                case 7:  px = H - 1 - sy; py = W - 1 - sx; break;
+                case 8:  px = sy;         py = W - 1 - sx; break;
+                default: px = sx;         py = sy;         break;
+            }
+            
+            px -= s->cropX;
+            py -= s->cropY;
+            if (px < 0 || py < 0 || px >= s->cropWidth || py >= s->cropHeight) continue;
+            
+            int cell = (py * GRID_H / s->cropHeight) * GRID_W + px * GRID_W / s->cropWidth;
+            uint32_t* sum = s->sums + cell * 3;
+            sum[0] += rgb[0];
+            sum[1] += rgb[1];
+            sum[2] += rgb[2];
+            s->counts[cell]++;
+        }
+    }
+    return true;
+}
+
+// ==================== Kernels ====================
+// One box pass over n values spaced step apart, edges clamped. The
+// reciprocal of the box is 4.12 fixed point so the sum times it stays in
+// 32 bits.
+static void boxLine(uint16_t* line, int n, int step, uint16_t* out) {
+    const int r = LETTERBOX_BLUR_RADIUS;
+    const uint32_t reciprocal = 4096 / (2 * r + 1);
+    
+    uint32_t sum = line[0] * (r + 1);
+    for (int i = 1; i <= r; i++) {
+        sum += line[min(i, n - 1) * step];
+    }
+    for (int i = 0; i < n; i++) {
+        out[i] = (sum * reciprocal) >> 12;
+        sum += line[min(i + r + 1, n - 1) * step];
+        sum -= line[max(i - r, 0) * step];
+    }
+    for (int i = 0; i < n; i++) {
+        line[i * step] = out[i];
+    }
+}
+
+void letterboxBlur(uint16_t* grid) {
+    uint16_t out[GRID_W > GRID_H ? GRID_W : GRID_H];
+    
+    for (int pass = 0; pass < LETTERBOX_BLUR_PASSES; pass++) {
+        for (int y = 0; y < GRID_H; y++) {
+            for (int c = 0; c < 3; c++) {
+                boxLine(grid + y * GRID_W * 3 + c, GRID_W, 3, out);
+            }
+        }
+        for (int x = 0; x < GRID_W; x++) {
+            for (int c = 0; c < 3; c++) {
+                boxLine(grid + x * 3 + c, GRID_H, GRID_W * 3, out);
+            }
+        }
+    }
+}
+
+// Neighbouring cell centers of pixel i and the weight of the second
+struct CellStep {
+    uint8_t first;
+    uint8_t second;
+    uint8_t weight;         // Out of WEIGHT_ONE
+};
+
+static void cellStep(int i, int cells, CellStep& step) {
+    // Pixel center in cells from the first cell center, in 1/WEIGHT_ONE
+    int p = 2 * i + 1 - LETTERBOX_CELL;
+    int first = p < 0 ? 0 : p / WEIGHT_ONE;
+    step.first = first;
+    step.second = first + 1 < cells ? first + 1 : first;
+    step.weight = p < 0 || first + 1 >= cells ? 0 : p % WEIGHT_ONE;
+}
+
+static CellStep columnSteps[480];
+static uint16_t stripRows[BLOCK][GRID_W * 3];   // Grid rows interpolated to each strip row
+static uint8_t blockRgb[BLOCK * BLOCK * 3];
+static uint16_t blockPixels[BLOCK * BLOCK];
+
+bool letterboxRender(const uint16_t* grid, int16_t holeX, int16_t holeY, int16_t holeWidth, int16_t holeHeight,
+                     LetterboxOutput output) {
+    if (columnSteps[479].first == 0) {
+        for (int x = 0; x < 480; x++) cellStep(x, GRID_W, columnSteps[x]);
+    }
+    
+    for (int by = 0; by < 800; by += BLOCK) {
+        bool stripReady = false;
+        bool rowsInHole = by >= holeY && by + BLOCK <= holeY + holeHeight;
+        
+        for (int bx = 0; bx < 480; bx += BLOCK) {
+            // Blocks the photo covers completely are left to it
+            if (rowsInHole && bx >= holeX && bx + BLOCK <= holeX + holeWidth) continue;
+            
+            if (!stripReady) {
+                for (int j = 0; j < BLOCK; j++) {
+                    CellStep v;
+                    cellStep(by + j, GRID_H, v);
+                    const uint16_t* a = grid + v.first * GRID_W * 3;
+                    const uint16_t* b = grid + v.second * GRID_W * 3;
+                    for (int k = 0; k < GRID_W * 3; k++) {
+                        stripRows[j][k] = (a[k] * (WEIGHT_ONE - v.weight) + b[k] * v.weight) / WEIGHT_ONE;
+                    }
+                }
+                stripReady = true;
+            }
+            
+            uint8_t* dst = blockRgb;
+            for (int j = 0; j < BLOCK; j++) {
+                const uint16_t* row = stripRows[j];
+                for (int i = 0; i < BLOCK; i++) {
+                    const CellStep& u = columnSteps[bx + i];
+                    const uint16_t* a = row + u.first * 3;
+                    const uint16_t* b = row + u.second * 3;
+                    uint32_t wa = WEIGHT_ONE - u.weight;
+                    uint32_t wb = u.weight;
+                    dst[0] = (a[0] * wa + b[0] * wb) / (WEIGHT_ONE * 256);
+                    dst[1] = (a[1] * wa + b[1] * wb) / (WEIGHT_ONE * 256);
+                    dst[2] = (a[2] * wa + b[2] * wb) / (WEIGHT_ONE * 256);
+                    dst += 3;
+                }
+            }
+            
+            // Dithered: smooth dark gradients band badly in RGB565
+            rgb888ToRgb565Dither(blockRgb, blockPixels, BLOCK, BLOCK, bx, by);
+            if (!output(bx, by, BLOCK, BLOCK, blockPixels)) return false;
+        }
+    }
+    return true;
+}
+
+// ==================== Drawing ====================
+bool letterboxDraw(const char* path, uint8_t orientation, uint16_t width, uint16_t height,
+                   int16_t shownX, int16_t shownY, int16_t shownWidth, int16_t shownHeight) {
+    unsigned long start = micros();
+    bool transposed = orientation >= 5;
+    
+    // Coarsest decode that still gives every cell a pixel
+    GridSource source;
+    int scale;
+    for (scale = 3; scale >= 0; scale--) {
+        source.srcWidth = (width + (1 << scale) - 1) >> scale;
+        source.srcHeight = (height + (1 << scale) - 1) >> scale;
+        int w = transposed ? source.srcHeight : source.srcWidth;
+        int h = transposed ? source.srcWidth : source.srcHeight;
+        
+        // Cover the screen: crop the longer side to 480:800
+        source.cropWidth = w;
+        source.cropHeight = h;
+        if (w * 800 > h * 480) {
+            source.cropWidth = h * 480 / 800;
+        } else {
+            source.cropHeight = w * 800 / 480;
+        }
+        source.cropX = (w - source.cropWidth) / 2;
+        source.cropY = (h - source.cropHeight) / 2;
+        if (source.cropWidth >= GRID_W && source.cropHeight >= GRID_H) break;
+    }
+    if (scale < 0) return false;
+    source.orientation = orientation;
+    
+    size_t sumBytes = GRID_CELLS * 3 * sizeof(uint32_t);
+    size_t countBytes = GRID_CELLS * sizeof(uint16_t);
+    ArenaScope arena(ARENA_DECODE);
+    uint8_t* memory = (uint8_t*)arena.alloc(sumBytes + countBytes + GRID_CELLS * 3 * sizeof(uint16_t));
+    if (!memory) return false;
+    memset(memory, 0, sumBytes + countBytes);
+    source.sums = (uint32_t*)memory;
+    source.counts = (uint16_t*)(memory + sumBytes);
+    uint16_t* grid = (uint16_t*)(memory + sumBytes + countBytes);
+    
+    int res = imageDecodeSd(path, scale, gridSink, &source);
+    unsigned long decodeTime = micros() - start;
+    if (res != DECODE_OK) return false;
+    
+    // Cell averages, dimmed, as 8.8 fixed point
+    for (int cell = 0; cell < GRID_CELLS; cell++) {
+        uint32_t count = source.counts[cell] ? source.counts[cell] : 1;
+        for (int c = 0; c < 3; c++) {
+            grid[cell * 3 + c] = (source.sums[cell * 3 + c] * 256 / count) * LETTERBOX_DIM_PERCENT / 100;
+        }
+    }
+    letterboxBlur(grid);
+    
+    setBlitTransform(1, 480, 800, 0, 0);
+    bool ok = letterboxRender(grid, shownX, shownY, shownWidth, shownHeight, oriented_output);
+    flushBlit();
+    
+    LOG_D("Letterbox: 1/%d decode %lu us, total %lu us\n", 1 << scale, decodeTime, micros() - start);
+    return ok;
+}
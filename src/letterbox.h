@@ -0,0 +1,33 @@
+#ifndef LETTERBOX_H
+#define LETTERBOX_H
+
+#include <Arduino.h>
+
+// ==================== Letterbox Fill ====================
+// Fills the bars around a photo that does not cover the screen with a
+// blurred, darkened copy of it scaled up to cover the screen. A 1/8-scale
+// decode is averaged into a grid of LETTERBOX_CELL-pixel cells, the grid
+// is box blurred in fixed point, and only the blocks the photo leaves
+// showing are interpolated back up to full size.
+
+// Draws around the photo's rect on screen (shown size, after EXIF
+// rotation) into the blit target. false if the decode failed or the image
+// is too small to fill the grid; nothing is drawn then.
+bool letterboxDraw(const char* path, uint8_t orientation, uint16_t width, uint16_t height,
+                   int16_t shownX, int16_t shownY, int16_t shownWidth, int16_t shownHeight);
+
+// ==================== Kernels ====================
+// The grid holds three 8.8 fixed-point channels per cell, row by row.
+// Exposed for the host benchmark (sim --bench letterbox).
+#define LETTERBOX_GRID_WIDTH (480 / LETTERBOX_CELL)
+#define LETTERBOX_GRID_HEIGHT (800 / LETTERBOX_CELL)
+
+void letterboxBlur(uint16_t* grid);   // LETTERBOX_BLUR_PASSES separable box passes
+
+// Interpolates the grid up to the screen in 16x16 blocks, skipping blocks
+// inside the hole, and hands each to output like a decoder would
+typedef bool (*LetterboxOutput)(int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t* bitmap);
+bool letterboxRender(const uint16_t* grid, int16_t holeX, int16_t holeY, int16_t holeWidth, int16_t holeHeight,
+                     LetterboxOutput output);
+
+#endif // LETTERBOX_H
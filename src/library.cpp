@@ -0,0 +1,711 @@
+#include "library.h"
+#include "config.h"
+#include "exif.h"
+#include "decoder.h"
+#include "mjpeg.h"
+#include "memstats.h"
+#include "log.h"
+#include "budget.h"
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/semphr.h>
+#include <algorithm>
+
+// ==================== Refresh State ====================
+static SemaphoreHandle_t sdMutex = NULL;
+static SemaphoreHandle_t pendingMutex = NULL;
+static TaskHandle_t refreshTask = NULL;
+
+// Filled by the refresh task, consumed by applyLibraryChanges()
+static std::vector<ImageEntry> pendingScan;
+static volatile bool pendingScanReady = false;
+
+// Directories the playlist covers. The loop task owns libraryDirs; the
+// refresh task copies it under pendingMutex at the start of each scan and
+// drops any scan that started before the last scope change.
+static std::vector<String> libraryDirs(1, "/");
+static volatile uint32_t scopeGeneration = 0;
+static uint32_t pendingScanGeneration = 0;
+
+// New playlist handed over on a scope change, so the first scan of the new
+// scope does not re-read EXIF for every file
+static std::vector<ImageEntry> pendingKnown;
+static bool pendingKnownReady = false;
+
+// Result of the previous scan, sorted by path. Lets unchanged files skip
+// the EXIF read. Only touched by the refresh task after startup.
+static std::vector<ImageEntry> knownImages;
+
+// Files that failed to decode, with the directory metadata they had then
+struct QuarantineEntry {
+    String path;
+    uint32_t size;
+    uint32_t mtime;
+    String reason;
+};
+static std::vector<QuarantineEntry> quarantine;
+
+// ==================== File Filters ====================
+bool isSystemFile(const String& filename) {
+    if (filename.startsWith("._")) return true;
+    if (filename.equalsIgnoreCase(".DS_Store")) return true;
+    if (filename.equalsIgnoreCase("Thumbs.db")) return true;
+    if (filename.equalsIgnoreCase("desktop.ini")) return true;
+    return false;
+}
+
+bool isImageFile(const String& filename) {
+    return isDecodableName(filename) || isClipName(filename);
+}
+
+String joinPath(const String& dir, const String& name) {
+    if (dir == "/") return "/" + name;
+    return dir + "/" + name;
+}
+
+String dirOf(const String& path) {
+    int slash = path.lastIndexOf('/');
+    if (slash <= 0) return "/";
+    return path.substring(0, slash);
+}
+
+// Fills an entry from an open directory entry, including its EXIF data
+void readImageEntry(File& entry, const String& dir, ImageEntry& image) {
+    image.path = joinPath(dir, entry.name());
+    image.size = entry.size();
+    image.mtime = entry.getLastWrite();
+    
+    image.hash = 0;
+    
+    ExifInfo exif;
+    readExifInfo(entry, exif);
+    image.orientation = exif.orientation;
+    image.taken = exif.taken;
+}
+
+// ==================== SD Lock ====================
+bool lockSD(TickType_t wait) {
+    if (sdMutex == NULL) return true;
+    return xSemaphoreTake(sdMutex, wait) == pdTRUE;
+}
+
+void unlockSD() {
+    if (sdMutex != NULL) {
+        xSemaphoreGive(sdMutex);
+    }
+}
+
+// ==================== Background Scan ====================
+static bool pathLess(const ImageEntry& a, const ImageEntry& b) {
+    return a.path < b.path;
+}
+
+static const ImageEntry* findKnownImage(const String& path) {
+    ImageEntry key;
+    key.path = path;
+    auto it = std::lower_bound(knownImages.begin(), knownImages.end(), key, pathLess);
+    if (it != knownImages.end() && it->path == path) return &*it;
+    return NULL;
+}
+
+// Walks one directory in slices of at most LIBRARY_SLICE_BUDGET_US.
+// A slice never starts while a decode holds the SD lock, and the decode
+// waits for at most one directory entry when a slice is running.
+// Gives up early if the scope changes underneath it.
+static bool scanDirectory(const String& dir, uint32_t generation, std::vector<ImageEntry>& found) {
+    File root;
+    
+    while (!root) {
+        if (lockSD(0)) {
+            root = SD.open(dir);
+            unlockSD();
+            if (!root) {
+                // A vanished album simply has no images left
+                return dir != "/";
+            }
+        } else {
+            vTaskDelay(pdMS_TO_TICKS(LIBRARY_SLICE_PAUSE_MS));
+        }
+    }
+    
+    bool done = false;
+    while (!done) {
+        if (generation != scopeGeneration) {
+            lockSD();
+            root.close();
+            unlockSD();
+            return false;
+        }
+        
+        if (!lockSD(0)) {
+            vTaskDelay(pdMS_TO_TICKS(LIBRARY_SLICE_PAUSE_MS));
+            continue;
+        }
+        
+        unsigned long sliceStart = micros();
+        while (micros() - sliceStart < LIBRARY_SLICE_BUDGET_US) {
+            File entry = root.openNextFile();
+            if (!entry) {
+                done = true;
+                break;
+            }
+            
+            String filename = entry.name();
+            if (!entry.isDirectory() && !isSystemFile(filename) && isImageFile(filename)) {
+                ImageEntry image;
+                image.path = joinPath(dir, filename);
+                image.size = entry.size();
+                image.mtime = entry.getLastWrite();
+                
+                const ImageEntry* known = findKnownImage(image.path);
+                if (known && known->size == image.size && known->mtime == image.mtime) {
+                    image.orientation = known->orientation;
+                    image.taken = known->taken;
+                    image.hash = known->hash;
+                } else {
+                    readImageEntry(entry, dir, image);
+                }
+                found.push_back(image);
+            }
+            entry.close();
+        }
+        
+        if (done) root.close();
+        unlockSD();
+        
+        if (!done) {
+            vTaskDelay(pdMS_TO_TICKS(LIBRARY_SLICE_PAUSE_MS));
+        }
+    }
+    
+    return true;
+}
+
+static bool scanLibrary(uint32_t generation, const std::vector<String>& dirs, std::vector<ImageEntry>& found) {
+    for (int i = 0; i < dirs.size(); i++) {
+        if (!scanDirectory(dirs[i], generation, found)) return false;
+    }
+    return true;
+}
+
+static void libraryRefreshTask(void* param) {
+    for (;;) {
+        vTaskDelay(pdMS_TO_TICKS(LIBRARY_RESCAN_INTERVAL));
+        
+        xSemaphoreTake(pendingMutex, portMAX_DELAY);
+        uint32_t generation = scopeGeneration;
+        std::vector<String> dirs = libraryDirs;
+        if (pendingKnownReady) {
+            knownImages.swap(pendingKnown);
+            std::vector<ImageEntry>().swap(pendingKnown);
+            pendingKnownReady = false;
+        }
+        xSemaphoreGive(pendingMutex);
+        
+        std::vector<ImageEntry> found;
+        unsigned long scanStart = millis();
+        if (!scanLibrary(generation, dirs, found)) {
+            if (generation == scopeGeneration) {
+                LOG_W("Library refresh: cannot open root directory\n");
+            }
+            continue;
+        }
+        
+        std::sort(found.begin(), found.end(), pathLess);
+        knownImages = found;
+        
+        xSemaphoreTake(pendingMutex, portMAX_DELAY);
+        pendingScan.swap(found);
+        pendingScanGeneration = generation;
+        pendingScanReady = true;
+        xSemaphoreGive(pendingMutex);
+        
+        LOG_I("Library refresh: %d images scanned in %lu ms\n",
+              pendingScan.size(), millis() - scanStart);
+    }
+}
+
+void startLibraryRefresh() {
+    if (refreshTask != NULL) return;
+    
+    sdMutex = xSemaphoreCreateMutex();
+    pendingMutex = xSemaphoreCreateMutex();
+    
+    // Seed with the boot scan so the first pass does not re-read EXIF
+    knownImages = imageFiles;
+    std::sort(knownImages.begin(), knownImages.end(), pathLess);
+    
+    xTaskCreatePinnedToCore(libraryRefreshTask, "libraryRefresh", LIBRARY_TASK_STACK,
+                            NULL, LIBRARY_TASK_PRIORITY, &refreshTask, LIBRARY_TASK_CORE);
+    LOG_I("Library refresh task started\n");
+}
+
+// Called on the loop task after imageFiles was rebuilt for new directories
+void setLibraryScope(const std::vector<String>& dirs) {
+    if (pendingMutex == NULL) {
+        // Refresh task not started yet; it seeds itself from imageFiles
+        libraryDirs = dirs;
+        return;
+    }
+    
+    std::vector<ImageEntry> known = imageFiles;
+    std::sort(known.begin(), known.end(), pathLess);
+    
+    xSemaphoreTake(pendingMutex, portMAX_DELAY);
+    libraryDirs = dirs;
+    scopeGeneration++;
+    pendingKnown.swap(known);
+    pendingKnownReady = true;
+    pendingScanReady = false;
+    std::vector<ImageEntry>().swap(pendingScan);
+    xSemaphoreGive(pendingMutex);
+}
+
+// Called on the loop task; the next scan walks the folder too
+void addLibraryDir(const String& dir) {
+    if (std::find(libraryDirs.begin(), libraryDirs.end(), dir) != libraryDirs.end()) return;
+    if (pendingMutex == NULL) {
+        libraryDirs.push_back(dir);
+        return;
+    }
+    
+    xSemaphoreTake(pendingMutex, portMAX_DELAY);
+    libraryDirs.push_back(dir);
+    scopeGeneration++;
+    pendingScanReady = false;
+    std::vector<ImageEntry>().swap(pendingScan);
+    xSemaphoreGive(pendingMutex);
+}
+
+// ==================== Directory Indexes ====================
+#define INDEX_MAGIC 0x33584449  // "IDX3"; older indexes are rebuilt
+
+struct IndexHeader {
+    uint32_t magic;
+    uint32_t count;
+};
+
+// Followed by nameLength bytes of file name
+struct IndexRecord {
+    uint32_t size;
+    uint32_t mtime;
+    uint32_t hashLow;       // Perceptual hash in two words, so the record has no padding
+    uint32_t hashHigh;
+    uint32_t taken;
+    uint8_t orientation;
+    uint8_t nameLength;
+    uint16_t reserved;
+};
+
+// Album directories are top-level, so the name alone is unique; the root
+// gets a name no album can have
+String libraryIndexPath(const String& dir, const char* extension) {
+    String key = dir == "/" ? String(".root") : dir.substring(1);
+    return String(ALBUM_INDEX_DIR) + "/" + key + extension;
+}
+
+int32_t libraryIndexCount(const String& dir) {
+    File file = SD.open(libraryIndexPath(dir), FILE_READ);
+    if (!file) return -1;
+    
+    IndexHeader header;
+    bool valid = file.read((uint8_t*)&header, sizeof(header)) == sizeof(header) && header.magic == INDEX_MAGIC;
+    file.close();
+    return valid ? (int32_t)header.count : -1;
+}
+
+// Reads the index through the library arena a window at a time; a record
+// cut off at the end of the window moves to the front before the refill
+bool loadLibraryIndex(const String& dir, std::vector<ImageEntry>& images) {
+    File file = SD.open(libraryIndexPath(dir), FILE_READ);
+    if (!file) return false;
+    
+    ArenaScope arena(ARENA_LIBRARY);
+    uint8_t* data = (uint8_t*)arena.alloc(LIBRARY_ARENA_SIZE);
+    IndexHeader header;
+    if (!data || file.read((uint8_t*)&header, sizeof(header)) != sizeof(header) || header.magic != INDEX_MAGIC) {
+        file.close();
+        return false;
+    }
+    
+    size_t first = images.size();
+    images.reserve(first + header.count);
+    size_t pos = 0;
+    size_t end = 0;
+    for (uint32_t i = 0; i < header.count; i++) {
+        if (end - pos < sizeof(IndexRecord) + 255) {
+            memmove(data, data + pos, end - pos);
+            end -= pos;
+            pos = 0;
+            int got = file.read(data + end, LIBRARY_ARENA_SIZE - end);
+            if (got > 0) end += got;
+        }
+        
+        IndexRecord record;
+        if (pos + sizeof(record) > end) break;
+        memcpy(&record, data + pos, sizeof(record));
+        pos += sizeof(record);
+        if (pos + record.nameLength > end) break;
+        
+        char name[256];
+        memcpy(name, data + pos, record.nameLength);
+        name[record.nameLength] = '\0';
+        
+        ImageEntry image;
+        image.path = joinPath(dir, name);
+        image.size = record.size;
+        image.mtime = record.mtime;
+        image.orientation = record.orientation;
+        image.taken = record.taken;
+        image.hash = ((uint64_t)record.hashHigh << 32) | record.hashLow;
+        images.push_back(image);
+        pos += record.nameLength;
+    }
+    file.close();
+    
+    // A short file means an interrupted write; rebuild rather than trust it
+    if (images.size() - first != header.count) {
+        images.resize(first);
+        return false;
+    }
+    return true;
+}
+
+bool saveLibraryIndex(const String& dir) {
+    SD.mkdir(ALBUM_INDEX_DIR);
+    File file = SD.open(libraryIndexPath(dir), FILE_WRITE);
+    if (!file) {
+        LOG_E("Failed to save index for %s\n", dir.c_str());
+        return false;
+    }
+    
+    IndexHeader header = {INDEX_MAGIC, 0};
+    file.write((const uint8_t*)&header, sizeof(header));
+    
+    int nameStart = dir == "/" ? 1 : dir.length() + 1;
+    for (int i = 0; i < imageFiles.size(); i++) {
+        const ImageEntry& image = imageFiles[i];
+        if (dirOf(image.path) != dir || image.path.length() - nameStart > 255) continue;
+        
+        IndexRecord record = {image.size, (uint32_t)image.mtime, (uint32_t)image.hash,
+                              (uint32_t)(image.hash >> 32), image.taken, image.orientation,
+                              (uint8_t)(image.path.length() - nameStart), 0};
+        file.write((const uint8_t*)&record, sizeof(record));
+        file.write((const uint8_t*)image.path.c_str() + nameStart, record.nameLength);
+        header.count++;
+    }
+    
+    // Count goes in last, so a write cut short fails the length check
+    file.seek(0);
+    file.write((const uint8_t*)&header, sizeof(header));
+    file.close();
+    return true;
+}
+
+// Full blocking walk of one directory, used when an album has no index yet
+bool scanLibraryDir(const String& dir, std::vector<ImageEntry>& images) {
+    File root = SD.open(dir);
+    if (!root) return false;
+    
+    while (true) {
+        File entry = root.openNextFile();
+        if (!entry) break;
+        
+        String filename = entry.name();
+        if (!entry.isDirectory() && !isSystemFile(filename) && isImageFile(filename)) {
+            ImageEntry image;
+            readImageEntry(entry, dir, image);
+            images.push_back(image);
+        }
+        entry.close();
+    }
+    
+    root.close();
+    return true;
+}
+
+// ==================== Quarantine ====================
+void loadQuarantine() {
+    quarantine.clear();
+    
+    File file = SD.open(QUARANTINE_FILENAME, FILE_READ);
+    if (!file) return;
+    
+    // One line per file: size <TAB> mtime <TAB> reason <TAB> path
+    while (file.available()) {
+        String line = file.readStringUntil('\n');
+        line.trim();
+        
+        int t1 = line.indexOf('\t');
+        int t2 = t1 < 0 ? -1 : line.indexOf('\t', t1 + 1);
+        int t3 = t2 < 0 ? -1 : line.indexOf('\t', t2 + 1);
+        if (t3 < 0) continue;
+        
+        QuarantineEntry entry;
+        entry.size = line.substring(0, t1).toInt();
+        entry.mtime = line.substring(t1 + 1, t2).toInt();
+        entry.reason = line.substring(t2 + 1, t3);
+        entry.path = line.substring(t3 + 1);
+        quarantine.push_back(entry);
+    }
+    file.close();
+    
+    LOG_I("Quarantine: %d files\n", quarantine.size());
+}
+
+// An entry dropped by isQuarantined(), whose callers may hold the SD lock
+static bool quarantineChanged = false;
+
+static void saveQuarantine() {
+    lockSD();
+    File file = SD.open(QUARANTINE_FILENAME, FILE_WRITE);
+    if (!file) {
+        unlockSD();
+        LOG_E("Failed to save quarantine list!\n");
+        return;
+    }
+    
+    for (int i = 0; i < quarantine.size(); i++) {
+        file.printf("%lu\t%lu\t%s\t%s\n", (unsigned long)quarantine[i].size,
+                    (unsigned long)quarantine[i].mtime, quarantine[i].reason.c_str(),
+                    quarantine[i].path.c_str());
+    }
+    file.close();
+    unlockSD();
+    quarantineChanged = false;
+}
+
+// A changed file gets another chance: its stale entry is dropped here
+bool isQuarantined(const ImageEntry& image) {
+    for (int i = 0; i < quarantine.size(); i++) {
+        if (quarantine[i].path != image.path) continue;
+        
+        if (quarantine[i].size == image.size && quarantine[i].mtime == (uint32_t)image.mtime) {
+            return true;
+        }
+        
+        LOG_I("Quarantine: %s changed, retrying\n", image.path.c_str());
+        quarantine.erase(quarantine.begin() + i);
+        quarantineChanged = true;
+        return false;
+    }
+    return false;
+}
+
+void quarantineImage(int index, const char* reason) {
+    if (index < 0 || index >= imageFiles.size()) return;
+    
+    const ImageEntry& image = imageFiles[index];
+    QuarantineEntry entry;
+    entry.path = image.path;
+    entry.size = image.size;
+    entry.mtime = image.mtime;
+    entry.reason = reason;
+    quarantine.push_back(entry);
+    saveQuarantine();
+    
+    LOG_W("Quarantined %s: %s\n", image.path.c_str(), reason);
+    removeImage(index);
+}
+
+// Drops one image from the playlist without disturbing the shuffle order
+void removeImage(int index) {
+    if (index < 0 || index >= imageFiles.size()) return;
+    
+    imageFiles.erase(imageFiles.begin() + index);
+    
+    std::vector<int> nextShuffle;
+    nextShuffle.reserve(shuffledIndices.size());
+    int nextShuffleIndex = currentShuffleIndex;
+    for (int k = 0; k < shuffledIndices.size(); k++) {
+        int value = shuffledIndices[k];
+        if (value == index) {
+            if (k < currentShuffleIndex) nextShuffleIndex--;
+            continue;
+        }
+        nextShuffle.push_back(value > index ? value - 1 : value);
+    }
+    if (nextShuffleIndex >= nextShuffle.size()) nextShuffleIndex = 0;
+    
+    shuffledIndices.swap(nextShuffle);
+    currentShuffleIndex = nextShuffleIndex;
+    
+    if (currentImageIndex > index) currentImageIndex--;
+    if (currentImageIndex >= imageFiles.size()) currentImageIndex = 0;
+}
+
+bool addImage(const ImageEntry& image) {
+    String dir = dirOf(image.path);
+    if (std::find(libraryDirs.begin(), libraryDirs.end(), dir) == libraryDirs.end()) return false;
+    if (isQuarantined(image)) return false;
+    
+    // A scan under way may have missed the file; merging it would drop it again
+    if (pendingMutex != NULL) {
+        xSemaphoreTake(pendingMutex, portMAX_DELAY);
+        scopeGeneration++;
+        pendingScanReady = false;
+        std::vector<ImageEntry>().swap(pendingScan);
+        xSemaphoreGive(pendingMutex);
+    }
+    
+    int index = 0;
+    while (index < imageFiles.size() && imageFiles[index].path != image.path) index++;
+    if (index < imageFiles.size()) {
+        imageFiles[index] = image;
+    } else {
+        // Comes up at a random point in the unplayed part of the cycle
+        imageFiles.push_back(image);
+        int first = min(currentShuffleIndex, (int)shuffledIndices.size());
+        int pos = random(first, shuffledIndices.size() + 1);
+        shuffledIndices.insert(shuffledIndices.begin() + pos, index);
+    }
+    
+    LOG_I("Library: added %s, %d images\n", image.path.c_str(), imageFiles.size());
+    lockSD();
+    saveLibraryIndex(dir);
+    unlockSD();
+    return true;
+}
+
+// ==================== Merge ====================
+static void noteChangedDir(std::vector<String>& dirs, const String& path) {
+    String dir = dirOf(path);
+    if (std::find(dirs.begin(), dirs.end(), dir) == dirs.end()) {
+        dirs.push_back(dir);
+    }
+}
+
+// Merges the last completed scan into the live playlist. Deleted files are
+// dropped from the shuffle without disturbing the remaining order, new files
+// are inserted at random positions in the unplayed part of the current cycle.
+bool applyLibraryChanges() {
+    // Written here, on the loop task without the SD lock
+    if (quarantineChanged) saveQuarantine();
+    if (!pendingScanReady) return false;
+    MemScope scope(MEM_SCAN);
+    
+    std::vector<ImageEntry> found;
+    xSemaphoreTake(pendingMutex, portMAX_DELAY);
+    found.swap(pendingScan);
+    pendingScanReady = false;
+    bool stale = pendingScanGeneration != scopeGeneration;
+    xSemaphoreGive(pendingMutex);
+    
+    // Scan of the album that was playing before a switch
+    if (stale) return false;
+    
+    // found arrives sorted by path from the refresh task
+    found.erase(std::remove_if(found.begin(), found.end(), isQuarantined), found.end());
+    
+    std::vector<int> byPath(imageFiles.size());
+    for (int i = 0; i < imageFiles.size(); i++) byPath[i] = i;
+    std::sort(byPath.begin(), byPath.end(), [](int a, int b) {
+        return imageFiles[a].path < imageFiles[b].path;
+    });
+    
+    // Walk both sorted lists to classify every entry
+    std::vector<bool> keep(imageFiles.size(), false);
+    std::vector<int> added;
+    std::vector<String> changedDirs;
+    int removedCount = 0;
+    int i = 0, j = 0;
+    while (i < byPath.size() || j < found.size()) {
+        if (j >= found.size() || (i < byPath.size() && imageFiles[byPath[i]].path < found[j].path)) {
+            noteChangedDir(changedDirs, imageFiles[byPath[i]].path);
+            removedCount++;
+            i++;
+        } else if (i >= byPath.size() || found[j].path < imageFiles[byPath[i]].path) {
+            noteChangedDir(changedDirs, found[j].path);
+            added.push_back(j);
+            j++;
+        } else {
+            ImageEntry& image = imageFiles[byPath[i]];
+            // A rewritten file is hashed again when next shown
+            if (image.size != found[j].size || image.mtime != found[j].mtime) image.hash = 0;
+            image.size = found[j].size;
+            image.mtime = found[j].mtime;
+            image.orientation = found[j].orientation;
+            image.taken = found[j].taken;
+            keep[byPath[i]] = true;
+            i++;
+            j++;
+        }
+    }
+    
+    if (removedCount == 0 && added.empty()) return false;
+    
+    // Compact the file list and remember where each survivor moved
+    std::vector<int> remap(imageFiles.size(), -1);
+    std::vector<ImageEntry> nextFiles;
+    nextFiles.reserve(imageFiles.size() - removedCount + added.size());
+    for (int k = 0; k < imageFiles.size(); k++) {
+        if (keep[k]) {
+            remap[k] = nextFiles.size();
+            nextFiles.push_back(imageFiles[k]);
+        }
+    }
+    
+    std::vector<int> nextShuffle;
+    nextShuffle.reserve(nextFiles.size() + added.size());
+    int nextShuffleIndex = currentShuffleIndex;
+    for (int k = 0; k < shuffledIndices.size(); k++) {
+        int mapped = remap[shuffledIndices[k]];
+        if (mapped < 0) {
+            if (k < currentShuffleIndex) nextShuffleIndex--;
+            continue;
+        }
+        nextShuffle.push_back(mapped);
+    }
+    if (nextShuffleIndex > nextShuffle.size()) nextShuffleIndex = nextShuffle.size();
+    
+    for (int k = 0; k < added.size(); k++) {
+        int index = nextFiles.size();
+        nextFiles.push_back(found[added[k]]);
+        int pos = random(nextShuffleIndex, nextShuffle.size() + 1);
+        nextShuffle.insert(nextShuffle.begin() + pos, index);
+    }
+    
+    if (nextShuffleIndex >= nextShuffle.size()) nextShuffleIndex = 0;
+    
+    int nextImageIndex = currentImageIndex < remap.size() ? remap[currentImageIndex] : -1;
+    
+    imageFiles.swap(nextFiles);
+    shuffledIndices.swap(nextShuffle);
+    currentShuffleIndex = nextShuffleIndex;
+    currentImageIndex = nextImageIndex >= 0 ? nextImageIndex : 0;
+    
+    LOG_I("Library updated: +%d -%d, %d images\n",
+          added.size(), removedCount, imageFiles.size());
+    
+    // Keep the indexes in step so the next album load sees the change
+    lockSD();
+    for (int k = 0; k < changedDirs.size(); k++) {
+        saveLibraryIndex(changedDirs[k]);
+    }
+    unlockSD();
+    return true;
+}
+
+// ==================== Photo Hashes ====================
+static std::vector<String> hashDirs;    // Directories whose index lacks new hashes
+static int unsavedHashes = 0;
+
+void setImageHash(int index, uint64_t hash) {
+    if (index < 0 || index >= imageFiles.size() || imageFiles[index].hash == hash) return;
+    
+    imageFiles[index].hash = hash;
+    noteChangedDir(hashDirs, imageFiles[index].path);
+    if (++unsavedHashes >= HASH_SAVE_BATCH) saveImageHashes();
+}
+
+void saveImageHashes() {
+    if (hashDirs.empty()) return;
+    
+    lockSD();
+    for (int k = 0; k < hashDirs.size(); k++) {
+        saveLibraryIndex(hashDirs[k]);
+    }
+    unlockSD();
+    hashDirs.clear();
+    unsavedHashes = 0;
+}
@@ -0,0 +1,76 @@
+#ifndef LIBRARY_H
+#define LIBRARY_H
+
+#include <Arduino.h>
+#include <SD.h>
+#include <vector>
+
+// ==================== Image Library ====================
+// One playlist entry. Size and mtime come straight from the directory
+// entry and let the background rescan tell a changed file from a new one.
+// Orientation and capture time are read from EXIF once, when the file is
+// first indexed; the perceptual hash (see phash.h) is filled in the first
+// time it is shown.
+struct ImageEntry {
+    String path;
+    uint32_t size;
+    time_t mtime;
+    uint8_t orientation;
+    uint32_t taken;         // EXIF capture time, 0 if the file has none
+    uint64_t hash;          // 0 until shown
+};
+
+extern std::vector<ImageEntry> imageFiles;
+extern std::vector<int> shuffledIndices;
+extern int currentImageIndex;
+extern int currentShuffleIndex;
+
+// ==================== Library Functions ====================
+bool isSystemFile(const String& filename);
+bool isImageFile(const String& filename);
+String joinPath(const String& dir, const String& name);
+String dirOf(const String& path);
+void readImageEntry(File& entry, const String& dir, ImageEntry& image);
+
+// Directory indexes: the images of one directory as last seen, stored in
+// ALBUM_INDEX_DIR so a playlist loads with one file read instead of a
+// directory walk. Load/scan append to images; save writes the entries of
+// imageFiles that live in dir.
+String libraryIndexPath(const String& dir, const char* extension = ".idx");
+bool loadLibraryIndex(const String& dir, std::vector<ImageEntry>& images);
+int32_t libraryIndexCount(const String& dir);
+bool saveLibraryIndex(const String& dir);
+bool scanLibraryDir(const String& dir, std::vector<ImageEntry>& images);
+
+// Records the hash of a photo just rendered. Indexes are rewritten every
+// HASH_SAVE_BATCH new hashes, and by saveImageHashes() before the playlist
+// is replaced.
+void setImageHash(int index, uint64_t hash);
+void saveImageHashes();
+
+// Directories the playlist is built from; the rescan walks only these
+void setLibraryScope(const std::vector<String>& dirs);
+void addLibraryDir(const String& dir);    // A folder that appeared under the scope playing
+
+// Background rescan: the task only walks the card; results are merged
+// into imageFiles/shuffledIndices on the loop task by applyLibraryChanges().
+void startLibraryRefresh();
+bool applyLibraryChanges();
+
+// Quarantine: images that failed to decode, kept out of the playlist
+// until their size or mtime changes. Persisted in QUARANTINE_FILENAME.
+void loadQuarantine();
+bool isQuarantined(const ImageEntry& image);
+void quarantineImage(int index, const char* reason);
+void removeImage(int index);
+
+// Adds a file written while running, e.g. an upload, without waiting for
+// the rescan; a file already listed has its entry refreshed. False if it
+// lies outside the directories playing or is quarantined.
+bool addImage(const ImageEntry& image);
+
+// Serializes SD access between the slideshow decode and the rescan slices
+bool lockSD(TickType_t wait = portMAX_DELAY);
+void unlockSD();
+
+#endif // LIBRARY_H
@@ -0,0 +1,91 @@
+#include "log.h"
+#include "config.h"
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <atomic>
+#include <stdarg.h>
+
+static_assert((LOG_RING_SLOTS & (LOG_RING_SLOTS - 1)) == 0, "LOG_RING_SLOTS must be a power of two");
+
+// ==================== Ring ====================
+// Bounded multi-producer, single-consumer ring. A writer claims the next
+// position with a compare-and-swap on writePos, formats into that slot and
+// publishes it through the slot's state; only the drain task reads. For
+// the lap that starts at position `lap` (a multiple of LOG_RING_SLOTS) a
+// slot's state is `lap` while free and `lap + 1` once written, so the
+// zeroed ring starts out free for the first lap.
+struct LogLine {
+    std::atomic<uint32_t> state;
+    uint16_t length;
+    char text[LOG_LINE_MAX];
+};
+
+static LogLine ring[LOG_RING_SLOTS];
+static std::atomic<uint32_t> writePos(0);
+static uint32_t readPos = 0;            // Drain task only
+static std::atomic<uint32_t> droppedLines(0);
+static TaskHandle_t drainTask = NULL;
+
+void logWrite(const char* format, ...) {
+    uint32_t pos = writePos.load(std::memory_order_relaxed);
+    LogLine* line;
+    for (;;) {
+        line = &ring[pos % LOG_RING_SLOTS];
+        uint32_t lap = pos - pos % LOG_RING_SLOTS;
+        int32_t diff = (int32_t)(line->state.load(std::memory_order_acquire) - lap);
+        if (diff == 0) {
+            // Lost races reload pos and try again
+            if (writePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+        } else if (diff < 0) {
+            // The slot still holds a line from the last lap
+            droppedLines.fetch_add(1, std::memory_order_relaxed);
+            return;
+        } else {
+            pos = writePos.load(std::memory_order_relaxed);
+        }
+    }
+    
+    va_list args;
+    va_start(args, format);
+    int length = vsnprintf(line->text, LOG_LINE_MAX, format, args);
+    va_end(args);
+    if (length < 0) length = 0;
+    if (length >= LOG_LINE_MAX) {
+        length = LOG_LINE_MAX - 1;
+        line->text[length - 1] = '\n';
+    }
+    line->length = length;
+    line->state.store(pos - pos % LOG_RING_SLOTS + 1, std::memory_order_release);
+}
+
+uint32_t logDropped() {
+    return droppedLines.load(std::memory_order_relaxed);
+}
+
+// ==================== Drain Task ====================
+static void logDrainTask(void* param) {
+    uint32_t reported = 0;
+    for (;;) {
+        for (;;) {
+            LogLine& line = ring[readPos % LOG_RING_SLOTS];
+            uint32_t lap = readPos - readPos % LOG_RING_SLOTS;
+            if (line.state.load(std::memory_order_acquire) != lap + 1) break;
+            Serial.write((const uint8_t*)line.text, line.length);
+            line.state.store(lap + LOG_RING_SLOTS, std::memory_order_release);
+            readPos++;
+        }
+        
+        uint32_t dropped = logDropped();
+        if (dropped != reported) {
+            Serial.printf("Log: %lu lines dropped\n", (unsigned long)(dropped - reported));
+            reported = dropped;
+        }
+        vTaskDelay(pdMS_TO_TICKS(LOG_DRAIN_INTERVAL));
+    }
+}
+
+void logBegin() {
+    if (drainTask) return;
+    xTaskCreatePinnedToCore(logDrainTask, "logDrain", LOG_TASK_STACK,
+                            NULL, LOG_TASK_PRIORITY, &drainTask, LOG_TASK_CORE);
+}
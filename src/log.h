@@ -0,0 +1,34 @@
+#ifndef LOG_H
+#define LOG_H
+
+#include <Arduino.h>
+
+// ==================== Logging ====================
+// LOG_E/W/I/D format a line into a lock-free ring and return; a task at
+// low priority drains the ring to Serial, so the caller never waits for
+// the UART. Levels above LOG_LEVEL in config.h compile to nothing, the
+// arguments included. When the ring is full the line is dropped, not
+// waited for, and the drain task reports the loss.
+//
+// Console reports asked for over serial (benchmarks, stats) still print
+// straight to Serial.
+
+#define LOG_LEVEL_NONE  0
+#define LOG_LEVEL_ERROR 1
+#define LOG_LEVEL_WARN  2
+#define LOG_LEVEL_INFO  3
+#define LOG_LEVEL_DEBUG 4
+
+#define LOG_AT(level, ...) do { if (LOG_LEVEL >= (level)) logWrite(__VA_ARGS__); } while (0)
+#define LOG_E(...) LOG_AT(LOG_LEVEL_ERROR, __VA_ARGS__)
+#define LOG_W(...) LOG_AT(LOG_LEVEL_WARN, __VA_ARGS__)
+#define LOG_I(...) LOG_AT(LOG_LEVEL_INFO, __VA_ARGS__)
+#define LOG_D(...) LOG_AT(LOG_LEVEL_DEBUG, __VA_ARGS__)
+
+// Starts the drain task. Lines logged earlier wait in the ring.
+void logBegin();
+// Safe from any task, not from an ISR. Lines are cut at LOG_LINE_MAX.
+void logWrite(const char* format, ...) __attribute__((format(printf, 1, 2)));
+uint32_t logDropped();
+
+#endif // LOG_H
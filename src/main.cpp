@@ -1,19 +1,50 @@
 #include "display.h"
 #include "config.h"
+#include "library.h"
+#include "album.h"
+#include "decoder.h"
+#include "jpeg.h"
+#include "thumbs.h"
+#include "memstats.h"
+#include "kenburns.h"
+#include "touch.h"
+#include "frames.h"
+#include "upload.h"
+#include "bootprof.h"
+#include "backlight.h"
+#include "letterbox.h"
+#include "mjpeg.h"
+#include "log.h"
+#include "budget.h"
+#include "phash.h"
+#include "bench.h"
+#include "playlist.h"
 #include <SD.h>
 #include <SPI.h>
-#include <TJpg_Decoder.h>
 #include <vector>
 #include <algorithm>
 
 // ==================== Global Variables ====================
 SPIClass sdSPI = SPIClass(HSPI);
-std::vector<String> imageFiles;
+uint32_t sdClockHz = 0;     // The clock the card mounted at
+std::vector<ImageEntry> imageFiles;
 std::vector<int> shuffledIndices;
 int currentImageIndex = 0;
 int currentShuffleIndex = 0;
 unsigned long lastImageChange = 0;
 
+// Photos shown, oldest first, for swiping back; the last is on screen
+std::vector<String> imageHistory;
+// Next slide the prefetch gave up on, so it is not retried every loop
+String prefetchFailed = "";
+// Photo last written to LAST_FRAME_FILENAME, and the one on screen now;
+// the file is rewritten at most every LAST_FRAME_SAVE_INTERVAL
+String lastFrameSaved = "";
+ImageEntry lastFramePending;
+unsigned long lastFrameWriteTime = 0;
+// Backlight percent of the photo on screen
+uint8_t photoBacklight = 100;
+
 // Updated slideshow intervals: 5с, 30с, 1м, 5м, 15м, 30м, 60м
 const unsigned long intervals[] = {
   5000,      // 5 seconds
@@ -30,22 +61,45 @@ unsigned long slideshowInterval = intervals[currentIntervalIndex];
 // Brightness
 uint8_t currentBrightness = BRIGHTNESS_DEFAULT;
 
+// Ken Burns pan and zoom instead of still slides
+bool motionEnabled = MOTION_DEFAULT;
+
+// Capture order from the album's date playlist instead of the shuffle
+bool dateOrder = DATE_ORDER_DEFAULT;
+// imageFiles changed since the playlist was opened
+bool datePlaylistStale = false;
+// Where the last dated photo was found in imageFiles; the next is usually close by
+int datedHint = 0;
+
 // System state
 enum SystemState {
     STATE_SLIDESHOW,
     STATE_MENU,
     STATE_SETTING_INTERVAL,
     STATE_SETTING_BRIGHTNESS,
-    STATE_INFO
+    STATE_INFO,
+    STATE_BROWSE,
+    STATE_ALBUMS,
+    STATE_BENCHMARK
 };
 SystemState currentState = STATE_SLIDESHOW;
 
 // Menu
-const char* menuItems[] = {"Set Interval", "Set Brightness", "System Info", "Exit"};
-int menuItemCount = 4;
+const char* menuItems[] = {"Set Interval", "Set Brightness", "System Info", "Browse Photos", "Albums", "Motion", "Order", "Benchmark", "Exit"};
+int menuItemCount = 9;
 int selectedMenuItem = 0;
 unsigned long menuLastInteraction = 0;
 
+// Browse grid
+const int BROWSE_PAGE_SIZE = BROWSE_COLUMNS * BROWSE_ROWS;
+const int BROWSE_CELL = 120;
+const int BROWSE_TOP = 60;
+int browseSelected = 0;
+int browsePage = -1;
+
+// Album picker: entry 0 is "All Albums", entry i + 1 is albums[i]
+int albumMenuSelected = 0;
+
 // Fatal error
 bool fatalError = false;
 String errorMessage = "";
@@ -71,22 +125,42 @@ unsigned long lastProgressUpdate = 0;
 const unsigned long PROGRESS_UPDATE_INTERVAL = 100;
 
 // ==================== Forward Declarations ====================
-void displayImage(int index);
+bool displayImage(int index);
+void showNextImage();
+void showPreviousImage();
+void prefetchNextImage();
 void showMessage(const String& message, uint16_t color = CYAN);
 void hideMessage();
 void processButtonInput();
+void processTouchInput();
 void handleShortPress();
 void handleLongPress();
+void handleSwipe(int direction);
+void runUploadSession();
 void saveIntervalToSD();
 void loadIntervalFromSD();
 void saveBrightnessToSD();
 void loadBrightnessFromSD();
+void saveMotionToSD();
+void loadMotionFromSD();
+void saveOrderToSD();
+void loadOrderFromSD();
 void initRandomSlideshow();
 int getNextRandomImage();
+void syncDatePlaylist(int after);
+int getNextDatedImage();
+void skipDuplicates();
 void showMainMenu();
 void showIntervalSetting();
 void showBrightnessSetting();
 void showSystemInfo();
+void showBenchmark();
+void enterBrowse();
+void showBrowsePage();
+void drawBrowseSelection(int index, uint16_t color);
+void moveBrowseSelection(int direction);
+void showAlbumMenu();
+void switchAlbum(int album);
 void exitToSlideshow();
 void adjustInterval(int direction);
 void adjustBrightness(int direction);
@@ -99,9 +173,12 @@ void hideLoadingScreen();
 
 // SD Card Functions
 bool initSDCard();
-int countTotalFiles();
+void loadSettingsFromSD();
+bool loadLastFrame(ImageEntry& image);
+void noteLastFrame(const ImageEntry& image);
+void saveLastFrame(bool now);
+bool showLastFrame(ImageEntry& image);
 void findImageFiles();
-bool isSystemFile(const String& filename);
 uint64_t getSDFreeSpace();
 String formatBytes(uint64_t bytes);
 
@@ -133,6 +210,7 @@ uint64_t getSDFreeSpace() {
 // ==================== Loading Screen Functions ====================
 void showLoadingScreen(const String& message) {
     showingLoading = true;
+    backlightShowFull();
     loadingMessage = message;
     loadingProgress = 0.0;
     lastProgressUpdate = 0;
@@ -201,53 +279,62 @@ void hideLoadingScreen() {
 
 // ==================== SD Card Functions ====================
 bool initSDCard() {
-    Serial.println("Initializing SD card...");
+    LOG_I("Initializing SD card...\n");
     updateLoadingProgress(0.0, "Initializing SD card...");
     
+    // SD.begin clocks the card through its power-up itself
     sdSPI.begin(SD_SCK, SD_MISO, SD_MOSI, SD_CS);
-    delay(100);
     
-    if (!SD.begin(SD_CS, sdSPI, 40000000)) {
-        if (!SD.begin(SD_CS, sdSPI, 20000000)) {
-            Serial.println("SD card initialization failed!");
+    sdClockHz = SD_CLOCK_HZ;
+    if (!SD.begin(SD_CS, sdSPI, sdClockHz)) {
+        sdClockHz = SD_CLOCK_FALLBACK_HZ;
+        if (!SD.begin(SD_CS, sdSPI, sdClockHz)) {
+            LOG_E("SD card initialization failed!\n");
             updateLoadingProgress(0.0, "SD card failed!");
             delay(1000);
             return false;
         }
+        LOG_W("SD card: no response at %lu MHz, running at %lu MHz\n",
+              (unsigned long)(SD_CLOCK_HZ / 1000000), (unsigned long)(sdClockHz / 1000000));
     }
     
     updateLoadingProgress(0.1, "SD card detected");
     
     uint8_t cardType = SD.cardType();
     if (cardType == CARD_NONE) {
-        Serial.println("No SD card attached");
+        LOG_E("No SD card attached\n");
         updateLoadingProgress(0.1, "No SD card!");
         delay(1000);
         return false;
     }
     
-    Serial.print("SD Card Type: ");
+    const char* typeName;
     switch(cardType) {
-        case CARD_MMC:  Serial.println("MMC"); break;
-        case CARD_SD:   Serial.println("SDSC"); break;
-        case CARD_SDHC: Serial.println("SDHC"); break;
-        default:        Serial.println("Unknown");
+        case CARD_MMC:  typeName = "MMC"; break;
+        case CARD_SD:   typeName = "SDSC"; break;
+        case CARD_SDHC: typeName = "SDHC"; break;
+        default:        typeName = "Unknown";
     }
+    LOG_I("SD Card Type: %s\n", typeName);
     
     uint64_t cardSize = SD.cardSize() / (1024 * 1024);
-    Serial.printf("SD Card Size: %lluMB\n", cardSize);
+    LOG_I("SD Card Size: %lluMB\n", cardSize);
     updateLoadingProgress(0.15, String(cardSize) + "MB detected");
-    
+    return true;
+}
+
+// Brightness is read straight after mounting, before the first paint
+void loadSettingsFromSD() {
     updateLoadingProgress(0.2, "Loading settings...");
     loadIntervalFromSD();
-    loadBrightnessFromSD();
-    
-    return true;
+    loadMotionFromSD();
+    loadOrderFromSD();
+    loadQuarantine();
 }
 
 void loadIntervalFromSD() {
     if (!SD.exists("/")) {
-        Serial.println("SD card not available for loading interval");
+        LOG_W("SD card not available for loading interval\n");
         currentIntervalIndex = INTERVAL_DEFAULT_INDEX;
         slideshowInterval = intervals[currentIntervalIndex];
         return;
@@ -264,34 +351,36 @@ void loadIntervalFromSD() {
             if (savedIndex >= 0 && savedIndex < (sizeof(intervals) / sizeof(intervals[0]))) {
                 currentIntervalIndex = savedIndex;
                 slideshowInterval = intervals[currentIntervalIndex];
-                Serial.printf("Interval loaded from SD: %d (index), %lu ms\n", 
-                              currentIntervalIndex, slideshowInterval);
+                LOG_I("Interval loaded from SD: %d (index), %lu ms\n", 
+                      currentIntervalIndex, slideshowInterval);
             } else {
                 currentIntervalIndex = INTERVAL_DEFAULT_INDEX;
                 slideshowInterval = intervals[currentIntervalIndex];
-                Serial.printf("Invalid interval data, using default: %d (index), %lu ms\n", 
-                              currentIntervalIndex, slideshowInterval);
+                LOG_W("Invalid interval data, using default: %d (index), %lu ms\n", 
+                      currentIntervalIndex, slideshowInterval);
                 saveIntervalToSD();
             }
         } else {
             currentIntervalIndex = INTERVAL_DEFAULT_INDEX;
             slideshowInterval = intervals[currentIntervalIndex];
-            Serial.printf("Failed to read interval file, using default: %d (index), %lu ms\n", 
-                          currentIntervalIndex, slideshowInterval);
+            LOG_W("Failed to read interval file, using default: %d (index), %lu ms\n", 
+                  currentIntervalIndex, slideshowInterval);
             saveIntervalToSD();
         }
     } else {
         currentIntervalIndex = INTERVAL_DEFAULT_INDEX;
         slideshowInterval = intervals[currentIntervalIndex];
-        Serial.printf("Interval file not found, using default: %d (index), %lu ms\n", 
-                      currentIntervalIndex, slideshowInterval);
+        LOG_I("Interval file not found, using default: %d (index), %lu ms\n", 
+              currentIntervalIndex, slideshowInterval);
         saveIntervalToSD();
     }
 }
 
 void saveIntervalToSD() {
+    lockSD();
     if (!SD.exists("/")) {
-        Serial.println("SD card not available for saving interval");
+        unlockSD();
+        LOG_W("SD card not available for saving interval\n");
         return;
     }
     
@@ -299,18 +388,19 @@ void saveIntervalToSD() {
     if (intervalFile) {
         intervalFile.print(currentIntervalIndex);
         intervalFile.close();
-        Serial.printf("Interval saved to SD: %d (index), %lu ms\n", 
-                      currentIntervalIndex, slideshowInterval);
+        LOG_I("Interval saved to SD: %d (index), %lu ms\n", 
+              currentIntervalIndex, slideshowInterval);
     } else {
-        Serial.println("Failed to save interval to SD card!");
+        LOG_E("Failed to save interval to SD card!\n");
     }
+    unlockSD();
 }
 
 void loadBrightnessFromSD() {
     if (!SD.exists("/")) {
-        Serial.println("SD card not available for loading brightness");
+        LOG_W("SD card not available for loading brightness\n");
         currentBrightness = BRIGHTNESS_DEFAULT;
-        set_brightness(currentBrightness);
+        backlightSetCeiling(currentBrightness);
         return;
     }
     
@@ -324,31 +414,33 @@ void loadBrightnessFromSD() {
             
             if (savedBrightness >= MIN_BRIGHTNESS && savedBrightness <= MAX_BRIGHTNESS) {
                 currentBrightness = savedBrightness;
-                set_brightness(currentBrightness);
-                Serial.printf("Brightness loaded from SD: %d\n", currentBrightness);
+                backlightSetCeiling(currentBrightness);
+                LOG_I("Brightness loaded from SD: %d\n", currentBrightness);
             } else {
                 currentBrightness = BRIGHTNESS_DEFAULT;
-                set_brightness(currentBrightness);
-                Serial.printf("Invalid brightness data, using default: %d\n", currentBrightness);
+                backlightSetCeiling(currentBrightness);
+                LOG_W("Invalid brightness data, using default: %d\n", currentBrightness);
                 saveBrightnessToSD();
             }
         } else {
             currentBrightness = BRIGHTNESS_DEFAULT;
-            set_brightness(currentBrightness);
-            Serial.printf("Failed to read brightness file, using default: %d\n", currentBrightness);
+            backlightSetCeiling(currentBrightness);
+            LOG_W("Failed to read brightness file, using default: %d\n", currentBrightness);
             saveBrightnessToSD();
         }
     } else {
         currentBrightness = BRIGHTNESS_DEFAULT;
-        set_brightness(currentBrightness);
-        Serial.printf("Brightness file not found, using default: %d\n", currentBrightness);
+        backlightSetCeiling(currentBrightness);
+        LOG_I("Brightness file not found, using default: %d\n", currentBrightness);
         saveBrightnessToSD();
     }
 }
 
 void saveBrightnessToSD() {
+    lockSD();
     if (!SD.exists("/")) {
-        Serial.println("SD card not available for saving brightness");
+        unlockSD();
+        LOG_W("SD card not available for saving brightness\n");
         return;
     }
     
@@ -356,115 +448,76 @@ void saveBrightnessToSD() {
     if (brightnessFile) {
         brightnessFile.print(currentBrightness);
         brightnessFile.close();
-        Serial.printf("Brightness saved to SD: %d\n", currentBrightness);
+        LOG_I("Brightness saved to SD: %d\n", currentBrightness);
     } else {
-        Serial.println("Failed to save brightness to SD card!");
+        LOG_E("Failed to save brightness to SD card!\n");
     }
+    unlockSD();
 }
 
-// ==================== Image Management ====================
-bool isSystemFile(const String& filename) {
-    if (filename.startsWith("._")) return true;
-    if (filename.equalsIgnoreCase(".DS_Store")) return true;
-    if (filename.equalsIgnoreCase("Thumbs.db")) return true;
-    if (filename.equalsIgnoreCase("desktop.ini")) return true;
-    return false;
+void loadMotionFromSD() {
+    motionEnabled = MOTION_DEFAULT;
+    
+    File motionFile = SD.open(MOTION_FILENAME, FILE_READ);
+    if (motionFile) {
+        motionEnabled = motionFile.readString().toInt() != 0;
+        motionFile.close();
+        LOG_I("Motion loaded from SD: %s\n", motionEnabled ? "on" : "off");
+    }
 }
 
-int countTotalFiles() {
-    int totalFiles = 0;
-    
-    File root = SD.open("/");
-    if (!root) {
-        return 0;
+void saveMotionToSD() {
+    lockSD();
+    File motionFile = SD.open(MOTION_FILENAME, FILE_WRITE);
+    if (motionFile) {
+        motionFile.print(motionEnabled ? 1 : 0);
+        motionFile.close();
+        LOG_I("Motion saved to SD: %s\n", motionEnabled ? "on" : "off");
+    } else {
+        LOG_E("Failed to save motion setting to SD card!\n");
     }
-    
-    while (true) {
-        File entry = root.openNextFile();
-        if (!entry) break;
-        
-        String filename = entry.name();
-        
-        if (entry.isDirectory()) {
-            entry.close();
-            continue;
-        }
-        
-        if (isSystemFile(filename)) {
-            entry.close();
-            continue;
-        }
-        
-        totalFiles++;
-        entry.close();
+    unlockSD();
+}
+
+void loadOrderFromSD() {
+    dateOrder = DATE_ORDER_DEFAULT;
+    
+    File orderFile = SD.open(ORDER_FILENAME, FILE_READ);
+    if (orderFile) {
+        dateOrder = orderFile.readString().toInt() != 0;
+        orderFile.close();
+        LOG_I("Order loaded from SD: %s\n", dateOrder ? "by date" : "shuffle");
     }
-    
-    root.close();
-    return totalFiles;
 }
 
-void findImageFiles() {
-    Serial.println("Scanning for images...");
-    updateLoadingProgress(0.2, "Scanning for images...");
-    
-    File root = SD.open("/");
-    if (!root) {
-        Serial.println("Cannot open root directory");
-        return;
+void saveOrderToSD() {
+    lockSD();
+    File orderFile = SD.open(ORDER_FILENAME, FILE_WRITE);
+    if (orderFile) {
+        orderFile.print(dateOrder ? 1 : 0);
+        orderFile.close();
+        LOG_I("Order saved to SD: %s\n", dateOrder ? "by date" : "shuffle");
+    } else {
+        LOG_E("Failed to save order setting to SD card!\n");
     }
+    unlockSD();
+}
+
+// ==================== Image Management ====================
+// Loads the selected album from its index; only albums without one yet
+// cost a directory walk
+void findImageFiles() {
+    MemScope scope(MEM_SCAN);
+    LOG_I("Scanning for images...\n");
+    updateLoadingProgress(0.2, "Scanning for albums...");
     
-    imageFiles.clear();
-    int fileCount = 0;
-    int imageCount = 0;
-    int totalFiles = countTotalFiles();
-    
-    if (totalFiles == 0) {
-        Serial.println("No files found on SD card");
-        updateLoadingProgress(0.5, "No files found");
-        root.close();
-        return;
-    }
+    discoverAlbums();
+    loadAlbumSelection();
     
-    Serial.printf("Total files to scan: %d\n", totalFiles);
+    updateLoadingProgress(0.4, "Loading " + albumLabel(currentAlbum) + "...");
+    loadAlbum(currentAlbum);
     
-    while (true) {
-        File entry = root.openNextFile();
-        if (!entry) break;
-        
-        String filename = entry.name();
-        
-        if (entry.isDirectory()) {
-            entry.close();
-            continue;
-        }
-        
-        if (isSystemFile(filename)) {
-            entry.close();
-            continue;
-        }
-        
-        fileCount++;
-        float progress = 0.2 + ((float)fileCount / totalFiles) * 0.7;
-        
-        String ext = filename.substring(filename.lastIndexOf('.'));
-        ext.toLowerCase();
-        
-        if (ext == ".jpg" || ext == ".jpeg") {
-            String path = "/" + String(entry.name());
-            imageFiles.push_back(path);
-            imageCount++;
-            
-            if (fileCount % 10 == 0 || fileCount == totalFiles) {
-                updateLoadingProgress(progress, String(imageCount) + " images found");
-            }
-        }
-        
-        entry.close();
-    }
-    
-    root.close();
-    
-    Serial.printf("Found %d images\n", imageFiles.size());
+    LOG_I("Found %d images\n", imageFiles.size());
     updateLoadingProgress(0.9, String(imageFiles.size()) + " images found");
 }
 
@@ -480,14 +533,28 @@ void initRandomSlideshow() {
         int j = random(0, i + 1);
         std::swap(shuffledIndices[i], shuffledIndices[j]);
     }
+    int spread = spreadShuffle(shuffledIndices);
     
     currentShuffleIndex = 0;
-    Serial.println("Random slideshow order initialized");
+    LOG_I("Random slideshow order initialized, %d near-duplicates moved apart\n", spread);
+}
+
+// Steps over copies of a photo already in the cycle, so the prefetch sees
+// the slide that will really come next. The last slide of a cycle is left.
+void skipDuplicates() {
+#if SHUFFLE_SKIP_DUPLICATES
+    while (currentShuffleIndex + 1 < shuffledIndices.size() &&
+           isDuplicateImage(shuffledIndices[currentShuffleIndex])) {
+        LOG_D("Skipped copy %s\n", imageFiles[shuffledIndices[currentShuffleIndex]].path.c_str());
+        currentShuffleIndex++;
+    }
+#endif
 }
 
 int getNextRandomImage() {
     if (imageFiles.empty()) return 0;
     
+    skipDuplicates();
     int imageIndex = shuffledIndices[currentShuffleIndex];
     
     currentShuffleIndex++;
@@ -497,49 +564,529 @@ int getNextRandomImage() {
             int j = random(0, i + 1);
             std::swap(shuffledIndices[i], shuffledIndices[j]);
         }
+        int spread = spreadShuffle(shuffledIndices);
         
         currentShuffleIndex = 0;
-        Serial.println("Reshuffled image order for new cycle");
+        LOG_I("Reshuffled image order for new cycle, %d near-duplicates moved apart\n", spread);
     }
+    skipDuplicates();
     
     return imageIndex;
 }
 
-void displayImage(int index) {
+// ==================== Date Order ====================
+// Opens the album's date playlist, sorting a new one when the photos have
+// changed, and moves the read position past imageFiles[after] (-1: the
+// oldest photo)
+void syncDatePlaylist(int after) {
+    datePlaylistStale = false;
+    if (!dateOrder) return;
+    
+    String path = albumStatePath(currentAlbum, ".dat");
+    uint32_t signature = playlistSignature();
+    lockSD();
+    if (!playlistOpen(path, signature)) {
+        showMessage("Sorting by date...", CYAN);
+        playlistBuild(path, signature);
+    }
+    if (after >= 0 && after < imageFiles.size()) playlistSeekAfter(imageFiles[after]);
+    unlockSD();
+}
+
+// findImageIndex() starting at hint, so stepping through the playlist
+// does not search imageFiles from the top every slide
+int findImageIndexNear(const String& path, int hint) {
+    int n = imageFiles.size();
+    if (hint < 0 || hint >= n) hint = 0;
+    for (int k = 0; k < n; k++) {
+        int i = (hint + k) % n;
+        if (imageFiles[i].path == path) return i;
+    }
+    return -1;
+}
+
+// The next photo in capture order. Playlist entries no longer in
+// imageFiles are passed over; without a playlist this is the shuffle.
+int getNextDatedImage() {
+    if (datePlaylistStale) syncDatePlaylist(currentImageIndex);
+    
+    for (int skipped = 0; skipped < PLAYLIST_SKIP_MAX && playlistCount() > 0; skipped++) {
+        String path = playlistPeek();
+        lockSD();
+        playlistAdvance();
+        unlockSD();
+        
+        int index = findImageIndexNear(path, datedHint);
+        if (index < 0) continue;
+#if SHUFFLE_SKIP_DUPLICATES
+        if (isDuplicateImage(index)) continue;
+#endif
+        datedHint = index + 1;
+        return index;
+    }
+    return getNextRandomImage();
+}
+
+const char* decodeFailureReason(int res) {
+    switch (res) {
+        case DECODE_READ_ERROR:      return "read error";
+        case DECODE_NO_MEMORY:
+        case DECODE_NO_MEMORY_INPUT: return "out of memory";
+        case DECODE_BAD_PARAMETER:   return "bad parameter";
+        case DECODE_CORRUPT:         return "corrupt data";
+        case DECODE_BAD_STRUCTURE:   return "bad structure";
+        case DECODE_UNSUPPORTED:     return "unsupported format";
+        default:                     return "decode error";
+    }
+}
+
+// Failures that may not repeat: an SD glitch or a fragmented heap
+bool isTransientFailure(const char* reason) {
+    return strcmp(reason, "read error") == 0 || strcmp(reason, "out of memory") == 0;
+}
+
+// Photos that failed transiently, and on how many passes in a row
+struct ReadStrike {
+    String path;
+    uint8_t count;
+};
+static std::vector<ReadStrike> readStrikes;
+
+// Counts a transient failure; true once the photo has had READ_ERROR_STRIKES
+static bool strikeImage(const String& path) {
+    for (size_t i = 0; i < readStrikes.size(); i++) {
+        if (readStrikes[i].path != path) continue;
+        if (++readStrikes[i].count < READ_ERROR_STRIKES) return false;
+        readStrikes.erase(readStrikes.begin() + i);
+        return true;
+    }
+    if (READ_ERROR_STRIKES <= 1) return true;
+    ReadStrike strike;
+    strike.path = path;
+    strike.count = 1;
+    readStrikes.push_back(strike);
+    return false;
+}
+
+static void clearStrikes(const String& path) {
+    for (size_t i = 0; i < readStrikes.size(); i++) {
+        if (readStrikes[i].path == path) {
+            readStrikes.erase(readStrikes.begin() + i);
+            return;
+        }
+    }
+}
+
+// Why an image cannot be shown, or NULL with its size filled in
+const char* checkImageLimits(const ImageEntry& image, uint16_t* width, uint16_t* height) {
+    if (image.size > DECODE_MAX_FILE_SIZE) return "file too large";
+    
+    int res = imageGetSdSize(width, height, image.path.c_str());
+    if (res != DECODE_OK) return decodeFailureReason(res);
+    if ((uint32_t)*width * *height > DECODE_MAX_PIXELS) return "image too large";
+    return NULL;
+}
+
+// Draws a still slide into the blit target, centered as it appears after
+// EXIF rotation. Returns a DecodeResult.
+int drawStill(const ImageEntry& image, uint16_t width, uint16_t height) {
+    bool transposed = image.orientation >= 5;
+    int shownWidth = transposed ? height : width;
+    int shownHeight = transposed ? width : height;
+    int offsetX = (480 - shownWidth) / 2;
+    int offsetY = (800 - shownHeight) / 2;
+    if (shownWidth < 480 || shownHeight < 800) {
+        // The last slide would show around the edges; the bars get a
+        // blurred copy of the photo, or black
+        bool fill = LETTERBOX_BLUR && image.size <= LETTERBOX_MAX_FILE_SIZE;
+        if (!fill || !letterboxDraw(image.path.c_str(), image.orientation, width, height,
+                                    offsetX, offsetY, shownWidth, shownHeight)) {
+            fillBlitTarget(BLACK);
+        }
+    }
+    setBlitTransform(image.orientation, width, height, offsetX, offsetY);
+    
+    int res = imageDrawSd(0, 0, image.path.c_str());
+    flushBlit();
+    return res;
+}
+
+int findImageIndex(const String& path) {
+    for (int i = 0; i < imageFiles.size(); i++) {
+        if (imageFiles[i].path == path) return i;
+    }
+    return -1;
+}
+
+void recordHistory(const String& path) {
+    if (!imageHistory.empty() && imageHistory.back() == path) return;
+    imageHistory.push_back(path);
+    if (imageHistory.size() > FRAME_HISTORY) {
+        imageHistory.erase(imageHistory.begin());
+    }
+}
+
+// Returns false if the image failed and was quarantined
+bool displayImage(int index) {
     if (imageFiles.empty()) {
-        return;
+        return false;
     }
     
     if (index < 0) index = 0;
     if (index >= imageFiles.size()) index = imageFiles.size() - 1;
     
+    MemScope scope(MEM_DECODE);
+    clipStop();
     currentImageIndex = index;
-    String path = imageFiles[currentImageIndex];
+    const ImageEntry& image = imageFiles[currentImageIndex];
+    String path = image.path;
+    const char* failure = NULL;
+    bool clip = isClipName(path);
+    LumaHistogram clipLuma;
+    uint64_t hash = 0;
+    
+    // Seen before or rendered ahead: no SD access or decode at all
+    if (!motionEnabled && !clip && frameCacheShow(path, &photoBacklight)) {
+        LOG_I("Displaying image %d/%d: %s (cached)\n", currentImageIndex + 1, imageFiles.size(), path.c_str());
+        backlightShowPhoto(photoBacklight);
+        recordHistory(path);
+        noteLastFrame(image);
+        lastImageChange = millis();
+        return true;
+    }
     
-    Serial.printf("Displaying image %d/%d: %s\n", currentImageIndex + 1, imageFiles.size(), path.c_str());
+    LOG_I("Displaying image %d/%d: %s\n", currentImageIndex + 1, imageFiles.size(), path.c_str());
     
-    if (path.endsWith(".jpg") || path.endsWith(".jpeg")) {
-        TJpgDec.setJpgScale(1);
-        TJpgDec.setCallback(tft_output);
+    if (clip) {
+        // Motion would draw over the clip, and both need the PSRAM
+        kenBurnsEnd();
+        lumaReset(clipLuma);
+        int res = clipBegin(path.c_str(), image.orientation, clipLuma);
+        if (res == DECODE_NO_MEMORY) {
+            frameCacheFree();
+            res = clipBegin(path.c_str(), image.orientation, clipLuma);
+        }
+        if (res != DECODE_OK) failure = decodeFailureReason(res);
+    } else if (isImageFile(path)) {
+        // Keep the background rescan off the card while decoding
+        lockSD();
+        unsigned long decodeStart = millis();
         
         uint16_t imgWidth, imgHeight;
-        JRESULT res = TJpgDec.getSdJpgSize(&imgWidth, &imgHeight, path.c_str());
+        uint8_t orientation = image.orientation;
+        int res = DECODE_OK;
+        failure = checkImageLimits(image, &imgWidth, &imgHeight);
         
-        if (res == JDR_OK) {
-            int offsetX = (480 - imgWidth) / 2;
-            int offsetY = (800 - imgHeight) / 2;
-            TJpgDec.drawSdJpg(offsetX, offsetY, path.c_str());
+        bool still = true;
+        if (!failure) {
+            decodeSetBudget(DECODE_TIME_BUDGET);
+            
+            if (motionEnabled) {
+                // Without PSRAM for the source the image is shown still
+                res = kenBurnsLoad(path.c_str(), orientation, imgWidth, imgHeight);
+                if (res == DECODE_NO_MEMORY) {
+                    frameCacheFree();
+                    res = kenBurnsLoad(path.c_str(), orientation, imgWidth, imgHeight);
+                }
+                still = res == DECODE_NO_MEMORY || res == DECODE_BAD_PARAMETER;
+            }
+            
+            if (still) {
+                res = drawStill(image, imgWidth, imgHeight);
+            }
+            
+            // DECODE_INTERRUPTED is also returned when the output stops at the screen edge
+            if (decodeBudgetExpired()) {
+                failure = "decode timeout";
+            } else if (res != DECODE_OK && res != DECODE_INTERRUPTED) {
+                failure = decodeFailureReason(res);
+            } else if (still) {
+                // The slide as rendered; motion frames move, so they are not hashed
+                hash = frameHash(gfx.getFramebuffer());
+            }
+            decodeSetBudget(0);
+        }
+        
+        unsigned long decodeTime = millis() - decodeStart;
+        unlockSD();
+        
+        if (still) {
+            LOG_D("Decode: %lu ms (blit %lu us in %lu writes)\n", decodeTime, blitMicros(), blitWrites());
         } else {
-            TJpgDec.drawSdJpg(240, 400, path.c_str());
+            LOG_D("Decode: %lu ms (motion)\n", decodeTime);
+        }
+        
+        const DecodeStats& stats = lastDecodeStats();
+        if (stats.micros > 0) {
+            // Bytes per microsecond is MB/s
+            LOG_D("Decoder %s: %.2f MB/s in, %.2f Mpx/s out\n", stats.decoder,
+                  (float)stats.bytesRead / stats.micros, (float)stats.pixels / stats.micros);
         }
     }
     
     lastImageChange = millis();
+    
+    if (failure) {
+        // A card glitch or a short heap may pass: skip the photo for this pass
+        if (isTransientFailure(failure) && !strikeImage(path)) {
+            LOG_W("Skipped %s: %s\n", path.c_str(), failure);
+        } else {
+            quarantineImage(currentImageIndex, failure);
+        }
+        return false;
+    }
+    if (!readStrikes.empty()) clearStrikes(path);
+    
+    if (hash) setImageHash(currentImageIndex, hash);
+    
+    // The histogram came with the decode
+    photoBacklight = backlightPercent(clip ? clipLuma : lastDecodeStats().luma);
+    backlightShowPhoto(photoBacklight);
+    LOG_D("Backlight: %u%% of %u, %u%% saved since boot\n", photoBacklight, currentBrightness,
+          backlightSavedPercent());
+    
+    if (!motionEnabled && !clip) {
+        frameCacheStore(path, photoBacklight);
+    }
+    recordHistory(path);
+    noteLastFrame(image);
+    return true;
+}
+
+// Advances the slideshow, skipping past images that fail to decode. Each
+// attempt is bounded by DECODE_TIME_BUDGET, so the gap between slides is too.
+void showNextImage() {
+    for (int attempt = 0; attempt < DECODE_MAX_ATTEMPTS && !imageFiles.empty(); attempt++) {
+        if (displayImage(dateOrder ? getNextDatedImage() : getNextRandomImage())) return;
+    }
+    
+    if (imageFiles.empty()) {
+        exitToSlideshow();
+    }
+}
+
+// Steps back through the photos shown before, up to FRAME_HISTORY
+void showPreviousImage() {
+    if (imageHistory.size() < 2) {
+        showMessage("No earlier photos", YELLOW);
+        return;
+    }
+    
+    imageHistory.pop_back();  // The photo on screen
+    while (!imageHistory.empty()) {
+        String path = imageHistory.back();
+        imageHistory.pop_back();  // displayImage() records it again
+        int index = findImageIndex(path);
+        if (index >= 0 && displayImage(index)) return;
+    }
+    showNextImage();
+}
+
+// Any button or touch input ends a prefetch early
+bool inputPending() {
+    return touchPending() || digitalRead(BOOT_BUTTON_PIN) == LOW;
+}
+
+// Renders the next slide offscreen while the current one is up, so the
+// slide change or a swipe to it is a frame copy. Failures are left for
+// displayImage() to quarantine when the slide comes up.
+void prefetchNextImage() {
+    // A clip playing has the blit path
+    if (motionEnabled || clipPlaying() || imageFiles.empty() || currentShuffleIndex >= shuffledIndices.size()) return;
+    
+    int index = shuffledIndices[currentShuffleIndex];
+    if (dateOrder) {
+        // A stale playlist is synced when the slide comes up
+        const String& next = playlistPeek();
+        if (datePlaylistStale || next.length() == 0 || next == prefetchFailed) return;
+        index = findImageIndexNear(next, datedHint);
+        if (index < 0) {
+            prefetchFailed = next;
+            return;
+        }
+    }
+    const ImageEntry& image = imageFiles[index];
+    if (image.path == prefetchFailed || frameCacheHas(image.path) || !isImageFile(image.path) ||
+        isClipName(image.path)) return;
+    
+    MemScope scope(MEM_DECODE);
+    String path = image.path;
+    uint16_t* frame = frameCacheBeginRender(path);
+    if (!frame || !setBlitTarget(frame)) {
+        frameCacheEndRender(false, 100);
+        prefetchFailed = path;
+        return;
+    }
+    
+    lockSD();
+    unsigned long start = millis();
+    uint16_t width, height;
+    bool ok = false;
+    if (!checkImageLimits(image, &width, &height)) {
+        decodeSetBudget(DECODE_TIME_BUDGET);
+        decodeSetCancel(inputPending);
+        int res = drawStill(image, width, height);
+        // DECODE_INTERRUPTED also ends a decode cut short by input or the budget
+        ok = (res == DECODE_OK || res == DECODE_INTERRUPTED) && !decodeBudgetExpired();
+        decodeSetCancel(NULL);
+        decodeSetBudget(0);
+    }
+    unlockSD();
+    setBlitTarget(NULL);
+    
+    if (ok) setImageHash(index, frameHash(frame));
+    frameCacheEndRender(ok, backlightPercent(lastDecodeStats().luma));
+    if (ok) {
+        LOG_D("Prefetched %s in %lu ms\n", path.c_str(), millis() - start);
+    } else if (!inputPending()) {
+        prefetchFailed = path;
+    }
+}
+
+// ==================== Last Frame ====================
+// The photo on screen is remembered by path rather than by pixels: its
+// file is the most compact copy of the frame there is. At boot it is
+// decoded as soon as the card is mounted, ahead of settings and albums.
+// One line: size <TAB> mtime <TAB> orientation <TAB> path
+bool loadLastFrame(ImageEntry& image) {
+    File file = SD.open(LAST_FRAME_FILENAME, FILE_READ);
+    if (!file) return false;
+    String line = file.readStringUntil('\n');
+    file.close();
+    
+    int t1 = line.indexOf('\t');
+    int t2 = t1 < 0 ? -1 : line.indexOf('\t', t1 + 1);
+    int t3 = t2 < 0 ? -1 : line.indexOf('\t', t2 + 1);
+    if (t3 < 0) return false;
+    
+    image.size = line.substring(0, t1).toInt();
+    image.mtime = line.substring(t1 + 1, t2).toInt();
+    image.orientation = line.substring(t2 + 1, t3).toInt();
+    image.path = line.substring(t3 + 1);
+    
+    // A file replaced since then is left for the slideshow to vet
+    File photo = SD.open(image.path, FILE_READ);
+    if (!photo) return false;
+    bool unchanged = photo.size() == image.size && (uint32_t)photo.getLastWrite() == (uint32_t)image.mtime;
+    photo.close();
+    return unchanged;
+}
+
+void noteLastFrame(const ImageEntry& image) {
+    lastFramePending = image;
+}
+
+// Writes the photo on screen if it changed, when LAST_FRAME_SAVE_INTERVAL
+// has passed since the last write or now is set, so a fast slideshow does
+// not rewrite the card every slide
+void saveLastFrame(bool now) {
+    const ImageEntry& image = lastFramePending;
+    if (image.path.length() == 0 || image.path == lastFrameSaved) return;
+    if (!now && millis() - lastFrameWriteTime < LAST_FRAME_SAVE_INTERVAL) return;
+    
+    lockSD();
+    File file = SD.open(LAST_FRAME_FILENAME, FILE_WRITE);
+    if (file) {
+        file.printf("%lu\t%lu\t%u\t%s\n", (unsigned long)image.size, (unsigned long)image.mtime,
+                    image.orientation, image.path.c_str());
+        file.close();
+        lastFrameSaved = image.path;
+    }
+    unlockSD();
+    lastFrameWriteTime = millis();
+}
+
+// Paints the photo that was up at power-off; false if there is none or it
+// cannot be shown
+bool showLastFrame(ImageEntry& image) {
+    if (!loadLastFrame(image)) return false;
+    
+    uint16_t width, height;
+    if (checkImageLimits(image, &width, &height)) return false;
+    
+    decodeSetBudget(DECODE_TIME_BUDGET);
+    int res = drawStill(image, width, height);
+    bool ok = (res == DECODE_OK || res == DECODE_INTERRUPTED) && !decodeBudgetExpired();
+    decodeSetBudget(0);
+    
+    if (ok) {
+        photoBacklight = backlightPercent(lastDecodeStats().luma);
+        backlightShowPhoto(photoBacklight);
+        lastFrameSaved = image.path;
+        LOG_I("Last frame: %s\n", image.path.c_str());
+    }
+    return ok;
+}
+
+// ==================== Serial Upload ====================
+void showUploadProgress(const String& path, uint32_t received, uint32_t size) {
+    if (!showingLoading) showLoadingScreen("Receiving photos...");
+    updateLoadingProgress(size ? (float)received / size : 1.0, path);
+}
+
+// Joins the playlist the way the rescan would have added it
+void addUploadedFile(const String& path) {
+    int slash = path.lastIndexOf('/');
+    if (!isImageFile(path) || isSystemFile(path.substring(slash + 1))) return;
+    
+    ImageEntry image;
+    lockSD();
+    File file = SD.open(path, FILE_READ);
+    bool opened = file;
+    if (opened) {
+        readImageEntry(file, dirOf(path), image);
+        file.close();
+    }
+    unlockSD();
+    if (!opened) return;
+    
+    // A folder the card did not have is a new album, which plays at once
+    // when all albums do
+    String dir = dirOf(path);
+    bool newAlbum = true;
+    for (int i = 0; i < albums.size() && newAlbum; i++) {
+        if (albums[i].dir == dir) newAlbum = false;
+    }
+    if (newAlbum && currentAlbum == ALBUM_ALL) addLibraryDir(dir);
+    
+    // A replaced photo must not come back from the frame cache
+    if (findImageIndex(path) >= 0) frameCacheClear();
+    if (addImage(image)) {
+        prefetchFailed = "";
+        datePlaylistStale = true;
+    }
+    
+    // After addImage, so the picker counts the new index
+    if (newAlbum) {
+        lockSD();
+        discoverAlbums();
+        unlockSD();
+    }
+}
+
+// The slideshow stops while files arrive; afterwards it picks up where it was
+void runUploadSession() {
+    // Progress is drawn where a clip would be
+    clipStop();
+    saveLastFrame(true);
+    uploadSession(showUploadProgress, addUploadedFile);
+    
+    // Nothing was drawn for a stray sync byte
+    if (!showingLoading) return;
+    hideLoadingScreen();
+    
+    if (fatalError && !imageFiles.empty()) {
+        fatalError = false;
+        errorMessage = "";
+    }
+    if (currentState == STATE_BROWSE) closeThumbCache();
+    exitToSlideshow();
 }
 
 // ==================== Message Functions ====================
 void showMessage(const String& message, uint16_t color) {
     if (showingLoading || currentState != STATE_SLIDESHOW) return;
+    MemScope scope(MEM_UI);
     
     gfx.fillRect(0, 0, 480, 50, BLACK);
     gfx.setCursor(10, 10);
@@ -554,7 +1101,8 @@ void showMessage(const String& message, uint16_t color) {
 
 void hideMessage() {
     if (showingMessage) {
-        if (!imageFiles.empty() && currentState == STATE_SLIDESHOW) {
+        // A moving image repaints the bar on its next frame
+        if (!imageFiles.empty() && currentState == STATE_SLIDESHOW && !kenBurnsActive()) {
             displayImage(currentImageIndex);
         }
         showingMessage = false;
@@ -563,12 +1111,13 @@ void hideMessage() {
 }
 
 // ==================== Debug Functions ====================
+// Straight to Serial: a long list would overrun the log ring
 void debugFileList() {
     Serial.println("=== DEBUG File List ===");
     Serial.printf("Total image files in vector: %d\n", imageFiles.size());
     
     for(int i = 0; i < min(40, (int)imageFiles.size()); i++) {
-        Serial.printf("%d: %s\n", i + 1, imageFiles[i].c_str());
+        Serial.printf("%d: %s\n", i + 1, imageFiles[i].path.c_str());
     }
     
     if(imageFiles.size() > 40) {
@@ -621,7 +1170,24 @@ void processButtonInput() {
             // Return to main menu after 5 seconds of inactivity
             currentState = STATE_MENU;
             showMainMenu();
-            Serial.println("Settings timeout - returning to menu");
+            LOG_I("Settings timeout - returning to menu\n");
+        }
+    }
+    
+    // Check timeout for browse grid
+    if (currentState == STATE_BROWSE) {
+        if (now - menuLastInteraction > BROWSE_TIMEOUT) {
+            closeThumbCache();
+            exitToSlideshow();
+            LOG_I("Browse timeout - returning to slideshow\n");
+        }
+    }
+    
+    // Check timeout for album picker
+    if (currentState == STATE_ALBUMS) {
+        if (now - menuLastInteraction > MENU_TIMEOUT) {
+            exitToSlideshow();
+            LOG_I("Album menu timeout - returning to slideshow\n");
         }
     }
     
@@ -630,94 +1196,214 @@ void processButtonInput() {
         if (now - menuLastInteraction > MENU_TIMEOUT) {
             // Return to slideshow after 10 seconds of inactivity
             exitToSlideshow();
-            Serial.println("Menu timeout - returning to slideshow");
+            LOG_I("Menu timeout - returning to slideshow\n");
         }
     }
 }
 
+// ==================== Touch Handling ====================
+// Tap and hold stand in for the button's short and long press
+void processTouchInput() {
+    switch (touchPoll()) {
+        case GESTURE_TAP:         handleShortPress(); break;
+        case GESTURE_LONG_PRESS:  handleLongPress();  break;
+        case GESTURE_SWIPE_LEFT:  handleSwipe(1);     break;
+        case GESTURE_SWIPE_RIGHT: handleSwipe(-1);    break;
+        default:                  break;
+    }
+}
+
+// Swipes page through photos in the slideshow and thumbnails in the browser
+void handleSwipe(int direction) {
+    menuLastInteraction = millis();
+    
+    switch (currentState) {
+        case STATE_SLIDESHOW:
+            if (imageFiles.empty()) break;
+            // The new slide covers the message bar
+            showingMessage = false;
+            currentMessage = "";
+            if (direction > 0) {
+                showNextImage();
+            } else {
+                showPreviousImage();
+            }
+            LOG_I("Swipe: %s photo\n", direction > 0 ? "next" : "previous");
+            break;
+        
+        case STATE_BROWSE:
+            moveBrowseSelection(direction);
+            break;
+        
+        default:
+            break;
+    }
+}
+
 void handleShortPress() {
     menuLastInteraction = millis();
+    // Whatever the press brings up would be drawn over by a clip
+    clipStop();
     
     switch (currentState) {
         case STATE_SLIDESHOW:
-            // Enter menu
+            // Enter menu; the photo it was on is kept for the next boot
+            saveLastFrame(true);
             currentState = STATE_MENU;
             showMainMenu();
-            Serial.println("Entered menu");
+            LOG_I("Entered menu\n");
             break;
-            
+        
         case STATE_MENU:
             // Select menu item
             switch (selectedMenuItem) {
                 case 0:  // Set Interval
                     currentState = STATE_SETTING_INTERVAL;
                     showIntervalSetting();
-                    Serial.println("Selected: Set Interval");
+                    LOG_I("Selected: Set Interval\n");
                     break;
                 case 1:  // Set Brightness
                     currentState = STATE_SETTING_BRIGHTNESS;
                     showBrightnessSetting();
-                    Serial.println("Selected: Set Brightness");
+                    LOG_I("Selected: Set Brightness\n");
                     break;
                 case 2:  // System Info
                     currentState = STATE_INFO;
                     showSystemInfo();
-                    Serial.println("Selected: System Info");
+                    LOG_I("Selected: System Info\n");
+                    break;
+                case 3:  // Browse Photos
+                    if (!imageFiles.empty()) {
+                        currentState = STATE_BROWSE;
+                        enterBrowse();
+                        LOG_I("Selected: Browse Photos\n");
+                    }
                     break;
-                case 3:  // Exit
+                case 4:  // Albums
+                    currentState = STATE_ALBUMS;
+                    lockSD();
+                    discoverAlbums();
+                    unlockSD();
+                    albumMenuSelected = currentAlbum + 1;
+                    showAlbumMenu();
+                    LOG_I("Selected: Albums\n");
+                    break;
+                case 5:  // Motion
+                    motionEnabled = !motionEnabled;
+                    if (!motionEnabled) {
+                        kenBurnsEnd();
+                    } else {
+                        // The motion source needs the PSRAM
+                        frameCacheFree();
+                    }
+                    saveMotionToSD();
+                    showMainMenu();
+                    LOG_I("Selected: Motion %s\n", motionEnabled ? "on" : "off");
+                    break;
+                case 6:  // Order
+                    dateOrder = !dateOrder;
+                    saveOrderToSD();
+                    if (dateOrder) {
+                        // Capture order carries on from the photo on screen
+                        syncDatePlaylist(currentImageIndex);
+                    } else {
+                        lockSD();
+                        playlistClose();
+                        unlockSD();
+                    }
+                    prefetchFailed = "";
+                    showMainMenu();
+                    LOG_I("Selected: Order %s\n", dateOrder ? "by date" : "shuffle");
+                    break;
+                case 7:  // Benchmark
+                    currentState = STATE_BENCHMARK;
+                    showBenchmark();
+                    LOG_I("Selected: Benchmark\n");
+                    break;
+                case 8:  // Exit
                     exitToSlideshow();
                     break;
             }
             break;
-            
+        
         case STATE_SETTING_INTERVAL:
             // Change interval (next value)
             adjustInterval(1);
             break;
-            
+        
         case STATE_SETTING_BRIGHTNESS:
             // Increase brightness
             adjustBrightness(1);
             break;
-            
+        
         case STATE_INFO:
+        case STATE_BENCHMARK:
             // Exit info to menu
             currentState = STATE_MENU;
             showMainMenu();
             break;
+        
+        case STATE_BROWSE:
+            // Jump slideshow to the selected photo
+            closeThumbCache();
+            currentState = STATE_SLIDESHOW;
+            if (!displayImage(browseSelected)) {
+                showNextImage();
+            }
+            LOG_I("Browse: jumped to image %d\n", browseSelected + 1);
+            break;
+        
+        case STATE_ALBUMS:
+            // Play the highlighted album
+            switchAlbum(albumMenuSelected - 1);
+            break;
     }
 }
 
 void handleLongPress() {
     menuLastInteraction = millis();
+    // Whatever the press brings up would be drawn over by a clip
+    clipStop();
     
     switch (currentState) {
         case STATE_SLIDESHOW:
             // Change interval directly
             changeInterval();
             break;
-            
+        
         case STATE_MENU:
             // Navigate to next menu item
             selectedMenuItem = (selectedMenuItem + 1) % menuItemCount;
             showMainMenu();
-            Serial.printf("Menu navigation: %s\n", menuItems[selectedMenuItem]);
+            LOG_I("Menu navigation: %s\n", menuItems[selectedMenuItem]);
             break;
-            
+        
         case STATE_SETTING_INTERVAL:
             // Decrease interval
             adjustInterval(-1);
             break;
-            
+        
         case STATE_SETTING_BRIGHTNESS:
             // Decrease brightness
             adjustBrightness(-1);
             break;
-            
+        
         case STATE_INFO:
+        case STATE_BENCHMARK:
             // Exit info to slideshow
             exitToSlideshow();
             break;
+        
+        case STATE_BROWSE:
+            // Move to next thumbnail
+            moveBrowseSelection(1);
+            break;
+        
+        case STATE_ALBUMS:
+            // Highlight next album
+            albumMenuSelected = (albumMenuSelected + 1) % (albums.size() + 1);
+            showAlbumMenu();
+            break;
     }
 }
 
@@ -738,11 +1424,13 @@ void changeInterval() {
     showMessage("Interval: " + intervalStr, GREEN);
     lastImageChange = millis();
     
-    Serial.printf("Interval changed to: %lu ms\n", slideshowInterval);
+    LOG_I("Interval changed to: %lu ms\n", slideshowInterval);
 }
 
 // ==================== Menu Functions ====================
 void showMainMenu() {
+    MemScope scope(MEM_UI);
+    backlightShowFull();
     gfx.fillScreen(BLACK);
     
     // Title
@@ -755,30 +1443,119 @@ void showMainMenu() {
     gfx.setTextSize(2);
     for (int i = 0; i < menuItemCount; i++) {
         int y = 150 + i * 50;
+        String label = menuItems[i];
+        if (i == 5) {
+            label += motionEnabled ? ": On" : ": Off";
+        } else if (i == 6) {
+            label += dateOrder ? ": By Date" : ": Shuffle";
+        }
         
         if (i == selectedMenuItem) {
             gfx.fillRect(100, y - 5, 280, 30, BLUE);
             gfx.setTextColor(WHITE);
             gfx.setCursor(120, y);
             gfx.print("> ");
-            gfx.print(menuItems[i]);
+            gfx.print(label);
         } else {
             gfx.setTextColor(GREEN);
             gfx.setCursor(140, y);
-            gfx.print(menuItems[i]);
+            gfx.print(label);
         }
     }
     
     // Instructions
-    gfx.setCursor(50, 400);
+    gfx.setCursor(50, 600);
     gfx.setTextSize(1);
     gfx.setTextColor(YELLOW);
     gfx.print("Short: Select/Change  Long: Navigate/Adjust");
     
-    gfx.setCursor(100, 430);
+    gfx.setCursor(100, 630);
     gfx.print("Auto-exit in 10 seconds");
 }
 
+// Paged list; the page follows the highlighted entry
+void showAlbumMenu() {
+    MemScope scope(MEM_UI);
+    gfx.fillScreen(BLACK);
+    
+    // Title
+    gfx.setCursor(170, 50);
+    gfx.setTextSize(3);
+    gfx.setTextColor(CYAN);
+    gfx.print("Albums");
+    
+    int entryCount = albums.size() + 1;
+    int first = (albumMenuSelected / ALBUM_MENU_ROWS) * ALBUM_MENU_ROWS;
+    
+    gfx.setTextSize(2);
+    for (int i = first; i < entryCount && i < first + ALBUM_MENU_ROWS; i++) {
+        int y = 130 + (i - first) * 50;
+        int album = i - 1;
+        
+        String label = albumLabel(album);
+        if (label.length() > 18) label = label.substring(0, 17) + "~";
+        
+        if (i == albumMenuSelected) {
+            gfx.fillRect(20, y - 5, 440, 30, BLUE);
+            gfx.setTextColor(WHITE);
+        } else {
+            gfx.setTextColor(album == currentAlbum ? YELLOW : GREEN);
+        }
+        gfx.setCursor(30, y);
+        gfx.print(i == albumMenuSelected ? "> " : "  ");
+        gfx.print(label);
+        
+        // Image count, if the album was indexed already
+        if (album != ALBUM_ALL && albums[album].count >= 0) {
+            gfx.setCursor(370, y);
+            gfx.print(albums[album].count);
+        }
+    }
+    
+    // Instructions
+    gfx.setCursor(50, 660);
+    gfx.setTextSize(1);
+    gfx.setTextColor(YELLOW);
+    gfx.print("Short: Play album  Long: Next");
+    
+    gfx.setCursor(50, 690);
+    gfx.print("Playing: " + albumLabel(currentAlbum));
+}
+
+// Switching reads the album's index; nothing on the card is walked unless
+// the album was never indexed
+void switchAlbum(int album) {
+    unsigned long switchStart = millis();
+    
+    // Takes the SD lock itself, which is not recursive
+    saveImageHashes();
+    lockSD();
+    selectAlbum(album);
+    unlockSD();
+    imageHistory.clear();
+    
+    if (shuffledIndices.size() != imageFiles.size()) {
+        initRandomSlideshow();
+    }
+    // A new album starts from its oldest photo
+    datedHint = 0;
+    syncDatePlaylist(-1);
+    
+    if (!imageFiles.empty()) {
+        fatalError = false;
+        errorMessage = "";
+    }
+    
+    LOG_I("Switched to album %s in %lu ms\n", albumLabel(currentAlbum).c_str(), millis() - switchStart);
+    
+    currentState = STATE_SLIDESHOW;
+    if (imageFiles.empty()) {
+        exitToSlideshow();
+    } else {
+        showNextImage();
+    }
+}
+
 void showIntervalSetting() {
     gfx.fillScreen(BLACK);
     
@@ -851,6 +1628,7 @@ void showBrightnessSetting() {
 }
 
 void showSystemInfo() {
+    MemScope scope(MEM_UI);
     gfx.fillScreen(BLACK);
     
     // Title
@@ -886,6 +1664,10 @@ void showSystemInfo() {
     gfx.print("Brightness: ");
     gfx.setTextColor(GREEN);
     gfx.print(currentBrightness);
+    if (BACKLIGHT_ADAPTIVE) {
+        // Duty the adaptive backlight saved against running at the setting
+        gfx.printf(", %u%% saved", backlightSavedPercent());
+    }
     
     y += lineHeight;
     
@@ -898,6 +1680,38 @@ void showSystemInfo() {
     
     y += lineHeight;
     
+    // Album playing
+    gfx.setTextColor(WHITE);
+    gfx.setCursor(50, y);
+    gfx.print("Album: ");
+    gfx.setTextColor(GREEN);
+    gfx.print(albumLabel(currentAlbum));
+    
+    y += lineHeight;
+    
+    // Motion frame rate and render load per core
+    gfx.setTextColor(WHITE);
+    gfx.setCursor(50, y);
+    gfx.print("Motion: ");
+    gfx.setTextColor(GREEN);
+    if (motionEnabled) {
+        const KenBurnsStats& motion = kenBurnsStats();
+        gfx.printf("%.1f fps, %d/%d%%", motion.fps, motion.loadCore1, motion.loadCore0);
+    } else {
+        gfx.print("Off");
+    }
+    
+    y += lineHeight;
+    
+    // Time from power-on to the first photo
+    gfx.setTextColor(WHITE);
+    gfx.setCursor(50, y);
+    gfx.print("First photo: ");
+    gfx.setTextColor(GREEN);
+    gfx.printf("%lu ms", (unsigned long)bootFirstPhotoMs());
+    
+    y += lineHeight;
+    
     // SD Card free space
     gfx.setTextColor(WHITE);
     gfx.setCursor(50, y);
@@ -913,27 +1727,224 @@ void showSystemInfo() {
     
     y += lineHeight;
     
-    // Free memory
+    // Memory: free / min free / largest block per region
+    MemSample mem;
+    takeMemSample(mem);
+    
     gfx.setTextColor(WHITE);
     gfx.setCursor(50, y);
-    gfx.print("Free RAM: ");
+    gfx.print("RAM: ");
     gfx.setTextColor(GREEN);
-    gfx.print(ESP.getFreeHeap() / 1024);
-    gfx.print(" KB");
+    gfx.printf("%lu/%lu/%lu KB", (unsigned long)mem.internal.freeBytes / 1024,
+               (unsigned long)mem.internal.minFreeBytes / 1024,
+               (unsigned long)mem.internal.largestBlock / 1024);
+    
+    y += lineHeight;
+    
+    gfx.setTextColor(WHITE);
+    gfx.setCursor(50, y);
+    gfx.print("PSRAM: ");
+    gfx.setTextColor(GREEN);
+    gfx.printf("%lu/%lu/%lu KB", (unsigned long)mem.psram.freeBytes / 1024,
+               (unsigned long)mem.psram.minFreeBytes / 1024,
+               (unsigned long)mem.psram.largestBlock / 1024);
+    
+    y += lineHeight;
+    
+    gfx.setTextColor(WHITE);
+    gfx.setCursor(50, y);
+    gfx.print("Heap trend: ");
+    gfx.setTextColor(GREEN);
+    gfx.printf("%ld B/h", (long)memTrendPerHour());
+    
+    y += lineHeight;
+    
+    // Decode arena peak and free-heap change per subsystem
+    gfx.setTextSize(1);
+    gfx.setTextColor(LIGHTGREY);
+    for (int i = 0; i < MEM_SUBSYSTEM_COUNT; i++) {
+        const MemSubsystemStats& stats = memSubsystemStats((MemSubsystem)i);
+        gfx.setCursor(50, y);
+        gfx.printf("%-6s calls %lu  arena %lu KB  heap net %ld B  max %ld B", memSubsystemName((MemSubsystem)i),
+                   (unsigned long)stats.calls, (unsigned long)stats.arenaPeak / 1024,
+                   (long)stats.heapNet, (long)stats.heapMaxDrop);
+        y += 14;
+    }
+    
+    // PSRAM reserved at boot
+    const FramePoolStats& pool = framePoolStats();
+    gfx.setCursor(50, y);
+    gfx.printf("frames %u/%u  peak %u  misses %lu", pool.slots - pool.owned[FRAME_OWNER_NONE],
+               pool.slots, pool.peak, (unsigned long)pool.misses);
+    y += 14;
+    for (int i = 0; i < ARENA_COUNT; i++) {
+        const ArenaStats& stats = arenaStats((MemArena)i);
+        gfx.setCursor(50, y);
+        gfx.printf("%-7s %lu/%lu KB  peak %lu KB  misses %lu", arenaName((MemArena)i),
+                   (unsigned long)stats.used / 1024, (unsigned long)stats.size / 1024,
+                   (unsigned long)stats.peak / 1024, (unsigned long)stats.misses);
+        y += 14;
+    }
     
     // Instructions
-    gfx.setCursor(100, 450);
+    gfx.setCursor(100, 720);
+    gfx.setTextSize(1);
+    gfx.setTextColor(YELLOW);
+    gfx.print("Press button to go back");
+}
+
+// One "label: value" line of the benchmark screen
+static void drawBenchLine(int y, const char* label, const String& value, uint16_t color) {
+    gfx.setTextColor(WHITE);
+    gfx.setCursor(50, y);
+    gfx.print(label);
+    gfx.setTextColor(color);
+    gfx.print(value);
+}
+
+// Runs the suite, then shows what it measured
+void showBenchmark() {
+    MemScope scope(MEM_UI);
+    gfx.fillScreen(BLACK);
+    gfx.setCursor(150, 50);
+    gfx.setTextSize(3);
+    gfx.setTextColor(CYAN);
+    gfx.print("Benchmark");
+    gfx.setCursor(50, 150);
+    gfx.setTextSize(2);
+    gfx.setTextColor(YELLOW);
+    gfx.print("Running...");
+    
+    BenchResults results;
+    runBenchmark(sdClockHz, results);
+    printBenchmark(results);
+    
+    // The screen tests drew over everything
+    gfx.fillScreen(BLACK);
+    gfx.setCursor(150, 50);
+    gfx.setTextSize(3);
+    gfx.setTextColor(CYAN);
+    gfx.print("Benchmark");
+    
+    gfx.setTextSize(2);
+    int y = 150;
+    int lineHeight = 40;
+    String failed = "Failed";
+    uint16_t sdColor = results.sdOk ? GREEN : RED;
+    
+    // Yellow when the card fell back to the slower clock
+    drawBenchLine(y, "SD clock: ", String(sdClockHz / 1000000) + " MHz", sdClockHz < SD_CLOCK_HZ ? YELLOW : GREEN);
+    y += lineHeight;
+    drawBenchLine(y, "SD write: ", results.sdOk ? String(results.writeMBs, 2) + " MB/s" : failed, sdColor);
+    y += lineHeight;
+    drawBenchLine(y, "SD read: ", results.sdOk ? String(results.seqReadMBs, 2) + " MB/s" : failed, sdColor);
+    y += lineHeight;
+    drawBenchLine(y, "SD random: ", results.sdOk ? String(results.randReadMBs, 2) + " MB/s, " +
+                  String(results.randReadMs, 1) + " ms/read" : failed, sdColor);
+    y += lineHeight;
+    drawBenchLine(y, "JPEG decode: ", results.jpegOk ? String(results.jpegMs, 1) + " ms" : failed,
+                  results.jpegOk ? GREEN : RED);
+    y += lineHeight;
+    drawBenchLine(y, "Fill: ", String(results.fillMs, 1) + " ms, " + String(results.fillMBs, 0) + " MB/s", GREEN);
+    y += lineHeight;
+    drawBenchLine(y, "Blit: ", String(results.blitMs, 1) + " ms, " + String(results.blitMBs, 0) + " MB/s", GREEN);
+    y += lineHeight * 2;
+    
     gfx.setTextSize(1);
+    gfx.setCursor(50, y);
+    gfx.setTextColor(results.saved ? CYAN : RED);
+    gfx.print(results.saved ? "Saved to " BENCH_RESULTS_FILENAME : "Could not write " BENCH_RESULTS_FILENAME);
+    
+    // Instructions
+    gfx.setCursor(100, 720);
     gfx.setTextColor(YELLOW);
     gfx.print("Press button to go back");
 }
 
+// ==================== Browse Functions ====================
+void enterBrowse() {
+    lockSD();
+    openThumbCache();
+    unlockSD();
+    
+    browseSelected = currentImageIndex;
+    browsePage = -1;
+    showBrowsePage();
+}
+
+void showBrowsePage() {
+    if (imageFiles.empty()) return;
+    if (browseSelected >= imageFiles.size()) browseSelected = imageFiles.size() - 1;
+    
+    browsePage = browseSelected / BROWSE_PAGE_SIZE;
+    int pageCount = (imageFiles.size() + BROWSE_PAGE_SIZE - 1) / BROWSE_PAGE_SIZE;
+    unsigned long pageStart = millis();
+    
+    gfx.fillScreen(BLACK);
+    
+    // Title
+    gfx.setCursor(20, 20);
+    gfx.setTextSize(2);
+    gfx.setTextColor(CYAN);
+    gfx.printf("Browse  %d/%d", browsePage + 1, pageCount);
+    
+    // Thumbnails
+    lockSD();
+    int first = browsePage * BROWSE_PAGE_SIZE;
+    for (int i = 0; i < BROWSE_PAGE_SIZE && first + i < imageFiles.size(); i++) {
+        int x = (i % BROWSE_COLUMNS) * BROWSE_CELL + (BROWSE_CELL - THUMB_SIZE) / 2;
+        int y = BROWSE_TOP + (i / BROWSE_COLUMNS) * BROWSE_CELL + (BROWSE_CELL - THUMB_SIZE) / 2;
+        
+        if (!drawThumbnail(imageFiles[first + i], x, y)) {
+            gfx.drawRect(x, y, THUMB_SIZE, THUMB_SIZE, DARKGREY);
+            gfx.setCursor(x + 40, y + 50);
+            gfx.setTextSize(1);
+            gfx.setTextColor(RED);
+            gfx.print("Error");
+        }
+    }
+    unlockSD();
+    
+    drawBrowseSelection(browseSelected, YELLOW);
+    
+    // Instructions
+    gfx.setCursor(20, 785);
+    gfx.setTextSize(1);
+    gfx.setTextColor(YELLOW);
+    gfx.print("Short: Show photo  Long: Next");
+    
+    LOG_I("Browse page %d drawn in %lu ms\n", browsePage + 1, millis() - pageStart);
+}
+
+void drawBrowseSelection(int index, uint16_t color) {
+    int slot = index % BROWSE_PAGE_SIZE;
+    int x = (slot % BROWSE_COLUMNS) * BROWSE_CELL + 1;
+    int y = BROWSE_TOP + (slot / BROWSE_COLUMNS) * BROWSE_CELL + 1;
+    
+    gfx.drawRect(x, y, BROWSE_CELL - 2, BROWSE_CELL - 2, color);
+    gfx.drawRect(x + 1, y + 1, BROWSE_CELL - 4, BROWSE_CELL - 4, color);
+}
+
+void moveBrowseSelection(int direction) {
+    if (imageFiles.empty()) return;
+    
+    int previous = browseSelected;
+    browseSelected = (browseSelected + direction + imageFiles.size()) % imageFiles.size();
+    
+    if (browseSelected / BROWSE_PAGE_SIZE != browsePage) {
+        showBrowsePage();
+    } else {
+        drawBrowseSelection(previous, BLACK);
+        drawBrowseSelection(browseSelected, YELLOW);
+    }
+}
+
 void exitToSlideshow() {
     currentState = STATE_SLIDESHOW;
     
     if (!imageFiles.empty()) {
         displayImage(currentImageIndex);
-        Serial.println("Exited to slideshow");
+        LOG_I("Exited to slideshow\n");
     } else {
         gfx.fillScreen(BLACK);
         gfx.setCursor(100, 350);
@@ -943,7 +1954,7 @@ void exitToSlideshow() {
         gfx.setCursor(80, 400);
         gfx.setTextSize(1);
         gfx.setTextColor(YELLOW);
-        gfx.print("Please add JPEG images to SD card");
+        gfx.print("Please add JPEG, PNG or BMP images to SD card");
     }
 }
 
@@ -962,7 +1973,7 @@ void adjustInterval(int direction) {
     // Update display
     showIntervalSetting();
     
-    Serial.printf("Interval changed to: %lu ms\n", slideshowInterval);
+    LOG_I("Interval changed to: %lu ms\n", slideshowInterval);
 }
 
 void adjustBrightness(int direction) {
@@ -973,29 +1984,35 @@ void adjustBrightness(int direction) {
     
     if (newBrightness != currentBrightness) {
         currentBrightness = newBrightness;
-        set_brightness(currentBrightness);
+        backlightSetCeiling(currentBrightness);
         saveBrightnessToSD();
         
         // Update display
         showBrightnessSetting();
         
-        Serial.printf("Brightness changed to: %d\n", currentBrightness);
+        LOG_I("Brightness changed to: %d\n", currentBrightness);
     }
 }
 
 // ==================== Setup ====================
 void setup() {
-    Serial.begin(115200);
-    delay(1000);
-    
-    Serial.println("\n" + String(60, '='));
-    Serial.println("ESP32 Photo Frame - Standalone Version");
-    Serial.println("No Wi-Fi / No Web Interface");
-    Serial.println("Intervals: 5s, 30s, 1m, 5m, 15m, 30m, 60m");
-    Serial.println("Short press: Open menu / Select");
-    Serial.println("Long press: Change interval / Navigate");
-    Serial.println("Menu auto-close: 10s, Settings auto-close: 5s");
-    Serial.println(String(60, '='));
+    // Room for a whole upload window while the loop is busy
+    Serial.setRxBufferSize(UPLOAD_RX_BUFFER);
+    Serial.begin(SERIAL_BAUD);
+    logBegin();
+    // Before anything else can fragment the PSRAM
+    budgetBegin();
+    bootMark("serial");
+    
+    LOG_I("\n============================================================\n");
+    LOG_I("ESP32 Photo Frame - Standalone Version\n");
+    LOG_I("No Wi-Fi / No Web Interface\n");
+    LOG_I("Intervals: 5s, 30s, 1m, 5m, 15m, 30m, 60m\n");
+    LOG_I("Short press: Open menu / Select\n");
+    LOG_I("Long press: Change interval / Navigate\n");
+    LOG_I("Touch: tap / hold as above, swipe for next / previous photo\n");
+    LOG_I("Menu auto-close: 10s, Settings auto-close: 5s\n");
+    LOG_I("============================================================\n");
     
     randomSeed(micros());
     
@@ -1004,44 +2021,85 @@ void setup() {
     
     // Initialize display
     setup_display();
-    gfx.setRotation(1);
-    
-    // Show initial loading screen
-    showLoadingScreen("Starting...");
-    delay(500);
+    gfx.setRotation(DISPLAY_ROTATION);
+    bootMark("display");
     
-    // Initialize JPG decoder
-    TJpgDec.setCallback(tft_output);
-    
-    // Try to initialize SD card
+    // Mount the card and put the last photo back up before anything else;
+    // settings, albums and indexes load behind it
     bool sdInitialized = initSDCard();
+    bootMark("sd mount");
     
+    ImageEntry lastFrame;
+    bool lastFrameShown = false;
     if (sdInitialized) {
+        loadBrightnessFromSD();
+        lastFrameShown = showLastFrame(lastFrame);
+        if (lastFrameShown) {
+            bootFirstPhoto();
+        }
+    }
+    if (!lastFrameShown) {
+        showLoadingScreen("Starting...");
+    }
+
+#if TOUCH_ENABLED
+    touchBegin();
+#endif
+
+    // Core 0 helper for Ken Burns frames
+    if (!kenBurnsBegin()) {
+        LOG_W("Motion unavailable on this display\n");
+    }
+    
+    if (sdInitialized) {
+        loadSettingsFromSD();
+        bootMark("settings");
+        
         // Find images
         findImageFiles();
-        debugFileList();
+        if (LOG_LEVEL >= LOG_LEVEL_DEBUG) {
+            debugFileList();
+        }
+        bootMark("albums");
         
         if (!imageFiles.empty()) {
-            initRandomSlideshow();
-            
-            // Finalize loading
-            updateLoadingProgress(1.0, "Ready!");
-            delay(500);
-            hideLoadingScreen();
+            // The album may have brought back its saved shuffle order
+            if (shuffledIndices.size() != imageFiles.size()) {
+                initRandomSlideshow();
+            }
             
-            // Start slideshow
-            int firstImageIndex = shuffledIndices[currentShuffleIndex];
-            displayImage(firstImageIndex);
-            currentShuffleIndex++;
+            // The photo from the last session stays up as the first slide,
+            // and capture order resumes after it
+            int lastIndex = lastFrameShown ? findImageIndex(lastFrame.path) : -1;
+            bool keepLastFrame = lastIndex >= 0 && !motionEnabled;
+            // Cached while the screen holds only the photo; a sort below
+            // draws its message over it
+            if (keepLastFrame) frameCacheStore(lastFrame.path, photoBacklight);
+            datedHint = max(lastIndex, 0);
+            syncDatePlaylist(lastIndex);
+            if (keepLastFrame) {
+                currentImageIndex = lastIndex;
+                recordHistory(lastFrame.path);
+                lastImageChange = millis();
+            } else if (lastIndex >= 0) {
+                displayImage(lastIndex);
+            } else {
+                updateLoadingProgress(1.0, "Ready!");
+                if (showingLoading) {
+                    hideLoadingScreen();
+                }
+                showNextImage();
+            }
+            bootFirstPhoto();
             
-            Serial.println("\nSlideshow started!");
-            Serial.printf("Total images: %d\n", imageFiles.size());
+            LOG_I("\nSlideshow started!\n");
+            LOG_I("Total images: %d\n", imageFiles.size());
             
             // SD card info
             uint64_t totalSpace = SD.cardSize();
             uint64_t usedSpace = SD.usedBytes();
             uint64_t freeSpace = totalSpace - usedSpace;
-            Serial.printf("SD Card: Total=%s, Used=%s, Free=%s\n", 
+            LOG_I("SD Card: Total=%s, Used=%s, Free=%s\n", 
                 formatBytes(totalSpace).c_str(),
                 formatBytes(usedSpace).c_str(),
                 formatBytes(freeSpace).c_str());
@@ -1053,17 +2111,20 @@ void setup() {
             } else {
                 intervalStr = String(slideshowInterval / 60000) + " minutes";
             }
-            Serial.printf("Interval: %s\n", intervalStr.c_str());
-            Serial.printf("Brightness: %d/255\n", currentBrightness);
+            LOG_I("Interval: %s\n", intervalStr.c_str());
+            LOG_I("Brightness: %d/255\n", currentBrightness);
         } else {
-            errorMessage = "No JPEG images found on SD card";
+            errorMessage = "No images found on SD card";
             fatalError = true;
-            Serial.println("\nERROR: " + errorMessage);
+            LOG_E("\nERROR: %s\n", errorMessage.c_str());
         }
+        
+        // Pick up files added or removed while running
+        startLibraryRefresh();
     } else {
         errorMessage = "SD card initialization failed";
         fatalError = true;
-        Serial.println("\nERROR: " + errorMessage);
+        LOG_E("\nERROR: %s\n", errorMessage.c_str());
     }
     
     // Show error if any
@@ -1090,23 +2151,85 @@ void setup() {
     if (showingLoading) {
         hideLoadingScreen();
     }
+    
+    bootMark("setup");
+    printBootProfile();
 }
 
 // ==================== Loop ====================
 void loop() {
     processButtonInput();
+    processTouchInput();
+    
+    // Memory telemetry; 'm' on Serial dumps the sample history, 'k' the
+    // Ken Burns frame rate and load, 'b' times the blit path per rotation,
+    // 'j' times every JPEG in the album on one and two cores, 'p' the boot
+    // phases, 'c' the stages of the last clip. An upload frame starts with
+    // a byte no command uses.
+    memStatsPoll();
+    if (Serial.available()) {
+        int command = Serial.read();
+        if (command == 'm') {
+            printMemStats(true);
+        } else if (command == 'k') {
+            printKenBurnsStats();
+        } else if (command == 'p') {
+            printBootProfile();
+        } else if (command == 'c') {
+            printClipStats();
+        } else if (command == 'j' && currentState == STATE_SLIDESHOW) {
+            lockSD();
+            for (size_t i = 0; i < imageFiles.size(); i++) {
+                jpegBenchmark(imageFiles[i].path.c_str());
+            }
+            unlockSD();
+        } else if (command == UPLOAD_SYNC) {
+            runUploadSession();
+        } else if (command == 'b' && currentState == STATE_SLIDESHOW) {
+            clipStop();
+            runBlitBenchmark();
+            gfx.fillScreen(BLACK);
+            if (!imageFiles.empty()) displayImage(currentImageIndex);
+        }
+    }
+    
+    // Merge results of the background rescan
+    if (applyLibraryChanges()) {
+        // A changed file keeps its path, so cached frames may be stale
+        frameCacheClear();
+        prefetchFailed = "";
+        datePlaylistStale = true;
+        if (fatalError && !imageFiles.empty()) {
+            // Images appeared on a card that had none
+            fatalError = false;
+            errorMessage = "";
+            if (currentState == STATE_SLIDESHOW) {
+                showNextImage();
+            }
+        } else if (imageFiles.empty() && (currentState == STATE_SLIDESHOW || currentState == STATE_BROWSE)) {
+            closeThumbCache();
+            exitToSlideshow();
+        } else if (currentState == STATE_BROWSE) {
+            // Indices may have shifted under the grid
+            showBrowsePage();
+        }
+    }
     
     // Handle messages
     if (showingMessage && (millis() - messageStartTime >= MESSAGE_DURATION)) {
         hideMessage();
     }
     
-    // Handle slideshow
+    // Handle slideshow; a clip plays out before the next slide
+    clipPoll();
     if (!fatalError && currentState == STATE_SLIDESHOW && !imageFiles.empty() && !showingMessage) {
-        if (millis() - lastImageChange >= slideshowInterval) {
-            int nextImageIndex = getNextRandomImage();
-            displayImage(nextImageIndex);
+        if (millis() - lastImageChange >= slideshowInterval && !clipPlaying()) {
+            showNextImage();
+        } else if (millis() - lastImageChange >= PREFETCH_DELAY) {
+            prefetchNextImage();
         }
+        saveLastFrame(false);
+        kenBurnsPoll();
     }
     
     delay(10);
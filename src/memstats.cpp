@@ -0,0 +1,120 @@
+#include "memstats.h"
+#include "config.h"
+#include "budget.h"
+#include <esp_heap_caps.h>
+
+// ==================== State ====================
+static MemSample memRing[MEMSTAT_RING_SIZE];
+static int memRingHead = 0;   // Next slot to write
+static int memRingCount = 0;
+static unsigned long lastMemSample = 0;
+
+static MemSubsystemStats subsystemStats[MEM_SUBSYSTEM_COUNT];
+static const char* subsystemNames[MEM_SUBSYSTEM_COUNT] = {"scan", "decode", "ui", "cache"};
+
+// ==================== Scopes ====================
+MemScope::MemScope(MemSubsystem s) : subsystem(s) {
+    startFree = heap_caps_get_free_size(MALLOC_CAP_8BIT);
+    startArena = arenaMark(ARENA_DECODE);
+    outerWatch = arenaWatchStart(ARENA_DECODE);
+}
+
+MemScope::~MemScope() {
+    int32_t drop = (int32_t)startFree - (int32_t)heap_caps_get_free_size(MALLOC_CAP_8BIT);
+    uint32_t arena = arenaWatchStop(ARENA_DECODE, outerWatch) - startArena;
+    
+    MemSubsystemStats& stats = subsystemStats[subsystem];
+    stats.calls++;
+    if (arena > stats.arenaPeak) stats.arenaPeak = arena;
+    stats.heapNet += drop;
+    if (drop > stats.heapMaxDrop) stats.heapMaxDrop = drop;
+}
+
+// ==================== Sampling ====================
+static void sampleRegion(uint32_t caps, MemRegionSample& region) {
+    region.freeBytes = heap_caps_get_free_size(caps);
+    region.minFreeBytes = heap_caps_get_minimum_free_size(caps);
+    region.largestBlock = heap_caps_get_largest_free_block(caps);
+}
+
+void takeMemSample(MemSample& sample) {
+    sample.uptime = millis() / 1000;
+    sampleRegion(MALLOC_CAP_INTERNAL, sample.internal);
+    sampleRegion(MALLOC_CAP_SPIRAM, sample.psram);
+}
+
+void memStatsPoll() {
+    unsigned long now = millis();
+    if (memRingCount > 0 && now - lastMemSample < MEMSTAT_SAMPLE_INTERVAL) return;
+    lastMemSample = now;
+    
+    takeMemSample(memRing[memRingHead]);
+    memRingHead = (memRingHead + 1) % MEMSTAT_RING_SIZE;
+    if (memRingCount < MEMSTAT_RING_SIZE) memRingCount++;
+    
+    printMemStats(false);
+}
+
+// ==================== Accessors ====================
+int memSampleCount() {
+    return memRingCount;
+}
+
+const MemSample& memSampleAt(int age) {
+    if (age >= memRingCount) age = memRingCount - 1;
+    if (age < 0) age = 0;
+    return memRing[(memRingHead - 1 - age + 2 * MEMSTAT_RING_SIZE) % MEMSTAT_RING_SIZE];
+}
+
+const MemSubsystemStats& memSubsystemStats(MemSubsystem subsystem) {
+    return subsystemStats[subsystem];
+}
+
+const char* memSubsystemName(MemSubsystem subsystem) {
+    return subsystemNames[subsystem];
+}
+
+int32_t memTrendPerHour() {
+    if (memRingCount < 2) return 0;
+    
+    const MemSample& newest = memSampleAt(0);
+    const MemSample& oldest = memSampleAt(memRingCount - 1);
+    uint32_t elapsed = newest.uptime - oldest.uptime;
+    if (elapsed == 0) return 0;
+    
+    int64_t delta = (int64_t)newest.internal.freeBytes - oldest.internal.freeBytes;
+    return (int32_t)(delta * 3600 / elapsed);
+}
+
+// ==================== Serial Report ====================
+void printMemStats(bool history) {
+    MemSample sample;
+    takeMemSample(sample);
+    
+    Serial.printf("MEM t=%lus int free=%lu min=%lu big=%lu | psram free=%lu min=%lu big=%lu | trend=%ld B/h\n",
+                  (unsigned long)sample.uptime,
+                  (unsigned long)sample.internal.freeBytes, (unsigned long)sample.internal.minFreeBytes,
+                  (unsigned long)sample.internal.largestBlock,
+                  (unsigned long)sample.psram.freeBytes, (unsigned long)sample.psram.minFreeBytes,
+                  (unsigned long)sample.psram.largestBlock,
+                  (long)memTrendPerHour());
+    
+    for (int i = 0; i < MEM_SUBSYSTEM_COUNT; i++) {
+        const MemSubsystemStats& stats = subsystemStats[i];
+        Serial.printf("MEM %-6s calls=%lu arena=%lu heap net=%ld max=%ld\n", subsystemNames[i],
+                      (unsigned long)stats.calls, (unsigned long)stats.arenaPeak,
+                      (long)stats.heapNet, (long)stats.heapMaxDrop);
+    }
+    printBudget();
+    
+    if (!history) return;
+    
+    for (int age = memRingCount - 1; age >= 0; age--) {
+        const MemSample& past = memSampleAt(age);
+        Serial.printf("MEM @%lus int %lu/%lu/%lu psram %lu/%lu/%lu\n", (unsigned long)past.uptime,
+                      (unsigned long)past.internal.freeBytes, (unsigned long)past.internal.minFreeBytes,
+                      (unsigned long)past.internal.largestBlock,
+                      (unsigned long)past.psram.freeBytes, (unsigned long)past.psram.minFreeBytes,
+                      (unsigned long)past.psram.largestBlock);
+    }
+}
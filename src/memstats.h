@@ -0,0 +1,60 @@
+#ifndef MEMSTATS_H
+#define MEMSTATS_H
+
+#include <Arduino.h>
+
+// ==================== Memory Telemetry ====================
+// Per-region heap samples kept in a ring buffer, plus per-subsystem counters
+// for each tracked operation: the decode arena it used, and how much the
+// free heap dropped across it (a growing net value means something is
+// leaking or fragmenting the heap).
+enum MemSubsystem {
+    MEM_SCAN,
+    MEM_DECODE,
+    MEM_UI,
+    MEM_CACHE,
+    MEM_SUBSYSTEM_COUNT
+};
+
+struct MemRegionSample {
+    uint32_t freeBytes;
+    uint32_t minFreeBytes;
+    uint32_t largestBlock;
+};
+
+struct MemSample {
+    uint32_t uptime;  // Seconds
+    MemRegionSample internal;
+    MemRegionSample psram;
+};
+
+struct MemSubsystemStats {
+    uint32_t calls;
+    uint32_t arenaPeak;    // Most decode arena one call held beyond what was in use at its start
+    int32_t heapNet;       // Free heap at the start less at the end, summed over calls
+    int32_t heapMaxDrop;   // Largest such drop across a single call
+};
+
+// Tracks one operation on the loop task. The decode arena is only used
+// there, so its peak is the operation's own. The free-heap change is not:
+// it includes what other tasks allocated meanwhile, and only what the
+// operation kept, not what it allocated and freed.
+struct MemScope {
+    MemScope(MemSubsystem subsystem);
+    ~MemScope();
+    MemSubsystem subsystem;
+    uint32_t startFree;
+    uint32_t startArena;
+    uint32_t outerWatch;
+};
+
+void memStatsPoll();
+void takeMemSample(MemSample& sample);
+int memSampleCount();
+const MemSample& memSampleAt(int age);  // 0 = newest
+const MemSubsystemStats& memSubsystemStats(MemSubsystem subsystem);
+const char* memSubsystemName(MemSubsystem subsystem);
+int32_t memTrendPerHour();  // Internal free heap change, bytes per hour
+void printMemStats(bool history = false);
+
+#endif // MEMSTATS_H
@@ -0,0 +1,640 @@
+#include "mjpeg.h"
+#include "config.h"
+#include "display.h"
+#include "decoder.h"
+#include "jpeg.h"
+#include "library.h"
+#include "log.h"
+#include "budget.h"
+#include <SD.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/queue.h>
+#include <freertos/semphr.h>
+
+#define CLIP_STAGES 3
+#define CLIP_EXTENSIONS ".avi.mjpg.mjpeg"
+#define AVI_PEEK 8          // Header of the next chunk, read along with a frame
+#define PACKET_BYTES ((MJPEG_MAX_FRAME_BYTES + 1 + AVI_PEEK + 15) & ~15UL)
+
+static_assert(MJPEG_READ_BUFFERS * PACKET_BYTES + MJPEG_READ_CHUNK <= FRAME_PIXELS * sizeof(uint16_t),
+              "MJPEG read buffers must fit in one frame slot");
+
+// ==================== Buffers ====================
+struct ClipPacket {
+    uint8_t* data;
+    uint32_t length;        // 0 marks the end of the clip
+    uint32_t index;         // Frame number in the clip
+};
+
+struct ClipFrame {
+    uint16_t* pixels;
+    uint32_t index;
+};
+
+static ClipPacket packets[MJPEG_READ_BUFFERS];
+static ClipFrame frames[MJPEG_FRAME_BUFFERS];
+static uint8_t* chunk = NULL;               // Raw streams: bytes read ahead of the frame split off
+
+// Free buffers go upstream, filled ones downstream; a NULL frame ends the clip
+static QueueHandle_t freePackets = NULL;
+static QueueHandle_t fullPackets = NULL;
+static QueueHandle_t freeFrames = NULL;
+static QueueHandle_t fullFrames = NULL;
+
+// ==================== Session State ====================
+static ClipStats stats = {};
+static bool session = false;                // Buffers and file held
+static bool pipelineRunning = false;        // Stages started on this session
+static volatile bool playing = false;
+static volatile bool stopping = false;
+static unsigned long playStart = 0;
+static unsigned long timelineStart = 0;     // Slot of frame n is timelineStart + n periods
+
+static uint8_t clipOrientation = 1;
+static int16_t offsetX = 0;
+static int16_t offsetY = 0;
+
+static TaskHandle_t readerHandle = NULL;
+static TaskHandle_t decoderHandle = NULL;
+static TaskHandle_t presenterHandle = NULL;
+static SemaphoreHandle_t stagesIdle = NULL;
+
+// How far past its slot frame index is now; negative while it is early
+static long lateMicros(uint32_t index) {
+    return (long)(micros() - (timelineStart + index * stats.periodMicros));
+}
+
+static void setPeriod(uint32_t usPerFrame) {
+    stats.periodMicros = usPerFrame ? max<uint32_t>(usPerFrame, 1000000UL / MJPEG_MAX_FPS)
+                                    : 1000000UL / MJPEG_DEFAULT_FPS;
+}
+
+// ==================== Container ====================
+enum ClipFormat {
+    CLIP_RAW,
+    CLIP_AVI
+};
+
+static File clipFile;
+static ClipFormat format = CLIP_RAW;
+
+// AVI: walk position, and the header of the chunk there once it is read
+static uint32_t chunkPos = 0;
+static uint32_t fileEnd = 0;
+static uint8_t chunkHeader[8];
+static bool headerRead = false;
+
+// Raw: chunk[chunkStart, chunkEnd) not yet split off
+static uint32_t chunkStart = 0;
+static uint32_t chunkEnd = 0;
+
+static uint32_t le32(const uint8_t* p) {
+    return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static bool readAt(uint32_t pos, uint8_t* buf, uint32_t length) {
+    lockSD();
+    bool ok = clipFile.seek(pos) && clipFile.read(buf, length) == length;
+    unlockSD();
+    return ok;
+}
+
+static size_t readNext(uint8_t* buf, size_t length) {
+    lockSD();
+    size_t n = clipFile.read(buf, length);
+    unlockSD();
+    return n;
+}
+
+// Finds the next video frame chunk. Lists are entered only where frames
+// or the main header live; every other chunk is stepped over unread.
+static bool nextAviFrame(uint32_t& offset, uint32_t& length) {
+    while (chunkPos + 8 <= fileEnd) {
+        if (!headerRead && !readAt(chunkPos, chunkHeader, 8)) return false;
+        headerRead = false;
+        const char* id = (const char*)chunkHeader;
+        uint32_t size = le32(chunkHeader + 4);
+        
+        if (!memcmp(id, "RIFF", 4) || !memcmp(id, "LIST", 4)) {
+            char type[4];
+            if (!readAt(chunkPos + 8, (uint8_t*)type, 4)) return false;
+            if (!memcmp(type, "AVI ", 4) || !memcmp(type, "AVIX", 4) || !memcmp(type, "hdrl", 4) ||
+                !memcmp(type, "movi", 4) || !memcmp(type, "rec ", 4)) {
+                chunkPos += 12;
+                continue;
+            }
+        }
+        // A chunk running past the end is a truncated file
+        if (size > fileEnd - chunkPos - 8) return false;
+        
+        if (!memcmp(id, "avih", 4) && size >= 4) {
+            uint8_t usPerFrame[4];
+            if (readAt(chunkPos + 8, usPerFrame, 4)) setPeriod(le32(usPerFrame));
+        } else if (id[2] == 'd' && (id[3] == 'c' || id[3] == 'b')) {
+            offset = chunkPos + 8;
+            length = size;
+            chunkPos = offset + size + (size & 1);
+            return true;
+        }
+        chunkPos += 8 + size + (size & 1);
+    }
+    return false;
+}
+
+static bool readAviFrame(ClipPacket& packet, uint32_t offset, uint32_t length) {
+    uint32_t pad = length & 1;
+    bool peek = chunkPos + AVI_PEEK <= fileEnd;
+    if (!readAt(offset, packet.data, length + pad + (peek ? AVI_PEEK : 0))) return false;
+    if (peek) {
+        memcpy(chunkHeader, packet.data + length + pad, AVI_PEEK);
+        headerRead = true;
+    }
+    packet.length = length;
+    return true;
+}
+
+// Splits the next SOI..EOI frame off a raw stream into out. Returns its
+// length, 0 at the end of the stream; tooLarge is set for a frame longer
+// than room, which is read through but not kept.
+static uint32_t nextRawFrame(uint8_t* out, uint32_t room, bool& tooLarge) {
+    uint32_t length = 0;
+    bool started = false;
+    uint8_t prev = 0;       // Last byte of the previous chunk, for markers split across two
+    tooLarge = false;
+    
+    while (true) {
+        if (chunkStart == chunkEnd) {
+            chunkStart = 0;
+            chunkEnd = readNext(chunk, MJPEG_READ_CHUNK);
+            // A frame cut short by the end of the file is dropped
+            if (chunkEnd == 0) return 0;
+        }
+        const uint8_t* p = chunk + chunkStart;
+        uint32_t n = chunkEnd - chunkStart;
+        uint32_t used = n;
+        
+        if (!started) {
+            // Anything between frames is skipped
+            for (uint32_t i = 0; i < n; i++) {
+                if (prev == 0xFF && p[i] == 0xD8) {
+                    started = true;
+                    out[0] = 0xFF;
+                    out[1] = 0xD8;
+                    length = 2;
+                    used = i + 1;
+                    break;
+                }
+                prev = p[i];
+            }
+            if (started) prev = 0;
+            chunkStart += used;
+            continue;
+        }
+        
+        // Entropy data stuffs every FF it holds, so the first FF D9 is EOI
+        const uint8_t* end = prev == 0xFF && p[0] == 0xD9 ? p : NULL;
+        const uint8_t* q = p;
+        while (!end) {
+            const uint8_t* ff = (const uint8_t*)memchr(q, 0xFF, p + n - q);
+            if (!ff || ff + 1 >= p + n) break;
+            if (ff[1] == 0xD9) end = ff + 1;
+            q = ff + 1;
+        }
+        if (end) used = end - p + 1;
+        
+        if (length + used > room) tooLarge = true;
+        if (!tooLarge) memcpy(out + length, p, used);
+        length += used;
+        chunkStart += used;
+        if (end) return length;
+        prev = p[n - 1];
+    }
+}
+
+// Reads the next frame that can still make its slot. False at the end of
+// the clip.
+static bool readPacket(ClipPacket& packet) {
+    while (true) {
+        uint32_t index = stats.frames;
+        bool late = pipelineRunning && lateMicros(index) > 0;
+        
+        if (format == CLIP_AVI) {
+            uint32_t offset, length;
+            if (!nextAviFrame(offset, length)) return false;
+            // An empty chunk repeats the frame before
+            stats.frames++;
+            if (length == 0) continue;
+            // Skipping costs a seek, where a raw stream has to be read
+            if (late || length > MJPEG_MAX_FRAME_BYTES) {
+                stats.read.dropped++;
+                continue;
+            }
+            if (!readAviFrame(packet, offset, length)) return false;
+        } else {
+            bool tooLarge;
+            uint32_t length = nextRawFrame(packet.data, MJPEG_MAX_FRAME_BYTES, tooLarge);
+            if (length == 0) return false;
+            stats.frames++;
+            if (tooLarge) {
+                stats.read.dropped++;
+                continue;
+            }
+            packet.length = length;
+        }
+        packet.index = index;
+        return true;
+    }
+}
+
+static int openClip(const char* path) {
+    lockSD();
+    clipFile = SD.open(path, FILE_READ);
+    unlockSD();
+    if (!clipFile) return DECODE_READ_ERROR;
+    
+    uint8_t magic[12];
+    if (!readAt(0, magic, sizeof(magic))) return DECODE_READ_ERROR;
+    setPeriod(0);
+    
+    if (!memcmp(magic, "RIFF", 4) && !memcmp(magic + 8, "AVI ", 4)) {
+        format = CLIP_AVI;
+        fileEnd = clipFile.size();
+        chunkPos = 0;
+        headerRead = false;
+    } else if (magic[0] == 0xFF && magic[1] == 0xD8) {
+        format = CLIP_RAW;
+        chunkStart = chunkEnd = 0;
+        lockSD();
+        clipFile.seek(0);
+        unlockSD();
+    } else {
+        return DECODE_UNSUPPORTED;
+    }
+    return DECODE_OK;
+}
+
+// ==================== Decode ====================
+static uint16_t clipBlock[16 * 16];
+
+static bool clipSink(void* ctx, int16_t x, int16_t y, uint16_t w, uint16_t h, const uint8_t* rgb) {
+    LumaHistogram* luma = (LumaHistogram*)ctx;
+#if JPEG_DITHER
+    rgb888ToRgb565Dither(rgb, clipBlock, w, h, x, y, luma);
+#else
+    rgb888ToRgb565(rgb, clipBlock, w, h, luma);
+#endif
+    return oriented_output(x, y, w, h, clipBlock);
+}
+
+static int decodeFrame(ClipFrame& frame, const ClipPacket& packet, LumaHistogram* luma) {
+    if (!setBlitTarget(frame.pixels)) return DECODE_NO_MEMORY;
+    setBlitTransform(clipOrientation, stats.width >> stats.scale, stats.height >> stats.scale, offsetX, offsetY);
+    int res = jpegDecodeBuffer(packet.data, packet.length, stats.scale, clipSink, luma);
+    flushBlit();
+    setBlitTarget(NULL);
+    // Output stopping at the screen edge is not an error
+    return res == DECODE_INTERRUPTED ? DECODE_OK : res;
+}
+
+// Centres the clip as it appears after rotation, reduced until the
+// whole frame fits the screen; that also bounds the decode time
+static void layoutFrames(uint8_t orientation) {
+    clipOrientation = orientation;
+    bool transposed = orientation >= 5;
+    uint16_t shownWidth = transposed ? stats.height : stats.width;
+    uint16_t shownHeight = transposed ? stats.width : stats.height;
+    
+    stats.scale = 0;
+    while (stats.scale < 3 && ((shownWidth >> stats.scale) > 480 || (shownHeight >> stats.scale) > 800)) {
+        stats.scale++;
+    }
+    shownWidth >>= stats.scale;
+    shownHeight >>= stats.scale;
+    offsetX = (480 - (int16_t)shownWidth) / 2;
+    offsetY = (800 - (int16_t)shownHeight) / 2;
+    
+    // Frames only ever cover the same area, so the bars are cleared once
+    if (shownWidth < 480 || shownHeight < 800) {
+        for (int i = 0; i < MJPEG_FRAME_BUFFERS; i++) {
+            setBlitTarget(frames[i].pixels);
+            fillBlitTarget(BLACK);
+        }
+        setBlitTarget(NULL);
+    }
+}
+
+// ==================== Stages ====================
+// Next buffer from queue, adding any wait to wait when given. False once
+// the clip is stopping.
+static bool take(QueueHandle_t queue, void* item, ClipWait* wait) {
+    if (xQueueReceive(queue, item, 0) == pdTRUE) return true;
+    
+    unsigned long start = micros();
+    bool got = false;
+    while (!stopping && !got) {
+        got = xQueueReceive(queue, item, pdMS_TO_TICKS(MJPEG_WAIT_SLICE_MS)) == pdTRUE;
+    }
+    if (wait) {
+        wait->count++;
+        wait->micros += micros() - start;
+    }
+    return got;
+}
+
+static void runReader() {
+    while (!stopping) {
+        ClipPacket* packet;
+        if (!take(freePackets, &packet, &stats.read.blocked)) break;
+        
+        unsigned long start = micros();
+        bool more = readPacket(*packet);
+        stats.read.busyMicros += micros() - start;
+        
+        if (!more) packet->length = 0;
+        xQueueSend(fullPackets, &packet, 0);
+        if (!more) break;
+    }
+}
+
+static void runDecoder() {
+    while (!stopping) {
+        ClipPacket* packet;
+        if (!take(fullPackets, &packet, &stats.decode.starved)) break;
+        if (packet->length == 0) {
+            ClipFrame* end = NULL;
+            xQueueSend(fullFrames, &end, 0);
+            break;
+        }
+        
+        // Behind its slot with a newer frame already read: catch up instead
+        uint32_t index = packet->index;
+        ClipPacket* next;
+        if (lateMicros(index) > 0 && xQueuePeek(fullPackets, &next, 0) == pdTRUE && next->length > 0) {
+            stats.decode.dropped++;
+            xQueueSend(freePackets, &packet, 0);
+            continue;
+        }
+        
+        ClipFrame* frame;
+        if (!take(freeFrames, &frame, &stats.decode.blocked)) break;
+        
+        unsigned long start = micros();
+        int res = decodeFrame(*frame, *packet, NULL);
+        stats.decode.busyMicros += micros() - start;
+        xQueueSend(freePackets, &packet, 0);
+        
+        if (res == DECODE_OK) {
+            frame->index = index;
+            xQueueSend(fullFrames, &frame, 0);
+        } else {
+            stats.corrupt++;
+            xQueueSend(freeFrames, &frame, 0);
+        }
+    }
+}
+
+static void runPresenter() {
+    while (!stopping) {
+        ClipFrame* frame;
+        unsigned long waitStart = micros();
+        if (!take(fullFrames, &frame, NULL) || !frame) break;
+        
+        // Waiting is only a stall once the frame's slot has passed
+        long late = lateMicros(frame->index);
+        uint32_t starved = min<uint32_t>(micros() - waitStart, max(0L, late));
+        if (starved > 0) {
+            stats.present.starved.count++;
+            stats.present.starved.micros += starved;
+        }
+        
+        while (!stopping && lateMicros(frame->index) < -1000) {
+            vTaskDelay(1);
+        }
+        if (stopping) break;
+        
+        unsigned long start = micros();
+        if (lateMicros(frame->index) >= (long)stats.periodMicros) stats.late++;
+        showFrame(frame->pixels);
+        stats.present.busyMicros += micros() - start;
+        stats.shown++;
+        xQueueSend(freeFrames, &frame, 0);
+    }
+    
+    stats.micros = micros() - playStart;
+    playing = false;
+}
+
+static void stageTask(void* parameter) {
+    void (*run)() = (void (*)())parameter;
+    for (;;) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        run();
+        xSemaphoreGive(stagesIdle);
+    }
+}
+
+static bool startStages() {
+    if (stagesIdle) return true;
+    
+    freePackets = xQueueCreate(MJPEG_READ_BUFFERS, sizeof(ClipPacket*));
+    fullPackets = xQueueCreate(MJPEG_READ_BUFFERS, sizeof(ClipPacket*));
+    freeFrames = xQueueCreate(MJPEG_FRAME_BUFFERS, sizeof(ClipFrame*));
+    fullFrames = xQueueCreate(MJPEG_FRAME_BUFFERS + 1, sizeof(ClipFrame*));   // And the end marker
+    if (!freePackets || !fullPackets || !freeFrames || !fullFrames) return false;
+    
+    xTaskCreatePinnedToCore(stageTask, "clipRead", MJPEG_TASK_STACK, (void*)runReader,
+                            MJPEG_TASK_PRIORITY, &readerHandle, MJPEG_READ_CORE);
+    xTaskCreatePinnedToCore(stageTask, "clipDecode", MJPEG_TASK_STACK, (void*)runDecoder,
+                            MJPEG_TASK_PRIORITY, &decoderHandle, MJPEG_DECODE_CORE);
+    xTaskCreatePinnedToCore(stageTask, "clipPresent", MJPEG_TASK_STACK, (void*)runPresenter,
+                            MJPEG_TASK_PRIORITY, &presenterHandle, MJPEG_PRESENT_CORE);
+    if (!readerHandle || !decoderHandle || !presenterHandle) return false;
+    
+    stagesIdle = xSemaphoreCreateCounting(CLIP_STAGES, 0);
+    return stagesIdle != NULL;
+}
+
+// ==================== Memory ====================
+static void release() {
+    if (clipFile) {
+        lockSD();
+        clipFile.close();
+        unlockSD();
+    }
+    // The packets and the chunk share the one slot at packets[0]
+    framePoolRelease(packets[0].data);
+    for (int i = 0; i < MJPEG_READ_BUFFERS; i++) {
+        packets[i].data = NULL;
+    }
+    for (int i = 0; i < MJPEG_FRAME_BUFFERS; i++) {
+        framePoolRelease(frames[i].pixels);
+        frames[i].pixels = NULL;
+    }
+    chunk = NULL;
+    
+    if (freePackets) {
+        xQueueReset(freePackets);
+        xQueueReset(fullPackets);
+        xQueueReset(freeFrames);
+        xQueueReset(fullFrames);
+    }
+    session = false;
+    pipelineRunning = false;
+    playing = false;
+}
+
+static bool allocate() {
+    // Every read buffer plus the raw-stream chunk fits in one frame slot
+    uint8_t* reads = (uint8_t*)framePoolTake(FRAME_OWNER_CLIP);
+    if (!reads) return false;
+    for (int i = 0; i < MJPEG_READ_BUFFERS; i++) {
+        packets[i].data = reads + i * PACKET_BYTES;
+    }
+    chunk = reads + MJPEG_READ_BUFFERS * PACKET_BYTES;
+    
+    for (int i = 0; i < MJPEG_FRAME_BUFFERS; i++) {
+        frames[i].pixels = framePoolTake(FRAME_OWNER_CLIP);
+        if (!frames[i].pixels) return false;
+    }
+    return true;
+}
+
+// ==================== Public API ====================
+bool isClipName(const String& filename) {
+    int dot = filename.lastIndexOf('.');
+    if (dot < 0) return false;
+    
+    String ext = filename.substring(dot);
+    ext.toLowerCase();
+    
+    // Match whole entries only, as isDecodableName() does
+    const char* found = strstr(CLIP_EXTENSIONS, ext.c_str());
+    while (found) {
+        char next = found[ext.length()];
+        if (next == '\0' || next == '.') return true;
+        found = strstr(found + 1, ext.c_str());
+    }
+    return false;
+}
+
+int clipBegin(const char* path, uint8_t orientation, LumaHistogram& luma) {
+    clipStop();
+    memset(&stats, 0, sizeof(stats));
+    session = true;
+    if (!startStages() || !allocate()) {
+        release();
+        return DECODE_NO_MEMORY;
+    }
+    
+    // The first frame goes up from this task, so a clip that cannot play
+    // fails here like a still
+    ClipPacket* packet = &packets[0];
+    ClipFrame* frame = &frames[0];
+    int res = openClip(path);
+    if (res == DECODE_OK && !readPacket(*packet)) res = DECODE_BAD_STRUCTURE;
+    if (res == DECODE_OK) res = jpegBufferSize(packet->data, packet->length, &stats.width, &stats.height);
+    if (res == DECODE_OK) {
+        layoutFrames(orientation);
+        res = decodeFrame(*frame, *packet, &luma);
+    }
+    if (res != DECODE_OK) {
+        release();
+        return res;
+    }
+    
+    showFrame(frame->pixels);
+    stats.shown = 1;
+    playStart = micros();
+    timelineStart = playStart + MJPEG_PREROLL_MS * 1000UL;
+    
+    for (int i = 0; i < MJPEG_READ_BUFFERS; i++) {
+        packet = &packets[i];
+        xQueueSend(freePackets, &packet, 0);
+    }
+    for (int i = 0; i < MJPEG_FRAME_BUFFERS; i++) {
+        frame = &frames[i];
+        xQueueSend(freeFrames, &frame, 0);
+    }
+    
+    LOG_I("Clip: %s, %ux%u at 1/%d scale, %.1f fps\n", format == CLIP_AVI ? "AVI" : "raw MJPEG",
+          stats.width, stats.height, 1 << stats.scale, 1e6f / stats.periodMicros);
+    
+    stopping = false;
+    playing = true;
+    pipelineRunning = true;
+    xTaskNotifyGive(readerHandle);
+    xTaskNotifyGive(decoderHandle);
+    xTaskNotifyGive(presenterHandle);
+    return DECODE_OK;
+}
+
+bool clipPlaying() {
+    return playing;
+}
+
+void clipPoll() {
+    if (session && !playing) clipStop();
+}
+
+void clipStop() {
+    if (!session) return;
+    
+    if (pipelineRunning) {
+        stopping = true;
+        for (int i = 0; i < CLIP_STAGES; i++) {
+            xSemaphoreTake(stagesIdle, portMAX_DELAY);
+        }
+        LOG_I("Clip: %lu of %lu frames shown in %.1f s, %lu dropped, %lu late\n",
+              (unsigned long)stats.shown, (unsigned long)stats.frames, stats.micros / 1e6f,
+              (unsigned long)(stats.read.dropped + stats.decode.dropped), (unsigned long)stats.late);
+    }
+    release();
+}
+
+const ClipStats& clipStats() {
+    return stats;
+}
+
+static void printStage(const char* name, const ClipStageStats& stage, unsigned long elapsed) {
+    Serial.printf("%-8s busy %3lu%%", name, (unsigned long)((uint64_t)stage.busyMicros * 100 / elapsed));
+    if (stage.starved.count) {
+        Serial.printf(", starved %lu%% (%lu waits)", (unsigned long)((uint64_t)stage.starved.micros * 100 / elapsed),
+                      (unsigned long)stage.starved.count);
+    }
+    if (stage.blocked.count) {
+        Serial.printf(", blocked %lu%% (%lu waits)", (unsigned long)((uint64_t)stage.blocked.micros * 100 / elapsed),
+                      (unsigned long)stage.blocked.count);
+    }
+    if (stage.dropped) {
+        Serial.printf(", dropped %lu", (unsigned long)stage.dropped);
+    }
+    Serial.println();
+}
+
+void printClipStats() {
+    Serial.println("=== Clip ===");
+    if (stats.periodMicros == 0) {
+        Serial.println("None played");
+        return;
+    }
+    unsigned long elapsed = max(1UL, playing ? micros() - playStart : stats.micros);
+    
+    Serial.printf("%s%ux%u at 1/%d scale, target %.1f fps\n", playing ? "Playing, " : "", stats.width, stats.height,
+                  1 << stats.scale, 1e6f / stats.periodMicros);
+    Serial.printf("Frames: %lu reached, %lu shown (%.1f fps), %lu late, %lu corrupt\n",
+                  (unsigned long)stats.frames, (unsigned long)stats.shown, stats.shown * 1e6f / elapsed,
+                  (unsigned long)stats.late, (unsigned long)stats.corrupt);
+    printStage("Read:", stats.read, elapsed);
+    printStage("Decode:", stats.decode, elapsed);
+    printStage("Present:", stats.present, elapsed);
+    
+    // The stage that is busy the largest share of the time sets the rate
+    const ClipStageStats* stages[CLIP_STAGES] = {&stats.read, &stats.decode, &stats.present};
+    const char* names[CLIP_STAGES] = {"read", "decode", "present"};
+    int busiest = 0;
+    for (int i = 1; i < CLIP_STAGES; i++) {
+        if (stages[i]->busyMicros > stages[busiest]->busyMicros) busiest = i;
+    }
+    Serial.printf("Bottleneck: %s\n", names[busiest]);
+}
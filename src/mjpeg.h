@@ -0,0 +1,65 @@
+#ifndef MJPEG_H
+#define MJPEG_H
+
+#include <Arduino.h>
+#include "color.h"
+
+// ==================== MJPEG Clips ====================
+// Short motion JPEG clips, in an AVI or as raw concatenated JPEG frames,
+// played as a slide. Three stages pass PSRAM buffers through bounded
+// queues, so each runs as far ahead as its buffers allow:
+//
+//   read     SD read-ahead of compressed frames (MJPEG_READ_CORE)
+//   decode   frame to an offscreen screen (MJPEG_DECODE_CORE)
+//   present  copy into the framebuffer at the frame's slot (MJPEG_PRESENT_CORE)
+//
+// Frame n is due MJPEG_PREROLL_MS plus n periods after the first one went
+// up. A frame already past its slot is skipped: the reader seeks over AVI
+// frames it is too late for, and the decoder drops a late frame when a
+// newer one is waiting. A clip plays once and leaves its last frame up.
+
+// Time a stage spent waiting on a neighbour
+struct ClipWait {
+    uint32_t count;
+    uint32_t micros;
+};
+
+struct ClipStageStats {
+    uint32_t busyMicros;
+    ClipWait starved;       // Nothing to work on: the stage before is behind
+    ClipWait blocked;       // No buffer to work into: the stage after is behind
+    uint32_t dropped;       // Frames skipped here to keep time
+};
+
+struct ClipStats {
+    uint16_t width;         // Frames as decoded
+    uint16_t height;
+    uint8_t scale;
+    uint32_t periodMicros;
+    uint32_t frames;        // Frames reached in the clip
+    uint32_t shown;
+    uint32_t late;          // Shown a whole period or more after their slot
+    uint32_t corrupt;       // Frames that failed to decode
+    unsigned long micros;   // From the first frame to the end of playback
+    ClipStageStats read;
+    ClipStageStats decode;
+    ClipStageStats present;
+};
+
+bool isClipName(const String& filename);
+
+// Shows the first frame and starts the pipeline on the rest. The first
+// frame's pixels are added to luma. Returns a DecodeResult; the clip is
+// not playing unless it is DECODE_OK.
+int clipBegin(const char* path, uint8_t orientation, LumaHistogram& luma);
+bool clipPlaying();
+
+// Frees the pipeline once a clip has played out
+void clipPoll();
+// Ends playback at once; the frame on screen stays
+void clipStop();
+
+const ClipStats& clipStats();   // The clip playing, or the last one
+void printClipStats();
+
+#endif // MJPEG_H
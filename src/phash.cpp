@@ -0,0 +1,87 @@
+#include "phash.h"
+#include "config.h"
+#include "display.h"
+#include "library.h"
+
+#define FRAME_STRIDE 800    // Panel framebuffer row, as in display.cpp
+#define FRAME_ROWS 480
+#define HASH_COLS 9
+#define HASH_ROWS 8
+#define CELL_SAMPLES 4      // Per cell edge; a slide is smooth at this scale
+
+// ==================== Hash ====================
+uint64_t frameHash(const uint16_t* frame) {
+    uint32_t luma[HASH_ROWS][HASH_COLS];
+    for (int row = 0; row < HASH_ROWS; row++) {
+        for (int col = 0; col < HASH_COLS; col++) {
+            uint32_t sum = 0;
+            for (int sy = 0; sy < CELL_SAMPLES; sy++) {
+                int y = ((row * CELL_SAMPLES + sy) * 2 + 1) * FRAME_ROWS / (HASH_ROWS * CELL_SAMPLES * 2);
+                const uint16_t* line = frame + (uint32_t)y * FRAME_STRIDE;
+                for (int sx = 0; sx < CELL_SAMPLES; sx++) {
+                    int x = ((col * CELL_SAMPLES + sx) * 2 + 1) * FRAME_STRIDE / (HASH_COLS * CELL_SAMPLES * 2);
+                    uint16_t p = line[x];
+                    // RGB565 widened to 6 bits a channel, BT.601 weights
+                    sum += ((p >> 10) & 0x3E) * 77 + ((p >> 5) & 0x3F) * 150 + ((p << 1) & 0x3E) * 29;
+                }
+            }
+            luma[row][col] = sum;
+        }
+    }
+    
+    uint64_t hash = 0;
+    for (int row = 0; row < HASH_ROWS; row++) {
+        for (int col = 0; col < HASH_COLS - 1; col++) {
+            if (luma[row][col] < luma[row][col + 1]) hash |= 1ULL << (row * (HASH_COLS - 1) + col);
+        }
+    }
+    // 0 is kept for "not hashed"; a flat frame gets the next value
+    return hash ? hash : 1;
+}
+
+int hashDistance(uint64_t a, uint64_t b) {
+    return __builtin_popcountll(a ^ b);
+}
+
+// ==================== Shuffle Spacing ====================
+// Whether imageFiles[candidate] would sit near a duplicate at position k
+static bool nearRecent(const std::vector<int>& order, int k, int candidate) {
+    uint64_t hash = imageFiles[candidate].hash;
+    if (!hash) return false;
+    
+    for (int j = max(0, k - SHUFFLE_SPREAD_WINDOW); j < k; j++) {
+        uint64_t other = imageFiles[order[j]].hash;
+        if (other && hashDistance(hash, other) <= SHUFFLE_NEAR_BITS) return true;
+    }
+    return false;
+}
+
+int spreadShuffle(std::vector<int>& order) {
+    int moved = 0;
+    int n = order.size();
+    for (int k = 1; k < n; k++) {
+        if (!nearRecent(order, k, order[k])) continue;
+        
+        // The nearest later photo that fits here swaps in; the search is
+        // bounded so an album of one long burst stays cheap
+        int last = min(n - 1, k + SHUFFLE_SPREAD_SEARCH);
+        for (int m = k + 1; m <= last; m++) {
+            if (!nearRecent(order, k, order[m])) {
+                std::swap(order[k], order[m]);
+                moved++;
+                break;
+            }
+        }
+    }
+    return moved;
+}
+
+bool isDuplicateImage(int index) {
+    const ImageEntry& image = imageFiles[index];
+    if (!image.hash) return false;
+    
+    for (int i = 0; i < index; i++) {
+        if (imageFiles[i].hash == image.hash && imageFiles[i].size == image.size) return true;
+    }
+    return false;
+}
@@ -0,0 +1,26 @@
+#ifndef PHASH_H
+#define PHASH_H
+
+#include <Arduino.h>
+#include <vector>
+
+// ==================== Perceptual Hash ====================
+// A 64-bit difference hash (dHash) of each slide, taken from the frame
+// the decode just rendered: 9x8 cells of mean luminance, one bit per
+// pair of neighbours. Burst shots and copies land a few bits apart. The
+// hash is kept in the directory index, so it is paid for once per photo;
+// 0 means the photo has not been shown yet.
+
+uint64_t frameHash(const uint16_t* frame);   // A whole frame of FRAME_PIXELS
+int hashDistance(uint64_t a, uint64_t b);    // Bits that differ
+
+// ==================== Shuffle Spacing ====================
+// Moves photos that are near-duplicates of one of the last few in the
+// order further along, so a burst does not play back to back. Photos
+// without a hash stay where the shuffle put them. Returns how many moved.
+int spreadShuffle(std::vector<int>& order);
+
+// True for a copy of a photo earlier in imageFiles: same hash and size
+bool isDuplicateImage(int index);
+
+#endif // PHASH_H
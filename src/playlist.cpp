@@ -0,0 +1,415 @@
+#include "playlist.h"
+#include "config.h"
+#include "budget.h"
+#include "log.h"
+#include <algorithm>
+
+#define PLAYLIST_MAGIC 0x314C5044   // "DPL1"
+#define PATH_MAX_STORED 255         // As in the directory indexes
+
+static_assert(PLAYLIST_RUN_BYTES >= (PLAYLIST_MERGE_WAYS + 1) * PLAYLIST_BUFFER_BYTES,
+              "the merge buffers are carved from the run area");
+
+struct PlaylistHeader {
+    uint32_t magic;
+    uint32_t count;
+    uint32_t signature;
+};
+
+// Followed by pathLength bytes of path. Runs are bare streams of these.
+struct PlaylistRecord {
+    uint32_t key;
+    uint16_t pathLength;
+    uint16_t reserved;
+};
+
+#define RECORD_MAX (sizeof(PlaylistRecord) + PATH_MAX_STORED)
+
+static_assert(PLAYLIST_BUFFER_BYTES >= 2 * RECORD_MAX, "a buffer must hold a whole record after a refill");
+
+// ==================== Read Position ====================
+static String playlistPath;
+static uint32_t recordCount = 0;
+static uint32_t fileEnd = 0;
+static uint32_t readOffset = 0;     // Of the record at the read position
+static uint32_t readLength = 0;     // Its size in the file
+static String nextPath;
+static PlaylistStats buildStats;
+
+uint32_t imageDateKey(const ImageEntry& image) {
+    return image.taken ? image.taken : (uint32_t)image.mtime;
+}
+
+// A sum of per-photo FNV-1a hashes, so a rescan that reorders imageFiles
+// keeps the playlist
+uint32_t playlistSignature() {
+    uint32_t signature = imageFiles.size();
+    for (int i = 0; i < imageFiles.size(); i++) {
+        uint32_t hash = 2166136261u;
+        const char* path = imageFiles[i].path.c_str();
+        while (*path) {
+            hash = (hash ^ (uint8_t)*path++) * 16777619u;
+        }
+        signature += (hash ^ imageDateKey(imageFiles[i])) * 16777619u;
+    }
+    return signature;
+}
+
+// Loads the record at offset into nextPath, starting over past the end
+static void loadRecordAt(uint32_t offset) {
+    if (offset >= fileEnd) offset = sizeof(PlaylistHeader);
+    readOffset = offset;
+    readLength = 0;
+    nextPath = "";
+    if (recordCount == 0) return;
+    
+    File file = SD.open(playlistPath, FILE_READ);
+    PlaylistRecord record;
+    char path[PATH_MAX_STORED + 1];
+    if (file && file.seek(offset) && file.read((uint8_t*)&record, sizeof(record)) == sizeof(record) &&
+        record.pathLength <= PATH_MAX_STORED &&
+        file.read((uint8_t*)path, record.pathLength) == record.pathLength) {
+        path[record.pathLength] = '\0';
+        nextPath = path;
+        readLength = sizeof(record) + record.pathLength;
+    }
+    if (file) file.close();
+}
+
+bool playlistOpen(const String& path, uint32_t signature) {
+    playlistClose();
+    File file = SD.open(path, FILE_READ);
+    if (!file) return false;
+    
+    PlaylistHeader header;
+    bool valid = file.read((uint8_t*)&header, sizeof(header)) == sizeof(header) &&
+                 header.magic == PLAYLIST_MAGIC && header.signature == signature;
+    uint32_t size = file.size();
+    file.close();
+    if (!valid) return false;
+    
+    playlistPath = path;
+    recordCount = header.count;
+    fileEnd = size;
+    loadRecordAt(sizeof(header));
+    return true;
+}
+
+uint32_t playlistCount() {
+    return recordCount;
+}
+
+const String& playlistPeek() {
+    return nextPath;
+}
+
+void playlistAdvance() {
+    if (recordCount == 0) return;
+    // A record that could not be read is passed over with the rest of the
+    // file, rather than read again forever
+    uint32_t next = readLength ? readOffset + readLength : fileEnd;
+    if (next >= fileEnd) LOG_I("Date playlist: starting over\n");
+    loadRecordAt(next);
+}
+
+void playlistClose() {
+    playlistPath = "";
+    recordCount = 0;
+    fileEnd = 0;
+    readOffset = 0;
+    readLength = 0;
+    nextPath = "";
+}
+
+const PlaylistStats& playlistStats() {
+    return buildStats;
+}
+
+// ==================== Record Streams ====================
+static int compareRecords(const uint8_t* a, const uint8_t* b) {
+    PlaylistRecord ra, rb;
+    memcpy(&ra, a, sizeof(ra));
+    memcpy(&rb, b, sizeof(rb));
+    if (ra.key != rb.key) return ra.key < rb.key ? -1 : 1;
+    
+    int order = memcmp(a + sizeof(ra), b + sizeof(rb), min(ra.pathLength, rb.pathLength));
+    if (order) return order;
+    return (int)ra.pathLength - (int)rb.pathLength;
+}
+
+// Reads records through a buffer; a record cut off at the end of the
+// buffer moves to the front before the refill, as in the index loader
+struct RecordReader {
+    File file;
+    uint8_t* buffer;
+    uint32_t base;          // File offset of buffer[0]
+    uint32_t pos;
+    uint32_t end;
+    const uint8_t* record;  // NULL once the stream is done
+    uint32_t length;
+};
+
+static void readerBegin(RecordReader& reader, File& file, uint8_t* buffer, uint32_t offset) {
+    reader.file = file;
+    reader.buffer = buffer;
+    reader.base = offset;
+    reader.pos = 0;
+    reader.end = 0;
+    reader.record = NULL;
+    reader.length = 0;
+}
+
+static bool readerNext(RecordReader& reader) {
+    if (reader.end - reader.pos < RECORD_MAX) {
+        memmove(reader.buffer, reader.buffer + reader.pos, reader.end - reader.pos);
+        reader.base += reader.pos;
+        reader.end -= reader.pos;
+        reader.pos = 0;
+        int got = reader.file.read(reader.buffer + reader.end, PLAYLIST_BUFFER_BYTES - reader.end);
+        if (got > 0) reader.end += got;
+    }
+    
+    reader.record = NULL;
+    PlaylistRecord record;
+    if (reader.pos + sizeof(record) > reader.end) return false;
+    memcpy(&record, reader.buffer + reader.pos, sizeof(record));
+    uint32_t length = sizeof(record) + record.pathLength;
+    if (record.pathLength > PATH_MAX_STORED || reader.pos + length > reader.end) return false;
+    
+    reader.record = reader.buffer + reader.pos;
+    reader.length = length;
+    reader.pos += length;
+    return true;
+}
+
+static uint32_t readerOffset(const RecordReader& reader) {
+    return reader.base + (reader.record - reader.buffer);
+}
+
+struct RecordWriter {
+    File file;
+    uint8_t* buffer;
+    uint32_t used;
+    uint32_t count;
+    bool ok;
+};
+
+static void writerBegin(RecordWriter& writer, File& file, uint8_t* buffer) {
+    writer.file = file;
+    writer.buffer = buffer;
+    writer.used = 0;
+    writer.count = 0;
+    writer.ok = file;
+}
+
+static void writerFlush(RecordWriter& writer) {
+    if (writer.used && writer.file.write(writer.buffer, writer.used) != writer.used) writer.ok = false;
+    writer.used = 0;
+}
+
+static void writerPut(RecordWriter& writer, const uint8_t* record, uint32_t length) {
+    if (writer.used + length > PLAYLIST_BUFFER_BYTES) writerFlush(writer);
+    memcpy(writer.buffer + writer.used, record, length);
+    writer.used += length;
+    writer.count++;
+}
+
+// ==================== Seek ====================
+// The playlist has no index of its own, so this is one pass over the file
+// through the library arena
+void playlistSeekAfter(const ImageEntry& image) {
+    if (recordCount == 0 || image.path.length() > PATH_MAX_STORED) return;
+    
+    uint8_t target[RECORD_MAX];
+    PlaylistRecord record = {imageDateKey(image), (uint16_t)image.path.length(), 0};
+    memcpy(target, &record, sizeof(record));
+    memcpy(target + sizeof(record), image.path.c_str(), record.pathLength);
+    
+    ArenaScope arena(ARENA_LIBRARY);
+    uint8_t* buffer = (uint8_t*)arena.alloc(PLAYLIST_BUFFER_BYTES);
+    File file = SD.open(playlistPath, FILE_READ);
+    if (!buffer || !file || !file.seek(sizeof(PlaylistHeader))) {
+        if (file) file.close();
+        return;
+    }
+    
+    // Past the newest photo the playlist starts over
+    uint32_t offset = fileEnd;
+    RecordReader reader;
+    readerBegin(reader, file, buffer, sizeof(PlaylistHeader));
+    while (readerNext(reader)) {
+        if (compareRecords(reader.record, target) > 0) {
+            offset = readerOffset(reader);
+            break;
+        }
+    }
+    file.close();
+    loadRecordAt(offset);
+}
+
+// ==================== Build ====================
+static String runPath(uint32_t run) {
+    return String(ALBUM_INDEX_DIR) + "/.run" + String(run) + ".tmp";
+}
+
+// The final file gets its header; the count goes in last, so an
+// interrupted build fails the check on the next open
+static bool openOutput(RecordWriter& writer, const String& path, uint8_t* buffer, bool final) {
+    File file = SD.open(path, FILE_WRITE);
+    writerBegin(writer, file, buffer);
+    if (final && file) {
+        PlaylistHeader header = {0, 0, 0};
+        writer.ok = file.write((const uint8_t*)&header, sizeof(header)) == sizeof(header);
+    }
+    return writer.ok;
+}
+
+static bool closeOutput(RecordWriter& writer, bool final, uint32_t signature) {
+    writerFlush(writer);
+    // A run read short or corrupt ends its stream early; without a header
+    // the playlist is sorted again instead of playing with photos missing
+    if (final && writer.ok && writer.count != buildStats.records) {
+        LOG_E("Date playlist: %lu of %lu photos merged\n", (unsigned long)writer.count,
+              (unsigned long)buildStats.records);
+        writer.ok = false;
+    }
+    if (final && writer.ok) {
+        PlaylistHeader header = {PLAYLIST_MAGIC, writer.count, signature};
+        writer.ok = writer.file.seek(0) &&
+                    writer.file.write((const uint8_t*)&header, sizeof(header)) == sizeof(header);
+    }
+    writer.file.close();
+    return writer.ok;
+}
+
+// Merges runs [first, first + count) into the writer and deletes them
+static bool mergeRuns(uint32_t first, uint32_t count, uint8_t* area, RecordWriter& writer) {
+    RecordReader readers[PLAYLIST_MERGE_WAYS];
+    bool ok = true;
+    for (uint32_t k = 0; k < count; k++) {
+        File file = SD.open(runPath(first + k), FILE_READ);
+        ok = ok && file;
+        readerBegin(readers[k], file, area + k * PLAYLIST_BUFFER_BYTES, 0);
+        if (file) readerNext(readers[k]);
+    }
+    
+    // Few enough inputs that a linear pick beats a heap
+    while (ok) {
+        int best = -1;
+        for (uint32_t k = 0; k < count; k++) {
+            if (readers[k].record && (best < 0 || compareRecords(readers[k].record, readers[best].record) < 0)) {
+                best = k;
+            }
+        }
+        if (best < 0) break;
+        writerPut(writer, readers[best].record, readers[best].length);
+        readerNext(readers[best]);
+    }
+    
+    for (uint32_t k = 0; k < count; k++) {
+        if (readers[k].file) readers[k].file.close();
+        SD.remove(runPath(first + k));
+    }
+    return ok;
+}
+
+bool playlistBuild(const String& path, uint32_t signature) {
+    playlistClose();
+    unsigned long start = millis();
+    SD.mkdir(ALBUM_INDEX_DIR);
+    
+    ArenaScope arena(ARENA_DECODE);
+    uint32_t mark = arena.mark;
+    uint8_t* area = (uint8_t*)arena.alloc(PLAYLIST_RUN_BYTES);
+    uint8_t* output = (uint8_t*)arena.alloc(PLAYLIST_BUFFER_BYTES);
+    if (!area || !output) {
+        LOG_E("Date playlist: no memory to sort\n");
+        return false;
+    }
+    
+    buildStats = PlaylistStats();
+    buildStats.peakBytes = arenaMark(ARENA_DECODE) - mark;
+    
+    // Records fill the area from the front, their offsets from the back;
+    // when the two meet the run is sorted and written out. A library that
+    // fits in one run is written straight to the playlist.
+    uint32_t used = 0;
+    uint32_t inRun = 0;
+    uint32_t runs = 0;
+    bool ok = true;
+    int n = imageFiles.size();
+    for (int i = 0; i <= n && ok; i++) {
+        uint32_t length = 0;
+        if (i < n) {
+            if (imageFiles[i].path.length() > PATH_MAX_STORED) continue;
+            length = sizeof(PlaylistRecord) + imageFiles[i].path.length();
+        }
+        
+        uint32_t aligned = (length + 3) & ~3u;
+        bool last = i == n;
+        if (inRun > 0 && (last || used + aligned + (inRun + 1) * sizeof(uint32_t) > PLAYLIST_RUN_BYTES)) {
+            uint32_t* offsets = (uint32_t*)(area + PLAYLIST_RUN_BYTES) - inRun;
+            std::sort(offsets, offsets + inRun, [area](uint32_t a, uint32_t b) {
+                return compareRecords(area + a, area + b) < 0;
+            });
+            
+            bool final = last && runs == 0;
+            RecordWriter writer;
+            ok = openOutput(writer, final ? path : runPath(runs), output, final);
+            for (uint32_t k = 0; ok && k < inRun; k++) {
+                PlaylistRecord record;
+                memcpy(&record, area + offsets[k], sizeof(record));
+                writerPut(writer, area + offsets[k], sizeof(record) + record.pathLength);
+            }
+            ok = closeOutput(writer, final, signature) && ok;
+            runs++;
+            used = 0;
+            inRun = 0;
+        }
+        if (last) break;
+        
+        const ImageEntry& image = imageFiles[i];
+        PlaylistRecord record = {imageDateKey(image), (uint16_t)image.path.length(), 0};
+        memcpy(area + used, &record, sizeof(record));
+        memcpy(area + used + sizeof(record), image.path.c_str(), record.pathLength);
+        *((uint32_t*)(area + PLAYLIST_RUN_BYTES) - inRun - 1) = used;
+        used += aligned;
+        inRun++;
+        buildStats.records++;
+    }
+    
+    // Merge a level at a time, so every pass reads and writes the whole
+    // file once; the level that fits in one merge writes the playlist
+    uint32_t first = 0;
+    uint32_t count = runs;
+    uint32_t nextRun = runs;
+    while (ok && count > 1) {
+        bool final = count <= PLAYLIST_MERGE_WAYS;
+        uint32_t levelFirst = nextRun;
+        for (uint32_t done = 0; ok && done < count; done += PLAYLIST_MERGE_WAYS) {
+            uint32_t ways = min((uint32_t)PLAYLIST_MERGE_WAYS, count - done);
+            RecordWriter writer;
+            ok = openOutput(writer, final ? path : runPath(nextRun), area + PLAYLIST_MERGE_WAYS * PLAYLIST_BUFFER_BYTES, final);
+            ok = ok && mergeRuns(first + done, ways, area, writer);
+            ok = closeOutput(writer, final, signature) && ok;
+            nextRun++;
+        }
+        buildStats.passes++;
+        first = levelFirst;
+        count = nextRun - levelFirst;
+    }
+    
+    if (!ok) {
+        // Leftover runs go, and the half-written playlist fails its next open
+        for (uint32_t run = 0; run < nextRun; run++) SD.remove(runPath(run));
+        LOG_E("Date playlist: writing %s failed\n", path.c_str());
+        return false;
+    }
+    
+    buildStats.runs = runs;
+    buildStats.millis = millis() - start;
+    LOG_I("Date playlist: %lu photos, %lu runs, %lu merge passes in %lu ms, %lu KB working memory\n",
+          (unsigned long)buildStats.records, (unsigned long)runs, (unsigned long)buildStats.passes,
+          (unsigned long)buildStats.millis, (unsigned long)buildStats.peakBytes / 1024);
+    return playlistOpen(path, signature);
+}
@@ -0,0 +1,44 @@
+#ifndef PLAYLIST_H
+#define PLAYLIST_H
+
+#include <Arduino.h>
+#include "library.h"
+
+// ==================== Date Playlist ====================
+// Capture order is kept on the card rather than in RAM: a file of (date,
+// path) records, one album's worth, built by an external merge sort. Runs
+// of records are sorted in a fixed slice of the decode arena and written
+// out, then merged PLAYLIST_MERGE_WAYS at a time until one is left, so the
+// build takes the same memory for a hundred photos as for a hundred
+// thousand. Playback reads the file one record at a time.
+
+struct PlaylistStats {
+    uint32_t records;
+    uint32_t runs;          // Sorted in memory
+    uint32_t passes;        // Merge passes over the whole file
+    uint32_t millis;
+    uint32_t peakBytes;     // Working memory, all of it from the arena
+};
+
+// The sort key: EXIF capture time, else the file's mtime
+uint32_t imageDateKey(const ImageEntry& image);
+
+// Fingerprint of imageFiles, order aside; a playlist built for a different
+// set of photos or dates is rebuilt
+uint32_t playlistSignature();
+
+// The caller holds the SD lock for everything below. Open and build leave
+// the read position at the oldest photo.
+bool playlistOpen(const String& path, uint32_t signature);    // False when missing or stale
+bool playlistBuild(const String& path, uint32_t signature);   // Sorts imageFiles into path
+const PlaylistStats& playlistStats();                         // Of the last build
+uint32_t playlistCount();                                     // 0 when none is open
+
+// The photo at the read position, without touching the card; "" when no
+// playlist is open
+const String& playlistPeek();
+void playlistAdvance();                             // Wraps to the oldest after the newest
+void playlistSeekAfter(const ImageEntry& image);    // Reads through the file once
+void playlistClose();
+
+#endif // PLAYLIST_H
@@ -0,0 +1,364 @@
+#include "png.h"
+#include "budget.h"
+#include <esp32s3/rom/miniz.h>
+
+// ==================== PNG Format ====================
+#define PNG_INPUT_SIZE 1024   // IDAT bytes read per refill
+
+static const uint8_t pngSignature[8] = {0x89, 'P', 'N', 'G', 0x0D, 0x0A, 0x1A, 0x0A};
+
+struct PngHeader {
+    uint32_t width;
+    uint32_t height;
+    uint8_t depth;
+    uint8_t colorType;
+    uint8_t interlace;
+};
+
+struct PngStream {
+    File* file;
+    PngHeader header;
+    uint8_t channels;
+    uint8_t pixelBytes;     // Filter distance, at least 1
+    uint32_t stride;        // Bytes per scanline, without the filter byte
+    uint8_t palette[256 * 3];
+    bool hasPalette;
+    
+    // Compressed input, possibly spread over several IDAT chunks
+    uint8_t input[PNG_INPUT_SIZE];
+    uint32_t chunkLeft;
+    bool inputEnded;
+    
+    // Current and previous scanline, each with its filter byte
+    uint8_t* current;
+    uint8_t* previous;
+    uint32_t filled;
+    uint32_t row;
+    uint8_t* rgb;
+    RowReducer reducer;
+    int result;
+};
+
+// Decodes run one at a time on the loop task; the stream and the inflator
+// stay in internal RAM, the larger buffers come from the decode arena
+static PngStream pngStream;
+static tinfl_decompressor pngInflator;
+
+static uint32_t readBE32(const uint8_t* p) {
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
+
+static bool readChunkHeader(File& file, uint32_t& length, uint8_t type[4]) {
+    uint8_t buf[8];
+    if (decodeRead(file, buf, 8) != 8) return false;
+    length = readBE32(buf);
+    memcpy(type, buf + 4, 4);
+    return true;
+}
+
+static int readHeader(File& file, PngHeader& header) {
+    uint8_t buf[8 + 8 + 13];
+    if (decodeRead(file, buf, sizeof(buf)) != sizeof(buf)) return DECODE_READ_ERROR;
+    if (memcmp(buf, pngSignature, 8) != 0 || memcmp(buf + 12, "IHDR", 4) != 0) return DECODE_BAD_STRUCTURE;
+    
+    const uint8_t* ihdr = buf + 16;
+    header.width = readBE32(ihdr);
+    header.height = readBE32(ihdr + 4);
+    header.depth = ihdr[8];
+    header.colorType = ihdr[9];
+    header.interlace = ihdr[12];
+    if (ihdr[10] != 0 || ihdr[11] != 0) return DECODE_BAD_STRUCTURE;
+    if (header.width == 0 || header.height == 0) return DECODE_BAD_STRUCTURE;
+    if (header.width > 0xFFFF || header.height > 0xFFFF) return DECODE_UNSUPPORTED;
+    
+    // CRC of IHDR
+    file.seek(file.position() + 4);
+    return DECODE_OK;
+}
+
+// ==================== Scanlines ====================
+static uint8_t paeth(uint8_t a, uint8_t b, uint8_t c) {
+    int p = a + b - c;
+    int pa = abs(p - a);
+    int pb = abs(p - b);
+    int pc = abs(p - c);
+    if (pa <= pb && pa <= pc) return a;
+    return pb <= pc ? b : c;
+}
+
+static bool unfilter(PngStream& s) {
+    uint8_t* x = s.current + 1;
+    const uint8_t* b = s.previous + 1;
+    uint32_t n = s.stride;
+    uint8_t bpp = s.pixelBytes;
+    
+    switch (s.current[0]) {
+        case 0:
+            break;
+        case 1:
+            for (uint32_t i = bpp; i < n; i++) x[i] += x[i - bpp];
+            break;
+        case 2:
+            for (uint32_t i = 0; i < n; i++) x[i] += b[i];
+            break;
+        case 3:
+            for (uint32_t i = 0; i < bpp; i++) x[i] += b[i] >> 1;
+            for (uint32_t i = bpp; i < n; i++) x[i] += (x[i - bpp] + b[i]) >> 1;
+            break;
+        case 4:
+            for (uint32_t i = 0; i < bpp; i++) x[i] += b[i];
+            for (uint32_t i = bpp; i < n; i++) x[i] += paeth(x[i - bpp], b[i], b[i - bpp]);
+            break;
+        default:
+            return false;
+    }
+    return true;
+}
+
+// Sample i of a row packed at 1, 2 or 4 bits
+static inline uint8_t packedSample(const uint8_t* x, uint32_t i, uint8_t depth) {
+    uint32_t bit = i * depth;
+    return (x[bit >> 3] >> (8 - depth - (bit & 7))) & ((1 << depth) - 1);
+}
+
+static void convertRow(PngStream& s) {
+    const uint8_t* x = s.current + 1;
+    uint8_t* out = s.rgb;
+    uint32_t w = s.header.width;
+    uint8_t depth = s.header.depth;
+    // 16-bit samples: only the high byte is kept
+    uint8_t step = depth == 16 ? 2 : 1;
+    
+    switch (s.header.colorType) {
+        case 0:  // Gray
+            for (uint32_t i = 0; i < w; i++) {
+                uint8_t v = depth >= 8 ? x[i * step] : packedSample(x, i, depth) * 255 / ((1 << depth) - 1);
+                out[0] = out[1] = out[2] = v;
+                out += 3;
+            }
+            break;
+        case 2:  // RGB
+            for (uint32_t i = 0; i < w; i++) {
+                out[0] = x[0];
+                out[1] = x[step];
+                out[2] = x[2 * step];
+                x += 3 * step;
+                out += 3;
+            }
+            break;
+        case 3:  // Palette
+            for (uint32_t i = 0; i < w; i++) {
+                uint8_t index = depth == 8 ? x[i] : packedSample(x, i, depth);
+                memcpy(out, s.palette + index * 3, 3);
+                out += 3;
+            }
+            break;
+        case 4:  // Gray + alpha over black
+            for (uint32_t i = 0; i < w; i++) {
+                uint8_t v = x[0] * x[step] / 255;
+                out[0] = out[1] = out[2] = v;
+                x += 2 * step;
+                out += 3;
+            }
+            break;
+        default:  // RGBA over black
+            for (uint32_t i = 0; i < w; i++) {
+                uint8_t a = x[3 * step];
+                out[0] = x[0] * a / 255;
+                out[1] = x[step] * a / 255;
+                out[2] = x[2 * step] * a / 255;
+                x += 4 * step;
+                out += 3;
+            }
+            break;
+    }
+}
+
+// Takes inflated bytes; false once all rows are out or the decode stopped
+static bool consume(PngStream& s, const uint8_t* data, size_t length) {
+    uint32_t rowBytes = s.stride + 1;
+    while (length > 0) {
+        size_t take = min<size_t>(length, rowBytes - s.filled);
+        memcpy(s.current + s.filled, data, take);
+        s.filled += take;
+        data += take;
+        length -= take;
+        if (s.filled < rowBytes) break;
+        
+        if (!unfilter(s)) {
+            s.result = DECODE_CORRUPT;
+            return false;
+        }
+        convertRow(s);
+        if (!rowReducerPush(s.reducer, s.rgb)) {
+            s.result = DECODE_INTERRUPTED;
+            return false;
+        }
+        
+        uint8_t* swap = s.previous;
+        s.previous = s.current;
+        s.current = swap;
+        s.filled = 0;
+        if (++s.row == s.header.height) {
+            s.result = rowReducerFinish(s.reducer) ? DECODE_OK : DECODE_INTERRUPTED;
+            return false;
+        }
+    }
+    return true;
+}
+
+// Next piece of compressed data, following the IDAT chunk sequence
+static size_t fillInput(PngStream& s) {
+    while (s.chunkLeft == 0) {
+        uint32_t length;
+        uint8_t type[4];
+        // Skip the CRC of the chunk just finished
+        if (!s.file->seek(s.file->position() + 4) || !readChunkHeader(*s.file, length, type) ||
+            memcmp(type, "IDAT", 4) != 0) {
+            return 0;
+        }
+        s.chunkLeft = length;
+    }
+    
+    size_t n = decodeRead(*s.file, s.input, min<uint32_t>(s.chunkLeft, PNG_INPUT_SIZE));
+    s.chunkLeft -= n;
+    return n;
+}
+
+static int inflateRows(PngStream& s, tinfl_decompressor* inflator, uint8_t* window) {
+    tinfl_init(inflator);
+    const uint8_t* next = s.input;
+    size_t available = 0;
+    size_t windowPos = 0;
+    s.result = DECODE_CORRUPT;
+    
+    while (true) {
+        if (available == 0 && !s.inputEnded) {
+            available = fillInput(s);
+            next = s.input;
+            s.inputEnded = available == 0;
+        }
+        
+        size_t inSize = available;
+        size_t outSize = TINFL_LZ_DICT_SIZE - windowPos;
+        mz_uint32 flags = TINFL_FLAG_PARSE_ZLIB_HEADER | (s.inputEnded ? 0 : TINFL_FLAG_HAS_MORE_INPUT);
+        tinfl_status status = tinfl_decompress(inflator, next, &inSize, window, window + windowPos, &outSize, flags);
+        next += inSize;
+        available -= inSize;
+        
+        if (outSize > 0) {
+            if (!consume(s, window + windowPos, outSize)) return s.result;
+            windowPos = (windowPos + outSize) & (TINFL_LZ_DICT_SIZE - 1);
+        }
+        
+        // Stream ended or broke before the last row
+        if (status < TINFL_STATUS_DONE || status == TINFL_STATUS_DONE) return DECODE_CORRUPT;
+        if (status == TINFL_STATUS_NEEDS_MORE_INPUT && s.inputEnded) return DECODE_CORRUPT;
+    }
+}
+
+// ==================== Decoder Interface ====================
+static bool pngProbe(const uint8_t* magic) {
+    return memcmp(magic, pngSignature, 8) == 0;
+}
+
+static int pngGetSize(File& file, uint16_t* w, uint16_t* h) {
+    PngHeader header;
+    int res = readHeader(file, header);
+    if (res == DECODE_OK) {
+        *w = header.width;
+        *h = header.height;
+    }
+    return res;
+}
+
+static int pngDecode(File& file, uint8_t scale, ImageBlockSink sink, void* ctx) {
+    PngHeader header;
+    int res = readHeader(file, header);
+    if (res != DECODE_OK) return res;
+    if (header.interlace != 0) return DECODE_UNSUPPORTED;
+    
+    uint8_t channels;
+    switch (header.colorType) {
+        case 0:  channels = 1; break;
+        case 2:  channels = 3; break;
+        case 3:  channels = 1; break;
+        case 4:  channels = 2; break;
+        case 6:  channels = 4; break;
+        default: return DECODE_BAD_STRUCTURE;
+    }
+    uint8_t d = header.depth;
+    bool validDepth = header.colorType == 0 ? (d == 1 || d == 2 || d == 4 || d == 8 || d == 16)
+                    : header.colorType == 3 ? (d == 1 || d == 2 || d == 4 || d == 8)
+                    : (d == 8 || d == 16);
+    if (!validDepth) return DECODE_BAD_STRUCTURE;
+    
+    ArenaScope arena(ARENA_DECODE);
+    PngStream* s = &pngStream;
+    tinfl_decompressor* inflator = &pngInflator;
+    uint8_t* window = (uint8_t*)arena.alloc(TINFL_LZ_DICT_SIZE);
+    if (!window) return DECODE_NO_MEMORY;
+    
+    memset(s, 0, sizeof(PngStream));
+    s->file = &file;
+    s->header = header;
+    s->channels = channels;
+    uint32_t bits = (uint32_t)channels * d;
+    s->pixelBytes = max<uint32_t>(1, bits / 8);
+    s->stride = (header.width * bits + 7) / 8;
+    
+    s->current = (uint8_t*)arena.alloc(s->stride + 1);
+    s->previous = (uint8_t*)arena.alloc(s->stride + 1);
+    s->rgb = (uint8_t*)arena.alloc(header.width * 3);
+    res = (s->current && s->previous && s->rgb) ? DECODE_OK : DECODE_NO_MEMORY;
+    if (res == DECODE_OK) {
+        memset(s->previous, 0, s->stride + 1);
+        res = rowReducerBegin(s->reducer, header.width, header.height, scale, sink, ctx);
+    }
+    
+    // Walk the chunks up to the first IDAT
+    while (res == DECODE_OK) {
+        uint32_t length;
+        uint8_t type[4];
+        if (!readChunkHeader(file, length, type)) {
+            res = DECODE_READ_ERROR;
+        } else if (memcmp(type, "IDAT", 4) == 0) {
+            if (header.colorType == 3 && !s->hasPalette) {
+                res = DECODE_BAD_STRUCTURE;
+                break;
+            }
+            s->chunkLeft = length;
+            res = inflateRows(*s, inflator, window);
+            break;
+        } else if (memcmp(type, "PLTE", 4) == 0 && length <= sizeof(s->palette)) {
+            if (decodeRead(file, s->palette, length) != length) res = DECODE_READ_ERROR;
+            s->hasPalette = true;
+            file.seek(file.position() + 4);
+        } else if (memcmp(type, "tRNS", 4) == 0 && header.colorType == 3 && length <= 256) {
+            // Palette alpha, blended over black up front
+            uint8_t alpha[256];
+            if (decodeRead(file, alpha, length) != length) res = DECODE_READ_ERROR;
+            for (uint32_t i = 0; i < length; i++) {
+                for (int c = 0; c < 3; c++) {
+                    s->palette[i * 3 + c] = s->palette[i * 3 + c] * alpha[i] / 255;
+                }
+            }
+            file.seek(file.position() + 4);
+        } else if (memcmp(type, "IEND", 4) == 0) {
+            res = DECODE_BAD_STRUCTURE;
+        } else if (!file.seek(file.position() + length + 4)) {
+            res = DECODE_READ_ERROR;
+        }
+    }
+    
+    rowReducerEnd(s->reducer);
+    return res;
+}
+
+const ImageDecoder pngDecoder = {
+    "PNG",
+    ".png",
+    pngProbe,
+    pngGetSize,
+    pngDecode,
+};
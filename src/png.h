@@ -0,0 +1,12 @@
+#ifndef PNG_H
+#define PNG_H
+
+#include "decoder.h"
+
+// ==================== PNG Decoder ====================
+// Streams IDAT data through the inflate in ROM with a 32 KB window and
+// unfilters one scanline at a time. All bit depths and color types;
+// alpha is blended over black. Interlaced files are not supported.
+extern const ImageDecoder pngDecoder;
+
+#endif // PNG_H
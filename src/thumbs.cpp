@@ -0,0 +1,309 @@
+#include "thumbs.h"
+#include "config.h"
+#include "display.h"
+#include "decoder.h"
+#include "memstats.h"
+#include "log.h"
+#include "budget.h"
+#include <SD.h>
+#include <vector>
+#include <algorithm>
+
+// ==================== Cache Format ====================
+#define THUMB_MAGIC 0x324D4854  // "THM2"; THM1 tiles could have gaps and are made again
+#define THUMB_PIXELS (THUMB_SIZE * THUMB_SIZE)
+#define THUMB_SLOT_BYTES (THUMB_PIXELS * 2)
+#define THUMB_DRAW_ROWS 16  // Rows per blit when drawing from the cache
+
+struct ThumbIndexHeader {
+    uint32_t magic;
+    uint32_t thumbSize;
+};
+
+struct ThumbRecord {
+    uint32_t pathHash;
+    uint32_t size;
+    uint32_t mtime;
+    uint32_t slot;
+};
+
+static std::vector<ThumbRecord> thumbIndex;  // Sorted by pathHash
+static uint32_t thumbSlotCount = 0;
+static bool thumbCacheOpen = false;
+
+// ==================== Helpers ====================
+static uint32_t hashPath(const String& path) {
+    // FNV-1a
+    uint32_t hash = 2166136261u;
+    for (unsigned int i = 0; i < path.length(); i++) {
+        hash ^= (uint8_t)path[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+static bool recordLess(const ThumbRecord& a, const ThumbRecord& b) {
+    return a.pathHash < b.pathHash;
+}
+
+static ThumbRecord* findRecord(uint32_t pathHash) {
+    ThumbRecord key = {pathHash, 0, 0, 0};
+    auto it = std::lower_bound(thumbIndex.begin(), thumbIndex.end(), key, recordLess);
+    if (it != thumbIndex.end() && it->pathHash == pathHash) return &*it;
+    return NULL;
+}
+
+static void resetThumbCache() {
+    SD.remove(THUMB_INDEX_FILENAME);
+    SD.remove(THUMB_DATA_FILENAME);
+    
+    File indexFile = SD.open(THUMB_INDEX_FILENAME, FILE_WRITE);
+    if (indexFile) {
+        ThumbIndexHeader header = {THUMB_MAGIC, THUMB_SIZE};
+        indexFile.write((const uint8_t*)&header, sizeof(header));
+        indexFile.close();
+    }
+    
+    File dataFile = SD.open(THUMB_DATA_FILENAME, FILE_WRITE);
+    if (dataFile) dataFile.close();
+    
+    thumbIndex.clear();
+    thumbSlotCount = 0;
+}
+
+// ==================== Open / Close ====================
+bool openThumbCache() {
+    if (thumbCacheOpen) return true;
+    
+    thumbIndex.clear();
+    thumbSlotCount = 0;
+    
+    File indexFile = SD.open(THUMB_INDEX_FILENAME, FILE_READ);
+    ThumbIndexHeader header;
+    if (!indexFile || indexFile.read((uint8_t*)&header, sizeof(header)) != sizeof(header) ||
+        header.magic != THUMB_MAGIC || header.thumbSize != THUMB_SIZE) {
+        if (indexFile) indexFile.close();
+        LOG_I("Thumbnail cache missing or stale, creating new one\n");
+        resetThumbCache();
+        thumbCacheOpen = true;
+        return true;
+    }
+    
+    // Append-only log: a later record for the same path replaces the earlier one
+    ThumbRecord record;
+    while (indexFile.read((uint8_t*)&record, sizeof(record)) == sizeof(record)) {
+        thumbIndex.push_back(record);
+        if (record.slot + 1 > thumbSlotCount) thumbSlotCount = record.slot + 1;
+    }
+    indexFile.close();
+    
+    std::stable_sort(thumbIndex.begin(), thumbIndex.end(), recordLess);
+    std::vector<ThumbRecord> unique;
+    unique.reserve(thumbIndex.size());
+    for (int i = 0; i < thumbIndex.size(); i++) {
+        if (i + 1 < thumbIndex.size() && thumbIndex[i + 1].pathHash == thumbIndex[i].pathHash) continue;
+        unique.push_back(thumbIndex[i]);
+    }
+    thumbIndex.swap(unique);
+    
+    LOG_I("Thumbnail cache: %d entries, %lu slots\n", thumbIndex.size(), thumbSlotCount);
+    thumbCacheOpen = true;
+    return true;
+}
+
+void closeThumbCache() {
+    std::vector<ThumbRecord>().swap(thumbIndex);
+    thumbCacheOpen = false;
+}
+
+// ==================== Generation ====================
+// Samples the 1/8-scale decode straight into the thumbnail, applying the
+// EXIF orientation and fitting the image inside the square tile.
+struct ThumbTarget {
+    uint16_t* pixels;
+    int srcWidth;
+    int srcHeight;
+    uint8_t orientation;
+    int shownWidth;
+    int shownHeight;
+    int fitWidth;
+    int fitHeight;
+    int offsetX;
+    int offsetY;
+};
+
+// Source pixel to its place in the upright image
+static void orientPoint(const ThumbTarget* t, int sx, int sy, int* px, int* py) {
+    const int W = t->srcWidth;
+    const int H = t->srcHeight;
+    switch (t->orientation) {
+        case 2:  *px = W - 1 - sx; *py = sy;         break;
+        case 3:  *px = W - 1 - sx; *py = H - 1 - sy; break;
+        case 4:  *px = sx;         *py = H - 1 - sy; break;
+        case 5:  *px = sy;         *py = sx;         break;
+        case 6:  *px = H - 1 - sy; *py = sx;         break;
+        case 7:  *px = H - 1 - sy; *py = W - 1 - sx; break;
+        case 8:  *px = sy;         *py = W - 1 - sx; break;
+        default: *px = sx;         *py = sy;         break;
+    }
+}
+
+// And back
+static void sourcePoint(const ThumbTarget* t, int px, int py, int* sx, int* sy) {
+    const int W = t->srcWidth;
+    const int H = t->srcHeight;
+    switch (t->orientation) {
+        case 2:  *sx = W - 1 - px; *sy = py;         break;
+        case 3:  *sx = W - 1 - px; *sy = H - 1 - py; break;
+        case 4:  *sx = px;         *sy = H - 1 - py; break;
+        case 5:  *sx = py;         *sy = px;         break;
+        case 6:  *sx = py;         *sy = H - 1 - px; break;
+        case 7:  *sx = W - 1 - py; *sy = H - 1 - px; break;
+        case 8:  *sx = W - 1 - py; *sy = px;         break;
+        default: *sx = px;         *sy = py;         break;
+    }
+}
+
+// Upright pixel a tile column or row samples, from the middle of its span
+static int tileSource(int u, int shown, int fit) {
+    return (2 * u + 1) * shown / (2 * fit);
+}
+
+// Each tile pixel takes the source pixel under its centre, so a decode
+// smaller than the tile still fills every pixel of it
+static bool thumbSink(void* ctx, int16_t x, int16_t y, uint16_t w, uint16_t h, const uint8_t* rgb) {
+    ThumbTarget* t = (ThumbTarget*)ctx;
+    int right = min(x + w, t->srcWidth) - 1;
+    int bottom = min(y + h, t->srcHeight) - 1;
+    if (right < x || bottom < y) return true;
+    
+    // The block as a rectangle of the upright image
+    int ax, ay, bx, by;
+    orientPoint(t, x, y, &ax, &ay);
+    orientPoint(t, right, bottom, &bx, &by);
+    int left = min(ax, bx), top = min(ay, by);
+    int last = max(ax, bx), lastRow = max(ay, by);
+    
+    int u0 = max(0, left * t->fitWidth / t->shownWidth - 1);
+    int v0 = max(0, top * t->fitHeight / t->shownHeight - 1);
+    for (int v = v0; v < t->fitHeight; v++) {
+        int py = tileSource(v, t->shownHeight, t->fitHeight);
+        if (py < top) continue;
+        if (py > lastRow) break;
+        
+        for (int u = u0; u < t->fitWidth; u++) {
+            int px = tileSource(u, t->shownWidth, t->fitWidth);
+            if (px < left) continue;
+            if (px > last) break;
+            
+            int sx, sy;
+            sourcePoint(t, px, py, &sx, &sy);
+            const uint8_t* p = rgb + ((sy - y) * w + (sx - x)) * 3;
+            t->pixels[(t->offsetY + v) * THUMB_SIZE + t->offsetX + u] =
+                ((p[0] & 0xF8) << 8) | ((p[1] & 0xFC) << 3) | (p[2] >> 3);
+        }
+    }
+    return true;
+}
+
+static bool generateThumbnail(const ImageEntry& image, uint16_t* pixels) {
+    uint16_t fullWidth, fullHeight;
+    if (imageGetSdSize(&fullWidth, &fullHeight, image.path.c_str()) != DECODE_OK) return false;
+    
+    ThumbTarget t;
+    t.pixels = pixels;
+    t.srcWidth = (fullWidth + 7) / 8;
+    t.srcHeight = (fullHeight + 7) / 8;
+    t.orientation = image.orientation;
+    bool transposed = image.orientation >= 5;
+    t.shownWidth = transposed ? t.srcHeight : t.srcWidth;
+    t.shownHeight = transposed ? t.srcWidth : t.srcHeight;
+    
+    if (t.shownWidth >= t.shownHeight) {
+        t.fitWidth = THUMB_SIZE;
+        t.fitHeight = max(1, t.shownHeight * THUMB_SIZE / t.shownWidth);
+    } else {
+        t.fitHeight = THUMB_SIZE;
+        t.fitWidth = max(1, t.shownWidth * THUMB_SIZE / t.shownHeight);
+    }
+    t.offsetX = (THUMB_SIZE - t.fitWidth) / 2;
+    t.offsetY = (THUMB_SIZE - t.fitHeight) / 2;
+    
+    memset(pixels, 0, THUMB_SLOT_BYTES);
+    return imageDecodeSd(image.path.c_str(), 3, thumbSink, &t) == DECODE_OK;
+}
+
+static bool storeThumbnail(const ImageEntry& image, uint32_t pathHash, const uint16_t* pixels) {
+    ThumbRecord* existing = findRecord(pathHash);
+    uint32_t slot = existing ? existing->slot : thumbSlotCount;
+    
+    File dataFile = SD.open(THUMB_DATA_FILENAME, "r+");
+    if (!dataFile) return false;
+    bool written = dataFile.seek(slot * THUMB_SLOT_BYTES) &&
+                   dataFile.write((const uint8_t*)pixels, THUMB_SLOT_BYTES) == THUMB_SLOT_BYTES;
+    dataFile.close();
+    if (!written) return false;
+    
+    ThumbRecord record = {pathHash, image.size, (uint32_t)image.mtime, slot};
+    File indexFile = SD.open(THUMB_INDEX_FILENAME, FILE_APPEND);
+    if (indexFile) {
+        indexFile.write((const uint8_t*)&record, sizeof(record));
+        indexFile.close();
+    }
+    
+    if (existing) {
+        *existing = record;
+    } else {
+        auto it = std::lower_bound(thumbIndex.begin(), thumbIndex.end(), record, recordLess);
+        thumbIndex.insert(it, record);
+        thumbSlotCount++;
+    }
+    return true;
+}
+
+// ==================== Drawing ====================
+static bool drawCachedThumbnail(uint32_t slot, int16_t x, int16_t y) {
+    File dataFile = SD.open(THUMB_DATA_FILENAME, FILE_READ);
+    if (!dataFile) return false;
+    
+    if (!dataFile.seek(slot * THUMB_SLOT_BYTES)) {
+        dataFile.close();
+        return false;
+    }
+    
+    static uint16_t rows[THUMB_SIZE * THUMB_DRAW_ROWS];
+    bool ok = true;
+    for (int row = 0; row < THUMB_SIZE && ok; row += THUMB_DRAW_ROWS) {
+        int count = min(THUMB_DRAW_ROWS, THUMB_SIZE - row);
+        size_t bytes = count * THUMB_SIZE * 2;
+        ok = dataFile.read((uint8_t*)rows, bytes) == bytes;
+        if (ok) gfx.draw16bitRGBBitmap(x, y + row, rows, THUMB_SIZE, count);
+    }
+    
+    dataFile.close();
+    return ok;
+}
+
+bool drawThumbnail(const ImageEntry& image, int16_t x, int16_t y) {
+    if (!thumbCacheOpen) return false;
+    MemScope scope(MEM_CACHE);
+    
+    uint32_t pathHash = hashPath(image.path);
+    ThumbRecord* record = findRecord(pathHash);
+    if (record && record->size == image.size && record->mtime == (uint32_t)image.mtime) {
+        if (drawCachedThumbnail(record->slot, x, y)) return true;
+    }
+    
+    ArenaScope arena(ARENA_DECODE);
+    uint16_t* pixels = (uint16_t*)arena.alloc(THUMB_SLOT_BYTES);
+    if (!pixels) return false;
+    
+    bool ok = generateThumbnail(image, pixels);
+    if (ok) {
+        gfx.draw16bitRGBBitmap(x, y, pixels, THUMB_SIZE, THUMB_SIZE);
+        if (!storeThumbnail(image, pathHash, pixels)) {
+            LOG_W("Failed to cache thumbnail: %s\n", image.path.c_str());
+        }
+    }
+    return ok;
+}
@@ -0,0 +1,18 @@
+#ifndef THUMBS_H
+#define THUMBS_H
+
+#include <Arduino.h>
+#include "library.h"
+
+// ==================== Thumbnail Cache ====================
+// Thumbnails are THUMB_SIZE x THUMB_SIZE RGB565 tiles built from a 1/8-scale
+// (DC only) decode and stored in fixed-size slots of THUMB_DATA_FILENAME.
+// THUMB_INDEX_FILENAME maps path hash + size + mtime to a slot.
+bool openThumbCache();
+void closeThumbCache();
+
+// Draws the thumbnail of an image at (x, y), generating and caching it on
+// first use. Returns false if the image could not be decoded.
+bool drawThumbnail(const ImageEntry& image, int16_t x, int16_t y);
+
+#endif // THUMBS_H
@@ -0,0 +1,193 @@
+#include "touch.h"
+#include "config.h"
+#include "log.h"
+#include <Wire.h>
+
+// ==================== GT911 Registers ====================
+#define GT911_ADDR 0x5D           // INT held low during reset
+#define GT911_ADDR_ALT 0x14       // INT held high, or left floating
+#define GT911_PRODUCT_ID 0x8140   // ASCII "911"
+#define GT911_STATUS 0x814E       // Bit 7: report ready, bits 0-3: points
+#define GT911_POINT 0x814F        // Track id, x, y, size (little endian), reserved
+#define GT911_MAX_POINTS 5
+
+// Touch coordinates follow the panel's native landscape layout
+#define TOUCH_NATIVE_WIDTH 800
+#define TOUCH_NATIVE_HEIGHT 480
+
+// ==================== Wire Transport ====================
+static uint8_t wireAddress = GT911_ADDR;
+
+static bool wireRead(uint16_t reg, uint8_t* buf, uint8_t length) {
+    Wire.beginTransmission(wireAddress);
+    Wire.write(reg >> 8);
+    Wire.write(reg & 0xFF);
+    if (Wire.endTransmission(false) != 0) return false;
+    if (Wire.requestFrom(wireAddress, length) != length) return false;
+    
+    for (uint8_t i = 0; i < length; i++) {
+        buf[i] = Wire.read();
+    }
+    return true;
+}
+
+static bool wireWrite(uint16_t reg, const uint8_t* buf, uint8_t length) {
+    Wire.beginTransmission(wireAddress);
+    Wire.write(reg >> 8);
+    Wire.write(reg & 0xFF);
+    Wire.write(buf, length);
+    return Wire.endTransmission() == 0;
+}
+
+const TouchBus wireTouchBus = {
+    wireRead,
+    wireWrite,
+};
+
+// ==================== Driver State ====================
+static const TouchBus* touchBus = NULL;
+static volatile bool touchIrq = false;
+static bool fingerDown = false;
+static int16_t fingerX = 0;
+static int16_t fingerY = 0;
+static unsigned long lastReport = 0;
+static unsigned long lastPoll = 0;
+static GestureTracker touchTracker = {};
+
+static void IRAM_ATTR touchIsr() {
+    touchIrq = true;
+}
+
+// Native panel coordinates to the screen as DISPLAY_ROTATION lays it out
+static void toScreen(int16_t nx, int16_t ny, int16_t& x, int16_t& y) {
+    switch (DISPLAY_ROTATION & 3) {
+        case 1:  x = ny;                           y = TOUCH_NATIVE_WIDTH - 1 - nx;  break;
+        case 2:  x = TOUCH_NATIVE_WIDTH - 1 - nx;  y = TOUCH_NATIVE_HEIGHT - 1 - ny; break;
+        case 3:  x = TOUCH_NATIVE_HEIGHT - 1 - ny; y = nx;                           break;
+        default: x = nx;                           y = ny;                           break;
+    }
+}
+
+static bool probe(uint8_t address) {
+    uint8_t id[4];
+    wireAddress = address;
+    return touchBus->read(GT911_PRODUCT_ID, id, sizeof(id)) && id[0] == '9';
+}
+
+bool touchBegin(const TouchBus* bus) {
+    touchBus = bus;
+    
+    if (bus == &wireTouchBus) {
+        Wire.begin(TOUCH_SDA, TOUCH_SCL, 400000);
+        
+        // INT low through the reset selects address 0x5D
+        if (TOUCH_RST_PIN >= 0 && TOUCH_INT_PIN >= 0) {
+            pinMode(TOUCH_INT_PIN, OUTPUT);
+            pinMode(TOUCH_RST_PIN, OUTPUT);
+            digitalWrite(TOUCH_INT_PIN, LOW);
+            digitalWrite(TOUCH_RST_PIN, LOW);
+            delay(10);
+            digitalWrite(TOUCH_RST_PIN, HIGH);
+            delay(10);
+            pinMode(TOUCH_INT_PIN, INPUT);
+            delay(50);
+        }
+        
+        if (!probe(GT911_ADDR) && !probe(GT911_ADDR_ALT)) {
+            LOG_W("Touch: no GT911 found\n");
+            touchBus = NULL;
+            return false;
+        }
+        LOG_I("Touch: GT911 at 0x%02X\n", wireAddress);
+    }
+    
+    if (TOUCH_INT_PIN >= 0) {
+        pinMode(TOUCH_INT_PIN, INPUT);
+        attachInterrupt(TOUCH_INT_PIN, touchIsr, FALLING);
+    }
+    return true;
+}
+
+bool touchPending() {
+    return touchIrq;
+}
+
+// Reads one report and acknowledges it so the controller can post the next
+static void readReport(unsigned long now) {
+    uint8_t status;
+    if (!touchBus->read(GT911_STATUS, &status, 1) || !(status & 0x80)) return;
+    
+    uint8_t points = status & 0x0F;
+    uint8_t point[8];
+    if (points > 0 && points <= GT911_MAX_POINTS && touchBus->read(GT911_POINT, point, sizeof(point))) {
+        // Only the first finger counts
+        int16_t nx = point[1] | (point[2] << 8);
+        int16_t ny = point[3] | (point[4] << 8);
+        toScreen(nx, ny, fingerX, fingerY);
+        fingerDown = true;
+    } else {
+        fingerDown = false;
+    }
+    
+    uint8_t clear = 0;
+    touchBus->write(GT911_STATUS, &clear, 1);
+    lastReport = now;
+}
+
+TouchGesture touchPoll() {
+    if (!touchBus) return GESTURE_NONE;
+    unsigned long now = millis();
+    
+    bool due = TOUCH_INT_PIN >= 0 ? touchIrq : now - lastPoll >= TOUCH_POLL_MS;
+    if (due) {
+        touchIrq = false;
+        lastPoll = now;
+        readReport(now);
+    }
+    
+    // Reports keep coming while a finger is down; a lost release report
+    // must not leave the touch held forever
+    if (fingerDown && now - lastReport > TOUCH_RELEASE_TIMEOUT) {
+        fingerDown = false;
+    }
+    
+    return gestureUpdate(touchTracker, fingerDown, fingerX, fingerY, now);
+}
+
+// ==================== Gesture Recognizer ====================
+TouchGesture gestureUpdate(GestureTracker& tracker, bool down, int16_t x, int16_t y, unsigned long now) {
+    if (down && !tracker.down) {
+        tracker.down = true;
+        tracker.moved = false;
+        tracker.longFired = false;
+        tracker.startX = tracker.lastX = x;
+        tracker.startY = tracker.lastY = y;
+        tracker.startTime = now;
+        return GESTURE_NONE;
+    }
+    if (!tracker.down) return GESTURE_NONE;
+    
+    if (down) {
+        tracker.lastX = x;
+        tracker.lastY = y;
+        if (abs(x - tracker.startX) > TOUCH_TAP_SLOP || abs(y - tracker.startY) > TOUCH_TAP_SLOP) {
+            tracker.moved = true;
+        }
+        if (!tracker.moved && !tracker.longFired && now - tracker.startTime >= TOUCH_LONG_PRESS_TIME) {
+            tracker.longFired = true;
+            return GESTURE_LONG_PRESS;
+        }
+        return GESTURE_NONE;
+    }
+    
+    // Finger lifted; the last position it was seen at counts
+    tracker.down = false;
+    if (tracker.longFired) return GESTURE_NONE;
+    
+    int16_t dx = tracker.lastX - tracker.startX;
+    int16_t dy = tracker.lastY - tracker.startY;
+    if (abs(dx) >= SWIPE_MIN_DISTANCE && abs(dx) > 2 * abs(dy) && now - tracker.startTime <= SWIPE_MAX_TIME) {
+        return dx < 0 ? GESTURE_SWIPE_LEFT : GESTURE_SWIPE_RIGHT;
+    }
+    return tracker.moved ? GESTURE_NONE : GESTURE_TAP;
+}
@@ -0,0 +1,53 @@
+#ifndef TOUCH_H
+#define TOUCH_H
+
+#include <Arduino.h>
+
+// ==================== Touch Input ====================
+// GT911 capacitive controller on the 8048S070C. The controller pulls INT
+// low with every report; the handler only sets a flag and the loop reads
+// the point over I2C, so no bus traffic happens in interrupt context.
+
+enum TouchGesture {
+    GESTURE_NONE,
+    GESTURE_TAP,
+    GESTURE_LONG_PRESS,      // Fires while the finger is still down
+    GESTURE_SWIPE_LEFT,      // Finger moved right to left: next photo
+    GESTURE_SWIPE_RIGHT
+};
+
+// Register access to the controller. The default goes through Wire; any
+// other implementation can stand in for it, e.g. to replay recorded
+// reports without hardware.
+struct TouchBus {
+    bool (*read)(uint16_t reg, uint8_t* buf, uint8_t length);
+    bool (*write)(uint16_t reg, const uint8_t* buf, uint8_t length);
+};
+extern const TouchBus wireTouchBus;
+
+// Resets and probes the controller; false if none answers
+bool touchBegin(const TouchBus* bus = &wireTouchBus);
+
+// Reads pending reports and returns the gesture they complete, if any
+TouchGesture touchPoll();
+
+// A report is waiting to be read; cheap enough to check inside a decode
+bool touchPending();
+
+// ==================== Gesture Recognizer ====================
+// Turns finger samples in screen coordinates into gestures. Kept apart
+// from the driver so it can be fed samples from anywhere.
+struct GestureTracker {
+    bool down;
+    bool moved;             // Left the tap radius at some point
+    bool longFired;
+    int16_t startX;
+    int16_t startY;
+    int16_t lastX;
+    int16_t lastY;
+    unsigned long startTime;
+};
+
+TouchGesture gestureUpdate(GestureTracker& tracker, bool down, int16_t x, int16_t y, unsigned long now);
+
+#endif // TOUCH_H
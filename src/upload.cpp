@@ -0,0 +1,433 @@
+#include "upload.h"
+#include "config.h"
+#include "library.h"
+#include "log.h"
+#include "budget.h"
+#include <SD.h>
+#include <esp32s3/rom/crc.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/queue.h>
+
+#define UPLOAD_BUFFERS 2
+#define FRAME_HEADER 5                                 // Sync, type, length
+#define FRAME_PAYLOAD_MAX (4 + UPLOAD_CHUNK)           // DATA offset and bytes
+#define FRAME_MAX (FRAME_HEADER + FRAME_PAYLOAD_MAX + 4)
+#define REPLY_LENGTH 13
+
+// ==================== Writer ====================
+// The loop fills one buffer while the task on UPLOAD_TASK_CORE writes the
+// other; the receive only waits when the card falls a whole buffer behind.
+struct UploadBuffer {
+    uint8_t* data;
+    size_t length;
+};
+
+static UploadBuffer buffers[UPLOAD_BUFFERS];
+static QueueHandle_t fullQueue = NULL;
+static QueueHandle_t freeQueue = NULL;
+static UploadBuffer* filling = NULL;
+static File uploadFile;
+static volatile bool writeFailed = false;
+static volatile uint32_t writeMicros = 0;
+
+static void uploadWriterTask(void* param) {
+    for (;;) {
+        UploadBuffer* buffer;
+        xQueueReceive(fullQueue, &buffer, portMAX_DELAY);
+        
+        if (!writeFailed) {
+            unsigned long start = micros();
+            lockSD();
+            if (uploadFile.write(buffer->data, buffer->length) != buffer->length) {
+                writeFailed = true;
+            }
+            unlockSD();
+            writeMicros += micros() - start;
+        }
+        
+        buffer->length = 0;
+        xQueueSend(freeQueue, &buffer, portMAX_DELAY);
+    }
+}
+
+static bool startWriter() {
+    if (fullQueue == NULL) {
+        fullQueue = xQueueCreate(UPLOAD_BUFFERS, sizeof(UploadBuffer*));
+        freeQueue = xQueueCreate(UPLOAD_BUFFERS, sizeof(UploadBuffer*));
+        xTaskCreatePinnedToCore(uploadWriterTask, "uploadWriter", UPLOAD_TASK_STACK,
+                                NULL, UPLOAD_TASK_PRIORITY, NULL, UPLOAD_TASK_CORE);
+    }
+    
+    // The buffers are the whole upload arena, held for the session
+    for (int i = 0; i < UPLOAD_BUFFERS; i++) {
+        buffers[i].data = (uint8_t*)arenaAlloc(ARENA_UPLOAD, UPLOAD_BUFFER_SIZE);
+        buffers[i].length = 0;
+        if (!buffers[i].data) {
+            arenaRelease(ARENA_UPLOAD, 0);
+            return false;
+        }
+    }
+    
+    filling = &buffers[0];
+    for (int i = 1; i < UPLOAD_BUFFERS; i++) {
+        UploadBuffer* buffer = &buffers[i];
+        xQueueSend(freeQueue, &buffer, 0);
+    }
+    return true;
+}
+
+// Only called with every buffer back from the writer
+static void stopWriter() {
+    xQueueReset(freeQueue);
+    filling = NULL;
+    for (int i = 0; i < UPLOAD_BUFFERS; i++) {
+        buffers[i].data = NULL;
+    }
+    arenaRelease(ARENA_UPLOAD, 0);
+}
+
+// Hands over the partly filled buffer and waits for every write to land
+static void flushWrites() {
+    if (filling->length > 0) {
+        xQueueSend(fullQueue, &filling, portMAX_DELAY);
+        xQueueReceive(freeQueue, &filling, portMAX_DELAY);
+    }
+    
+    UploadBuffer* idle[UPLOAD_BUFFERS - 1];
+    for (int i = 0; i < UPLOAD_BUFFERS - 1; i++) {
+        xQueueReceive(freeQueue, &idle[i], portMAX_DELAY);
+    }
+    for (int i = 0; i < UPLOAD_BUFFERS - 1; i++) {
+        xQueueSend(freeQueue, &idle[i], 0);
+    }
+}
+
+static void append(const uint8_t* data, size_t count) {
+    while (count > 0) {
+        size_t n = min(count, (size_t)(UPLOAD_BUFFER_SIZE - filling->length));
+        memcpy(filling->data + filling->length, data, n);
+        filling->length += n;
+        data += n;
+        count -= n;
+        
+        // Start the write as soon as a buffer is full
+        if (filling->length == UPLOAD_BUFFER_SIZE) {
+            xQueueSend(fullQueue, &filling, portMAX_DELAY);
+            xQueueReceive(freeQueue, &filling, portMAX_DELAY);
+        }
+    }
+}
+
+// ==================== Frames ====================
+static uint8_t frame[FRAME_MAX];
+static size_t framePos = 0;
+
+static uint16_t frameLength() {
+    return frame[3] | (frame[4] << 8);
+}
+
+// Collects bytes from Serial into frame[]. True once a whole frame has
+// arrived intact; corrupt is set when one arrived with a bad CRC.
+static bool receiveFrame(bool& corrupt) {
+    corrupt = false;
+    while (Serial.available() > 0) {
+        if (framePos < FRAME_HEADER) {
+            uint8_t c = Serial.read();
+            if (framePos == 0 && c != UPLOAD_SYNC) continue;
+            if (framePos == 1 && c != UPLOAD_SYNC2) {
+                framePos = c == UPLOAD_SYNC ? 1 : 0;
+                continue;
+            }
+            frame[framePos++] = c;
+            // Sync bytes inside a log line or a damaged header
+            if (framePos == FRAME_HEADER && frameLength() > FRAME_PAYLOAD_MAX) framePos = 0;
+            continue;
+        }
+        
+        size_t total = FRAME_HEADER + frameLength() + 4;
+        size_t want = min(total - framePos, (size_t)Serial.available());
+        framePos += Serial.readBytes(frame + framePos, want);
+        if (framePos < total) continue;
+        
+        framePos = 0;
+        uint32_t crc;
+        memcpy(&crc, frame + total - 4, 4);
+        if (crc32_le(0, frame + 2, total - 6) == crc) return true;
+        corrupt = true;
+        return false;
+    }
+    return false;
+}
+
+static void sendFrame(uint8_t type, const uint8_t* payload, uint16_t length) {
+    uint8_t out[FRAME_HEADER + REPLY_LENGTH + 4];
+    if (length > REPLY_LENGTH) return;
+    
+    out[0] = UPLOAD_SYNC;
+    out[1] = UPLOAD_SYNC2;
+    out[2] = type;
+    out[3] = length & 0xFF;
+    out[4] = length >> 8;
+    memcpy(out + FRAME_HEADER, payload, length);
+    uint32_t crc = crc32_le(0, out + 2, 3 + length);
+    memcpy(out + FRAME_HEADER + length, &crc, 4);
+    Serial.write(out, FRAME_HEADER + length + 4);
+}
+
+// Answers the frame in frame[], or a corrupt one
+static void reply(uint8_t status, uint32_t offset, uint32_t crc) {
+    uint8_t payload[REPLY_LENGTH];
+    uint16_t chunk = UPLOAD_CHUNK;
+    payload[0] = frame[2];
+    payload[1] = status;
+    memcpy(payload + 2, &offset, 4);
+    memcpy(payload + 6, &crc, 4);
+    memcpy(payload + 10, &chunk, 2);
+    payload[12] = UPLOAD_WINDOW;
+    sendFrame(UPLOAD_REPLY, payload, REPLY_LENGTH);
+}
+
+// ==================== File State ====================
+static bool fileOpen = false;
+static String uploadPath;
+static uint32_t uploadSize = 0;
+static uint32_t received = 0;
+static uint32_t receivedCrc = 0;   // CRC32 of bytes 0..received
+static bool resendSent = false;    // Waiting for the host to go back
+static uint32_t startOffset = 0;
+static unsigned long startTime = 0;
+
+// Photos go in the root or an album folder; the library never looks deeper
+static bool validPath(const String& path) {
+    if (!path.startsWith("/") || path.endsWith("/") || path.indexOf("..") >= 0 ||
+        path.indexOf("//") >= 0 || path.length() + strlen(UPLOAD_PART_SUFFIX) >= 200) {
+        return false;
+    }
+    int slash = path.indexOf('/', 1);
+    return !isImageFile(path) || slash < 0 || path.indexOf('/', slash + 1) < 0;
+}
+
+// Leaves what arrived on the card under the partial name
+static void closeFile() {
+    if (!fileOpen) return;
+    flushWrites();
+    lockSD();
+    uploadFile.close();
+    unlockSD();
+    fileOpen = false;
+}
+
+static void beginFile(const uint8_t* payload, uint16_t length) {
+    closeFile();
+    if (length < 6 || length - 5 > 255) {
+        reply(UPLOAD_ERR_PATH, 0, 0);
+        return;
+    }
+    
+    uint32_t size;
+    memcpy(&size, payload, 4);
+    uint8_t flags = payload[4];
+    char name[256];
+    memcpy(name, payload + 5, length - 5);
+    name[length - 5] = '\0';
+    String path = name;
+    if (!validPath(path)) {
+        reply(UPLOAD_ERR_PATH, 0, 0);
+        return;
+    }
+    
+    String part = path + UPLOAD_PART_SUFFIX;
+    uint32_t offset = 0;
+    uint32_t crc = 0;
+    uint8_t status = UPLOAD_OK;
+    
+    lockSD();
+    if (flags & UPLOAD_RESTART) SD.remove(part);
+    String dir = dirOf(path);
+    if (dir != "/" && !SD.exists(dir)) SD.mkdir(dir);
+    
+    // Everything on the card came through a CRC check, so it can be kept;
+    // the host compares the CRC in case it is a different file
+    File existing = SD.open(part, FILE_READ);
+    if (existing) {
+        uint32_t partSize = existing.size();
+        while (partSize <= size && offset < partSize) {
+            size_t n = existing.read(filling->data, min((uint32_t)UPLOAD_BUFFER_SIZE, partSize - offset));
+            if (n == 0) break;
+            crc = crc32_le(crc, filling->data, n);
+            offset += n;
+        }
+        existing.close();
+        if (offset != partSize || partSize > size) {
+            SD.remove(part);
+            offset = 0;
+            crc = 0;
+        }
+    }
+    
+    if (size - offset > SD.totalBytes() - SD.usedBytes()) {
+        status = UPLOAD_ERR_SPACE;
+    } else {
+        uploadFile = SD.open(part, FILE_APPEND);
+        if (!uploadFile) status = UPLOAD_ERR_SD;
+    }
+    unlockSD();
+    
+    if (status != UPLOAD_OK) {
+        reply(status, 0, 0);
+        return;
+    }
+    
+    fileOpen = true;
+    uploadPath = path;
+    uploadSize = size;
+    received = offset;
+    receivedCrc = crc;
+    resendSent = false;
+    writeFailed = false;
+    writeMicros = 0;
+    startOffset = offset;
+    startTime = millis();
+    reply(UPLOAD_OK, offset, crc);
+    
+    if (offset > 0) {
+        LOG_I("Upload: resuming %s at %lu of %lu bytes\n", path.c_str(),
+              (unsigned long)offset, (unsigned long)size);
+    }
+}
+
+// Asks once for everything from the first byte missing
+static void requestResend() {
+    if (!fileOpen || resendSent) return;
+    resendSent = true;
+    reply(UPLOAD_RESEND, received, receivedCrc);
+}
+
+static void receiveData(const uint8_t* payload, uint16_t length) {
+    if (!fileOpen || length < 4) {
+        reply(UPLOAD_ERR_STATE, received, 0);
+        return;
+    }
+    
+    uint32_t offset;
+    memcpy(&offset, payload, 4);
+    uint32_t count = length - 4;
+    if (offset > received) {
+        requestResend();
+        return;
+    }
+    if (offset + count > uploadSize) {
+        reply(UPLOAD_ERR_STATE, received, 0);
+        return;
+    }
+    if (writeFailed) {
+        closeFile();
+        reply(UPLOAD_ERR_SD, received, 0);
+        return;
+    }
+    
+    // Frames sent before a resend request repeat data already here
+    uint32_t skip = received - offset;
+    if (skip < count) {
+        const uint8_t* data = payload + 4 + skip;
+        receivedCrc = crc32_le(receivedCrc, data, count - skip);
+        append(data, count - skip);
+        received += count - skip;
+        resendSent = false;
+    }
+    reply(UPLOAD_OK, received, 0);
+}
+
+static void endFile(const uint8_t* payload, uint16_t length, UploadDone done) {
+    if (!fileOpen || length < 4) {
+        reply(UPLOAD_ERR_STATE, received, 0);
+        return;
+    }
+    if (received != uploadSize) {
+        reply(UPLOAD_RESEND, received, receivedCrc);
+        return;
+    }
+    
+    uint32_t crc;
+    memcpy(&crc, payload, 4);
+    closeFile();
+    
+    String part = uploadPath + UPLOAD_PART_SUFFIX;
+    uint8_t status = UPLOAD_OK;
+    lockSD();
+    if (writeFailed || crc != receivedCrc) {
+        status = writeFailed ? UPLOAD_ERR_SD : UPLOAD_ERR_CRC;
+        SD.remove(part);
+    } else {
+        if (SD.exists(uploadPath)) SD.remove(uploadPath);
+        if (!SD.rename(part, uploadPath)) status = UPLOAD_ERR_SD;
+    }
+    unlockSD();
+    reply(status, received, receivedCrc);
+    
+    unsigned long elapsed = millis() - startTime;
+    uint32_t bytes = received - startOffset;
+    LOG_I("Upload: %s %s, %lu KB in %lu ms (%.1f KB/s, SD busy %lu%%)\n",
+          uploadPath.c_str(), status == UPLOAD_OK ? "saved" : "failed",
+          (unsigned long)(bytes / 1024), elapsed,
+          elapsed ? bytes / 1.024f / elapsed : 0.0f,
+          elapsed ? (unsigned long)(writeMicros / 10 / elapsed) : 0UL);
+    
+    if (status == UPLOAD_OK && done) done(uploadPath);
+}
+
+// ==================== Session ====================
+void uploadSession(UploadProgress progress, UploadDone done) {
+    if (!startWriter()) {
+        LOG_E("Upload: not enough memory for the buffers\n");
+        return;
+    }
+    
+    // loop() already read the first sync byte
+    frame[0] = UPLOAD_SYNC;
+    framePos = 1;
+    
+    unsigned long lastFrame = millis();
+    unsigned long lastProgress = 0;
+    while (millis() - lastFrame < UPLOAD_IDLE_TIMEOUT) {
+        bool corrupt;
+        if (!receiveFrame(corrupt)) {
+            if (corrupt) {
+                lastFrame = millis();
+                requestResend();
+            } else {
+                delay(1);
+            }
+            continue;
+        }
+        lastFrame = millis();
+        
+        const uint8_t* payload = frame + FRAME_HEADER;
+        uint16_t length = frameLength();
+        switch (frame[2]) {
+            case UPLOAD_BEGIN:
+                beginFile(payload, length);
+                if (fileOpen && progress) progress(uploadPath, received, uploadSize);
+                break;
+            case UPLOAD_DATA:
+                receiveData(payload, length);
+                break;
+            case UPLOAD_END:
+                endFile(payload, length, done);
+                break;
+        }
+        
+        if (fileOpen && progress && lastFrame - lastProgress >= UPLOAD_PROGRESS_INTERVAL) {
+            lastProgress = lastFrame;
+            progress(uploadPath, received, uploadSize);
+        }
+    }
+    
+    if (fileOpen) {
+        LOG_W("Upload: %s stopped at %lu of %lu bytes\n", uploadPath.c_str(),
+              (unsigned long)received, (unsigned long)uploadSize);
+    }
+    closeFile();
+    stopWriter();
+}
@@ -0,0 +1,62 @@
+#ifndef UPLOAD_H
+#define UPLOAD_H
+
+#include <Arduino.h>
+
+// ==================== Serial Upload ====================
+// Framed binary file transfer onto the SD card over the console port.
+// Every frame is
+//
+//   0xA5 0x5A  type  length (u16)  payload  CRC32 of type..payload (u32)
+//
+// with all integers little endian. The first sync byte is not ASCII, so a
+// frame never looks like a console command; log lines printed meanwhile
+// sit between frames and the host skips them.
+//
+// Host to device:
+//   BEGIN  size (u32), flags (u8), path       start or resume a file
+//   DATA   offset (u32), up to UPLOAD_CHUNK bytes
+//   END    CRC32 of the whole file (u32)
+// Device to host, one per frame received:
+//   REPLY  type answered (u8), status (u8), offset (u32), crc (u32),
+//          chunk (u16), window (u8)
+//
+// BEGIN answers with the bytes already on the card from an interrupted
+// upload and their CRC; the host checks the CRC against its own copy and
+// either continues from there or sends BEGIN again with UPLOAD_RESTART.
+// DATA is acknowledged with the next offset wanted as soon as it is in a
+// buffer; the host keeps up to `window` frames in flight. A frame that
+// fails its CRC or skips ahead gets one UPLOAD_RESEND and the host goes
+// back to that offset. SD writes run on core 0 from one buffer while the
+// receive fills the other.
+#define UPLOAD_SYNC 0xA5
+#define UPLOAD_SYNC2 0x5A
+#define UPLOAD_RESTART 0x01    // BEGIN flag: drop any partial copy
+
+enum UploadFrameType {
+    UPLOAD_BEGIN = 'B',
+    UPLOAD_DATA = 'D',
+    UPLOAD_END = 'E',
+    UPLOAD_REPLY = 'R'
+};
+
+enum UploadStatus {
+    UPLOAD_OK,
+    UPLOAD_RESEND,          // Send again from the offset in the reply
+    UPLOAD_ERR_PATH,
+    UPLOAD_ERR_SPACE,
+    UPLOAD_ERR_SD,
+    UPLOAD_ERR_CRC,         // Whole file did not match; the copy is dropped
+    UPLOAD_ERR_STATE        // DATA or END without a file open, or END early
+};
+
+// Progress of the file being received, and each file once it is complete
+typedef void (*UploadProgress)(const String& path, uint32_t received, uint32_t size);
+typedef void (*UploadDone)(const String& path);
+
+// Runs a session after loop() read UPLOAD_SYNC from Serial. Returns once
+// the host has been quiet for UPLOAD_IDLE_TIMEOUT; a file left unfinished
+// stays on the card for a resume.
+void uploadSession(UploadProgress progress, UploadDone done);
+
+#endif // UPLOAD_H
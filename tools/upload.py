@@ -0,0 +1,157 @@
+#!/usr/bin/env python3
+"""Send photos to the frame over its USB serial port (see src/upload.h).
+
+    python3 tools/upload.py /dev/ttyUSB0 photos/*.jpg [--dest /Holiday]
+
+Needs pyserial. An interrupted upload resumes when the same file is sent
+again. The frame adds each photo to the slideshow as soon as it is saved.
+"""
+
+import argparse
+import os
+import struct
+import sys
+import time
+import zlib
+
+import serial
+
+SYNC = b"\xa5\x5a"
+BEGIN, DATA, END, REPLY = b"B", b"D", b"E", b"R"
+RESTART = 0x01
+STATUS = ["ok", "resend", "bad path", "card full", "SD error", "CRC mismatch", "out of sequence"]
+OK, RESEND = 0, 1
+REPLY_TIMEOUT = 1.0
+
+
+def frame(kind, payload):
+    body = kind + struct.pack("<H", len(payload)) + payload
+    return SYNC + body + struct.pack("<I", zlib.crc32(body))
+
+
+class Link:
+    """Reply frames from the frame; console text in between is echoed."""
+
+    def __init__(self, port, baud):
+        self.port = serial.Serial()
+        self.port.port = port
+        self.port.baudrate = baud
+        # Left low, DTR and RTS do not reset the board on open
+        self.port.dtr = False
+        self.port.rts = False
+        self.port.timeout = 0.05
+        self.port.open()
+        self.buffer = b""
+
+    def send(self, kind, payload):
+        self.port.write(frame(kind, payload))
+
+    def reply(self, timeout=REPLY_TIMEOUT):
+        deadline = time.monotonic() + timeout
+        while True:
+            start = self.buffer.find(SYNC)
+            if start < 0:
+                # A sync byte at the end may be half of the next frame's
+                start = len(self.buffer) - self.buffer.endswith(SYNC[:1])
+            text = self.buffer[:start]
+            if text:
+                sys.stdout.write(text.decode("utf-8", "replace"))
+                self.buffer = self.buffer[len(text):]
+            if len(self.buffer) >= 5:
+                total = 5 + struct.unpack_from("<H", self.buffer, 3)[0] + 4
+                if len(self.buffer) >= total:
+                    data, self.buffer = self.buffer[:total], self.buffer[total:]
+                    crc = struct.unpack_from("<I", data, total - 4)[0]
+                    if data[2:3] == REPLY and total == 22 and zlib.crc32(data[2:-4]) == crc:
+                        return struct.unpack_from("<cBIIHB", data, 5)
+                    # Not a reply after all; skip its sync bytes
+                    sys.stdout.write(data[:2].decode("latin-1"))
+                    self.buffer = data[2:] + self.buffer
+                    continue
+            if time.monotonic() >= deadline:
+                return None
+            self.buffer += self.port.read(max(1, self.port.in_waiting))
+
+
+def begin(link, path, size, flags):
+    payload = struct.pack("<IB", size, flags) + path.encode()
+    for _ in range(3):
+        link.send(BEGIN, payload)
+        while True:
+            r = link.reply()
+            if r is None:
+                break
+            if r[0] == BEGIN:
+                return r
+    raise RuntimeError("no answer from the frame")
+
+
+def upload(link, local, remote):
+    data = open(local, "rb").read()
+    size = len(data)
+    kind, status, offset, crc, chunk, window = begin(link, remote, size, 0)
+    if status == OK and offset and zlib.crc32(data[:offset]) != crc:
+        print("%s: partial copy on the card differs, starting over" % remote)
+        kind, status, offset, crc, chunk, window = begin(link, remote, size, RESTART)
+    if status != OK:
+        raise RuntimeError("%s: %s" % (remote, STATUS[status]))
+    if offset:
+        print("%s: resuming at %d of %d bytes" % (remote, offset, size))
+
+    start = time.monotonic()
+    resumed = offset
+    acked = sent = offset
+    end_sent = False
+    while True:
+        # Keep up to `window` data frames ahead of the acknowledgements
+        while not end_sent and sent < size and sent - acked < chunk * window:
+            n = min(chunk, size - sent)
+            link.send(DATA, struct.pack("<I", sent) + data[sent:sent + n])
+            sent += n
+        if not end_sent and acked == size:
+            link.send(END, struct.pack("<I", zlib.crc32(data)))
+            end_sent = True
+
+        r = link.reply()
+        if r is None:
+            sent = acked
+            end_sent = False
+            continue
+        kind, status, offset = r[0], r[1], r[2]
+        if status == OK:
+            if kind == END:
+                break
+            acked = max(acked, offset)
+        elif status == RESEND:
+            acked = sent = offset
+            end_sent = False
+        else:
+            raise RuntimeError("%s: %s" % (remote, STATUS[status]))
+
+    seconds = time.monotonic() - start
+    print("%s: %d bytes in %.1f s, %.1f KB/s" % (remote, size - resumed, seconds,
+                                                  (size - resumed) / 1024.0 / seconds))
+    return size - resumed
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("port")
+    parser.add_argument("files", nargs="+")
+    parser.add_argument("--dest", default="/", help="directory on the card (default /)")
+    parser.add_argument("--baud", type=int, default=921600, help="SERIAL_BAUD of the firmware")
+    args = parser.parse_args()
+
+    link = Link(args.port, args.baud)
+    dest = args.dest.rstrip("/")
+    total = 0
+    start = time.monotonic()
+    for local in args.files:
+        total += upload(link, local, dest + "/" + os.path.basename(local))
+    seconds = time.monotonic() - start
+    print("%d files, %.1f KB/s overall (link %.1f KB/s)" % (len(args.files), total / 1024.0 / seconds,
+                                                             args.baud / 10 / 1024.0))
+
+
+if __name__ == "__main__":
+    main()